@@ -6,6 +6,7 @@
 #include <fcntl.h>
 #include <sys/uio.h>
 #include <errno.h>
+#include <pthread.h>
 
 #include "int.h"
 #include "log.h"
@@ -20,30 +21,53 @@
 #define LOG_PREFIX "bfd: "
 
 /*
- * Kernel doesn't produce more than one page of
- * date per one read call on proc files.
+ * Buffers come in two sizes. Proc files are read with a few pages
+ * long ones, seq files fill them in one read call. Images are read
+ * and written sequentially and can be large (mm, core, pagemap), so
+ * they get bigger ones.
  */
-#define BUFSIZE (PAGE_SIZE)
+enum {
+	BUF_PROC,
+	BUF_IMAGE,
+	BUF_NR_CLASSES,
+};
+
+static const unsigned int buf_sizes[BUF_NR_CLASSES] = {
+	[BUF_PROC] = 4 * PAGE_SIZE,
+	[BUF_IMAGE] = 16 * PAGE_SIZE,
+};
 
 struct bfd_buf {
 	char *mem;
+	int class;
 	struct list_head l;
 };
 
-static LIST_HEAD(bufs);
+static struct list_head bufs[BUF_NR_CLASSES] = {
+	LIST_HEAD_INIT(bufs[BUF_PROC]),
+	LIST_HEAD_INIT(bufs[BUF_IMAGE]),
+};
+/*
+ * Images may be written and closed by helper threads (see the
+ * overlapped memory dump), so the pool of buffers is locked.
+ */
+static pthread_mutex_t bufs_lock = PTHREAD_MUTEX_INITIALIZER;
 
 #define BUFBATCH (16)
 
-static int buf_get(struct xbuf *xb)
+static int buf_get(struct xbuf *xb, int class)
 {
+	unsigned int bufsize = buf_sizes[class];
 	struct bfd_buf *b;
 
-	if (list_empty(&bufs)) {
+	pthread_mutex_lock(&bufs_lock);
+	if (list_empty(&bufs[class])) {
 		void *mem;
 		int i;
 
-		mem = mmap(NULL, BUFBATCH * BUFSIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, 0, 0);
+		mem = mmap(NULL, BUFBATCH * bufsize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, 0, 0);
 		if (mem == MAP_FAILED) {
+			pthread_mutex_unlock(&bufs_lock);
 			pr_perror("No buf");
 			return -1;
 		}
@@ -52,6 +76,7 @@ static int buf_get(struct xbuf *xb)
 			b = xmalloc(sizeof(*b));
 			if (!b) {
 				if (i == 0) {
+					pthread_mutex_unlock(&bufs_lock);
 					pr_err("No buffer for bfd\n");
 					return -1;
 				}
@@ -60,17 +85,20 @@ static int buf_get(struct xbuf *xb)
 				break;
 			}
 
-			b->mem = mem + i * BUFSIZE;
-			list_add_tail(&b->l, &bufs);
+			b->mem = mem + i * bufsize;
+			b->class = class;
+			list_add_tail(&b->l, &bufs[class]);
 		}
 	}
 
-	b = list_first_entry(&bufs, struct bfd_buf, l);
+	b = list_first_entry(&bufs[class], struct bfd_buf, l);
 	list_del_init(&b->l);
+	pthread_mutex_unlock(&bufs_lock);
 
 	xb->mem = b->mem;
 	xb->data = xb->mem;
 	xb->sz = 0;
+	xb->size = bufsize;
 	xb->buf = b;
 	return 0;
 }
@@ -81,31 +109,77 @@ static void buf_put(struct xbuf *xb)
 	 * Don't unmap buffer back, it will get reused
 	 * by next bfdopen call
 	 */
-	list_add(&xb->buf->l, &bufs);
+	pthread_mutex_lock(&bufs_lock);
+	list_add(&xb->buf->l, &bufs[xb->buf->class]);
+	pthread_mutex_unlock(&bufs_lock);
 	xb->buf = NULL;
 	xb->mem = NULL;
 	xb->data = NULL;
 }
 
-static int bfdopen(struct bfd *f, bool writable)
+static int bfdopen(struct bfd *f, bool writable, int class)
 {
-	if (buf_get(&f->b)) {
+	if (buf_get(&f->b, class)) {
 		close_safe(&f->fd);
 		return -1;
 	}
 
 	f->writable = writable;
+	f->mapped = false;
 	return 0;
 }
 
 int bfdopenr(struct bfd *f)
 {
-	return bfdopen(f, false);
+	return bfdopen(f, false, BUF_PROC);
 }
 
 int bfdopenw(struct bfd *f)
 {
-	return bfdopen(f, true);
+	return bfdopen(f, true, BUF_PROC);
+}
+
+int bfdopen_image(struct bfd *f, bool writable)
+{
+	/*
+	 * Images are read start to end, let the kernel read ahead more
+	 * aggressively. Fails on pipes (--stream), which is fine.
+	 */
+	if (!writable)
+		posix_fadvise(f->fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+	return bfdopen(f, writable, BUF_IMAGE);
+}
+
+/*
+ * The whole image is already in memory, so the buffer is the image
+ * itself and refills just hit EOF.
+ */
+void bfdopenm(struct bfd *f, void *data, size_t len)
+{
+	f->fd = -1;
+	f->writable = false;
+	f->mapped = true;
+	f->b.mem = data;
+	f->b.data = data;
+	f->b.sz = len;
+	f->b.size = len;
+	f->b.buf = NULL;
+}
+
+static void bufs_lock_fork(void)
+{
+	pthread_mutex_lock(&bufs_lock);
+}
+
+static void bufs_unlock_fork(void)
+{
+	pthread_mutex_unlock(&bufs_lock);
+}
+
+static void __attribute__((constructor)) bfd_init_lock(void)
+{
+	pthread_atfork(bufs_lock_fork, bufs_unlock_fork, bufs_unlock_fork);
 }
 
 static int bflush(struct bfd *bfd);
@@ -118,7 +192,12 @@ int bfd_flush_images(void)
 
 void bclose(struct bfd *f)
 {
-	if (bfd_buffered(f)) {
+	if (bfd_mapped(f)) {
+		f->b.mem = NULL;
+		f->b.data = NULL;
+		f->b.sz = 0;
+		f->mapped = false;
+	} else if (bfd_buffered(f)) {
 		if (f->writable && bflush(f) < 0) {
 			/*
 			 * This is to propagate error up. It's
@@ -141,10 +220,13 @@ static int brefill(struct bfd *f)
 	int ret;
 	struct xbuf *b = &f->b;
 
+	if (f->mapped)
+		return 0;
+
 	memmove(b->mem, b->data, b->sz);
 	b->data = b->mem;
 
-	ret = read_all(f->fd, b->mem + b->sz, BUFSIZE - b->sz);
+	ret = read_all(f->fd, b->mem + b->sz, b->size - b->sz);
 	if (ret < 0) {
 		pr_perror("Error reading file");
 		return -1;
@@ -195,7 +277,7 @@ again:
 		if (!b->sz)
 			return NULL;
 
-		if (b->sz == BUFSIZE) {
+		if (!f->mapped && b->sz == b->size) {
 			pr_err("The bfd buffer is too small\n");
 			return ERR_PTR(-EIO);
 		}
@@ -248,20 +330,65 @@ static int bflush(struct bfd *bfd)
 	return 0;
 }
 
+/*
+ * Writes what's buffered and the data that doesn't fit into the
+ * buffer with one syscall.
+ */
+static int bflush_with(struct bfd *bfd, const void *buf, int size)
+{
+	struct xbuf *b = &bfd->b;
+	struct iovec iov[2] = {
+		{ .iov_base = b->data, .iov_len = b->sz },
+		{ .iov_base = (void *)buf, .iov_len = size },
+	};
+	struct iovec *cur = iov;
+	int cnt = 2;
+
+	if (!b->sz) {
+		cur++;
+		cnt--;
+	}
+
+	while (cnt) {
+		ssize_t ret;
+
+		ret = writev(bfd->fd, cur, cnt);
+		if (ret < 0) {
+			if (errno == EINTR)
+				continue;
+			return -1;
+		}
+
+		while (cnt && ret >= cur->iov_len) {
+			ret -= cur->iov_len;
+			cur++;
+			cnt--;
+		}
+
+		if (cnt) {
+			cur->iov_base += ret;
+			cur->iov_len -= ret;
+		}
+	}
+
+	b->sz = 0;
+	return size;
+}
+
 static int __bwrite(struct bfd *bfd, const void *buf, int size)
 {
 	struct xbuf *b = &bfd->b;
 
-	if (b->sz + size > BUFSIZE) {
+	if (size > b->size)
+		return bflush_with(bfd, buf, size);
+
+	if (b->sz + size > b->size) {
 		int ret;
 		ret = bflush(bfd);
 		if (ret < 0)
 			return ret;
 	}
 
-	if (size > BUFSIZE)
-		return write_all(bfd->fd, buf, size);
-
 	memcpy(b->data + b->sz, buf, size);
 	b->sz += size;
 	return size;
@@ -302,6 +429,27 @@ int bwritev(struct bfd *bfd, const struct iovec *iov, int cnt)
 	return written;
 }
 
+/*
+ * Returns the next size bytes right from the buffer and skips them, or
+ * NULL if they don't fit there and have to be bread() instead.
+ */
+void *bpeek(struct bfd *bfd, int size)
+{
+	struct xbuf *b = &bfd->b;
+	void *ret;
+
+	if (!bfd_buffered(bfd))
+		return NULL;
+
+	if (b->sz < size && (bfd->mapped || size > b->size || brefill(bfd) <= 0 || b->sz < size))
+		return NULL;
+
+	ret = b->data;
+	b->data += size;
+	b->sz -= size;
+	return ret;
+}
+
 int bread(struct bfd *bfd, void *buf, int size)
 {
 	struct xbuf *b = &bfd->b;
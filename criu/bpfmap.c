@@ -362,4 +362,5 @@ struct collect_image_info bpfmap_cinfo = {
 	.pb_type = PB_BPFMAP_FILE,
 	.priv_size = sizeof(struct bpfmap_file_info),
 	.collect = collect_one_bpfmap,
+	.flags = COLLECT_ARENA,
 };
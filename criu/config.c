@@ -27,6 +27,8 @@
 #include "sockets.h"
 #include "tty.h"
 #include "version.h"
+#include "pages-comp.h"
+#include "page-xfer.h"
 
 #include "common/xmalloc.h"
 
@@ -422,6 +424,7 @@ void init_opts(void)
 	opts.cpu_cap = CPU_CAP_DEFAULT;
 	opts.manage_cgroups = CG_MODE_DEFAULT;
 	opts.ps_socket = -1;
+	opts.ps_streams = 1;
 	opts.ghost_limit = DEFAULT_GHOST_LIMIT;
 	opts.timeout = DEFAULT_TIMEOUT;
 	opts.empty_ns = 0;
@@ -650,6 +653,11 @@ int parse_options(int argc, char **argv, bool *usage_error, bool *has_exec_cmd,
 		{ "ms", no_argument, 0, 1054 },
 		BOOL_OPT("track-mem", &opts.track_mem),
 		BOOL_OPT("auto-dedup", &opts.auto_dedup),
+		BOOL_OPT("compress-pages", &opts.compress_pages),
+		BOOL_OPT("pack-images", &opts.pack_images),
+		BOOL_OPT("pages-csum", &opts.pages_csum),
+		BOOL_OPT("overlap-dump", &opts.overlap_dump),
+		BOOL_OPT("map-page-images", &opts.map_page_images),
 		{ "libdir", required_argument, 0, 'L' },
 		{ "cpu-cap", optional_argument, 0, 1057 },
 		BOOL_OPT("force-irmap", &opts.force_irmap),
@@ -709,6 +717,13 @@ int parse_options(int argc, char **argv, bool *usage_error, bool *has_exec_cmd,
 		{ "rdma-buf-sock-path", required_argument, 0, 1237 },
 		{ "rdma-pgoff", required_argument, 0, 1238 },
 		{ "mem-pool", required_argument, 0, 1239 },
+		{ "ps-streams", required_argument, 0, 1240 },
+		{ "fault-profile", optional_argument, 0, 1241 },
+		{ "lazy-pages-cache", required_argument, 0, 1242 },
+		{ "pre-copy", optional_argument, 0, 1243 },
+		{ "dedup-store", required_argument, 0, 1244 },
+		{ "compact-dir", required_argument, 0, 1246 },
+		{ "lazy-pages-workers", required_argument, 0, 1247 },
 		{},
 	};
 
@@ -1024,6 +1039,8 @@ int parse_options(int argc, char **argv, bool *usage_error, bool *has_exec_cmd,
 		case 1097:
 			if (!strcmp("read", optarg)) {
 				opts.pre_dump_mode = PRE_DUMP_READ;
+			} else if (!strcmp("read-batch", optarg)) {
+				opts.pre_dump_mode = PRE_DUMP_READ_BATCH;
 			} else if (strcmp("splice", optarg)) {
 				pr_err("Unable to parse value of --pre-dump-mode\n");
 				return 1;
@@ -1084,6 +1101,35 @@ int parse_options(int argc, char **argv, bool *usage_error, bool *has_exec_cmd,
 				return 1;
 			}
 			break;
+		case 1240:
+			opts.ps_streams = atoi(optarg);
+			if (opts.ps_streams < 1 || opts.ps_streams > PS_MAX_STREAMS)
+				goto bad_arg;
+			break;
+		case 1241:
+			opts.fault_profile_ms = optarg ? atoi(optarg) : DEFAULT_FAULT_PROFILE_MS;
+			if (opts.fault_profile_ms <= 0)
+				goto bad_arg;
+			break;
+		case 1242:
+			SET_CHAR_OPTS(lazy_pages_cache, optarg);
+			break;
+		case 1243:
+			opts.pre_copy = optarg ? atoi(optarg) : DEFAULT_PRE_COPY_ITERS;
+			if (opts.pre_copy <= 0)
+				goto bad_arg;
+			break;
+		case 1244:
+			SET_CHAR_OPTS(dedup_store, optarg);
+			break;
+		case 1246:
+			SET_CHAR_OPTS(compact_dir, optarg);
+			break;
+		case 1247:
+			opts.lazy_pages_workers = atoi(optarg);
+			if (opts.lazy_pages_workers <= 0)
+				goto bad_arg;
+			break;
 		default:
 			return 2;
 		}
@@ -1147,6 +1193,53 @@ int check_options(void)
 	}
 #endif
 
+	if (opts.compress_pages) {
+		if (!pages_comp_supported()) {
+			pr_err("CRIU was built without pages compression support\n");
+			return 1;
+		}
+		if (opts.stream) {
+			pr_err("--compress-pages is not compatible with --stream\n");
+			return 1;
+		}
+	}
+
+	if (opts.pack_images && opts.stream) {
+		pr_err("--pack-images is not compatible with --stream\n");
+		return 1;
+	}
+
+	if (opts.overlap_dump && opts.stream) {
+		pr_err("--overlap-dump is not compatible with --stream\n");
+		return 1;
+	}
+
+	if (opts.dedup_store && opts.stream) {
+		pr_err("--dedup-store is not compatible with --stream\n");
+		return 1;
+	}
+
+	if (opts.pages_csum && opts.stream) {
+		pr_err("--pages-csum is not compatible with --stream\n");
+		return 1;
+	}
+
+	/* Holes punched in the pages images don't match the checksums */
+	if (opts.pages_csum && opts.auto_dedup) {
+		pr_err("--pages-csum is not compatible with --auto-dedup\n");
+		return 1;
+	}
+
+	if (opts.pre_copy && (opts.stream || opts.use_page_server)) {
+		pr_err("--pre-copy is not compatible with --stream and --page-server\n");
+		return 1;
+	}
+
+	if (opts.ps_streams > 1 && opts.tls) {
+		pr_err("--ps-streams is not compatible with --tls\n");
+		return 1;
+	}
+
 	if (opts.mntns_compat_mode && opts.mode != CR_RESTORE) {
 		pr_err("Option --mntns-compat-mode is only valid on restore\n");
 		return 1;
@@ -1380,6 +1380,26 @@ static int check_ipv6_freebind(void)
 	return 0;
 }
 
+static int check_pagemap_scan(void)
+{
+	if (!kdat.has_pagemap_scan) {
+		pr_warn("PAGEMAP_SCAN ioctl is not supported, pagemap is read page by page\n");
+		return -1;
+	}
+
+	return 0;
+}
+
+static int check_uffd_wp_async(void)
+{
+	if (!kdat.has_uffd_wp_async) {
+		pr_warn("Async userfaultfd write-protect is not supported, pre-copy uses soft-dirty bits\n");
+		return -1;
+	}
+
+	return 0;
+}
+
 static int (*chk_feature)(void);
 
 /*
@@ -1500,6 +1520,8 @@ int cr_check(void)
 		ret |= check_openat2();
 		ret |= check_ptrace_get_rseq_conf();
 		ret |= check_ipv6_freebind();
+		ret |= check_pagemap_scan();
+		ret |= check_uffd_wp_async();
 
 		if (kdat.lsm == LSMTYPE__APPARMOR)
 			ret |= check_apparmor_stacking();
@@ -1621,6 +1643,8 @@ static struct feature_list feature_list[] = {
 	{ "openat2", check_openat2 },
 	{ "get_rseq_conf", check_ptrace_get_rseq_conf },
 	{ "ipv6_freebind", check_ipv6_freebind },
+	{ "pagemap_scan", check_pagemap_scan },
+	{ "uffd_wp_async", check_uffd_wp_async },
 	{ NULL, NULL },
 };
 
@@ -0,0 +1,418 @@
+#include <unistd.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <dirent.h>
+#include <sys/stat.h>
+
+#undef LOG_PREFIX
+#define LOG_PREFIX "compact: "
+
+#include "int.h"
+#include "crtools.h"
+#include "cr_options.h"
+#include "image.h"
+#include "image-pack.h"
+#include "pagemap.h"
+#include "pages-comp.h"
+#include "protobuf.h"
+#include "servicefd.h"
+#include "util.h"
+#include "xmalloc.h"
+#include "log.h"
+#include "images/pagemap.pb-c.h"
+
+/*
+ * Compaction flattens a chain of incremental images into a directory
+ * without a parent. All the images but the memory ones are copied as
+ * they are (packed ones are unpacked), and every pagemap is rewritten
+ * with the pages it sees through the chain copied into a new pages
+ * image. Pages lying in a row in one image are copied with one
+ * copy_file_range() call.
+ */
+
+#define COMPACT_BUF_SIZE (64 << 10)
+
+struct compact_run {
+	struct page_read *src; /* the pages image of which the run is in */
+	off_t src_off;
+	off_t dst_off;
+	size_t len;
+};
+
+static int copy_range(int sfd, off_t soff, int dfd, off_t doff, size_t len)
+{
+	static char buf[COMPACT_BUF_SIZE];
+	bool fallback = false;
+
+	while (len) {
+		ssize_t ret;
+
+		if (!fallback) {
+			ret = copy_file_range(sfd, &soff, dfd, &doff, len, 0);
+			if (ret < 0 && (errno == EXDEV || errno == ENOSYS || errno == EINVAL || errno == EOPNOTSUPP)) {
+				fallback = true;
+				continue;
+			}
+		} else {
+			ret = pread(sfd, buf, min_t(size_t, len, sizeof(buf)), soff);
+			if (ret > 0) {
+				if (pwrite(dfd, buf, ret, doff) != ret)
+					ret = -1;
+				soff += ret;
+				doff += ret;
+			}
+		}
+
+		if (ret < 0) {
+			pr_perror("Can't copy data");
+			return -1;
+		}
+		if (ret == 0) {
+			pr_err("Image is shorter than expected\n");
+			return -1;
+		}
+		len -= ret;
+	}
+
+	return 0;
+}
+
+static int write_data(int fd, void *data, size_t len, off_t off)
+{
+	while (len) {
+		ssize_t ret;
+
+		ret = pwrite(fd, data, len, off);
+		if (ret < 0) {
+			pr_perror("Can't write data");
+			return -1;
+		}
+		data += ret;
+		off += ret;
+		len -= ret;
+	}
+
+	return 0;
+}
+
+static int copy_comp_range(struct page_read *src, off_t soff, int dfd, off_t doff, size_t len)
+{
+	static char buf[COMPACT_BUF_SIZE];
+
+	while (len) {
+		size_t chunk = min_t(size_t, len, sizeof(buf));
+
+		if (pages_comp_read(src->comp, buf, chunk, soff))
+			return -1;
+		if (write_data(dfd, buf, chunk, doff))
+			return -1;
+		soff += chunk;
+		doff += chunk;
+		len -= chunk;
+	}
+
+	return 0;
+}
+
+static int flush_run(struct compact_run *run, int fd)
+{
+	int ret;
+
+	if (!run->len)
+		return 0;
+
+	pr_debug("Copy %zu bytes from pr%lu-%u at %#lx to %#lx\n", run->len, run->src->img_id, run->src->id,
+		 (unsigned long)run->src_off, (unsigned long)run->dst_off);
+
+	if (run->src->comp)
+		ret = copy_comp_range(run->src, run->src_off, fd, run->dst_off, run->len);
+	else
+		ret = copy_range(img_raw_fd(run->src->pi), run->src_off, fd, run->dst_off, run->len);
+
+	run->dst_off += run->len;
+	run->len = 0;
+	return ret;
+}
+
+static int compact_pages(struct page_read *pr, PagemapEntry *pe, struct compact_run *run, int fd)
+{
+	unsigned long vaddr = pr->pe->vaddr;
+	int left = pr->pe->nr_pages;
+
+	pe->csum = xmalloc(pe->nr_pages * sizeof(u32));
+	if (!pe->csum)
+		return -1;
+	pe->n_csum = pe->nr_pages;
+
+	while (left) {
+		struct page_read *src;
+		int nr = left;
+
+		src = pagemap_locate_pages(pr, vaddr, &nr);
+		if (!src)
+			return -1;
+
+		/* The checksums go along with the pages if all of them have ones */
+		if (pe->n_csum && src->pe->n_csum == src->pe->nr_pages)
+			memcpy(pe->csum + pe->nr_pages - left, src->pe->csum + (vaddr - src->pe->vaddr) / PAGE_SIZE,
+			       nr * sizeof(u32));
+		else
+			pe->n_csum = 0;
+
+		if (run->src != src || run->src_off + run->len != src->pi_off) {
+			if (flush_run(run, fd))
+				return -1;
+			run->src = src;
+			run->src_off = src->pi_off;
+		}
+		run->len += nr * PAGE_SIZE;
+
+		pr->skip_pages(pr, nr * PAGE_SIZE);
+		vaddr += nr * PAGE_SIZE;
+		left -= nr;
+	}
+
+	return 0;
+}
+
+static int compact_pagemap(int sdfd, int odfd, unsigned long id, int pr_flags)
+{
+	int type = pr_flags == PR_TASK ? CR_FD_PAGEMAP : CR_FD_SHMEM_PAGEMAP;
+	struct compact_run run = {};
+	struct cr_img *pmi, *pi;
+	struct page_read pr;
+	u32 pages_id, comp = PAGES_COMP_NONE;
+	int ret;
+
+	ret = open_page_read_at(sdfd, id, &pr, pr_flags);
+	if (ret <= 0)
+		return ret;
+
+	ret = -1;
+	pmi = open_image_at(odfd, type, O_DUMP, id);
+	if (!pmi)
+		goto out;
+	pi = open_pages_image_at(odfd, O_DUMP, pmi, &pages_id, &comp);
+	if (!pi)
+		goto out_pmi;
+
+	while (1) {
+		PagemapEntry pe = PAGEMAP_ENTRY__INIT;
+
+		ret = pr.advance(&pr);
+		if (ret <= 0)
+			break;
+
+		pe.vaddr = pr.pe->vaddr;
+		pe.nr_pages = pr.pe->nr_pages;
+		pe.has_flags = true;
+		pe.flags = pr.pe->flags;
+		if (pagemap_in_parent(pr.pe))
+			pe.flags = (pe.flags & ~PE_PARENT) | PE_PRESENT;
+
+		ret = -1;
+		if ((!pagemap_present(&pe) || !compact_pages(&pr, &pe, &run, img_raw_fd(pi))) &&
+		    pb_write_one(pmi, &pe, PB_PAGEMAP) >= 0)
+			ret = 0;
+		xfree(pe.csum);
+		if (ret)
+			break;
+	}
+
+	if (!ret && flush_run(&run, img_raw_fd(pi)))
+		ret = -1;
+	if (!ret)
+		pr_info("Compacted %s pagemap %lu: %lu bytes of pages\n", pr_flags == PR_TASK ? "task" : "shmem", id,
+			(unsigned long)run.dst_off);
+
+	close_image(pi);
+out_pmi:
+	close_image(pmi);
+out:
+	pr.close(&pr);
+	return ret;
+}
+
+/*
+ * Returns 1 if the image is a pagemap (and compacts it), 0 if it's to
+ * be copied and -1 on error.
+ */
+static int compact_if_pagemap(int sdfd, int odfd, const char *name)
+{
+	unsigned long id;
+	int len = 0;
+
+	if (sscanf(name, "pagemap-%lu.img%n", &id, &len) == 1 && !name[len])
+		return compact_pagemap(sdfd, odfd, id, PR_TASK) < 0 ? -1 : 1;
+	if (sscanf(name, "pagemap-shmem-%lu.img%n", &id, &len) == 1 && !name[len])
+		return compact_pagemap(sdfd, odfd, id, PR_SHMEM) < 0 ? -1 : 1;
+
+	return 0;
+}
+
+static bool image_copied(const char *name)
+{
+	size_t len = strlen(name);
+
+	/* Pages images are rewritten along with their pagemaps */
+	if (!strncmp(name, "pages-", 6))
+		return false;
+
+	return len > 4 && !strcmp(name + len - 4, ".img");
+}
+
+struct compact_ctl {
+	int sdfd;
+	int odfd;
+};
+
+static int compact_packed(const char *name, void *data, size_t len, void *arg)
+{
+	struct compact_ctl *c = arg;
+	int fd, ret;
+
+	ret = compact_if_pagemap(c->sdfd, c->odfd, name);
+	if (ret)
+		return ret < 0 ? -1 : 0;
+	if (!image_copied(name))
+		return 0;
+
+	fd = openat(c->odfd, name, O_WRONLY | O_CREAT | O_EXCL, CR_FD_PERM);
+	if (fd < 0) {
+		pr_perror("Can't create %s", name);
+		return -1;
+	}
+
+	ret = write_data(fd, data, len, 0);
+	close(fd);
+	return ret;
+}
+
+static int copy_image_file(struct compact_ctl *c, const char *name)
+{
+	int sfd, dfd, ret = -1;
+	struct stat st;
+
+	sfd = openat(c->sdfd, name, O_RDONLY);
+	if (sfd < 0) {
+		pr_perror("Can't open %s", name);
+		return -1;
+	}
+
+	if (fstat(sfd, &st)) {
+		pr_perror("Can't stat %s", name);
+		goto out;
+	}
+
+	/* Not images */
+	if (!S_ISREG(st.st_mode)) {
+		ret = 0;
+		goto out;
+	}
+
+	dfd = openat(c->odfd, name, O_WRONLY | O_CREAT | O_EXCL, CR_FD_PERM);
+	if (dfd < 0) {
+		pr_perror("Can't create %s", name);
+		goto out;
+	}
+
+	ret = copy_range(sfd, 0, dfd, 0, st.st_size);
+	close(dfd);
+out:
+	close(sfd);
+	return ret;
+}
+
+static int compact_images(struct compact_ctl *c)
+{
+	struct dirent *de;
+	int fd, ret = 0;
+	DIR *d;
+
+	fd = dup(c->sdfd);
+	d = fd >= 0 ? fdopendir(fd) : NULL;
+	if (!d) {
+		pr_perror("Can't open images dir");
+		close_safe(&fd);
+		return -1;
+	}
+	rewinddir(d);
+
+	while (!ret && (de = readdir(d))) {
+		ret = compact_if_pagemap(c->sdfd, c->odfd, de->d_name);
+		if (ret) {
+			ret = ret < 0 ? -1 : 0;
+			continue;
+		}
+
+		if (image_copied(de->d_name))
+			ret = copy_image_file(c, de->d_name);
+	}
+
+	closedir(d);
+	if (ret)
+		return -1;
+
+	return image_pack_for_each(c->sdfd, compact_packed, c);
+}
+
+static int open_compact_dir(char *dir)
+{
+	struct dirent *de;
+	int fd, nr = 0;
+	DIR *d;
+
+	if (mkdir(dir, 0700) && errno != EEXIST) {
+		pr_perror("Can't create %s", dir);
+		return -1;
+	}
+
+	d = opendir(dir);
+	if (!d) {
+		pr_perror("Can't open %s", dir);
+		return -1;
+	}
+
+	while ((de = readdir(d)))
+		if (!dir_dots(de))
+			nr++;
+
+	if (nr) {
+		pr_err("%s is not empty\n", dir);
+		closedir(d);
+		return -1;
+	}
+
+	fd = dup(dirfd(d));
+	if (fd < 0)
+		pr_perror("Can't dup %s", dir);
+	closedir(d);
+	return fd;
+}
+
+int cr_compact(void)
+{
+	struct compact_ctl c = { .sdfd = get_service_fd(IMG_FD_OFF) };
+	int ret;
+
+	if (!opts.compact_dir) {
+		pr_err("compact requires --compact-dir\n");
+		return -1;
+	}
+
+	c.odfd = open_compact_dir(opts.compact_dir);
+	if (c.odfd < 0)
+		return -1;
+
+	ret = compact_images(&c);
+	close(c.odfd);
+
+	if (ret) {
+		pr_err("Failed to compact images into %s\n", opts.compact_dir);
+		return -1;
+	}
+
+	pr_info("Compacted images into %s\n", opts.compact_dir);
+	return 0;
+}
@@ -33,6 +33,7 @@
 #include "images/mm.pb-c.h"
 #include "images/pstree.pb-c.h"
 #include "imgset.h"
+#include "pages-csum.h"
 
 #undef LOG_PREFIX
 #define LOG_PREFIX "converter: "
@@ -506,7 +507,12 @@ int cr_convert(void)
 		return 1;
 	}
 
+	if (opts.pages_csum && pages_csum_verify_start(get_service_fd(IMG_FD_OFF)))
+		return -1;
+
 	ret = convert_one_ctr(&cc);
+	if (pages_csum_verify_wait())
+		ret = -1;
 	if (ret)
 		return ret;
 	pr_debug("Finish cr convert at %s\n", opts.imgs_dir);
@@ -5,8 +5,11 @@
 
 #include "int.h"
 #include "crtools.h"
+#include "cr_options.h"
+#include "dedup-store.h"
 #include "pagemap.h"
 #include "restorer.h"
+#include "servicefd.h"
 
 static int cr_dedup_one_pagemap(unsigned long img_id, int flags);
 
@@ -17,6 +20,16 @@ int cr_dedup(void)
 	DIR *dirp;
 	struct dirent *ent;
 
+	if (opts.dedup_store) {
+		if (dedup_store_check(get_service_fd(IMG_FD_OFF)) || dedup_store_images(get_service_fd(IMG_FD_OFF)))
+			return -1;
+		/* Sharing with the store is enough w/o a parent */
+		if (access(CR_PARENT_LINK, F_OK) && errno == ENOENT) {
+			pr_info("Deduplicated\n");
+			return 0;
+		}
+	}
+
 	dirp = opendir(CR_PARENT_LINK);
 	if (dirp == NULL) {
 		pr_perror("Can't enter previous snapshot folder");
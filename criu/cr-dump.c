@@ -42,6 +42,8 @@
 #include "util.h"
 #include "namespaces.h"
 #include "image.h"
+#include "image-pack.h"
+#include "dedup-store.h"
 #include "proc_parse.h"
 #include "parasite.h"
 #include "parasite-syscall.h"
@@ -65,6 +67,7 @@
 #include "stats.h"
 #include "mem.h"
 #include "page-pipe.h"
+#include "mem-track.h"
 #include "posix-timer.h"
 #include "vdso.h"
 #include "vma.h"
@@ -1821,7 +1824,8 @@ static int cr_pre_dump_finish(int status)
 		goto err;
 
 	he.has_pre_dump_mode = true;
-	he.pre_dump_mode = opts.pre_dump_mode;
+	/* Images of both read modes are the same for the next pre-dump */
+	he.pre_dump_mode = pre_dump_mode_read(opts.pre_dump_mode) ? PRE_DUMP_READ : opts.pre_dump_mode;
 
 	pstree_switch_state(root_item, TASK_ALIVE);
 
@@ -1849,14 +1853,15 @@ static int cr_pre_dump_finish(int status)
 
 		mem_pp = dmpi(item)->mem_pp;
 
-		if (opts.pre_dump_mode == PRE_DUMP_READ) {
+		if (pre_dump_mode_read(opts.pre_dump_mode)) {
 			timing_stop(TIME_MEMWRITE);
 			ret = page_xfer_predump_pages(item->pid->real, &xfer, mem_pp);
 		} else {
 			ret = page_xfer_dump_pages(&xfer, mem_pp);
 		}
 
-		xfer.close(&xfer);
+		if (xfer.close(&xfer))
+			ret = -1;
 
 		if (ret)
 			goto err;
@@ -2015,6 +2020,9 @@ static int cr_dump_finish(int ret)
 {
 	int post_dump_ret = 0;
 
+	if (mem_writer_finish())
+		ret = -1;
+
 	if (disconnect_from_page_server())
 		ret = -1;
 
@@ -2023,6 +2031,9 @@ static int cr_dump_finish(int ret)
 	if (bfd_flush_images())
 		ret = -1;
 
+	if (opts.pack_images && image_pack_finish(get_service_fd(IMG_FD_OFF), !ret))
+		ret = -1;
+
 	cr_plugin_fini(CR_PLUGIN_STAGE__DUMP, ret);
 	cgp_fini();
 
@@ -2079,6 +2090,14 @@ static int cr_dump_finish(int ret)
 		return -1;
 	pstree_switch_state(root_item, (ret || post_dump_ret) ? TASK_ALIVE : opts.final_state);
 	timing_stop(TIME_FROZEN);
+
+	/*
+	 * The pages images are complete, and sharing them with the store
+	 * doesn't change their contents, so the tasks needn't wait for it.
+	 */
+	if (!ret && !post_dump_ret && opts.dedup_store && dedup_store_images(get_service_fd(IMG_FD_OFF)))
+		ret = -1;
+
 	free_pstree(root_item);
 	seccomp_free_entries();
 	free_file_locks();
@@ -2110,6 +2129,12 @@ int cr_dump_tasks(pid_t pid)
 	pr_info("Dumping processes (pid: %d comm: %s)\n", pid, __task_comm_info(pid));
 	pr_info("========================================\n");
 
+	if (opts.dedup_store && dedup_store_check(get_service_fd(IMG_FD_OFF)))
+		return 1;
+
+	if (opts.pack_images && image_pack_start(get_service_fd(IMG_FD_OFF)))
+		return 1;
+
 	/*
 	 *  We will fetch all file descriptors for each task, their number can
 	 *  be bigger than a default file limit, so we need to raise it to the
@@ -2234,6 +2259,13 @@ int cr_dump_tasks(pid_t pid)
 	if (dump_pstree(root_item))
 		goto err;
 
+	/*
+	 * Shmem pages go the same way as the tasks' ones, so the
+	 * overlapped memory dump should be over by now.
+	 */
+	if (mem_writer_finish())
+		goto err;
+
 	/*
 	 * TODO: cr_dump_shmem has to be called before dump_namespaces(),
 	 * because page_ids is a global variable and it is used to dump
@@ -2286,3 +2318,223 @@ err:
 
 	return cr_dump_finish(ret);
 }
+
+/*
+ * Iterative pre-dumps, either the --pre-copy ones below or the RPC
+ * converging dump, write the pages the tasks dirtied since the previous
+ * round. That gives the dirty rate, and from it and from what the last
+ * round cost we project how long the tasks would stay frozen if the
+ * final dump started now. The rounds stop when that fits the target,
+ * when there's too little memory left to bother, when a round didn't
+ * write at least 20% fewer pages than the previous one, i.e. the tasks
+ * dirty memory about as fast as we copy it, or when there were enough
+ * rounds.
+ */
+#define PRE_DUMP_MIN_PAGES 256
+
+void pre_dump_round_stats(struct pre_dump_round *r)
+{
+	r->pages_written = dump_cnt(CNT_PAGES_WRITTEN);
+	r->frozen_us = dump_time_us(TIME_FROZEN);
+	r->memdump_us = dump_time_us(TIME_MEMDUMP);
+	r->memwrite_us = dump_time_us(TIME_MEMWRITE);
+}
+
+bool pre_dump_converged(struct pre_dump_conv *c, struct pre_dump_round *r)
+{
+	struct timeval now;
+	long frozen_us, per_page_ns, interval_us;
+	unsigned long projected;
+	bool first = c->iter == 0;
+	bool ret = false;
+
+	c->dirty_rate = 0;
+	c->projected_ms = ULONG_MAX;
+
+	/* The first round writes everything, there's no dirty rate yet */
+	if (!first) {
+		interval_us = max_t(long, r->start_us - c->prev.start_us, 1);
+		c->dirty_rate = r->pages_written * USEC_PER_SEC / interval_us;
+
+		gettimeofday(&now, NULL);
+		projected = c->dirty_rate * (timeval_to_us(&now) - r->start_us) / USEC_PER_SEC;
+
+		per_page_ns = 0;
+		if (r->pages_written)
+			per_page_ns = (r->memdump_us + r->memwrite_us) * 1000 / r->pages_written;
+		frozen_us = r->frozen_us - r->memdump_us + projected * per_page_ns / 1000;
+		c->projected_ms = max_t(long, frozen_us, 0) / 1000;
+	}
+
+	pr_info("Pre-dump round %d: %lu pages written, %lu pages/s dirtied, "
+		"final dump projected to freeze for %lu ms\n",
+		c->iter, r->pages_written, c->dirty_rate, c->projected_ms);
+
+	if (c->projected_ms <= c->target_ms)
+		ret = true;
+	else if (r->pages_written <= PRE_DUMP_MIN_PAGES) {
+		pr_info("Pre-dump rounds leave too few pages\n");
+		ret = true;
+	} else if (!first && r->pages_written * 5 > c->prev.pages_written * 4) {
+		pr_info("Pre-dump rounds stopped shrinking\n");
+		ret = true;
+	} else if (c->iter + 1 >= c->max_iters) {
+		pr_info("Pre-dump didn't converge in %d rounds\n", c->iter + 1);
+		ret = true;
+	}
+
+	c->prev = *r;
+	c->iter++;
+	return ret;
+}
+
+/*
+ * With --pre-copy the memory is first pre-dumped into the pre-copy-N
+ * subdirectories of the images directory, each one on top of the
+ * previous one, until the rounds converge. Then the tasks are dumped on
+ * top of the last pre-dump, so only the pages dirtied since then are
+ * written, or, with --lazy-pages, left for the post-copy phase.
+ */
+#define PRE_COPY_DIR "pre-copy-%d"
+
+static int link_parent_images(int dfd, char *parent)
+{
+	if (unlinkat(dfd, CR_PARENT_LINK, 0) && errno != ENOENT) {
+		pr_perror("Can't remove the parent link");
+		return -1;
+	}
+
+	if (symlinkat(parent, dfd, CR_PARENT_LINK)) {
+		pr_perror("Can't link parent snapshot %s", parent);
+		return -1;
+	}
+
+	return 0;
+}
+
+static int pre_copy_open_dir(int iter)
+{
+	char dir[32], parent[PATH_MAX];
+	int fd;
+
+	snprintf(dir, sizeof(dir), PRE_COPY_DIR, iter);
+	if (mkdirat(get_service_fd(IMG_FD_OFF), dir, 0700) && errno != EEXIST) {
+		pr_perror("Can't create %s", dir);
+		return -1;
+	}
+
+	fd = openat(get_service_fd(IMG_FD_OFF), dir, O_RDONLY | O_DIRECTORY);
+	if (fd < 0) {
+		pr_perror("Can't open %s", dir);
+		return -1;
+	}
+
+	if (install_service_fd(IMG_FD_OFF, fd) < 0)
+		return -1;
+
+	if (iter > 1)
+		snprintf(parent, sizeof(parent), "../" PRE_COPY_DIR, iter - 1);
+	else if (opts.img_parent && opts.img_parent[0] != '/')
+		snprintf(parent, sizeof(parent), "../%s", opts.img_parent);
+	else if (opts.img_parent)
+		snprintf(parent, sizeof(parent), "%s", opts.img_parent);
+	else
+		return 0;
+
+	/* the memory dump only skips pages when there is a parent */
+	SET_CHAR_OPTS(img_parent, parent);
+	return link_parent_images(get_service_fd(IMG_FD_OFF), parent);
+}
+
+static int pre_copy_one(pid_t pid, int iter, struct pre_dump_round *r)
+{
+	int p[2], status, ret;
+	pid_t child;
+
+	if (pipe(p)) {
+		pr_perror("Can't create pipe");
+		return -1;
+	}
+
+	child = fork();
+	if (child < 0) {
+		pr_perror("Can't fork pre-copy iteration");
+		close(p[0]);
+		close(p[1]);
+		return -1;
+	}
+
+	if (child == 0) {
+		close(p[0]);
+		/* all the pages go to the images, laziness is for the final dump */
+		opts.lazy_pages = false;
+		if (pre_copy_open_dir(iter) || cr_pre_dump_tasks(pid))
+			exit(1);
+
+		pre_dump_round_stats(r);
+		if (write(p[1], r, sizeof(*r)) != sizeof(*r)) {
+			pr_perror("Can't report pre-copy iteration result");
+			exit(1);
+		}
+		exit(0);
+	}
+
+	close(p[1]);
+	ret = read(p[0], r, sizeof(*r));
+	close(p[0]);
+
+	if (waitpid(child, &status, 0) != child) {
+		pr_perror("Can't wait for pre-copy iteration");
+		return -1;
+	}
+
+	if (!WIFEXITED(status) || WEXITSTATUS(status) || ret != sizeof(*r)) {
+		pr_err("Pre-copy iteration %d failed\n", iter);
+		return -1;
+	}
+
+	return 0;
+}
+
+int cr_pre_copy_tasks(pid_t pid)
+{
+	struct pre_dump_conv conv = { .max_iters = opts.pre_copy };
+	struct pre_dump_round r;
+	struct timeval now;
+	char parent[32];
+	int iter, ret = 1;
+
+	/* the iterations are forked, let them share the grown pipes */
+	if (page_pipe_pool_fill())
+		return 1;
+
+	/* and the write-protect tracking of the tasks */
+	if (mem_track_init())
+		return 1;
+
+	for (iter = 1; iter <= opts.pre_copy; iter++) {
+		gettimeofday(&now, NULL);
+		r.start_us = timeval_to_us(&now);
+		if (pre_copy_one(pid, iter, &r))
+			goto out;
+
+		if (pre_dump_converged(&conv, &r))
+			break;
+	}
+
+	if (iter > opts.pre_copy)
+		iter = opts.pre_copy;
+
+	snprintf(parent, sizeof(parent), PRE_COPY_DIR, iter);
+	if (link_parent_images(get_service_fd(IMG_FD_OFF), parent))
+		goto out;
+
+	pr_info("Dumping on top of %s\n", parent);
+	SET_CHAR_OPTS(img_parent, parent);
+	opts.track_mem = true;
+
+	ret = cr_dump_tasks(pid);
+out:
+	mem_track_fini();
+	return ret;
+}
@@ -103,6 +103,7 @@
 #include "cr-errno.h"
 
 #include "switch.h"
+#include "pages-csum.h"
 
 #ifndef arch_export_restore_thread
 #define arch_export_restore_thread __export_restore_thread
@@ -2452,6 +2453,12 @@ skip_ns_bouncing:
 	if (ret < 0)
 		goto out_kill;
 
+	/* All the tasks are forked, none of them inherits the checking threads' locks */
+	if (opts.pages_csum && pages_csum_verify_start(get_service_fd(IMG_FD_OFF))) {
+		ret = -1;
+		goto out_kill;
+	}
+
 	ret = apply_memfd_seals();
 	if (ret < 0)
 		goto out_kill;
@@ -2489,6 +2496,9 @@ skip_ns_bouncing:
 	if (fault_injected(FI_POST_RESTORE))
 		goto out_kill;
 
+	if (pages_csum_verify_wait())
+		goto out_kill;
+
 	ret = run_scripts(ACT_POST_RESTORE);
 	if (ret != 0) {
 		pr_err("Aborting restore due to post-restore script ret code %d\n", ret);
@@ -2807,6 +2817,8 @@ int cr_restore_tasks(void)
 		goto clean_cgroup;
 
 	ret = restore_root_task(root_item);
+	/* If the restore failed before it checked them */
+	pages_csum_verify_wait();
 	pr_debug("restore_root_task() return %d\n", ret);
 clean_cgroup:
 	fini_cgroup();
@@ -7,6 +7,7 @@
 #include <stdlib.h>
 #include <errno.h>
 #include <string.h>
+#include <inttypes.h>
 #include <sys/types.h>
 #include <sys/socket.h>
 #include <sys/un.h>
@@ -15,6 +16,7 @@
 #include <arpa/inet.h>
 #include <sched.h>
 #include <sys/prctl.h>
+#include <sys/mman.h>
 
 #include "version.h"
 #include "crtools.h"
@@ -28,6 +30,7 @@
 #include "cr-service.h"
 #include "cr-service-const.h"
 #include "page-xfer.h"
+#include "page-pipe.h"
 #include "protobuf.h"
 #include "net.h"
 #include "mount.h"
@@ -42,6 +45,7 @@
 #include "common/scm.h"
 #include "uffd.h"
 #include "pidfd-store.h"
+#include "mem-track.h"
 #include "stats.h"
 
 #include "setproctitle.h"
@@ -491,6 +495,20 @@ static int setup_opts_from_req(int sk, CriuOpts *req)
 	if (req->has_auto_dedup)
 		opts.auto_dedup = req->auto_dedup;
 
+	if (req->has_compress_pages)
+		opts.compress_pages = req->compress_pages;
+
+	if (req->has_overlap_dump)
+		opts.overlap_dump = req->overlap_dump;
+
+	if (req->has_ps_streams) {
+		if (req->ps_streams < 1 || req->ps_streams > PS_MAX_STREAMS) {
+			pr_err("Bad number of page server streams %u\n", req->ps_streams);
+			goto err;
+		}
+		opts.ps_streams = req->ps_streams;
+	}
+
 	if (req->has_force_irmap)
 		opts.force_irmap = req->force_irmap;
 
@@ -512,6 +530,9 @@ static int setup_opts_from_req(int sk, CriuOpts *req)
 		case CRIU_PRE_DUMP_MODE__VM_READ:
 			opts.pre_dump_mode = PRE_DUMP_READ;
 			break;
+		case CRIU_PRE_DUMP_MODE__VM_READ_BATCH:
+			opts.pre_dump_mode = PRE_DUMP_READ_BATCH;
+			break;
 		default:
 			goto err;
 		}
@@ -940,6 +961,214 @@ static int pre_dump_loop(int sk, CriuReq *msg)
 	return dump_using_req(sk, msg->opts);
 }
 
+/*
+ * Converging dump. CRIU pre-dumps the tasks again and again, each round
+ * into the pre-N subdirectory of the images directory on top of the
+ * previous one, until pre_dump_converged() says the rounds are done.
+ * Then the final dump goes into the images directory with the last round
+ * as its parent.
+ */
+static int open_pre_dump_dir(int iter, char *parent)
+{
+	char path[32], *dir;
+	int ret;
+
+	snprintf(path, sizeof(path), "pre-%d", iter);
+	if (mkdirat(get_service_fd(IMG_FD_OFF), path, 0700) && errno != EEXIST) {
+		pr_perror("Can't create %s", path);
+		return -1;
+	}
+
+	xfree(opts.img_parent);
+	opts.img_parent = NULL;
+	if (parent) {
+		opts.img_parent = xstrdup(parent);
+		if (!opts.img_parent)
+			return -1;
+	}
+
+	dir = xsprintf("%s/pre-%d", images_dir, iter);
+	if (!dir)
+		return -1;
+
+	close_image_dir();
+	ret = open_image_dir(dir, -1);
+	xfree(dir);
+	return ret;
+}
+
+static int pre_dump_round(int sk, CriuOpts *req, int iter, char *parent, struct pre_dump_round *r)
+{
+	int pid, status;
+
+	pid = fork();
+	if (pid < 0) {
+		pr_perror("Can't fork");
+		return -1;
+	}
+
+	if (pid == 0) {
+		int ret = 1;
+
+		opts.mode = CR_PRE_DUMP;
+		if (setup_opts_from_req(sk, req))
+			goto cout;
+
+		if (open_pre_dump_dir(iter, parent))
+			goto cout;
+
+		__setproctitle("pre-dump --rpc -t %d -D %s/pre-%d", req->pid, images_dir, iter);
+
+		if (init_pidfd_store_hash())
+			goto pidfd_store_err;
+
+		if (cr_pre_dump_tasks(req->pid))
+			goto cout;
+
+		pre_dump_round_stats(r);
+
+		ret = 0;
+cout:
+		free_pidfd_store();
+pidfd_store_err:
+		exit(ret);
+	}
+
+	if (waitpid(pid, &status, 0) != pid) {
+		pr_perror("Unable to wait %d", pid);
+		return -1;
+	}
+
+	return status ? -1 : 0;
+}
+
+static int send_pre_dump_progress(int sk, CriuPreDumpIter *pi)
+{
+	CriuResp msg = CRIU_RESP__INIT;
+	CriuNotify cn = CRIU_NOTIFY__INIT;
+	CriuReq *req;
+	int ret;
+
+	msg.type = CRIU_REQ_TYPE__NOTIFY;
+	msg.success = true;
+	msg.notify = &cn;
+	cn.script = "pre-dump-iter";
+	cn.pre_dump = pi;
+
+	if (send_criu_msg(sk, &msg) < 0)
+		return -1;
+
+	if (recv_criu_msg(sk, &req) < 0)
+		return -1;
+
+	ret = 0;
+	if (req->type != CRIU_REQ_TYPE__NOTIFY || !req->notify_success) {
+		pr_err("RPC client stopped the pre-dump rounds\n");
+		ret = -1;
+	}
+
+	criu_req__free_unpacked(req, NULL);
+	return ret;
+}
+
+static int converge_dump(int sk, CriuOpts *req)
+{
+	struct pre_dump_conv conv = {
+		.max_iters = req->pre_dump_max_iters,
+		.target_ms = req->pre_dump_target_ms,
+	};
+	struct pre_dump_round *r;
+	char parent[32], *req_parent = req->parent_img;
+	struct timeval now;
+	bool converged;
+	int iter, ret;
+
+	if (!req->pid) {
+		send_criu_err(sk, "Converging dump of self is not supported");
+		return -1;
+	}
+
+	/* The rounds are forked, let them share the grown pipes and the tracking */
+	if (page_pipe_pool_fill() || mem_track_init()) {
+		send_criu_err(sk, "Can't start pre-dump rounds");
+		return -1;
+	}
+
+	r = mmap(NULL, sizeof(*r), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (r == MAP_FAILED) {
+		pr_perror("Can't map pre-dump round stats");
+		send_criu_err(sk, "Can't start pre-dump rounds");
+		mem_track_fini();
+		return -1;
+	}
+
+	/*
+	 * The rounds and the final dump manage the parent links themselves,
+	 * so the one from the request is only used by the very first round.
+	 */
+	req->has_track_mem = true;
+	req->track_mem = true;
+	req->parent_img = NULL;
+
+	for (iter = 0;; iter++) {
+		CriuPreDumpIter pi = CRIU_PRE_DUMP_ITER__INIT;
+		char *round_parent = NULL, *client_parent = NULL;
+
+		if (iter > 0) {
+			snprintf(parent, sizeof(parent), "../pre-%d", iter - 1);
+			round_parent = parent;
+		} else if (req_parent) {
+			if (req_parent[0] != '/') {
+				client_parent = xsprintf("../%s", req_parent);
+				if (!client_parent)
+					goto err;
+			}
+			round_parent = client_parent ?: req_parent;
+		}
+
+		memset(r, 0, sizeof(*r));
+		gettimeofday(&now, NULL);
+		r->start_us = timeval_to_us(&now);
+
+		ret = pre_dump_round(sk, req, iter, round_parent, r);
+		xfree(client_parent);
+		if (ret) {
+			pr_err("Pre-dump round %d failed\n", iter);
+			goto err;
+		}
+
+		converged = pre_dump_converged(&conv, r);
+
+		pi.iter = iter;
+		pi.pages_written = r->pages_written;
+		pi.dirty_rate = conv.dirty_rate;
+		pi.projected_ms = min_t(unsigned long, conv.projected_ms, UINT32_MAX);
+
+		if (req->notify_scripts && send_pre_dump_progress(sk, &pi))
+			goto err;
+
+		if (converged)
+			break;
+	}
+
+	munmap(r, sizeof(*r));
+
+	snprintf(parent, sizeof(parent), "pre-%d", iter);
+	req->parent_img = parent;
+	ret = dump_using_req(sk, req);
+	req->parent_img = req_parent;
+	mem_track_fini();
+
+	return ret;
+
+err:
+	munmap(r, sizeof(*r));
+	req->parent_img = req_parent;
+	mem_track_fini();
+	send_criu_dump_resp(sk, false, false);
+	return -1;
+}
+
 static int start_page_server_req(int sk, CriuOpts *req, bool daemon_mode)
 {
 	int ret = -1, pid, start_pipe[2];
@@ -1306,6 +1535,9 @@ more:
 	case CRIU_REQ_TYPE__SINGLE_PRE_DUMP:
 		ret = pre_dump_using_req(sk, msg->opts, true);
 		break;
+	case CRIU_REQ_TYPE__CONVERGE_DUMP:
+		ret = converge_dump(sk, msg->opts);
+		break;
 
 	default:
 		send_criu_err(sk, "Invalid req");
@@ -47,6 +47,7 @@
 #include "setproctitle.h"
 #include "sysctl.h"
 #include "cr-convert.h"
+#include "pages-csum.h"
 
 struct timeval global_main_start;
 
@@ -107,6 +108,10 @@ static int parse_criu_mode(char *mode)
 		opts.mode = CR_SHOW_DEPRECATED;
 	else if (!strcmp(mode, "convert"))
 		opts.mode = CR_CONVERT;
+	else if (!strcmp(mode, "check-image"))
+		opts.mode = CR_CHECK_IMAGE;
+	else if (!strcmp(mode, "compact"))
+		opts.mode = CR_COMPACT;
 	else
 		return -1;
 
@@ -292,6 +297,9 @@ int main(int argc, char *argv[], char *envp[])
 		if (!opts.tree_id)
 			goto opt_pid_missing;
 
+		if (opts.pre_copy)
+			return cr_pre_copy_tasks(opts.tree_id);
+
 		return cr_dump_tasks(opts.tree_id);
 	}
 
@@ -362,6 +370,12 @@ int main(int argc, char *argv[], char *envp[])
 	if (opts.mode == CR_CONVERT)
 		return cr_convert();
 
+	if (opts.mode == CR_CHECK_IMAGE)
+		return pages_csum_verify(get_service_fd(IMG_FD_OFF)) != 0;
+
+	if (opts.mode == CR_COMPACT)
+		return cr_compact() != 0;
+
 	pr_err("unknown command: %s\n", argv[optind]);
 usage:
 	pr_msg("\n"
@@ -372,6 +386,8 @@ usage:
 	       "  criu page-server\n"
 	       "  criu service [<options>]\n"
 	       "  criu dedup\n"
+	       "  criu check-image -D DIR\n"
+	       "  criu compact -D DIR --compact-dir OUT\n"
 	       "  criu lazy-pages -D DIR [<options>]\n"
 	       "\n"
 	       "Commands:\n"
@@ -382,6 +398,8 @@ usage:
 	       "  page-server    launch page server\n"
 	       "  service        launch service\n"
 	       "  dedup          remove duplicates in memory dump\n"
+	       "  check-image    check pages images against their checksums\n"
+	       "  compact        flatten a chain of incremental images\n"
 	       "  cpuinfo dump   writes cpu information into image file\n"
 	       "  cpuinfo check  validates cpu information read from image file\n"
 	       "  convert        convert an existing img to use pseudo_mm API\n");
@@ -420,6 +438,19 @@ usage:
 	       "                        this requires running a second instance of criu\n"
 	       "                        in lazy-pages mode: 'criu lazy-pages -D DIR'\n"
 	       "                        --lazy-pages and lazy-pages mode require userfaultfd\n"
+	       "  --fault-profile [MS]  in lazy-pages mode, prefetch pages in the order\n"
+	       "                        recorded in the fault profile image, or record\n"
+	       "                        the faults of the first MS milliseconds (1000)\n"
+	       "                        if the images don't have one\n"
+	       "  --lazy-pages-workers NUM\n"
+	       "                        in lazy-pages mode, serve the processes from NUM\n"
+	       "                        threads, by default from one per CPU, up to 8\n"
+	       "  --map-page-images     in lazy-pages mode, copy pages into the processes\n"
+	       "                        straight from the mapped pages images\n"
+	       "  --lazy-pages-cache DIR\n"
+	       "                        in lazy-pages mode, keep the pages received from\n"
+	       "                        the page server in DIR and reuse them when the\n"
+	       "                        same checkpoint is restored again\n"
 	       "  --stream              dump/restore images using criu-image-streamer\n"
 	       "  --mntns-compat-mode   Use mount engine in compatibility mode. By default criu\n"
 	       "                        tries to use mount-v2 mode with more reliable algorithm\n"
@@ -551,13 +582,30 @@ usage:
 	       "                        pages images of previous dump\n"
 	       "                        when used on restore, as soon as page is restored, it\n"
 	       "                        will be punched from the image\n"
+	       "  --compress-pages      store pages images as compressed blocks; with\n"
+	       "                        --page-server asks the server to compress them\n"
+	       "  --pack-images         pack all images but the pages ones into one file\n"
+	       "  --dedup-store DIR     on dump and dedup, share the pages that are already\n"
+	       "                        in the store at DIR with it and add the new ones\n"
+	       "  --pages-csum          on dump, checksum the pages as they are written; on\n"
+	       "                        restore and convert, check them against the checksums\n"
+	       "  --overlap-dump        write pages in background while the rest of the\n"
+	       "                        tasks state is dumped\n"
 	       "  --pre-dump-mode       splice - parasite based pre-dumping (default)\n"
 	       "                        read   - process_vm_readv syscall based pre-dumping\n"
+	       "                        read-batch - like read, but reads in big batches\n"
+	       "                                 with several threads\n"
+	       "  --pre-copy [N]        on dump, pre-dump the memory up to N times (5)\n"
+	       "                        while the amount of it keeps shrinking, then\n"
+	       "                        dump on top of the last pre-dump\n"
+	       "  --compact-dir DIR     write the flattened images into DIR on compact\n"
 	       "\n"
 	       "Page/Service server options:\n"
 	       "  --address ADDR        address of server or service\n"
 	       "  --port PORT           port of page server\n"
 	       "  --ps-socket FD        use specified FD as page server socket\n"
+	       "  --ps-streams NUM      send pages to page server over NUM parallel\n"
+	       "                        connections\n"
 	       "  -d|--daemon           run in the background after creating socket\n"
 	       "  --status-fd FD        write \\0 to the FD and close it once process is ready\n"
 	       "                        to handle requests\n"
@@ -0,0 +1,546 @@
+#include <unistd.h>
+#include <inttypes.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <dirent.h>
+#include <sys/file.h>
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <linux/fs.h>
+
+#undef LOG_PREFIX
+#define LOG_PREFIX "dedup-store: "
+
+#include "types.h"
+#include "page.h"
+#include "cr_options.h"
+#include "dedup-store.h"
+#include "util.h"
+#include "xmalloc.h"
+#include "log.h"
+
+#ifndef FICLONERANGE
+struct file_clone_range {
+	__s64 src_fd;
+	__u64 src_offset;
+	__u64 src_length;
+	__u64 dest_offset;
+};
+
+#define FICLONERANGE _IOW(0x94, 13, struct file_clone_range)
+#endif
+
+#define STORE_CHUNKS "chunks"
+#define STORE_INDEX  "index"
+
+struct store_rec {
+	u64 hash; /* 0 marks a free slot in the table */
+	u64 off;
+};
+
+struct dedup_store {
+	int chunks_fd;
+	int index_fd;
+	u64 flushed; /* the chunks file really has that many bytes */
+	u64 end;     /* and that many with the pages of the pending run */
+
+	struct store_rec *table; /* open addressing, by hash */
+	unsigned long table_size;
+	unsigned long nr;
+
+	struct store_rec *new; /* to be appended to the index */
+	unsigned long nr_new;
+	unsigned long new_size;
+
+	unsigned long nr_shared;
+	unsigned long nr_added;
+};
+
+/*
+ * Pages are cloned in runs that are contiguous both in the image
+ * and in the store, either from the store into the image (the page
+ * is already there) or the other way round (a new page).
+ */
+enum {
+	RUN_NONE,
+	RUN_FROM_STORE,
+	RUN_TO_STORE,
+};
+
+struct clone_run {
+	int dir;
+	u64 img_off;
+	u64 store_off;
+	u64 len;
+};
+
+/*
+ * Not a cryptographic hash, equal hashes are always confirmed by
+ * comparing the pages before sharing them.
+ */
+static u64 page_hash(const void *page)
+{
+	const u64 *p = page;
+	u64 h = 0xcbf29ce484222325ULL;
+	int i;
+
+	for (i = 0; i < PAGE_SIZE / sizeof(u64); i++) {
+		h ^= p[i];
+		h *= 0x100000001b3ULL;
+		h ^= h >> 32;
+	}
+
+	return h ?: 1;
+}
+
+static bool page_is_zero(const void *page)
+{
+	const u64 *p = page;
+	int i;
+
+	for (i = 0; i < PAGE_SIZE / sizeof(u64); i++)
+		if (p[i])
+			return false;
+
+	return true;
+}
+
+static struct store_rec *table_find(struct dedup_store *s, u64 hash)
+{
+	unsigned long i = hash & (s->table_size - 1);
+
+	if (!s->table_size)
+		return NULL;
+
+	while (s->table[i].hash) {
+		if (s->table[i].hash == hash)
+			return &s->table[i];
+		i = (i + 1) & (s->table_size - 1);
+	}
+
+	return NULL;
+}
+
+static void __table_add(struct store_rec *table, unsigned long size, u64 hash, u64 off)
+{
+	unsigned long i = hash & (size - 1);
+
+	while (table[i].hash)
+		i = (i + 1) & (size - 1);
+
+	table[i].hash = hash;
+	table[i].off = off;
+}
+
+static int table_add(struct dedup_store *s, u64 hash, u64 off)
+{
+	if ((s->nr + 1) * 2 > s->table_size) {
+		unsigned long i, size = s->table_size ? s->table_size * 2 : 4096;
+		struct store_rec *t;
+
+		t = xzalloc(size * sizeof(*t));
+		if (!t)
+			return -1;
+
+		for (i = 0; i < s->table_size; i++)
+			if (s->table[i].hash)
+				__table_add(t, size, s->table[i].hash, s->table[i].off);
+
+		xfree(s->table);
+		s->table = t;
+		s->table_size = size;
+	}
+
+	__table_add(s->table, s->table_size, hash, off);
+	s->nr++;
+	return 0;
+}
+
+static int load_index(struct dedup_store *s)
+{
+	struct store_rec *recs;
+	struct stat st;
+	unsigned long i, nr;
+	int ret = -1;
+
+	if (fstat(s->chunks_fd, &st)) {
+		pr_perror("Can't stat " STORE_CHUNKS);
+		return -1;
+	}
+	/* A crashed run may have left unindexed pages at the end */
+	s->flushed = s->end = round_up(st.st_size, PAGE_SIZE);
+
+	if (fstat(s->index_fd, &st)) {
+		pr_perror("Can't stat " STORE_INDEX);
+		return -1;
+	}
+
+	nr = st.st_size / sizeof(*recs);
+	if (!nr)
+		return 0;
+
+	recs = xmalloc(nr * sizeof(*recs));
+	if (!recs)
+		return -1;
+
+	if (pread(s->index_fd, recs, nr * sizeof(*recs), 0) != nr * sizeof(*recs)) {
+		pr_perror("Can't read " STORE_INDEX);
+		goto out;
+	}
+
+	for (i = 0; i < nr; i++) {
+		if (!recs[i].hash || recs[i].off + PAGE_SIZE > s->flushed || table_find(s, recs[i].hash))
+			continue;
+		if (table_add(s, recs[i].hash, recs[i].off))
+			goto out;
+	}
+
+	pr_info("%lu pages in the store\n", s->nr);
+	ret = 0;
+out:
+	xfree(recs);
+	return ret;
+}
+
+static int dedup_store_open(struct dedup_store *s)
+{
+	int dir;
+
+	memset(s, 0, sizeof(*s));
+	s->chunks_fd = s->index_fd = -1;
+
+	dir = open(opts.dedup_store, O_RDONLY | O_DIRECTORY);
+	if (dir < 0) {
+		pr_perror("Can't open %s", opts.dedup_store);
+		return -1;
+	}
+
+	s->index_fd = openat(dir, STORE_INDEX, O_RDWR | O_CREAT, 0600);
+	if (s->index_fd < 0) {
+		pr_perror("Can't open %s/" STORE_INDEX, opts.dedup_store);
+		goto err;
+	}
+
+	/* Dumps sharing the store take turns */
+	if (flock(s->index_fd, LOCK_EX)) {
+		pr_perror("Can't lock %s", opts.dedup_store);
+		goto err;
+	}
+
+	s->chunks_fd = openat(dir, STORE_CHUNKS, O_RDWR | O_CREAT, 0600);
+	if (s->chunks_fd < 0) {
+		pr_perror("Can't open %s/" STORE_CHUNKS, opts.dedup_store);
+		goto err;
+	}
+
+	close(dir);
+	return load_index(s);
+
+err:
+	close(dir);
+	return -1;
+}
+
+static int new_rec(struct dedup_store *s, u64 hash, u64 off)
+{
+	if (s->nr_new == s->new_size) {
+		unsigned long size = s->new_size ? s->new_size * 2 : 4096;
+		struct store_rec *n;
+
+		n = xrealloc(s->new, size * sizeof(*n));
+		if (!n)
+			return -1;
+		s->new = n;
+		s->new_size = size;
+	}
+
+	s->new[s->nr_new].hash = hash;
+	s->new[s->nr_new].off = off;
+	s->nr_new++;
+
+	return table_add(s, hash, off);
+}
+
+/*
+ * Only the pages that made it into the chunks file are indexed, so
+ * that a failed run leaves the store consistent.
+ */
+static int dedup_store_close(struct dedup_store *s)
+{
+	unsigned long nr = 0;
+	int ret = 0;
+
+	while (nr < s->nr_new && s->new[nr].off + PAGE_SIZE <= s->flushed)
+		nr++;
+
+	if (nr) {
+		if (fdatasync(s->chunks_fd)) {
+			pr_perror("Can't sync " STORE_CHUNKS);
+			ret = -1;
+		} else if (lseek(s->index_fd, 0, SEEK_END) < 0 ||
+			   write_all(s->index_fd, s->new, nr * sizeof(*s->new)) != nr * sizeof(*s->new) ||
+			   fdatasync(s->index_fd)) {
+			pr_perror("Can't update " STORE_INDEX);
+			ret = -1;
+		}
+	}
+
+	pr_info("%lu pages shared with the store, %lu added to it\n", s->nr_shared, s->nr_added);
+
+	close_safe(&s->chunks_fd);
+	close_safe(&s->index_fd);
+	xfree(s->table);
+	xfree(s->new);
+	return ret;
+}
+
+/*
+ * Returns 1 if the file system can't share extents between the image
+ * and the store, which only stops the deduplication.
+ */
+static int flush_run(struct dedup_store *s, int img_fd, struct clone_run *r)
+{
+	struct file_clone_range fcr = {
+		.src_length = r->len,
+	};
+	int ret, dir = r->dir;
+
+	if (dir == RUN_NONE || !r->len)
+		return 0;
+
+	r->dir = RUN_NONE;
+
+	if (dir == RUN_FROM_STORE) {
+		fcr.src_fd = s->chunks_fd;
+		fcr.src_offset = r->store_off;
+		fcr.dest_offset = r->img_off;
+		ret = ioctl(img_fd, FICLONERANGE, &fcr);
+	} else {
+		fcr.src_fd = img_fd;
+		fcr.src_offset = r->img_off;
+		fcr.dest_offset = r->store_off;
+		ret = ioctl(s->chunks_fd, FICLONERANGE, &fcr);
+	}
+
+	if (ret) {
+		if (errno == EOPNOTSUPP || errno == EXDEV || errno == EINVAL || errno == ENOTTY) {
+			pr_warn("Can't share extents with %s: %s\n", opts.dedup_store, strerror(errno));
+			return 1;
+		}
+		pr_perror("Can't clone %#" PRIx64 " bytes at %#" PRIx64, r->len, r->img_off);
+		return -1;
+	}
+
+	if (dir == RUN_FROM_STORE)
+		s->nr_shared += r->len / PAGE_SIZE;
+	else {
+		s->flushed = r->store_off + r->len;
+		s->nr_added += r->len / PAGE_SIZE;
+	}
+
+	return 0;
+}
+
+static int add_to_run(struct dedup_store *s, int img_fd, struct clone_run *r, int dir, u64 img_off, u64 store_off)
+{
+	int ret;
+
+	if (r->dir == dir && r->img_off + r->len == img_off && r->store_off + r->len == store_off) {
+		r->len += PAGE_SIZE;
+		return 0;
+	}
+
+	ret = flush_run(s, img_fd, r);
+	if (ret)
+		return ret;
+
+	r->dir = dir;
+	r->img_off = img_off;
+	r->store_off = store_off;
+	r->len = PAGE_SIZE;
+	return 0;
+}
+
+static int dedup_one_image(struct dedup_store *s, int dfd, const char *name)
+{
+	struct clone_run run = { .dir = RUN_NONE };
+	void *page = NULL, *spage = NULL;
+	struct stat st;
+	int fd, ret = -1;
+	u64 off;
+
+	fd = openat(dfd, name, O_RDWR);
+	if (fd < 0) {
+		pr_perror("Can't open %s", name);
+		return -1;
+	}
+
+	if (fstat(fd, &st)) {
+		pr_perror("Can't stat %s", name);
+		goto out;
+	}
+
+	page = xmalloc(PAGE_SIZE);
+	spage = xmalloc(PAGE_SIZE);
+	if (!page || !spage)
+		goto out;
+
+	for (off = 0; off + PAGE_SIZE <= st.st_size; off += PAGE_SIZE) {
+		struct store_rec *rec;
+		u64 hash;
+
+		if (pread(fd, page, PAGE_SIZE, off) != PAGE_SIZE) {
+			pr_perror("Can't read %s at %#" PRIx64, name, off);
+			ret = -1;
+			goto out;
+		}
+
+		/* Holes punched by --auto-dedup, or just zeroes */
+		if (page_is_zero(page))
+			continue;
+
+		hash = page_hash(page);
+		rec = table_find(s, hash);
+		if (!rec) {
+			ret = new_rec(s, hash, s->end);
+			if (!ret)
+				ret = add_to_run(s, fd, &run, RUN_TO_STORE, off, s->end);
+			if (ret)
+				goto out;
+			s->end += PAGE_SIZE;
+			continue;
+		}
+
+		/* The page may have been added to the store by this very run */
+		if (rec->off >= s->flushed) {
+			ret = flush_run(s, fd, &run);
+			if (ret)
+				goto out;
+		}
+
+		if (pread(s->chunks_fd, spage, PAGE_SIZE, rec->off) != PAGE_SIZE) {
+			pr_perror("Can't read " STORE_CHUNKS " at %#" PRIx64, rec->off);
+			ret = -1;
+			goto out;
+		}
+
+		if (memcmp(page, spage, PAGE_SIZE))
+			continue;
+
+		ret = add_to_run(s, fd, &run, RUN_FROM_STORE, off, rec->off);
+		if (ret)
+			goto out;
+	}
+
+	ret = flush_run(s, fd, &run);
+out:
+	xfree(page);
+	xfree(spage);
+	close(fd);
+	return ret;
+}
+
+static bool is_pages_image(int dfd, const char *name)
+{
+	char idx[PATH_MAX];
+	unsigned int id;
+	int len = 0;
+
+	if (sscanf(name, "pages-%u.img%n", &id, &len) != 1 || name[len])
+		return false;
+
+	/* Compressed images have no pages to share */
+	snprintf(idx, sizeof(idx), "pages-index-%u.img", id);
+	return faccessat(dfd, idx, F_OK, 0) != 0;
+}
+
+/*
+ * There's no way to refer to the store from the images other than
+ * sharing the extents, so the store is only usable where this works.
+ */
+int dedup_store_check(int dfd)
+{
+	struct file_clone_range fcr = {
+		.src_length = PAGE_SIZE,
+	};
+	int src = -1, dst = -1, ret = -1;
+	void *page;
+
+	page = xmalloc(PAGE_SIZE);
+	if (!page)
+		return -1;
+	/* Zero pages are never shared, see page_is_zero() */
+	memset(page, 0xa5, PAGE_SIZE);
+
+	src = open(opts.dedup_store, O_TMPFILE | O_RDWR, 0600);
+	if (src < 0) {
+		pr_perror("Can't create a file in %s", opts.dedup_store);
+		goto out;
+	}
+
+	dst = openat(dfd, ".", O_TMPFILE | O_RDWR, 0600);
+	if (dst < 0) {
+		pr_perror("Can't create a file in the images dir");
+		goto out;
+	}
+
+	if (write_all(src, page, PAGE_SIZE) != PAGE_SIZE) {
+		pr_perror("Can't write a file in %s", opts.dedup_store);
+		goto out;
+	}
+
+	fcr.src_fd = src;
+	if (ioctl(dst, FICLONERANGE, &fcr)) {
+		pr_perror("The images dir can't share extents with %s (need one file system with reflinks)",
+			  opts.dedup_store);
+		goto out;
+	}
+
+	ret = 0;
+out:
+	close_safe(&src);
+	close_safe(&dst);
+	xfree(page);
+	return ret;
+}
+
+int dedup_store_images(int dfd)
+{
+	struct dedup_store s;
+	struct dirent *de;
+	int ret = 0, fd;
+	DIR *d;
+
+	if (dedup_store_open(&s)) {
+		dedup_store_close(&s);
+		return -1;
+	}
+
+	fd = dup(dfd);
+	d = fd >= 0 ? fdopendir(fd) : NULL;
+	if (!d) {
+		pr_perror("Can't open images dir");
+		close_safe(&fd);
+		dedup_store_close(&s);
+		return -1;
+	}
+	rewinddir(d);
+
+	while ((de = readdir(d))) {
+		if (!is_pages_image(dfd, de->d_name))
+			continue;
+
+		pr_debug("Deduplicating %s\n", de->d_name);
+		ret = dedup_one_image(&s, dfd, de->d_name);
+		if (ret)
+			break;
+	}
+	closedir(d);
+
+	if (dedup_store_close(&s))
+		ret = -1;
+
+	/* The file system can't share pages, but the images are intact */
+	return ret < 0 ? -1 : 0;
+}
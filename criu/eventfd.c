@@ -111,4 +111,5 @@ struct collect_image_info eventfd_cinfo = {
 	.pb_type = PB_EVENTFD_FILE,
 	.priv_size = sizeof(struct eventfd_file_info),
 	.collect = collect_one_efd,
+	.flags = COLLECT_ARENA,
 };
@@ -480,7 +480,7 @@ struct collect_image_info epoll_tfd_cinfo = {
 	.fd_type = CR_FD_EVENTPOLL_TFD,
 	.pb_type = PB_EVENTPOLL_TFD,
 	.collect = collect_one_epoll_tfd,
-	.flags = COLLECT_NOFREE,
+	.flags = COLLECT_NOFREE | COLLECT_ARENA,
 };
 
 static int collect_one_epoll(void *o, ProtobufCMessage *msg, struct cr_img *i)
@@ -497,4 +497,5 @@ struct collect_image_info epoll_cinfo = {
 	.pb_type = PB_EVENTPOLL_FILE,
 	.priv_size = sizeof(struct eventpoll_file_info),
 	.collect = collect_one_epoll,
+	.flags = COLLECT_ARENA,
 };
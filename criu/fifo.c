@@ -166,6 +166,7 @@ struct collect_image_info fifo_cinfo = {
 	.pb_type = PB_FIFO,
 	.priv_size = sizeof(struct fifo_info),
 	.collect = collect_one_fifo,
+	.flags = COLLECT_ARENA,
 };
 
 static int collect_fifo_data(void *obj, ProtobufCMessage *msg, struct cr_img *img)
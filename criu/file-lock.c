@@ -45,6 +45,7 @@ struct collect_image_info file_locks_cinfo = {
 	.pb_type = PB_FILE_LOCK,
 	.priv_size = sizeof(struct file_lock_rst),
 	.collect = collect_one_file_lock,
+	.flags = COLLECT_ARENA,
 };
 
 struct file_lock *alloc_file_lock(void)
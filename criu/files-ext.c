@@ -81,6 +81,7 @@ struct collect_image_info ext_file_cinfo = {
 	.pb_type = PB_EXT_FILE,
 	.priv_size = sizeof(struct ext_file_info),
 	.collect = collect_one_ext,
+	.flags = COLLECT_ARENA,
 };
 
 int dump_unsupp_fd(struct fd_parms *p, int lfd, char *more, char *info, FdinfoEntry *e)
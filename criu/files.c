@@ -1795,7 +1795,7 @@ struct collect_image_info files_cinfo = {
 	.pb_type = PB_FILE,
 	.priv_size = 0,
 	.collect = collect_one_file,
-	.flags = COLLECT_NOFREE,
+	.flags = COLLECT_NOFREE | COLLECT_ARENA,
 };
 
 int prepare_files(void)
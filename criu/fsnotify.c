@@ -805,6 +805,7 @@ struct collect_image_info inotify_cinfo = {
 	.pb_type = PB_INOTIFY_FILE,
 	.priv_size = sizeof(struct fsnotify_file_info),
 	.collect = collect_one_inotify,
+	.flags = COLLECT_ARENA,
 };
 
 static int collect_one_fanotify(void *o, ProtobufCMessage *msg, struct cr_img *img)
@@ -839,6 +840,7 @@ struct collect_image_info fanotify_cinfo = {
 	.pb_type = PB_FANOTIFY_FILE,
 	.priv_size = sizeof(struct fsnotify_file_info),
 	.collect = collect_one_fanotify,
+	.flags = COLLECT_ARENA,
 };
 
 static int collect_one_inotify_mark(void *o, ProtobufCMessage *msg, struct cr_img *i)
@@ -877,6 +879,7 @@ struct collect_image_info inotify_mark_cinfo = {
 	.pb_type = PB_INOTIFY_WD,
 	.priv_size = sizeof(struct fsnotify_mark_info),
 	.collect = collect_one_inotify_mark,
+	.flags = COLLECT_ARENA,
 };
 
 static int collect_one_fanotify_mark(void *o, ProtobufCMessage *msg, struct cr_img *i)
@@ -905,4 +908,5 @@ struct collect_image_info fanotify_mark_cinfo = {
 	.pb_type = PB_FANOTIFY_MARK,
 	.priv_size = sizeof(struct fsnotify_mark_info),
 	.collect = collect_one_fanotify_mark,
+	.flags = COLLECT_ARENA,
 };
@@ -89,6 +89,7 @@ struct cr_fd_desc_tmpl imgset_template[CR_FD_MAX] = {
 	FD_ENTRY(FILE_LOCKS,	"filelocks"),
 	FD_ENTRY(RLIMIT,	"rlimit-%u"),
 	FD_ENTRY_F(PAGES,	"pages-%u", O_NOBUF),
+	FD_ENTRY(PAGES_INDEX,	"pages-index-%u"),
 	FD_ENTRY_F(PAGES_OLD,	"pages-%d", O_NOBUF),
 	FD_ENTRY_F(SHM_PAGES_OLD, "pages-shmem-%ld", O_NOBUF),
 	FD_ENTRY(SIGNAL,	"signal-s-%u"),
@@ -97,6 +98,7 @@ struct cr_fd_desc_tmpl imgset_template[CR_FD_MAX] = {
 	FD_ENTRY(CGROUP,	"cgroup"),
 	FD_ENTRY(TIMERFD,	"timerfd"),
 	FD_ENTRY(CPUINFO,	"cpuinfo"),
+	FD_ENTRY(FAULT_PROFILE,	"fault-profile"),
 	FD_ENTRY(SECCOMP,	"seccomp"),
 	FD_ENTRY(USERNS,	"userns-%u"),
 	FD_ENTRY(NETNF_CT,	"netns-ct-%u"),
@@ -120,4 +122,10 @@ struct cr_fd_desc_tmpl imgset_template[CR_FD_MAX] = {
 		.magic	= IRMAP_CACHE_MAGIC,
 		.oflags = O_SERVICE | O_FORCE_LOCAL,
 	},
+
+	/* Renamed into fault-profile.img once written */
+	[CR_FD_FAULT_PROFILE_TMP] = {
+		.fmt	= "fault-profile.img.%d",
+		.magic	= FAULT_PROFILE_MAGIC,
+	},
 };
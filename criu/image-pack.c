@@ -0,0 +1,550 @@
+#include <unistd.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#undef LOG_PREFIX
+#define LOG_PREFIX "image-pack: "
+
+#include "common/compiler.h"
+#include "image-pack.h"
+#include "memfd.h"
+#include "string.h"
+#include "util.h"
+#include "xmalloc.h"
+#include "log.h"
+
+#define IMAGE_PACK_TMP IMAGE_PACK_NAME ".tmp"
+
+static int entry_cmp(const void *a, const void *b)
+{
+	const struct image_pack_entry *x = a, *y = b;
+
+	return strcmp(x->name, y->name);
+}
+
+/*
+ * The pack is written while the dump goes on. Each image is kept in a
+ * memfd while it's open and goes into the pack when it's closed, after
+ * a chunk header with its name and length:
+ *
+ *	struct image_pack_head, zeroed
+ *	struct image_pack_chunk, image data, 8-byte aligned, at least one byte apart
+ *	...
+ *
+ * Some images are written by the children criu forks (e.g. the
+ * namespaces ones), so the end of the pack lives in shared memory, the
+ * children only reserve room for their images there and don't need to
+ * report back. Once the dump is over, the index is made of the chunk
+ * headers and the head is filled.
+ */
+struct image_pack_chunk {
+	char name[IMAGE_PACK_NAME_LEN];
+	u64 len;
+};
+
+struct pack_shared {
+	pthread_mutex_t lock;
+	u64 end; /* where the next chunk goes */
+	bool failed;
+};
+
+/* An image being written into its memfd */
+struct pack_image {
+	int fd;	   /* the image one, the key */
+	int memfd; /* a dup, that survives the image's close */
+	pid_t pid; /* only the one who opened it puts it into the pack */
+	char name[IMAGE_PACK_NAME_LEN];
+	struct pack_image *next;
+};
+
+static struct {
+	int fd; /* of the pack, -1 if it's not written */
+	int dfd;
+	struct pack_shared *sh;
+	struct pack_image *images; /* under sh->lock */
+} pack_wr = { .fd = -1 };
+
+static void pack_lock(void)
+{
+	if (pthread_mutex_lock(&pack_wr.sh->lock) == EOWNERDEAD) {
+		/* A child died with it, its chunk is lost */
+		pack_wr.sh->failed = true;
+		pthread_mutex_consistent(&pack_wr.sh->lock);
+	}
+}
+
+static void pack_unlock(void)
+{
+	pthread_mutex_unlock(&pack_wr.sh->lock);
+}
+
+int image_pack_start(int dfd)
+{
+	struct image_pack_head head = {};
+	pthread_mutexattr_t attr;
+
+	pack_wr.sh = mmap(NULL, sizeof(*pack_wr.sh), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (pack_wr.sh == MAP_FAILED) {
+		pr_perror("Can't map the pack state");
+		pack_wr.sh = NULL;
+		return -1;
+	}
+
+	pthread_mutexattr_init(&attr);
+	pthread_mutexattr_setpshared(&attr, PTHREAD_PROCESS_SHARED);
+	pthread_mutexattr_setrobust(&attr, PTHREAD_MUTEX_ROBUST);
+	pthread_mutex_init(&pack_wr.sh->lock, &attr);
+	pthread_mutexattr_destroy(&attr);
+
+	pack_wr.fd = openat(dfd, IMAGE_PACK_TMP, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+	if (pack_wr.fd < 0) {
+		pr_perror("Can't create " IMAGE_PACK_TMP);
+		goto err;
+	}
+
+	if (pwrite(pack_wr.fd, &head, sizeof(head), 0) != sizeof(head)) {
+		pr_perror("Can't write " IMAGE_PACK_TMP);
+		close_safe(&pack_wr.fd);
+		unlinkat(dfd, IMAGE_PACK_TMP, 0);
+		goto err;
+	}
+
+	pack_wr.sh->end = sizeof(head);
+	pack_wr.dfd = dfd;
+	return 0;
+
+err:
+	munmap(pack_wr.sh, sizeof(*pack_wr.sh));
+	pack_wr.sh = NULL;
+	return -1;
+}
+
+int image_pack_create(int dfd, const char *name, int *fd)
+{
+	struct pack_image *pi;
+
+	if (pack_wr.fd < 0 || dfd != pack_wr.dfd)
+		return 0;
+	/* pages-N.img and pages-index-N.img */
+	if (!strncmp(name, "pages-", 6) || strchr(name, '/') || strlen(name) >= IMAGE_PACK_NAME_LEN)
+		return 0;
+
+	pi = xzalloc(sizeof(*pi));
+	if (!pi)
+		return -1;
+
+	pi->fd = memfd_create(name, MFD_CLOEXEC);
+	if (pi->fd < 0) {
+		pr_perror("Can't create memfd for %s", name);
+		xfree(pi);
+		return -1;
+	}
+
+	pi->memfd = fcntl(pi->fd, F_DUPFD_CLOEXEC, 0);
+	if (pi->memfd < 0) {
+		pr_perror("Can't dup memfd for %s", name);
+		close(pi->fd);
+		xfree(pi);
+		return -1;
+	}
+
+	pi->pid = getpid();
+	__strlcpy(pi->name, name, sizeof(pi->name));
+
+	pack_lock();
+	pi->next = pack_wr.images;
+	pack_wr.images = pi;
+	pack_unlock();
+
+	*fd = pi->fd;
+	return 1;
+}
+
+static int write_chunk(struct pack_image *pi)
+{
+	struct image_pack_chunk ch = {};
+	struct stat st;
+	void *data = NULL;
+	size_t curr = 0;
+	u64 off;
+
+	if (fstat(pi->memfd, &st)) {
+		pr_perror("Can't stat %s", pi->name);
+		return -1;
+	}
+
+	if (st.st_size) {
+		data = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, pi->memfd, 0);
+		if (data == MAP_FAILED) {
+			pr_perror("Can't map %s", pi->name);
+			return -1;
+		}
+	}
+
+	__strlcpy(ch.name, pi->name, sizeof(ch.name));
+	ch.len = st.st_size;
+
+	/* The room is reserved under the lock, and filled w/o it */
+	pack_lock();
+	off = pack_wr.sh->end;
+	/* breadchr() may put a '\0' right after the image */
+	pack_wr.sh->end = round_up(off + sizeof(ch) + ch.len + 1, 8);
+	pack_unlock();
+
+	if (pwrite(pack_wr.fd, &ch, sizeof(ch), off) != sizeof(ch))
+		goto err;
+	off += sizeof(ch);
+
+	while (curr < ch.len) {
+		ssize_t ret;
+
+		ret = pwrite(pack_wr.fd, data + curr, ch.len - curr, off + curr);
+		if (ret <= 0)
+			goto err;
+		curr += ret;
+	}
+
+	if (data)
+		munmap(data, ch.len);
+	return 0;
+
+err:
+	pr_perror("Can't write %s into the pack", pi->name);
+	if (data)
+		munmap(data, ch.len);
+	return -1;
+}
+
+struct pack_image *image_pack_closing(int fd)
+{
+	struct pack_image *pi, **p;
+
+	if (pack_wr.fd < 0)
+		return NULL;
+
+	pack_lock();
+	for (p = &pack_wr.images; *p; p = &(*p)->next)
+		if ((*p)->fd == fd)
+			break;
+	pi = *p;
+	if (pi)
+		*p = pi->next;
+	pack_unlock();
+
+	return pi;
+}
+
+void image_pack_closed(struct pack_image *pi)
+{
+	if (pi->pid == getpid() && write_chunk(pi))
+		pack_wr.sh->failed = true;
+
+	close(pi->memfd);
+	xfree(pi);
+}
+
+/* The pack has been written or removed, drop what's known about it */
+static void forget_pack(int dfd);
+
+static int collect_chunks(struct image_pack_entry **entries, u32 *nr)
+{
+	struct image_pack_entry *e = NULL, *tmp;
+	u32 n = 0, size = 0, i, j;
+	u64 off = sizeof(struct image_pack_head);
+
+	while (off < pack_wr.sh->end) {
+		struct image_pack_chunk ch;
+
+		if (pread(pack_wr.fd, &ch, sizeof(ch), off) != sizeof(ch)) {
+			pr_perror("Can't read a chunk at %#" PRIx64, off);
+			goto err;
+		}
+
+		if (!ch.name[0] || !memchr(ch.name, 0, sizeof(ch.name)) || ch.len > pack_wr.sh->end - off - sizeof(ch)) {
+			pr_err("Corrupted chunk at %#" PRIx64 "\n", off);
+			goto err;
+		}
+
+		if (n == size) {
+			size = size ? size * 2 : 64;
+			tmp = xrealloc(e, size * sizeof(*e));
+			if (!tmp)
+				goto err;
+			e = tmp;
+		}
+
+		memset(&e[n], 0, sizeof(e[n]));
+		__strlcpy(e[n].name, ch.name, sizeof(e[n].name));
+		e[n].off = off + sizeof(ch);
+		e[n].len = ch.len;
+		n++;
+
+		off = round_up(off + sizeof(ch) + ch.len + 1, 8);
+	}
+
+	/* An image written twice is taken as of the last time, as with files */
+	qsort(e, n, sizeof(*e), entry_cmp);
+	for (i = 0, j = 0; i < n; i++) {
+		if (j && !strcmp(e[j - 1].name, e[i].name)) {
+			if (e[i].off > e[j - 1].off)
+				e[j - 1] = e[i];
+			continue;
+		}
+		e[j++] = e[i];
+	}
+
+	*entries = e;
+	*nr = j;
+	return 0;
+
+err:
+	xfree(e);
+	return -1;
+}
+
+int image_pack_finish(int dfd, bool ok)
+{
+	struct image_pack_head head = {
+		.magic = IMAGE_PACK_MAGIC,
+		.version = IMAGE_PACK_VERSION,
+	};
+	struct image_pack_entry *entries = NULL;
+	struct pack_image *pi;
+	size_t idx_len;
+	u32 nr;
+	int ret = -1;
+
+	if (pack_wr.fd < 0)
+		return 0;
+
+	/* Images left open don't make it into the pack */
+	while ((pi = pack_wr.images)) {
+		pr_warn("%s is not closed, not packing it\n", pi->name);
+		pack_wr.images = pi->next;
+		close(pi->memfd);
+		xfree(pi);
+	}
+
+	if (!ok)
+		goto out;
+	if (pack_wr.sh->failed) {
+		pr_err("Some images didn't make it into the pack\n");
+		goto out;
+	}
+
+	if (collect_chunks(&entries, &nr))
+		goto out;
+
+	head.nr_entries = nr;
+	head.index_off = pack_wr.sh->end;
+	idx_len = nr * sizeof(*entries);
+	if (pwrite(pack_wr.fd, entries, idx_len, head.index_off) != idx_len ||
+	    pwrite(pack_wr.fd, &head, sizeof(head), 0) != sizeof(head)) {
+		pr_perror("Can't write the pack index");
+		goto out;
+	}
+
+	if (renameat(dfd, IMAGE_PACK_TMP, dfd, IMAGE_PACK_NAME)) {
+		pr_perror("Can't rename " IMAGE_PACK_TMP);
+		goto out;
+	}
+
+	pr_info("Packed %u images, %" PRIu64 " bytes\n", nr, head.index_off + idx_len);
+	ret = 0;
+out:
+	if (ret)
+		unlinkat(dfd, IMAGE_PACK_TMP, 0);
+	close_safe(&pack_wr.fd);
+	munmap(pack_wr.sh, sizeof(*pack_wr.sh));
+	pack_wr.sh = NULL;
+	forget_pack(dfd);
+	xfree(entries);
+	return ret;
+}
+
+/*
+ * Packs are looked up by the directory they are in, because images are
+ * opened from the parent directories as well. Directories without a
+ * pack are remembered too, with map == NULL.
+ */
+struct image_pack {
+	dev_t dev;
+	ino_t ino;
+	void *map;
+	size_t len;
+	struct image_pack_entry *index;
+	u32 nr;
+	struct image_pack *next;
+};
+
+static struct image_pack *packs;
+static pthread_mutex_t packs_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static int map_pack(int dfd, struct image_pack *p)
+{
+	struct image_pack_head *head;
+	struct stat st;
+	int fd;
+
+	fd = openat(dfd, IMAGE_PACK_NAME, O_RDONLY);
+	if (fd < 0) {
+		if (errno == ENOENT)
+			return 0;
+		pr_perror("Can't open " IMAGE_PACK_NAME);
+		return -1;
+	}
+
+	if (fstat(fd, &st)) {
+		pr_perror("Can't stat " IMAGE_PACK_NAME);
+		close(fd);
+		return -1;
+	}
+
+	if (st.st_size < sizeof(*head)) {
+		pr_err("Truncated " IMAGE_PACK_NAME "\n");
+		close(fd);
+		return -1;
+	}
+
+	/* Writable, but private, for breadchr() */
+	p->map = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (p->map == MAP_FAILED) {
+		pr_perror("Can't map " IMAGE_PACK_NAME);
+		p->map = NULL;
+		return -1;
+	}
+	p->len = st.st_size;
+
+	head = p->map;
+	if (head->magic != IMAGE_PACK_MAGIC || head->version != IMAGE_PACK_VERSION ||
+	    head->index_off > p->len || (p->len - head->index_off) / sizeof(*p->index) < head->nr_entries) {
+		pr_err("Corrupted " IMAGE_PACK_NAME "\n");
+		munmap(p->map, p->len);
+		p->map = NULL;
+		return -1;
+	}
+
+	p->index = p->map + head->index_off;
+	p->nr = head->nr_entries;
+	pr_debug("Mapped " IMAGE_PACK_NAME " with %u images\n", p->nr);
+	return 0;
+}
+
+static struct image_pack *get_pack(int dfd)
+{
+	struct image_pack *p;
+	struct stat st;
+
+	if (fstat(dfd, &st)) {
+		pr_perror("Can't stat images dir");
+		return NULL;
+	}
+
+	for (p = packs; p; p = p->next)
+		if (p->dev == st.st_dev && p->ino == st.st_ino)
+			return p;
+
+	p = xzalloc(sizeof(*p));
+	if (!p)
+		return NULL;
+
+	p->dev = st.st_dev;
+	p->ino = st.st_ino;
+	if (map_pack(dfd, p)) {
+		xfree(p);
+		return NULL;
+	}
+
+	p->next = packs;
+	packs = p;
+	return p;
+}
+
+static void forget_pack(int dfd)
+{
+	struct image_pack *p, **pp;
+	struct stat st;
+
+	if (fstat(dfd, &st))
+		return;
+
+	pthread_mutex_lock(&packs_lock);
+	for (pp = &packs; (p = *pp); pp = &p->next) {
+		if (p->dev != st.st_dev || p->ino != st.st_ino)
+			continue;
+
+		*pp = p->next;
+		if (p->map)
+			munmap(p->map, p->len);
+		xfree(p);
+		break;
+	}
+	pthread_mutex_unlock(&packs_lock);
+}
+
+int image_pack_lookup(int dfd, const char *name, void **data, size_t *len)
+{
+	struct image_pack_entry key = {}, *e;
+	struct image_pack *p;
+
+	if (strlen(name) >= IMAGE_PACK_NAME_LEN)
+		return 0;
+
+	pthread_mutex_lock(&packs_lock);
+	p = get_pack(dfd);
+	pthread_mutex_unlock(&packs_lock);
+	if (!p)
+		return -1;
+	if (!p->map)
+		return 0;
+
+	__strlcpy(key.name, name, sizeof(key.name));
+	e = bsearch(&key, p->index, p->nr, sizeof(*e), entry_cmp);
+	if (!e)
+		return 0;
+
+	if (e->off > p->len || e->len > p->len - e->off) {
+		pr_err("Corrupted %s in " IMAGE_PACK_NAME "\n", name);
+		return -1;
+	}
+
+	*data = p->map + e->off;
+	*len = e->len;
+	return 1;
+}
+
+int image_pack_for_each(int dfd, int (*cb)(const char *name, void *data, size_t len, void *arg), void *arg)
+{
+	struct image_pack *p;
+	u32 i;
+
+	pthread_mutex_lock(&packs_lock);
+	p = get_pack(dfd);
+	pthread_mutex_unlock(&packs_lock);
+	if (!p)
+		return -1;
+
+	for (i = 0; p->map && i < p->nr; i++) {
+		struct image_pack_entry *e = &p->index[i];
+		char name[IMAGE_PACK_NAME_LEN];
+
+		if (e->off > p->len || e->len > p->len - e->off) {
+			pr_err("Corrupted %.*s in " IMAGE_PACK_NAME "\n", IMAGE_PACK_NAME_LEN, e->name);
+			return -1;
+		}
+
+		__strlcpy(name, e->name, sizeof(name));
+		if (cb(name, p->map + e->off, e->len, arg))
+			return -1;
+	}
+
+	return 0;
+}
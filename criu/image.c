@@ -3,6 +3,7 @@
 #include <stdarg.h>
 #include <fcntl.h>
 #include <limits.h>
+#include <dirent.h>
 #include <sys/stat.h>
 #include "crtools.h"
 #include "cr_options.h"
@@ -19,6 +20,9 @@
 #include "proc_parse.h"
 #include "img-streamer.h"
 #include "namespaces.h"
+#include "pages-comp.h"
+#include "image-pack.h"
+#include "memfd.h"
 
 bool ns_per_id = false;
 bool img_common_magic = true;
@@ -243,6 +247,10 @@ int prepare_inventory(InventoryEntry *he)
 	he->has_network_lock_method = true;
 	he->network_lock_method = opts.network_lock_method;
 
+	/* Identifies the images, e.g. for --lazy-pages-cache on restore */
+	he->has_dump_id = true;
+	he->dump_id = criu_run_id;
+
 	return 0;
 }
 
@@ -440,12 +448,148 @@ static int userns_openat(void *arg, int dfd, int pid)
 	return ret;
 }
 
+/*
+ * Images from a pack are read right from its mapping. The few that are
+ * read raw (spliced, lseeked, passed to tar, etc.) need a real file, so
+ * they get a copy in a memfd.
+ */
+static int open_packed_image(struct cr_img *img, unsigned long oflags, char *path, void *data, size_t len)
+{
+	int fd;
+
+	if (!(oflags & O_NOBUF)) {
+		bfdopenm(&img->_x, data, len);
+		return 0;
+	}
+
+	fd = memfd_create(path, 0);
+	if (fd < 0) {
+		pr_perror("Can't create memfd for %s", path);
+		return -1;
+	}
+
+	if (write_all(fd, data, len) != len || lseek(fd, 0, SEEK_SET)) {
+		pr_perror("Can't copy packed %s", path);
+		close(fd);
+		return -1;
+	}
+
+	img->_x.fd = fd;
+	bfd_setraw(&img->_x);
+	return 0;
+}
+
+/*
+ * Dump doesn't leave images it wrote nothing into, so on restore most
+ * of the image kinds probed for a tree are just absent. Rather than
+ * trying to open each of them, the images directory is listed once
+ * and the names not in it are known to be empty.
+ */
+static struct {
+	char **names;
+	int nr;
+	bool listed;
+} img_list;
+
+static int name_cmp(const void *a, const void *b)
+{
+	return strcmp(*(char **)a, *(char **)b);
+}
+
+static int list_image_dir(int dfd)
+{
+	struct dirent *de;
+	char **names;
+	int fd, size = 0;
+	DIR *d;
+
+	fd = dup(dfd);
+	d = fd >= 0 ? fdopendir(fd) : NULL;
+	if (!d) {
+		pr_perror("Can't list images dir");
+		close_safe(&fd);
+		return -1;
+	}
+	rewinddir(d);
+
+	while ((de = readdir(d))) {
+		if (img_list.nr == size) {
+			size = size ? size * 2 : 64;
+			names = xrealloc(img_list.names, size * sizeof(char *));
+			if (!names)
+				goto err;
+			img_list.names = names;
+		}
+
+		img_list.names[img_list.nr] = xstrdup(de->d_name);
+		if (!img_list.names[img_list.nr])
+			goto err;
+		img_list.nr++;
+	}
+	closedir(d);
+
+	qsort(img_list.names, img_list.nr, sizeof(char *), name_cmp);
+	pr_debug("%d entries in images dir\n", img_list.nr);
+	return 0;
+
+err:
+	closedir(d);
+	while (img_list.nr)
+		xfree(img_list.names[--img_list.nr]);
+	xfree(img_list.names);
+	img_list.names = NULL;
+	return -1;
+}
+
+static bool image_absent(int dfd, char *path)
+{
+	if (opts.mode != CR_RESTORE || dfd != get_service_fd(IMG_FD_OFF))
+		return false;
+
+	if (!img_list.listed) {
+		img_list.listed = true;
+		/* Fall back to opening them */
+		if (list_image_dir(dfd))
+			return false;
+	}
+
+	return img_list.names && !bsearch(&path, img_list.names, img_list.nr, sizeof(char *), name_cmp);
+}
+
 static int do_open_image(struct cr_img *img, int dfd, int type, unsigned long oflags, char *path)
 {
-	int ret, flags;
+	int ret, flags, fd;
 
 	flags = oflags & ~(O_NOBUF | O_SERVICE | O_FORCE_LOCAL);
 
+	if (flags == O_RDONLY && !opts.stream) {
+		void *data;
+		size_t len;
+
+		ret = image_pack_lookup(dfd, path, &data, &len);
+		if (ret < 0)
+			goto err;
+		if (ret > 0) {
+			if (open_packed_image(img, oflags, path, data, len))
+				goto err;
+			goto check_magic;
+		}
+
+		if (image_absent(dfd, path)) {
+			pr_info("No %s image\n", path);
+			img->_x.fd = EMPTY_IMG_FD;
+			goto skip_magic;
+		}
+	}
+
+	if (flags == O_DUMP && !opts.stream) {
+		ret = image_pack_create(dfd, path, &fd);
+		if (ret < 0)
+			goto err;
+		if (ret > 0)
+			goto opened;
+	}
+
 	if (opts.stream && !(oflags & O_FORCE_LOCAL)) {
 		ret = img_streamer_open(path, flags);
 		errno = EIO; /* errno value is meaningless, only the ret value is meaningful */
@@ -477,19 +621,18 @@ static int do_open_image(struct cr_img *img, int dfd, int type, unsigned long of
 		goto err;
 	}
 
-	img->_x.fd = ret;
+	fd = ret;
+opened:
+	img->_x.fd = fd;
 	if (oflags & O_NOBUF)
 		bfd_setraw(&img->_x);
 	else {
-		if (flags == O_RDONLY)
-			ret = bfdopenr(&img->_x);
-		else
-			ret = bfdopenw(&img->_x);
-
+		ret = bfdopen_image(&img->_x, flags != O_RDONLY);
 		if (ret)
 			goto err;
 	}
 
+check_magic:
 	if (imgset_template[type].magic == RAW_IMAGE_MAGIC)
 		goto skip_magic;
 
@@ -534,8 +677,13 @@ void close_image(struct cr_img *img)
 		 */
 		unlinkat(get_service_fd(IMG_FD_OFF), img->path, 0);
 		xfree(img->path);
-	} else if (!empty_image(img))
+	} else if (!empty_image(img)) {
+		struct pack_image *pi = image_pack_closing(img->_x.fd);
+
 		bclose(&img->_x);
+		if (pi)
+			image_pack_closed(pi);
+	}
 
 	xfree(img);
 }
@@ -645,17 +793,22 @@ void up_page_ids_base(void)
 	page_ids += 0x10000;
 }
 
-struct cr_img *open_pages_image_at(int dfd, unsigned long flags, struct cr_img *pmi, u32 *id)
+struct cr_img *open_pages_image_at(int dfd, unsigned long flags, struct cr_img *pmi, u32 *id, u32 *comp)
 {
 	if (flags == O_RDONLY || flags == O_RDWR) {
 		PagemapHead *h;
 		if (pb_read_one(pmi, &h, PB_PAGEMAP_HEAD) < 0)
 			return NULL;
 		*id = h->pages_id;
+		*comp = h->has_comp_algo ? h->comp_algo : PAGES_COMP_NONE;
 		pagemap_head__free_unpacked(h, NULL);
 	} else {
 		PagemapHead h = PAGEMAP_HEAD__INIT;
 		*id = h.pages_id = page_ids++;
+		if (*comp != PAGES_COMP_NONE) {
+			h.has_comp_algo = true;
+			h.comp_algo = *comp;
+		}
 		if (pb_write_one(pmi, &h, PB_PAGEMAP_HEAD) < 0)
 			return NULL;
 	}
@@ -663,9 +816,9 @@ struct cr_img *open_pages_image_at(int dfd, unsigned long flags, struct cr_img *
 	return open_image_at(dfd, CR_FD_PAGES, flags, *id);
 }
 
-struct cr_img *open_pages_image(unsigned long flags, struct cr_img *pmi, u32 *id)
+struct cr_img *open_pages_image(unsigned long flags, struct cr_img *pmi, u32 *id, u32 *comp)
 {
-	return open_pages_image_at(get_service_fd(IMG_FD_OFF), flags, pmi, id);
+	return open_pages_image_at(get_service_fd(IMG_FD_OFF), flags, pmi, id, comp);
 }
 
 /*
@@ -761,6 +914,9 @@ off_t img_raw_size(struct cr_img *img)
 {
 	struct stat stat;
 
+	if (bfd_mapped(&img->_x))
+		return img->_x.b.data + img->_x.b.sz - img->_x.b.mem;
+
 	if (fstat(img->_x.fd, &stat)) {
 		pr_perror("Failed to get image stats");
 		return -1;
@@ -8,12 +8,14 @@ struct xbuf {
 	char *mem;	 /* buffer */
 	char *data;	 /* position we see bytes at */
 	unsigned int sz; /* bytes sitting after b->pos */
+	unsigned int size; /* size of the buffer at b->mem */
 	struct bfd_buf *buf;
 };
 
 struct bfd {
 	int fd;
 	bool writable;
+	bool mapped; /* b.mem is the whole image mapped, see image-pack.h */
 	struct xbuf b;
 };
 
@@ -22,6 +24,11 @@ static inline bool bfd_buffered(struct bfd *b)
 	return b->b.mem != NULL;
 }
 
+static inline bool bfd_mapped(struct bfd *b)
+{
+	return bfd_buffered(b) && b->mapped;
+}
+
 static inline void bfd_setraw(struct bfd *b)
 {
 	b->b.mem = NULL;
@@ -29,6 +36,8 @@ static inline void bfd_setraw(struct bfd *b)
 
 int bfdopenr(struct bfd *f);
 int bfdopenw(struct bfd *f);
+int bfdopen_image(struct bfd *f, bool writable);
+void bfdopenm(struct bfd *f, void *data, size_t len);
 void bclose(struct bfd *f);
 char *breadline(struct bfd *f);
 char *breadchr(struct bfd *f, char c);
@@ -36,5 +45,6 @@ int bwrite(struct bfd *f, const void *buf, int sz);
 struct iovec;
 int bwritev(struct bfd *f, const struct iovec *iov, int cnt);
 int bread(struct bfd *f, void *buf, int sz);
+void *bpeek(struct bfd *f, int sz);
 int bfd_flush_images(void);
 #endif
@@ -46,8 +46,12 @@ struct cg_root_opt {
 /*
  * Pre-dump variants
  */
-#define PRE_DUMP_SPLICE 1 /* Pre-dump using parasite */
-#define PRE_DUMP_READ	2 /* Pre-dump using process_vm_readv syscall */
+#define PRE_DUMP_SPLICE	    1 /* Pre-dump using parasite */
+#define PRE_DUMP_READ	    2 /* Pre-dump using process_vm_readv syscall */
+#define PRE_DUMP_READ_BATCH 3 /* Same as PRE_DUMP_READ, with batched parallel reads */
+
+/* Both read modes produce the same images, they only differ in how pages are read */
+#define pre_dump_mode_read(mode) ((mode) == PRE_DUMP_READ || (mode) == PRE_DUMP_READ_BATCH)
 
 /*
  * Cgroup management options.
@@ -78,6 +82,16 @@ enum NETWORK_LOCK_METHOD {
 
 #define DEFAULT_TIMEOUT 10
 
+/*
+ * How long the lazy-pages daemon records faults for the fault profile, ms.
+ */
+#define DEFAULT_FAULT_PROFILE_MS 1000
+
+/*
+ * The maximum number of pre-dump iterations of dump --pre-copy.
+ */
+#define DEFAULT_PRE_COPY_ITERS 5
+
 enum FILE_VALIDATION_OPTIONS {
 	/*
 	 * This constant indicates that the file validation should be tried with the
@@ -125,6 +139,8 @@ enum criu_mode {
 	CR_EXEC_DEPRECATED,
 	CR_SHOW_DEPRECATED,
 	CR_CONVERT,
+	CR_CHECK_IMAGE,
+	CR_COMPACT,
 };
 
 struct cr_options {
@@ -145,6 +161,7 @@ struct cr_options {
 	int link_remap_ok;
 	int log_file_per_pid;
 	int pre_dump_mode;
+	int pre_copy;
 	bool swrk_restore;
 	char *output;
 	char *root;
@@ -159,9 +176,13 @@ struct cr_options {
 	unsigned short port;
 	char *addr;
 	int ps_socket;
+	int ps_streams;
 	int track_mem;
 	char *img_parent;
 	int auto_dedup;
+	int compress_pages;
+	int pack_images;
+	int overlap_dump;
 	unsigned int cpu_cap;
 	int force_irmap;
 	char **exec_cmd;
@@ -189,6 +210,13 @@ struct cr_options {
 	unsigned int empty_ns;
 	int tcp_skip_in_flight;
 	bool lazy_pages;
+	int fault_profile_ms;
+	int lazy_pages_workers;
+	int map_page_images;
+	char *lazy_pages_cache;
+	char *dedup_store;
+	int pages_csum;
+	char *compact_dir;
 	char *work_dir;
 	int network_lock_method;
 	int skip_file_rwx_check;
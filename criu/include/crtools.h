@@ -25,11 +25,35 @@ extern void add_post_prepare_cb(struct pprep_head *);
 extern bool deprecated_ok(char *what);
 extern int cr_dump_tasks(pid_t pid);
 extern int cr_pre_dump_tasks(pid_t pid);
+extern int cr_pre_copy_tasks(pid_t pid);
+
+struct pre_dump_round {
+	unsigned long pages_written;
+	long start_us;
+	long frozen_us;
+	long memdump_us;
+	long memwrite_us;
+};
+
+struct pre_dump_conv {
+	int iter;
+	int max_iters;
+	unsigned long target_ms;
+	struct pre_dump_round prev;
+	/* from the last round */
+	unsigned long dirty_rate;
+	unsigned long projected_ms;
+};
+
+extern void pre_dump_round_stats(struct pre_dump_round *r);
+extern bool pre_dump_converged(struct pre_dump_conv *c, struct pre_dump_round *r);
+
 extern int cr_restore_tasks(void);
 extern int convert_to_elf(char *elf_path, int fd_core);
 extern int cr_check(void);
 extern int check_caps(void);
 extern int cr_dedup(void);
+extern int cr_compact(void);
 extern int cr_lazy_pages(bool daemon);
 
 extern int check_add_feature(char *arg);
@@ -0,0 +1,19 @@
+#ifndef __CR_DEDUP_STORE_H__
+#define __CR_DEDUP_STORE_H__
+
+/*
+ * Content-addressed store of pages shared by many checkpoints.
+ *
+ * The store directory has a "chunks" file with pages and an "index"
+ * file with a { hash, offset } record per page in "chunks". Pages
+ * images are deduplicated against it by sharing the extents of equal
+ * pages with FICLONERANGE, so that they stay self-contained and are
+ * read on restore as usual. New pages are cloned into the store in
+ * the same way. Thus the store and the images must be on one file
+ * system with reflinks, dedup_store_check() makes sure they are.
+ */
+
+extern int dedup_store_check(int dfd);
+extern int dedup_store_images(int dfd);
+
+#endif /* __CR_DEDUP_STORE_H__ */
@@ -78,6 +78,7 @@ enum {
 	CR_FD_BINFMT_MISC,
 	CR_FD_BINFMT_MISC_OLD,
 	CR_FD_PAGES,
+	CR_FD_PAGES_INDEX,
 
 	CR_FD_SIGACT,
 	CR_FD_VMAS,
@@ -89,6 +90,8 @@ enum {
 
 	CR_FD_IRMAP_CACHE,
 	CR_FD_CPUINFO,
+	CR_FD_FAULT_PROFILE,
+	CR_FD_FAULT_PROFILE_TMP,
 
 	CR_FD_SIGNAL,
 	CR_FD_PSIGNAL,
@@ -0,0 +1,69 @@
+#ifndef __CR_IMAGE_PACK_H__
+#define __CR_IMAGE_PACK_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "int.h"
+
+/*
+ * Packed images.
+ *
+ * With --pack-images the dump writes its images into one images.pack
+ * file in the images directory as they are closed, so that a restore
+ * doesn't open, stat and check a file per image:
+ *
+ *	struct image_pack_head
+ *	image data, 8-byte aligned, at least one byte apart
+ *	struct image_pack_entry index[nr_entries], sorted by name
+ *
+ * The images keep their contents, headers and magic included. On
+ * restore the pack is mapped and the buffered images are read right
+ * from the mapping. The pages images are never packed, they are read
+ * with pread, spliced and mapped on their own.
+ */
+
+#define IMAGE_PACK_NAME	   "images.pack"
+#define IMAGE_PACK_MAGIC   0x4b434150 /* PACK */
+#define IMAGE_PACK_VERSION 1
+
+#define IMAGE_PACK_NAME_LEN 64
+
+struct image_pack_head {
+	u32 magic;
+	u32 version;
+	u32 nr_entries;
+	u32 pad;
+	u64 index_off;
+};
+
+struct image_pack_entry {
+	char name[IMAGE_PACK_NAME_LEN];
+	u64 off;
+	u64 len;
+};
+
+extern int image_pack_start(int dfd);
+extern int image_pack_finish(int dfd, bool ok);
+
+/*
+ * Returns 1 and the fd to write the image into if it goes into the pack
+ * being written, 0 if it doesn't and -1 on error. When the image is
+ * closed, image_pack_closing() is called on the fd before it's closed
+ * and image_pack_closed() puts the image into the pack after that.
+ */
+struct pack_image;
+extern int image_pack_create(int dfd, const char *name, int *fd);
+extern struct pack_image *image_pack_closing(int fd);
+extern void image_pack_closed(struct pack_image *pi);
+
+/*
+ * Returns 1 and the image contents if dfd has a pack with the image,
+ * 0 if it has no pack or no such image in it, -1 on error.
+ */
+extern int image_pack_lookup(int dfd, const char *name, void **data, size_t *len);
+
+/* Calls cb for every image in the pack of dfd, if there's one */
+extern int image_pack_for_each(int dfd, int (*cb)(const char *name, void *data, size_t len, void *arg), void *arg);
+
+#endif /* __CR_IMAGE_PACK_H__ */
@@ -85,6 +85,8 @@ struct kerndat_s {
 	bool has_ptrace_get_rseq_conf;
 	struct __ptrace_rseq_configuration libc_rseq_conf;
 	bool has_ipv6_freebind;
+	bool has_pagemap_scan;
+	bool has_uffd_wp_async;
 };
 
 extern struct kerndat_s kdat;
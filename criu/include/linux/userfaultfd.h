@@ -37,8 +37,9 @@
 #define _UFFDIO_UNREGISTER (0x01)
 #define _UFFDIO_WAKE	   (0x02)
 #define _UFFDIO_COPY	   (0x03)
-#define _UFFDIO_ZEROPAGE   (0x04)
-#define _UFFDIO_API	   (0x3F)
+#define _UFFDIO_ZEROPAGE     (0x04)
+#define _UFFDIO_WRITEPROTECT (0x06)
+#define _UFFDIO_API	     (0x3F)
 
 /* userfaultfd ioctl ids */
 #define UFFDIO		  0xAA
@@ -48,6 +49,7 @@
 #define UFFDIO_WAKE	  _IOR(UFFDIO, _UFFDIO_WAKE, struct uffdio_range)
 #define UFFDIO_COPY	  _IOWR(UFFDIO, _UFFDIO_COPY, struct uffdio_copy)
 #define UFFDIO_ZEROPAGE	  _IOWR(UFFDIO, _UFFDIO_ZEROPAGE, struct uffdio_zeropage)
+#define UFFDIO_WRITEPROTECT _IOWR(UFFDIO, _UFFDIO_WRITEPROTECT, struct uffdio_writeprotect)
 
 /* read() structure */
 struct uffd_msg {
@@ -144,6 +146,11 @@ struct uffdio_api {
 #define UFFD_FEATURE_MISSING_HUGETLBFS (1 << 4)
 #define UFFD_FEATURE_MISSING_SHMEM     (1 << 5)
 #define UFFD_FEATURE_EVENT_UNMAP       (1 << 6)
+	/*
+	 * UFFD_FEATURE_WP_ASYNC makes the kernel resolve the write-protect
+	 * faults by itself, the written pages are then seen via pagemap.
+	 */
+#define UFFD_FEATURE_WP_ASYNC (1 << 15)
 	__u64 features;
 
 	__u64 ioctls;
@@ -199,4 +206,14 @@ struct uffdio_zeropage {
 	__s64 zeropage;
 };
 
+struct uffdio_writeprotect {
+	struct uffdio_range range;
+#define UFFDIO_WRITEPROTECT_MODE_WP	  ((__u64)1 << 0)
+#define UFFDIO_WRITEPROTECT_MODE_DONTWAKE ((__u64)1 << 1)
+	__u64 mode;
+};
+
+/* Flags for userfaultfd(2) */
+#define UFFD_USER_MODE_ONLY 1
+
 #endif /* _LINUX_USERFAULTFD_H */
@@ -100,6 +100,8 @@
 #define BPFMAP_FILE_MAGIC    0x57506142 /* Alapayevsk */
 #define BPFMAP_DATA_MAGIC    0x64324033 /* Arkhangelsk */
 #define APPARMOR_MAGIC	     0x59423047 /* Nikolskoye */
+#define PAGES_INDEX_MAGIC    0x55218605 /* Kemerovo */
+#define FAULT_PROFILE_MAGIC  0x57226431 /* Tobolsk */
 
 #define IFADDR_MAGIC	RAW_IMAGE_MAGIC
 #define ROUTE_MAGIC	RAW_IMAGE_MAGIC
@@ -0,0 +1,30 @@
+#ifndef __CR_MEM_TRACK_H__
+#define __CR_MEM_TRACK_H__
+
+#include <sys/types.h>
+
+/*
+ * Write-protect memory tracking.
+ *
+ * Soft-dirty tracking is reset via clear_refs, which write-protects the
+ * whole mm. When the kernel has async userfaultfd write-protection the
+ * pre-dump rounds of --pre-copy and of the RPC converging dump register
+ * the private VMAs with a userfaultfd instead, the kernel un-protects
+ * the pages on write by itself and PAGEMAP_SCAN reports them as written.
+ *
+ * The userfaultfd only tracks while it's open, so the loop keeps them
+ * queued in a socket it creates before forking the rounds. Each round
+ * picks them up and queues back the ones of the tasks it dumped. Tasks
+ * without one fall back to soft-dirty.
+ */
+
+struct parasite_ctl;
+struct vm_area_list;
+
+extern int mem_track_init(void);
+extern void mem_track_fini(void);
+
+extern int mem_track_wp(pid_t pid);
+extern int mem_track_reset(pid_t pid, struct parasite_ctl *ctl, struct vm_area_list *vmas);
+
+#endif /* __CR_MEM_TRACK_H__ */
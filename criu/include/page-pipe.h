@@ -21,6 +21,12 @@ struct kernel_pipe_buffer {
  */
 #define PIPE_MAX_SIZE ((1 << PAGE_ALLOC_COSTLY_ORDER) * PAGE_SIZE / sizeof(struct kernel_pipe_buffer))
 
+/*
+ * Pipes grow above PIPE_MAX_SIZE only if the kernel lets us, and never
+ * above that.
+ */
+#define PIPE_SIZE_HARD_MAX (8 * PIPE_MAX_SIZE)
+
 /* The number of pipes for one chunk */
 #define NR_PIPES_PER_CHUNK 8
 
@@ -135,6 +141,7 @@ struct page_pipe {
 
 struct page_pipe *create_page_pipe(unsigned int nr_segs, struct iovec *iovs, unsigned flags);
 extern void destroy_page_pipe(struct page_pipe *p);
+extern int page_pipe_pool_fill(void);
 extern int page_pipe_add_page(struct page_pipe *p, unsigned long addr, unsigned int flags);
 extern int page_pipe_add_hole(struct page_pipe *pp, unsigned long addr, unsigned int flags);
 
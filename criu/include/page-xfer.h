@@ -12,6 +12,8 @@ extern int cr_page_server(bool daemon_mode, bool lazy_dump, int cfd);
 /* User buffer for read-mode pre-dump*/
 #define PIPE_MAX_BUFFER_SIZE (PIPE_MAX_SIZE << PAGE_SHIFT)
 
+struct pages_comp_writer;
+
 /*
  * page_xfer -- transfer pages into image file.
  * Two images backends are implemented -- local image file
@@ -23,7 +25,7 @@ struct page_xfer {
 	int (*write_pagemap)(struct page_xfer *self, struct iovec *iov, u32 flags);
 	/* transfers pages related to previous pagemap */
 	int (*write_pages)(struct page_xfer *self, int pipe, unsigned long len);
-	void (*close)(struct page_xfer *self);
+	int (*close)(struct page_xfer *self);
 
 	/*
 	 * In case we need to dump pagemaps not as-is, but
@@ -37,17 +39,23 @@ struct page_xfer {
 		struct /* local */ {
 			struct cr_img *pmi; /* pagemaps */
 			struct cr_img *pi;  /* pages */
+			struct pages_comp_writer *comp;
+			struct pages_csum_writer *csum;
 		};
 
 		struct /* page-server */ {
 			int sk;
 			u64 dst_id;
+			int stripe; /* carries the pages of the last entry */
 		};
 	};
 
 	struct page_read *parent;
 };
 
+/* Limit for --ps-streams */
+#define PS_MAX_STREAMS 16
+
 extern int open_page_xfer(struct page_xfer *xfer, int fd_type, unsigned long id);
 struct page_pipe;
 extern int page_xfer_dump_pages(struct page_xfer *, struct page_pipe *);
@@ -66,12 +74,15 @@ extern int check_parent_page_xfer(int fd_type, unsigned long id);
      pid) or PS_IOV_ADD(0, 0, 0) if it failed to locate the required
      pages
  * - dump-side page server sends the raw page data
+ * Many requests can be in flight. The server answers those marked as
+ * urgent first, so lazy-pages matches answers by the (pid, vaddr) pair.
  */
 
 /* async request/receive of remote pages */
-extern int request_remote_pages(unsigned long img_id, unsigned long addr, int nr_pages);
+extern int request_remote_pages(unsigned long img_id, unsigned long addr, int nr_pages, unsigned flags);
 
 typedef int (*ps_async_read_complete)(unsigned long img_id, unsigned long vaddr, int nr_pages, void *);
-extern int page_server_start_read(void *buf, int nr_pages, ps_async_read_complete complete, void *priv, unsigned flags);
+extern int page_server_start_read(unsigned long img_id, unsigned long vaddr, void *buf, int nr_pages,
+				  ps_async_read_complete complete, void *priv, unsigned flags);
 
 #endif /* __CR_PAGE_XFER__H__ */
@@ -2,11 +2,21 @@
 #define __CR_PAGEMAP_H__
 
 #include <sys/types.h>
+#include <stdbool.h>
 #include "int.h"
 
 #include "common/list.h"
 
 struct vma_area;
+struct page_region;
+
+/*
+ * What we ask PAGEMAP_SCAN about, enough to build the pagemap
+ * entries generate_iovs() looks at.
+ */
+#define PMC_SCAN_CATEGORIES                                                                     \
+	(PAGE_IS_PRESENT | PAGE_IS_SWAPPED | PAGE_IS_FILE | PAGE_IS_PFNZERO | PAGE_IS_SOFT_DIRTY | \
+	 PAGE_IS_WRITTEN)
 
 #define PAGEMAP_PFN_OFF(addr) (PAGE_PFN(addr) * sizeof(u64))
 
@@ -17,6 +27,8 @@ typedef struct {
 	const struct list_head *vma_head; /* list head of VMAs we're serving */
 	u64 *map;			  /* local buffer */
 	size_t map_len;			  /* length of a buffer */
+	struct page_region *regs;	  /* PAGEMAP_SCAN output, NULL if the ioctl isn't used */
+	bool wp;			  /* dirty are the pages written since write-protected */
 	int fd;				  /* file to read PMs from */
 } pmc_t;
 
@@ -6,6 +6,8 @@
 #include "page.h"
 #include "cr-convert.h"
 
+struct pages_comp_reader;
+
 /*
  * page_read -- engine, that reads pages from image file(s)
  *
@@ -63,6 +65,11 @@ struct page_read {
 	struct cr_img *pmi;
 	struct cr_img *pi;
 	u32 pages_img_id;
+	struct pages_comp_reader *comp; /* set if pages image is compressed */
+	struct pages_cache *cache;	/* local copy of remote pages, see pages-cache.h */
+	bool mapped;			/* pages image is mapped at pi_map */
+	void *pi_map;
+	size_t pi_map_len;
 
 	PagemapEntry *pe;	  /* current pagemap we are on */
 	struct page_read *parent; /* parent pagemap (if ->in_parent pagemap is met in image,
@@ -79,11 +86,16 @@ struct page_read {
 	int curr_pme;
 
 	struct list_head async;
+
+	/* remote reads in flight and cache hits held till they land, see maybe_read_page_cached */
+	int nr_remote;
+	struct list_head cache_held;
 };
 
 /* flags for ->read_pages */
-#define PR_ASYNC 0x1 /* may exit w/o data in the buffer */
-#define PR_ASAP	 0x2 /* PR_ASYNC, but start the IO right now */
+#define PR_ASYNC  0x1 /* may exit w/o data in the buffer */
+#define PR_ASAP	  0x2 /* PR_ASYNC, but start the IO right now */
+#define PR_URGENT 0x4 /* someone waits for the data, e.g. a #PF */
 
 /* flags for open_page_read */
 #define PR_SHMEM 0x1
@@ -92,6 +104,7 @@ struct page_read {
 #define PR_TYPE_MASK 0x3
 #define PR_MOD	     0x4 /* Will need to modify */
 #define PR_REMOTE    0x8
+#define PR_MMAP	     0x10 /* Map the pages image, see pagemap_map_pages() */
 
 /*
  * -1 -- error
@@ -116,6 +129,9 @@ extern void dup_page_read(struct page_read *src, struct page_read *dst);
 
 extern int dedup_one_iovec(struct page_read *pr, unsigned long base, unsigned long len);
 
+extern int pagemap_map_pages(struct page_read *pr, unsigned long vaddr, int *nr, void **src);
+extern struct page_read *pagemap_locate_pages(struct page_read *pr, unsigned long vaddr, int *nr);
+
 static inline unsigned long pagemap_len(PagemapEntry *pe)
 {
 	return pe->nr_pages * PAGE_SIZE;
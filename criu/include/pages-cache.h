@@ -0,0 +1,28 @@
+#ifndef __CR_PAGES_CACHE_H__
+#define __CR_PAGES_CACHE_H__
+
+#include <stdbool.h>
+#include <sys/types.h>
+
+/*
+ * Local cache of the pages fetched from a page server.
+ *
+ * For every remote page_read the cache keeps a sparse copy of the
+ * pages-N.img the page server reads from, laid out the same way the
+ * local pagemap describes it, and a bitmap of the pages that are
+ * already there. The files are named after the dump id from the
+ * inventory, the pagemap id and a checksum of the pagemap entries, so
+ * a restore of the same checkpoint on the same host finds them and
+ * reads the pages from the local disk instead of the network.
+ */
+
+struct page_read;
+struct pages_cache;
+
+extern int pages_cache_open(int dfd, struct page_read *pr);
+extern bool pages_cache_has(struct pages_cache *c, off_t off, unsigned long len);
+extern int pages_cache_read(struct pages_cache *c, void *buf, unsigned long len, off_t off);
+extern void pages_cache_store(struct pages_cache *c, void *buf, unsigned long len, off_t off);
+extern void pages_cache_close(struct pages_cache *c);
+
+#endif /* __CR_PAGES_CACHE_H__ */
@@ -0,0 +1,39 @@
+#ifndef __CR_PAGES_COMP_H__
+#define __CR_PAGES_COMP_H__
+
+#include <stdbool.h>
+
+#include "int.h"
+
+/*
+ * Compressed pages images.
+ *
+ * With compression the pages-N.img file is a sequence of independently
+ * compressed blocks. Each block holds PAGES_COMP_BLOCK_SIZE bytes of the
+ * raw pages stream (the last one may be shorter). Offsets and lengths of
+ * the blocks live in the pages-index-N.img image, so a reader can find
+ * the block for any raw offset and decompress only that one.
+ *
+ * The algorithm is recorded in pagemap_head.comp_algo.
+ */
+
+#define PAGES_COMP_NONE 0
+#define PAGES_COMP_ZSTD 1
+
+#define PAGES_COMP_BLOCK_SIZE (64 * PAGE_SIZE)
+
+struct pages_comp_writer;
+struct pages_comp_reader;
+
+extern bool pages_comp_supported(void);
+
+extern struct pages_comp_writer *pages_comp_writer_open(int fd, u32 pages_id);
+extern int pages_comp_write(struct pages_comp_writer *w, int pipe, unsigned long len);
+extern int pages_comp_write_buf(struct pages_comp_writer *w, const void *buf, unsigned long len);
+extern int pages_comp_writer_close(struct pages_comp_writer *w);
+
+extern struct pages_comp_reader *pages_comp_reader_open(int dfd, int fd, u32 pages_id, u32 algo);
+extern int pages_comp_read(struct pages_comp_reader *r, void *buf, unsigned long len, off_t off);
+extern void pages_comp_reader_close(struct pages_comp_reader *r);
+
+#endif /* __CR_PAGES_COMP_H__ */
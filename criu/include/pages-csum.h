@@ -0,0 +1,34 @@
+#ifndef __CR_PAGES_CSUM_H__
+#define __CR_PAGES_CSUM_H__
+
+#include "int.h"
+
+#include "images/pagemap.pb-c.h"
+
+/*
+ * Pages checksums.
+ *
+ * With --pages-csum the dump computes the crc32c of every page as it
+ * writes it into the pages image and stores them in the csum array of
+ * the pagemap entry the page belongs to (so the entry is written after
+ * its pages). The checksums are of the raw pages, compressed images are
+ * checked after decompression. Restore and convert check the images in
+ * a background thread and fail before the tasks are resumed if they
+ * don't match. The check-image command checks a whole images directory.
+ */
+
+struct cr_img;
+struct pages_comp_writer;
+struct pages_csum_writer;
+
+extern struct pages_csum_writer *pages_csum_writer_open(struct cr_img *pmi, int fd, struct pages_comp_writer *comp);
+extern int pages_csum_entry(struct pages_csum_writer *w, PagemapEntry *pe);
+extern int pages_csum_write(struct pages_csum_writer *w, int pipe, unsigned long len);
+extern int pages_csum_writer_close(struct pages_csum_writer *w);
+
+extern int pages_csum_verify(int dfd);
+
+extern int pages_csum_verify_start(int dfd);
+extern int pages_csum_verify_wait(void);
+
+#endif /* __CR_PAGES_CSUM_H__ */
@@ -38,6 +38,7 @@ extern int dump_thread_core(int pid, CoreEntry *core, const struct parasite_dump
 extern int parasite_drain_fds_seized(struct parasite_ctl *ctl, struct parasite_drain_fd *dfds, int nr_fds, int off,
 				     int *lfds, struct fd_opts *flags);
 extern int parasite_get_proc_fd_seized(struct parasite_ctl *ctl);
+extern int parasite_get_uffd_seized(struct parasite_ctl *ctl);
 
 extern struct parasite_ctl *parasite_infect_seized(pid_t pid, struct pstree_item *item,
 						   struct vm_area_list *vma_area_list);
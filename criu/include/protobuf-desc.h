@@ -70,6 +70,8 @@ enum {
 	PB_BPFMAP_FILE,
 	PB_BPFMAP_DATA,
 	PB_APPARMOR,
+	PB_PAGES_BLOCK,
+	PB_FAULT_PROFILE,
 
 	/* PB_AUTOGEN_STOP */
 
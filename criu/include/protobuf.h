@@ -35,6 +35,7 @@ struct collect_image_info {
 #define COLLECT_SHARED	 0x1 /* use shared memory for obj-s */
 #define COLLECT_NOFREE	 0x2 /* don't free entry after callback */
 #define COLLECT_HAPPENED 0x4 /* image was opened and collected */
+#define COLLECT_ARENA	 0x8 /* entries and obj-s are never freed, put them into an arena */
 
 extern int collect_image(struct collect_image_info *);
 extern int collect_entry(ProtobufCMessage *base, struct collect_image_info *cinfo);
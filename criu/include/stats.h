@@ -28,6 +28,7 @@ extern const char* RESTORE_TIME_MAP [RESTORE_TIME_NS_STATS];
 
 extern void timing_start(int t);
 extern void timing_stop(int t);
+extern void timing_add_us(int t, long us);
 
 enum {
 	CNT_PAGES_SCANNED,
@@ -54,6 +55,8 @@ enum {
 
 extern void cnt_add(int c, unsigned long val);
 extern void cnt_sub(int c, unsigned long val);
+extern unsigned long dump_cnt(int c);
+extern long dump_time_us(int t);
 
 #define DUMP_STATS    1
 #define RESTORE_STATS 2
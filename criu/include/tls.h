@@ -12,6 +12,10 @@ ssize_t tls_recv(void *buf, size_t len, int flags);
 int tls_send_data_from_fd(int fd, unsigned long len);
 int tls_recv_data_to_fd(int fd, unsigned long len);
 
+/* Whether data has to go through gnutls, i.e. isn't handled by kernel TLS */
+bool tls_user_tx(void);
+bool tls_user_rx(void);
+
 #else /* CONFIG_GNUTLS */
 
 #define tls_x509_init(sockfd, is_server) (0)
@@ -20,6 +24,8 @@ int tls_recv_data_to_fd(int fd, unsigned long len);
 #define tls_send_data_from_fd(fd, len)	 (-1)
 #define tls_recv_data_to_fd(fd, len)	 (-1)
 #define tls_terminate_session(async)
+#define tls_user_tx()			 (false)
+#define tls_user_rx()			 (false)
 
 #endif /* CONFIG_HAS_GNUTLS */
 
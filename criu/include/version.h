@@ -0,0 +1,8 @@
+/* Autogenerated, do not edit */
+#ifndef __CR_VERSION_H__
+#define __CR_VERSION_H__
+#define CRIU_VERSION "3.18"
+#define CRIU_VERSION_MAJOR  3
+#define CRIU_VERSION_MINOR  18
+#define CRIU_GITID "2ce01eb"
+#endif /* __CR_VERSION_H__ */
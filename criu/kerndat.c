@@ -45,6 +45,8 @@
 #include "netfilter.h"
 #include "fsnotify.h"
 #include "linux/userfaultfd.h"
+#include "linux/pagemap-scan.h"
+#include "pagemap-cache.h"
 #include "prctl.h"
 #include "uffd.h"
 #include "vdso.h"
@@ -375,6 +377,61 @@ int kerndat_fs_virtualized(unsigned int which, u32 kdev)
  * this functionality under CONFIG_MEM_SOFT_DIRTY option.
  */
 
+/*
+ * PAGEMAP_SCAN (v6.7) reports the pages state in ranges rather than a
+ * u64 per page. Check it knows all the categories the pagemap cache
+ * asks for.
+ */
+static int kerndat_has_pagemap_scan(void)
+{
+	struct page_region reg = {};
+	struct pm_scan_arg arg = {};
+	char *map;
+	int fd, ret;
+
+	if (kdat.pmap == PM_DISABLED)
+		return 0;
+
+	map = mmap(NULL, PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (map == MAP_FAILED) {
+		pr_perror("Can't mmap memory for PAGEMAP_SCAN test");
+		return -1;
+	}
+	map[0] = 1;
+
+	fd = open_proc(PROC_SELF, "pagemap");
+	if (fd < 0) {
+		munmap(map, PAGE_SIZE);
+		return -1;
+	}
+
+	arg.size = sizeof(arg);
+	arg.start = (unsigned long)map;
+	arg.end = (unsigned long)map + PAGE_SIZE;
+	arg.vec = (unsigned long)&reg;
+	arg.vec_len = 1;
+	arg.category_anyof_mask = PAGE_IS_PRESENT | PAGE_IS_SWAPPED;
+	arg.return_mask = PMC_SCAN_CATEGORIES;
+
+	ret = ioctl(fd, PAGEMAP_SCAN, &arg);
+	if (ret < 0) {
+		if (errno != ENOTTY && errno != EINVAL) {
+			pr_perror("PAGEMAP_SCAN failed");
+			goto out;
+		}
+		ret = 0;
+	} else {
+		kdat.has_pagemap_scan = ret == 1 && (reg.categories & PAGE_IS_PRESENT);
+		ret = 0;
+	}
+
+	pr_info("PAGEMAP_SCAN is %ssupported\n", kdat.has_pagemap_scan ? "" : "not ");
+out:
+	close(fd);
+	munmap(map, PAGE_SIZE);
+	return ret;
+}
+
 static int kerndat_get_dirty_track(void)
 {
 	char *map;
@@ -1361,6 +1418,13 @@ static int kerndat_uffd(void)
 
 	kdat.has_uffd = true;
 
+	/*
+	 * The pages written since the write-protection was set are found
+	 * with PAGEMAP_SCAN, so the tracking needs both.
+	 */
+	kdat.has_uffd_wp_async = kdat.has_pagemap_scan && (kdat.uffd_features & UFFD_FEATURE_WP_ASYNC);
+	pr_info("Async write-protect tracking is %ssupported\n", kdat.has_uffd_wp_async ? "" : "not ");
+
 	/*
 	 * we have to close the uffd and reopen in later in restorer
 	 * to enable non-cooperative features
@@ -1798,6 +1862,10 @@ int kerndat_init(void)
 		pr_err("kerndat_get_dirty_track failed when initializing kerndat.\n");
 		ret = -1;
 	}
+	if (!ret && kerndat_has_pagemap_scan()) {
+		pr_err("kerndat_has_pagemap_scan failed when initializing kerndat.\n");
+		ret = -1;
+	}
 	if (!ret && init_zero_page_pfn()) {
 		pr_err("init_zero_page_pfn failed when initializing kerndat.\n");
 		ret = -1;
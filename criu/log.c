@@ -5,6 +5,7 @@
 #include <unistd.h>
 #include <stdbool.h>
 #include <limits.h>
+#include <pthread.h>
 
 #include <sys/types.h>
 #include <sys/time.h>
@@ -37,6 +38,14 @@ static void vprint_on_level(unsigned int, const char *, va_list);
 
 static char buffer[LOG_BUF_LEN];
 static char buf_off = 0;
+/*
+ * The buffer above is shared with helper threads, e.g. the one
+ * writing pages during the overlapped dump, so messages are
+ * serialized. The lock is held across fork() not to leave the
+ * child with it taken. It's recursive for the sake of signal
+ * handlers that print messages.
+ */
+static pthread_mutex_t buffer_lock = PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP;
 /*
  * The early_log_buffer is used to store log messages before
  * logging is set up to make sure no logs are lost.
@@ -353,6 +362,7 @@ static void vprint_on_level(unsigned int loglevel, const char *format, va_list p
 
 	if (unlikely(loglevel == LOG_MSG)) {
 		fd = STDOUT_FILENO;
+		pthread_mutex_lock(&buffer_lock);
 		off = buf_off; /* skip dangling timestamp */
 	} else {
 		/*
@@ -366,6 +376,7 @@ static void vprint_on_level(unsigned int loglevel, const char *format, va_list p
 		if (loglevel > current_loglevel)
 			return;
 		fd = log_get_fd();
+		pthread_mutex_lock(&buffer_lock);
 		if (current_loglevel >= LOG_TIMESTAMP)
 			print_ts();
 	}
@@ -384,9 +395,25 @@ static void vprint_on_level(unsigned int loglevel, const char *format, va_list p
 	if (loglevel == LOG_ERROR)
 		log_note_err(buffer + buf_off);
 
+	pthread_mutex_unlock(&buffer_lock);
 	errno = _errno;
 }
 
+static void log_lock_buffer(void)
+{
+	pthread_mutex_lock(&buffer_lock);
+}
+
+static void log_unlock_buffer(void)
+{
+	pthread_mutex_unlock(&buffer_lock);
+}
+
+static void __attribute__((constructor)) log_init_lock(void)
+{
+	pthread_atfork(log_lock_buffer, log_unlock_buffer, log_unlock_buffer);
+}
+
 void print_on_level(unsigned int loglevel, const char *format, ...)
 {
 	va_list params;
@@ -0,0 +1,236 @@
+#include <sys/socket.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+#include <limits.h>
+#include <errno.h>
+
+#include "common/compiler.h"
+#include "linux/userfaultfd.h"
+#include "common/scm.h"
+#include "common/list.h"
+#include "kerndat.h"
+#include "log.h"
+#include "util.h"
+#include "vma.h"
+#include "sockets.h"
+#include "parasite-syscall.h"
+#include "mem-track.h"
+
+#undef LOG_PREFIX
+#define LOG_PREFIX "mem-track: "
+
+struct wp_entry {
+	pid_t pid;
+	int uffd;
+	struct hlist_node hash;
+};
+
+/* [0] queues the descriptors, [1] gets them back */
+static int wp_sk[2] = { -1, -1 };
+static bool wp_collected;
+#define WP_HASH_SIZE 32
+static struct hlist_head wp_hash[WP_HASH_SIZE];
+
+int mem_track_init(void)
+{
+	/* In kernel a bufsize has type int and a value is doubled. */
+	uint32_t buf[2] = { INT_MAX / 2, INT_MAX / 2 };
+
+	if (socketpair(AF_UNIX, SOCK_DGRAM | SOCK_CLOEXEC, 0, wp_sk)) {
+		pr_perror("Can't create tracking store");
+		return -1;
+	}
+
+	if (sk_setbufs(wp_sk[0], buf) || sk_setbufs(wp_sk[1], buf)) {
+		mem_track_fini();
+		return -1;
+	}
+
+	return 0;
+}
+
+void mem_track_fini(void)
+{
+	struct wp_entry *we;
+	struct hlist_node *tmp;
+	int i;
+
+	for (i = 0; i < WP_HASH_SIZE; i++) {
+		hlist_for_each_entry_safe(we, tmp, &wp_hash[i], hash) {
+			close(we->uffd);
+			xfree(we);
+		}
+		INIT_HLIST_HEAD(&wp_hash[i]);
+	}
+
+	close_safe(&wp_sk[0]);
+	close_safe(&wp_sk[1]);
+	wp_collected = false;
+}
+
+static bool wp_enabled(void)
+{
+	return wp_sk[0] >= 0 && kdat.has_uffd_wp_async;
+}
+
+/* Take the descriptors the previous round has queued */
+static int wp_collect(void)
+{
+	struct wp_entry *we;
+	int ret;
+
+	if (wp_collected)
+		return 0;
+
+	while (1) {
+		we = xmalloc(sizeof(*we));
+		if (!we)
+			return -1;
+
+		ret = __recv_fds(wp_sk[1], &we->uffd, 1, &we->pid, sizeof(we->pid), MSG_DONTWAIT);
+		if (ret == -EAGAIN || ret == -EWOULDBLOCK) {
+			xfree(we);
+			break;
+		} else if (ret) {
+			pr_perror("Can't read tracking store");
+			xfree(we);
+			return -1;
+		}
+
+		hlist_add_head(&we->hash, &wp_hash[we->pid % WP_HASH_SIZE]);
+	}
+
+	wp_collected = true;
+	return 0;
+}
+
+static struct wp_entry *wp_find(pid_t pid)
+{
+	struct wp_entry *we;
+
+	hlist_for_each_entry(we, &wp_hash[pid % WP_HASH_SIZE], hash)
+		if (we->pid == pid)
+			return we;
+
+	return NULL;
+}
+
+/*
+ * 1 - the pages are write-protected since the previous round
+ * 0 - soft-dirty is used for the task
+ * -1 - error
+ */
+int mem_track_wp(pid_t pid)
+{
+	if (!wp_enabled())
+		return 0;
+
+	if (wp_collect())
+		return -1;
+
+	return wp_find(pid) ? 1 : 0;
+}
+
+/*
+ * Register the private VMAs (the ones already registered are kept) and
+ * write-protect them. The VMAs that can't be registered are always seen
+ * as written. When none can, the userfaultfd is of the mm the task had
+ * before exec or of a task that had its pid, and 1 is returned.
+ */
+static int wp_protect(pid_t pid, int uffd, struct vm_area_list *vmas)
+{
+	unsigned long nr = 0, nr_reg = 0;
+	struct vma_area *vma;
+
+	list_for_each_entry(vma, &vmas->h, list) {
+		struct uffdio_register reg = {
+			.range.start = vma->e->start,
+			.range.len = vma_area_len(vma),
+			.mode = UFFDIO_REGISTER_MODE_WP,
+		};
+		struct uffdio_writeprotect wp = {
+			.range = reg.range,
+			.mode = UFFDIO_WRITEPROTECT_MODE_WP,
+		};
+
+		if (!vma_area_is_private(vma, kdat.task_size) || vma_area_is(vma, VMA_AREA_VDSO) ||
+		    vma_area_is(vma, VMA_AREA_VVAR))
+			continue;
+
+		nr++;
+		if (ioctl(uffd, UFFDIO_REGISTER, &reg)) {
+			pr_debug("Can't register %d's %lx-%lx: %m\n", pid, (long)vma->e->start, (long)vma->e->end);
+			continue;
+		}
+
+		if (ioctl(uffd, UFFDIO_WRITEPROTECT, &wp)) {
+			pr_perror("Can't write-protect %d's %lx-%lx", pid, (long)vma->e->start, (long)vma->e->end);
+			return -1;
+		}
+		nr_reg++;
+	}
+
+	pr_info("Write-protected %lu of %lu %d's VMAs\n", nr_reg, nr, pid);
+	return nr && !nr_reg ? 1 : 0;
+}
+
+/*
+ * 1 - the task isn't tracked this way, reset soft-dirty
+ * 0 - the pages are write-protected
+ * -1 - error
+ */
+int mem_track_reset(pid_t pid, struct parasite_ctl *ctl, struct vm_area_list *vmas)
+{
+	struct wp_entry *we;
+	int ret;
+
+	if (!wp_enabled())
+		return 1;
+
+	if (wp_collect())
+		return -1;
+
+	we = wp_find(pid);
+	if (we) {
+		ret = wp_protect(pid, we->uffd, vmas);
+		if (ret < 0)
+			return -1;
+		if (ret) {
+			pr_info("The %d's userfaultfd is stale, making a new one\n", pid);
+			hlist_del(&we->hash);
+			close(we->uffd);
+			xfree(we);
+			we = NULL;
+		}
+	}
+
+	if (!we) {
+		we = xmalloc(sizeof(*we));
+		if (!we)
+			return -1;
+
+		we->pid = pid;
+		we->uffd = parasite_get_uffd_seized(ctl);
+		if (we->uffd < 0) {
+			xfree(we);
+			return -1;
+		}
+
+		ret = wp_protect(pid, we->uffd, vmas);
+		if (ret) {
+			close(we->uffd);
+			xfree(we);
+			return ret;
+		}
+
+		hlist_add_head(&we->hash, &wp_hash[pid % WP_HASH_SIZE]);
+	}
+
+	/* Keep it for the next round */
+	if (send_fds(wp_sk[0], NULL, 0, &we->uffd, 1, &pid, sizeof(pid))) {
+		pr_perror("Can't queue %d's userfaultfd", pid);
+		return -1;
+	}
+
+	return 0;
+}
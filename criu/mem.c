@@ -6,6 +6,7 @@
 #include <fcntl.h>
 #include <sys/syscall.h>
 #include <sys/prctl.h>
+#include <pthread.h>
 
 #include "types.h"
 #include "cr_options.h"
@@ -32,18 +33,26 @@
 #include "prctl.h"
 #include "compel/infect-util.h"
 #include "pidfd-store.h"
+#include "mem-track.h"
 #include "pseudo_mm.h"
 
 #include "protobuf.h"
 #include "images/pagemap.pb-c.h"
 
-static int task_reset_dirty_track(int pid)
+static int task_reset_dirty_track(int pid, struct parasite_ctl *ctl, struct vm_area_list *vmas, bool pre_dump)
 {
 	int ret;
 
 	if (!opts.track_mem)
 		return 0;
 
+	/* The final dump leaves soft-dirty for whoever dumps the task next */
+	if (pre_dump) {
+		ret = mem_track_reset(pid, ctl, vmas);
+		if (ret <= 0)
+			return ret;
+	}
+
 	BUG_ON(!kdat.has_dirty_track);
 
 	ret = do_task_reset_dirty_track(pid);
@@ -404,7 +413,7 @@ static int generate_vma_iovs(struct pstree_item *item, struct vma_area *vma, str
 	 */
 
 	if (!(vma->e->prot & PROT_READ)) {
-		if (opts.pre_dump_mode == PRE_DUMP_READ && pre_dump)
+		if (pre_dump_mode_read(opts.pre_dump_mode) && pre_dump)
 			return 0;
 		if ((parent_predump_mode == PRE_DUMP_READ && opts.pre_dump_mode == PRE_DUMP_SPLICE) || !pre_dump)
 			has_parent = false;
@@ -447,6 +456,172 @@ again:
 	return ret;
 }
 
+/*
+ * Overlapped memory dump.
+ *
+ * On regular dump pages are normally written into images right after
+ * they are drained from the task and the next dump steps wait for that.
+ * With --overlap-dump the drained page pipe is handed over to a writer
+ * thread instead, and the main thread goes on collecting the rest of
+ * the task's state and the next tasks while the pages drain. All the
+ * tasks stay frozen until the writer is done, so the pipes contents
+ * stays consistent.
+ */
+struct mem_write_job {
+	struct list_head l;
+	int pid;
+	struct page_pipe *pp;
+	struct page_xfer xfer;
+};
+
+/* Don't keep too many drained tasks (and their pipes) in memory */
+#define MEM_WRITER_MAX_JOBS 4
+
+static struct {
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+	struct list_head jobs;
+	int nr_jobs;
+	bool busy;
+	bool started;
+	bool stop;
+	int ret;
+	long write_us; /* accounted by the main thread when the writer is done */
+	pthread_t thread;
+} mem_writer = {
+	.lock = PTHREAD_MUTEX_INITIALIZER,
+	.cond = PTHREAD_COND_INITIALIZER,
+	.jobs = LIST_HEAD_INIT(mem_writer.jobs),
+};
+
+static void *mem_writer_fn(void *arg)
+{
+	struct mem_write_job *job;
+	long write_us;
+	int ret;
+
+	while (1) {
+		pthread_mutex_lock(&mem_writer.lock);
+		mem_writer.busy = false;
+		pthread_cond_broadcast(&mem_writer.cond);
+		while (list_empty(&mem_writer.jobs) && !mem_writer.stop)
+			pthread_cond_wait(&mem_writer.cond, &mem_writer.lock);
+		if (list_empty(&mem_writer.jobs)) {
+			pthread_mutex_unlock(&mem_writer.lock);
+			break;
+		}
+
+		job = list_first_entry(&mem_writer.jobs, struct mem_write_job, l);
+		list_del(&job->l);
+		mem_writer.busy = true;
+		ret = mem_writer.ret;
+		pthread_mutex_unlock(&mem_writer.lock);
+
+		/* After a failure the rest of the jobs are only cleaned up */
+		write_us = 0;
+		if (!ret) {
+			struct timeval start, end;
+
+			pr_debug("Writing pages of %d in background\n", job->pid);
+			gettimeofday(&start, NULL);
+			ret = page_xfer_dump_pages(&job->xfer, job->pp);
+			gettimeofday(&end, NULL);
+			write_us = timeval_to_us(&end) - timeval_to_us(&start);
+		}
+		if (job->xfer.close(&job->xfer))
+			ret = -1;
+		destroy_page_pipe(job->pp);
+		xfree(job);
+
+		pthread_mutex_lock(&mem_writer.lock);
+		mem_writer.write_us += write_us;
+		mem_writer.nr_jobs--;
+		if (ret)
+			mem_writer.ret = -1;
+		pthread_mutex_unlock(&mem_writer.lock);
+	}
+
+	return NULL;
+}
+
+static int mem_writer_queue(struct mem_write_job *job)
+{
+	int ret;
+
+	pthread_mutex_lock(&mem_writer.lock);
+	if (!mem_writer.started) {
+		mem_writer.stop = false;
+		mem_writer.ret = 0;
+		mem_writer.write_us = 0;
+		mem_writer.busy = true;
+		if (pthread_create(&mem_writer.thread, NULL, mem_writer_fn, NULL)) {
+			pthread_mutex_unlock(&mem_writer.lock);
+			pr_perror("Can't start pages writer");
+			return -1;
+		}
+		mem_writer.started = true;
+	}
+
+	while (mem_writer.nr_jobs >= MEM_WRITER_MAX_JOBS && !mem_writer.ret)
+		pthread_cond_wait(&mem_writer.cond, &mem_writer.lock);
+
+	ret = mem_writer.ret;
+	if (!ret) {
+		list_add_tail(&job->l, &mem_writer.jobs);
+		mem_writer.nr_jobs++;
+		pthread_cond_broadcast(&mem_writer.cond);
+	}
+	pthread_mutex_unlock(&mem_writer.lock);
+
+	if (ret)
+		pr_err("Background pages writing failed\n");
+	return ret;
+}
+
+/*
+ * Waits for the pages queued so far to get written. Needed before
+ * anything else talks to the page server, the writer may be using
+ * the connection.
+ */
+int mem_writer_sync(void)
+{
+	int ret;
+
+	pthread_mutex_lock(&mem_writer.lock);
+	while (mem_writer.started && (mem_writer.busy || !list_empty(&mem_writer.jobs)))
+		pthread_cond_wait(&mem_writer.cond, &mem_writer.lock);
+	ret = mem_writer.ret;
+	pthread_mutex_unlock(&mem_writer.lock);
+
+	return ret;
+}
+
+int mem_writer_finish(void)
+{
+	int ret;
+
+	pthread_mutex_lock(&mem_writer.lock);
+	if (!mem_writer.started) {
+		pthread_mutex_unlock(&mem_writer.lock);
+		return 0;
+	}
+	mem_writer.stop = true;
+	pthread_cond_broadcast(&mem_writer.cond);
+	pthread_mutex_unlock(&mem_writer.lock);
+
+	if (pthread_join(mem_writer.thread, NULL)) {
+		pr_err("Can't join pages writer\n");
+		return -1;
+	}
+
+	mem_writer.started = false;
+	timing_add_us(TIME_MEMWRITE, mem_writer.write_us);
+	ret = mem_writer.ret;
+	if (ret)
+		pr_err("Background pages writing failed\n");
+	return ret;
+}
+
 static int __parasite_dump_pages_seized(struct pstree_item *item, struct parasite_dump_pages_args *args,
 					struct vm_area_list *vma_area_list, struct mem_dump_ctl *mdc,
 					struct parasite_ctl *ctl)
@@ -461,6 +636,7 @@ static int __parasite_dump_pages_seized(struct pstree_item *item, struct parasit
 	int possible_pid_reuse = 0;
 	bool has_parent;
 	int parent_predump_mode = -1;
+	bool overlap = opts.overlap_dump && !(mdc->pre_dump || mdc->lazy);
 
 	pr_info("\n");
 	pr_info("Dumping pages (type: %d pid: %d)\n", CR_FD_PAGES, item->pid->real);
@@ -478,14 +654,19 @@ static int __parasite_dump_pages_seized(struct pstree_item *item, struct parasit
 	if (pmc_init(&pmc, item->pid->real, &vma_area_list->h, pmc_size * PAGE_SIZE))
 		return -1;
 
-	if (!(mdc->pre_dump || mdc->lazy))
+	if (!(mdc->pre_dump || mdc->lazy || overlap))
 		/*
 		 * Chunk mode pushes pages portion by portion. This mode
 		 * only works when we don't need to keep pp for later
-		 * use, i.e. on non-lazy non-predump.
+		 * use, i.e. on non-lazy non-predump non-overlapped dump.
 		 */
 		cpp_flags |= PP_CHUNK_MODE;
-	pp = create_page_pipe(vma_area_list->nr_priv_pages, mdc->lazy ? NULL : pargs_iovs(args), cpp_flags);
+	/*
+	 * The pp that outlives the parasite can't keep its iovs in the
+	 * parasite args, they are copied there before draining.
+	 */
+	pp = create_page_pipe(vma_area_list->nr_priv_pages, (mdc->lazy || overlap) ? NULL : pargs_iovs(args),
+			      cpp_flags);
 	if (!pp)
 		goto out;
 
@@ -495,6 +676,11 @@ static int __parasite_dump_pages_seized(struct pstree_item *item, struct parasit
 		 * right here. For pre-dumps the pp will be taken by the
 		 * caller and handled later.
 		 */
+		if (overlap && opts.use_page_server && mem_writer_sync()) {
+			ret = -1;
+			goto out_pp;
+		}
+
 		ret = open_page_xfer(&xfer, CR_FD_PAGEMAP, vpid(item));
 		if (ret < 0)
 			goto out_pp;
@@ -530,7 +716,7 @@ static int __parasite_dump_pages_seized(struct pstree_item *item, struct parasit
 			goto out_xfer;
 	}
 
-	if (mdc->lazy)
+	if (mdc->lazy || overlap)
 		memcpy(pargs_iovs(args), pp->iovs, sizeof(struct iovec) * pp->nr_iovs);
 
 	/*
@@ -539,12 +725,12 @@ static int __parasite_dump_pages_seized(struct pstree_item *item, struct parasit
 	 * actual optimization which reduces time for which process was frozen
 	 * during pre-dump.
 	 */
-	if (mdc->pre_dump && opts.pre_dump_mode == PRE_DUMP_READ)
+	if (mdc->pre_dump && pre_dump_mode_read(opts.pre_dump_mode))
 		ret = 0;
 	else
 		ret = drain_pages(pp, ctl, args);
 
-	if (!ret && !mdc->pre_dump)
+	if (!ret && !mdc->pre_dump && !overlap)
 		ret = xfer_pages(pp, &xfer);
 	if (ret)
 		goto out_xfer;
@@ -555,13 +741,37 @@ static int __parasite_dump_pages_seized(struct pstree_item *item, struct parasit
 	 * Step 4 -- clean up
 	 */
 
-	ret = task_reset_dirty_track(item->pid->real);
+	ret = task_reset_dirty_track(item->pid->real, ctl, vma_area_list, mdc->pre_dump);
 	if (ret)
 		goto out_xfer;
+
+	if (overlap) {
+		struct mem_write_job *job;
+
+		job = xmalloc(sizeof(*job));
+		if (!job) {
+			ret = -1;
+			goto out_xfer;
+		}
+
+		job->pid = item->pid->real;
+		job->pp = pp;
+		job->xfer = xfer;
+		/* From now on both belong to the writer */
+		ret = mem_writer_queue(job);
+		if (ret) {
+			xfree(job);
+			goto out_xfer;
+		}
+
+		exit_code = 0;
+		goto out;
+	}
+
 	exit_code = 0;
 out_xfer:
-	if (!mdc->pre_dump)
-		xfer.close(&xfer);
+	if (!mdc->pre_dump && xfer.close(&xfer))
+		exit_code = -1;
 out_pp:
 	if (ret || !(mdc->pre_dump || mdc->lazy))
 		destroy_page_pipe(pp);
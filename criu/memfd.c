@@ -233,7 +233,7 @@ static struct collect_image_info memfd_inode_cinfo = {
 	.pb_type = PB_MEMFD_INODE,
 	.priv_size = sizeof(struct memfd_restore_inode),
 	.collect = collect_one_memfd_inode,
-	.flags = COLLECT_SHARED | COLLECT_NOFREE,
+	.flags = COLLECT_SHARED | COLLECT_NOFREE | COLLECT_ARENA,
 };
 
 int prepare_memfd_inodes(void)
@@ -405,6 +405,7 @@ struct collect_image_info memfd_cinfo = {
 	.pb_type = PB_MEMFD_FILE,
 	.priv_size = sizeof(struct memfd_info),
 	.collect = collect_one_memfd,
+	.flags = COLLECT_ARENA,
 };
 
 struct file_desc *collect_memfd(u32 id)
@@ -1,4 +1,6 @@
 #include <unistd.h>
+#include <pthread.h>
+#include <sys/ioctl.h>
 
 #undef LOG_PREFIX
 #define LOG_PREFIX "page-pipe: "
@@ -11,6 +13,7 @@
 #include "fcntl.h"
 #include "stats.h"
 #include "cr_options.h"
+#include "sysctl.h"
 
 /* can existing iov accumulate the page? */
 static inline bool iov_grow_page(struct iovec *iov, unsigned long addr)
@@ -29,6 +32,152 @@ static inline void iov_init(struct iovec *iov, unsigned long addr)
 	iov->iov_len = PAGE_SIZE;
 }
 
+/*
+ * Pipes are allowed to grow above PIPE_MAX_SIZE while the kernel manages
+ * to allocate buffers for them. The limit starts at what the system
+ * allows in /proc/sys/fs/pipe-max-size and goes down to the size of the
+ * biggest pipe we've got once growing a pipe fails.
+ *
+ * Lazy pages are read out of the page pipe with tee() into a pipe of
+ * PIPE_MAX_SIZE, so theirs are never bigger than that.
+ */
+static unsigned long pipe_size_max;
+
+static unsigned long pipe_size_limit(void)
+{
+	u32 sys_max;
+	struct sysctl_req req[] = {
+		{ "fs/pipe-max-size", &sys_max, CTL_U32 },
+	};
+
+	if (opts.lazy_pages)
+		return PIPE_MAX_SIZE;
+
+	if (pipe_size_max)
+		return pipe_size_max;
+
+	pipe_size_max = PIPE_MAX_SIZE;
+	if (sysctl_op(req, ARRAY_SIZE(req), CTL_READ, 0)) {
+		pr_warn("Can't get pipe-max-size, pipes are limited to %lu pages\n", pipe_size_max);
+		return pipe_size_max;
+	}
+
+	sys_max /= PAGE_SIZE;
+	if (sys_max > PIPE_SIZE_HARD_MAX)
+		sys_max = PIPE_SIZE_HARD_MAX;
+	if (sys_max > pipe_size_max)
+		pipe_size_max = sys_max;
+
+	pr_debug("Pipes can grow up to %lu pages\n", pipe_size_max);
+	return pipe_size_max;
+}
+
+static void pipe_size_limit_fail(unsigned long size)
+{
+	if (size >= pipe_size_max)
+		return;
+
+	pipe_size_max = max_t(unsigned long, size, PIPE_MAX_SIZE);
+	pr_debug("Pipes are limited to %lu pages now\n", pipe_size_max);
+}
+
+/*
+ * Drained pipes are kept for the next page pipes instead of being
+ * closed, so that dumping many tasks doesn't create and grow pipes
+ * over and over again. The pipes are pooled at the size they've grown
+ * to and only shrink when taken by a page pipe with a lower limit.
+ * The page pipes may be destroyed by the background pages writer,
+ * thus the lock.
+ */
+#define PIPE_POOL_SIZE (4 * NR_PIPES_PER_CHUNK)
+
+static int pipe_pool[PIPE_POOL_SIZE][2];
+static int pipe_pool_nr;
+static pthread_mutex_t pipe_pool_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static int pipe_pool_get(int *p, unsigned long limit)
+{
+	int size, len;
+
+	while (1) {
+		pthread_mutex_lock(&pipe_pool_lock);
+		if (!pipe_pool_nr) {
+			pthread_mutex_unlock(&pipe_pool_lock);
+			return -1;
+		}
+		pipe_pool_nr--;
+		p[0] = pipe_pool[pipe_pool_nr][0];
+		p[1] = pipe_pool[pipe_pool_nr][1];
+		pthread_mutex_unlock(&pipe_pool_lock);
+
+		/*
+		 * Pipes filled by page_pipe_pool_fill() are shared with the
+		 * processes forked after it, which may have died before
+		 * draining them.
+		 */
+		if (ioctl(p[0], FIONREAD, &len) || len)
+			goto close;
+
+		size = fcntl(p[0], F_GETPIPE_SZ, 0);
+		if (size < 0)
+			goto close;
+		if (size / PAGE_SIZE <= limit)
+			return 0;
+
+		/* Empty pipes can always shrink */
+		if (fcntl(p[0], F_SETPIPE_SZ, limit * PAGE_SIZE) >= 0)
+			return 0;
+close:
+		close(p[0]);
+		close(p[1]);
+	}
+}
+
+static void pipe_pool_put(int *p)
+{
+	int len;
+
+	/* Pipes with something left in them aren't reusable */
+	if (ioctl(p[0], FIONREAD, &len) || len)
+		goto close;
+
+	pthread_mutex_lock(&pipe_pool_lock);
+	if (pipe_pool_nr < PIPE_POOL_SIZE) {
+		pipe_pool[pipe_pool_nr][0] = p[0];
+		pipe_pool[pipe_pool_nr][1] = p[1];
+		pipe_pool_nr++;
+		p = NULL;
+	}
+	pthread_mutex_unlock(&pipe_pool_lock);
+
+	if (!p)
+		return;
+close:
+	close(p[0]);
+	close(p[1]);
+}
+
+/*
+ * The pre-dump iterations run in forked processes, so the pipes they
+ * create and grow die with them. The pipes pooled before forking them
+ * are shared though, and keep the size they've grown to in one
+ * iteration for the next ones.
+ */
+int page_pipe_pool_fill(void)
+{
+	int p[2];
+
+	while (pipe_pool_nr < PIPE_POOL_SIZE) {
+		if (pipe2(p, O_CLOEXEC)) {
+			pr_perror("Can't make pipe for the pool");
+			return -1;
+		}
+		pipe_pool_put(p);
+	}
+
+	return 0;
+}
+
 static int __ppb_resize_pipe(struct page_pipe_buf *ppb, unsigned long new_size)
 {
 	int ret;
@@ -49,21 +198,26 @@ static int __ppb_resize_pipe(struct page_pipe_buf *ppb, unsigned long new_size)
 static inline int ppb_resize_pipe(struct page_pipe_buf *ppb)
 {
 	unsigned long new_size = ppb->pipe_size << 1;
+	unsigned long limit;
 	int ret;
 
 	if (ppb->pages_in + ppb->pipe_off < ppb->pipe_size)
 		return 0;
 
-	if (new_size > PIPE_MAX_SIZE) {
-		if (ppb->pipe_size < PIPE_MAX_SIZE)
-			new_size = PIPE_MAX_SIZE;
+	limit = pipe_size_limit();
+	if (new_size > limit) {
+		if (ppb->pipe_size < limit)
+			new_size = limit;
 		else
 			return 1;
 	}
 
 	ret = __ppb_resize_pipe(ppb, new_size);
-	if (ret < 0)
+	if (ret < 0) {
+		if (new_size > PIPE_MAX_SIZE)
+			pipe_size_limit_fail(ppb->pipe_size);
 		return 1; /* need to add another buf */
+	}
 
 	return 0;
 }
@@ -112,7 +266,7 @@ static struct page_pipe_buf *ppb_alloc(struct page_pipe *pp, unsigned int ppb_fl
 		ppb->pipe_off = prev->pages_in + prev->pipe_off;
 		ppb->pipe_size = prev->pipe_size;
 	} else {
-		if (pipe(ppb->p)) {
+		if (pipe_pool_get(ppb->p, pipe_size_limit()) && pipe2(ppb->p, O_CLOEXEC)) {
 			xfree(ppb);
 			pr_perror("Can't make pipe for page-pipe");
 			return NULL;
@@ -134,10 +288,8 @@ static struct page_pipe_buf *ppb_alloc(struct page_pipe *pp, unsigned int ppb_fl
 static void ppb_destroy(struct page_pipe_buf *ppb)
 {
 	/* Check whether a pipe is shared with another ppb */
-	if (ppb->pipe_off == 0) {
-		close(ppb->p[0]);
-		close(ppb->p[1]);
-	}
+	if (ppb->pipe_off == 0)
+		pipe_pool_put(ppb->p);
 	xfree(ppb);
 }
 
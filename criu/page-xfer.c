@@ -7,6 +7,11 @@
 #include <sys/wait.h>
 #include <sys/stat.h>
 #include <sys/mman.h>
+#include <sys/ioctl.h>
+#include <sys/random.h>
+#include <pthread.h>
+#include <poll.h>
+#include <limits.h>
 
 #undef LOG_PREFIX
 #define LOG_PREFIX "page-xfer: "
@@ -26,6 +31,8 @@
 #include "rst_info.h"
 #include "stats.h"
 #include "tls.h"
+#include "pages-comp.h"
+#include "pages-csum.h"
 
 static int page_server_sk = -1;
 
@@ -50,6 +57,9 @@ static void psi2iovec(struct page_server_iov *ps, struct iovec *iov)
 #define PS_IOV_ADD_F  6
 #define PS_IOV_GET    7
 
+#define PS_IOV_STRIPE	   8
+#define PS_IOV_STRIPE_JOIN 9
+
 #define PS_IOV_CLOSE	   0x1023
 #define PS_IOV_FORCE_CLOSE 0x1024
 
@@ -61,6 +71,18 @@ static void psi2iovec(struct page_server_iov *ps, struct iovec *iov)
 
 #define PS_TYPE_PID   (1)
 #define PS_TYPE_SHMEM (2)
+
+/* PS_IOV_OPEN2 flags */
+#define PS_OPEN_COMPRESS (1 << 0) /* ask server to compress pages image */
+#define PS_OPEN_CSUM	 (1 << 1) /* ask server to checksum pages */
+
+/* PS_IOV_GET flags, older servers ignore them */
+#define PS_GET_URGENT (1 << 0) /* someone waits for these pages */
+
+/* PS_IOV_OPEN2 reply bits */
+#define PS_OPEN_HAS_PARENT (1 << 0)
+#define PS_OPEN_COMPRESSED (1 << 1)
+#define PS_OPEN_CSUMMED	   (1 << 2)
 /*
  * XXX: When adding new types here check decode_pm for legacy
  * numbers that can be met from older CRIUs
@@ -135,16 +157,46 @@ static inline u32 decode_ps_flags(u32 cmd)
 
 static inline int __send(int sk, const void *buf, size_t sz, int fl)
 {
-	return opts.tls ? tls_send(buf, sz, fl) : send(sk, buf, sz, fl);
+	return tls_user_tx() ? tls_send(buf, sz, fl) : send(sk, buf, sz, fl);
 }
 
 static inline int __recv(int sk, void *buf, size_t sz, int fl)
 {
-	return opts.tls ? tls_recv(buf, sz, fl) : recv(sk, buf, sz, fl);
+	return tls_user_rx() ? tls_recv(buf, sz, fl) : recv(sk, buf, sz, fl);
+}
+
+/*
+ * Pagemap entries without pages (holes, lazy pages) are collected here
+ * and go to the server in one send() together with the next command,
+ * instead of a send() per entry. Any command flushes the batch first,
+ * so the server sees everything in the original order.
+ */
+#define PS_PSI_BATCH 128
+
+static struct page_server_iov psi_batch[PS_PSI_BATCH];
+static int psi_batch_nr;
+
+static int flush_psi_batch(int sk)
+{
+	int len = psi_batch_nr * sizeof(psi_batch[0]);
+
+	if (!psi_batch_nr)
+		return 0;
+
+	psi_batch_nr = 0;
+	if (__send(sk, psi_batch, len, 0) != len) {
+		pr_perror("Can't send %zu pagemap entries to server", len / sizeof(psi_batch[0]));
+		return -1;
+	}
+
+	return 0;
 }
 
 static inline int send_psi_flags(int sk, struct page_server_iov *pi, int flags)
 {
+	if (flush_psi_batch(sk))
+		return -1;
+
 	if (__send(sk, pi, sizeof(*pi), flags) != sizeof(*pi)) {
 		pr_perror("Can't send PSI %d to server", pi->cmd);
 		return -1;
@@ -157,21 +209,370 @@ static inline int send_psi(int sk, struct page_server_iov *pi)
 	return send_psi_flags(sk, pi, 0);
 }
 
+/*
+ * Striped page server.
+ *
+ * One TCP stream served by one CPU doesn't fill a fast link, so the
+ * pages can be sent over several extra connections (stripes). The
+ * pagemap entries and all the other commands stay on the main
+ * connection, while the data of each PE_PRESENT entry goes to the
+ * next stripe round-robin. Both sides walk the stripes in the same
+ * order, so the server always knows which stripe carries the data of
+ * the entry it has just received and the images look exactly as if
+ * they were received over one connection.
+ *
+ * Every stripe has a thread that moves data between its socket and a
+ * pipe, the main thread only splices pages into and out of the pipes.
+ *
+ * The client asks for striping with PS_IOV_STRIPE, nr_pages being the
+ * number of stripes, right after connecting. The server answers with a
+ * non-zero u32 token or with 0 if it can't stripe the session. Then the
+ * client connects the stripes and sends PS_IOV_STRIPE_JOIN on each, with
+ * the token in dst_id and the stripe number in nr_pages.
+ */
+#define PS_STRIPE_PIPE_SIZE (PIPE_MAX_SIZE * PAGE_SIZE)
+
+struct ps_stripe {
+	int sk;
+	int p[2];
+	pthread_t thread;
+	bool threaded;
+	int ret;
+};
+
+static struct ps_stripe *ps_stripes;
+static int ps_nr_stripes;
+static int ps_stripe_cur;
+static bool ps_stripes_sending;
+
+/* The server's listening socket, kept until the first command arrives */
+static int ps_listen_sk = -1;
+
+static int ps_stripe_next(void)
+{
+	int i = ps_stripe_cur;
+
+	ps_stripe_cur = (ps_stripe_cur + 1) % ps_nr_stripes;
+	return i;
+}
+
+static int ps_stripes_alloc(int nr)
+{
+	int i;
+
+	ps_stripes = xzalloc(nr * sizeof(*ps_stripes));
+	if (!ps_stripes)
+		return -1;
+
+	for (i = 0; i < nr; i++) {
+		ps_stripes[i].sk = -1;
+		ps_stripes[i].p[0] = -1;
+		ps_stripes[i].p[1] = -1;
+	}
+
+	return 0;
+}
+
+static int ps_stripe_pipe(struct ps_stripe *s)
+{
+	if (pipe2(s->p, O_CLOEXEC)) {
+		pr_perror("Can't make pipe for a stripe");
+		return -1;
+	}
+
+	if (fcntl(s->p[0], F_SETPIPE_SZ, PS_STRIPE_PIPE_SIZE) < 0)
+		pr_debug("Can't grow a stripe pipe, keeping the default size\n");
+
+	return 0;
+}
+
+/* Client side: pages from the pipe go to the stripe socket */
+static void *ps_stripe_send(void *arg)
+{
+	struct ps_stripe *s = arg;
+
+	while (1) {
+		ssize_t ret;
+
+		ret = splice(s->p[0], NULL, s->sk, NULL, PS_STRIPE_PIPE_SIZE, SPLICE_F_MOVE);
+		if (ret == 0)
+			break;
+		if (ret < 0) {
+			pr_perror("Can't send pages over a stripe");
+			s->ret = -1;
+			/* Make the writer fail on EPIPE instead of blocking */
+			close_safe(&s->p[0]);
+			break;
+		}
+	}
+
+	return NULL;
+}
+
+/* Server side: pages from the stripe socket go to the pipe */
+static void *ps_stripe_recv(void *arg)
+{
+	struct ps_stripe *s = arg;
+
+	while (1) {
+		ssize_t ret;
+
+		ret = splice(s->sk, NULL, s->p[1], NULL, PS_STRIPE_PIPE_SIZE, SPLICE_F_MOVE);
+		if (ret == 0)
+			break;
+		if (ret < 0) {
+			pr_perror("Can't receive pages from a stripe");
+			s->ret = -1;
+			break;
+		}
+	}
+
+	/* The reader sees EOF here and fails if it still expects pages */
+	close_safe(&s->p[1]);
+	return NULL;
+}
+
+static int ps_stripes_start(void *(*fn)(void *))
+{
+	int i;
+
+	for (i = 0; i < ps_nr_stripes; i++) {
+		struct ps_stripe *s = &ps_stripes[i];
+
+		if (pthread_create(&s->thread, NULL, fn, s)) {
+			pr_err("Can't start a stripe thread\n");
+			return -1;
+		}
+		s->threaded = true;
+	}
+
+	return 0;
+}
+
+static void ps_stripe_drain(struct ps_stripe *s)
+{
+	char buf[PAGE_SIZE];
+
+	while (read(s->p[0], buf, sizeof(buf)) > 0)
+		;
+}
+
+/*
+ * Stops the stripe threads. Normally the senders drain their pipes
+ * and the receivers get EOF from the sockets, on abort both are kicked
+ * out of whatever they block on.
+ */
+static int ps_stripes_fini(bool abort)
+{
+	int i, ret = 0;
+
+	if (!ps_stripes)
+		return 0;
+
+	for (i = 0; i < ps_nr_stripes; i++) {
+		struct ps_stripe *s = &ps_stripes[i];
+
+		if (abort && s->sk >= 0)
+			shutdown(s->sk, SHUT_RDWR);
+
+		if (ps_stripes_sending)
+			close_safe(&s->p[1]);
+		else if (abort && s->threaded)
+			/* The receiver may wait for room in the pipe */
+			ps_stripe_drain(s);
+	}
+
+	for (i = 0; i < ps_nr_stripes; i++) {
+		struct ps_stripe *s = &ps_stripes[i];
+
+		if (s->threaded && pthread_join(s->thread, NULL)) {
+			pr_err("Can't join a stripe thread\n");
+			ret = -1;
+		}
+		if (s->ret)
+			ret = -1;
+
+		close_safe(&s->p[0]);
+		close_safe(&s->p[1]);
+		close_safe(&s->sk);
+	}
+
+	xfree(ps_stripes);
+	ps_stripes = NULL;
+	ps_nr_stripes = 0;
+	ps_stripe_cur = 0;
+
+	return ret;
+}
+
+static int ps_stripes_connect(int nr)
+{
+	struct page_server_iov pi = {
+		.cmd = PS_IOV_STRIPE,
+		.nr_pages = nr,
+	};
+	u32 token;
+	int i;
+
+	if (send_psi(page_server_sk, &pi))
+		return -1;
+
+	tcp_nodelay(page_server_sk, true);
+
+	if (recv(page_server_sk, &token, sizeof(token), MSG_WAITALL) != sizeof(token)) {
+		pr_perror("The page server doesn't answer");
+		return -1;
+	}
+
+	if (!token) {
+		pr_warn("Page server can't use %d streams, sending pages over one\n", nr);
+		return 0;
+	}
+
+	if (ps_stripes_alloc(nr))
+		return -1;
+
+	ps_nr_stripes = nr;
+	ps_stripes_sending = true;
+	for (i = 0; i < nr; i++) {
+		struct ps_stripe *s = &ps_stripes[i];
+		struct page_server_iov join = {
+			.cmd = PS_IOV_STRIPE_JOIN,
+			.nr_pages = i,
+			.dst_id = token,
+		};
+
+		s->sk = setup_tcp_client(opts.addr);
+		if (s->sk < 0)
+			goto err;
+
+		if (send_psi(s->sk, &join))
+			goto err;
+
+		tcp_cork(s->sk, true);
+
+		if (ps_stripe_pipe(s))
+			goto err;
+	}
+
+	if (ps_stripes_start(ps_stripe_send))
+		goto err;
+
+	/*
+	 * Only the pagemap entries go over the main connection now, and
+	 * the server waits for each of them before it takes the pages
+	 * from a stripe. Don't let them sit in the cork.
+	 */
+	tcp_cork(page_server_sk, false);
+
+	pr_info("Sending pages over %d streams\n", nr);
+	return 0;
+
+err:
+	ps_stripes_fini(true);
+	return -1;
+}
+
+static int ps_stripes_accept(u32 token, int nr)
+{
+	int i;
+
+	if (ps_stripes_alloc(nr))
+		return -1;
+
+	ps_nr_stripes = nr;
+	ps_stripes_sending = false;
+	for (i = 0; i < nr; i++) {
+		struct pollfd pfd = { .fd = ps_listen_sk, .events = POLLIN };
+		struct page_server_iov join;
+		struct ps_stripe *s;
+		int sk;
+
+		/* Don't hang forever if the client gave up half-way */
+		if (poll(&pfd, 1, opts.timeout * 1000) <= 0) {
+			pr_err("Stripes didn't connect in time\n");
+			return -1;
+		}
+
+		sk = accept(ps_listen_sk, NULL, NULL);
+		if (sk < 0) {
+			pr_perror("Can't accept a stripe");
+			return -1;
+		}
+
+		if (recv(sk, &join, sizeof(join), MSG_WAITALL) != sizeof(join)) {
+			pr_perror("Can't read a stripe header");
+			close(sk);
+			return -1;
+		}
+
+		if (join.cmd != PS_IOV_STRIPE_JOIN || join.dst_id != token || join.nr_pages >= nr ||
+		    ps_stripes[join.nr_pages].sk >= 0) {
+			pr_err("Bad stripe join %u/%u\n", join.cmd, join.nr_pages);
+			close(sk);
+			return -1;
+		}
+
+		s = &ps_stripes[join.nr_pages];
+		s->sk = sk;
+		if (ps_stripe_pipe(s))
+			return -1;
+	}
+
+	return ps_stripes_start(ps_stripe_recv);
+}
+
+static int page_server_stripe(int sk, struct page_server_iov *pi)
+{
+	u32 token = 0;
+
+	if (ps_listen_sk < 0 || opts.tls || opts.lazy_pages || ps_nr_stripes || pi->nr_pages < 2 ||
+	    pi->nr_pages > PS_MAX_STREAMS)
+		pr_warn("Can't stripe the session over %u streams\n", pi->nr_pages);
+	else if (getrandom(&token, sizeof(token), 0) != sizeof(token)) {
+		pr_perror("Can't make a stripe token");
+		token = 0;
+	}
+
+	/* Zero means "no striping" for the client */
+	if (send(sk, &token, sizeof(token), 0) != sizeof(token)) {
+		pr_perror("Can't answer the stripe request");
+		return -1;
+	}
+
+	if (!token)
+		return 0;
+
+	if (ps_stripes_accept(token, pi->nr_pages)) {
+		ps_stripes_fini(true);
+		return -1;
+	}
+
+	pr_info("Receiving pages over %d streams\n", ps_nr_stripes);
+	return 0;
+}
+
 /* page-server xfer */
 static int write_pages_to_server(struct page_xfer *xfer, int p, unsigned long len)
 {
 	ssize_t ret, left = len;
 
-	if (opts.tls) {
+	if (tls_user_tx()) {
 		pr_debug("Sending %lu bytes / %lu pages\n", len, len / PAGE_SIZE);
 
 		if (tls_send_data_from_fd(p, len))
 			return -1;
 	} else {
-		pr_debug("Splicing %lu bytes / %lu pages into socket\n", len, len / PAGE_SIZE);
+		int fd = xfer->sk;
+
+		if (ps_nr_stripes) {
+			fd = ps_stripes[xfer->stripe].p[1];
+			pr_debug("Splicing %lu bytes / %lu pages into stripe %d\n", len, len / PAGE_SIZE, xfer->stripe);
+		} else
+			pr_debug("Splicing %lu bytes / %lu pages into socket\n", len, len / PAGE_SIZE);
 
 		while (left > 0) {
-			ret = splice(p, NULL, xfer->sk, NULL, left, SPLICE_F_MOVE);
+			ret = splice(p, NULL, fd, NULL, left, SPLICE_F_MOVE);
 			if (ret < 0) {
 				pr_perror("Can't write pages to socket");
 				return -1;
@@ -194,19 +595,34 @@ static int write_pagemap_to_server(struct page_xfer *xfer, struct iovec *iov, u3
 		.dst_id = xfer->dst_id,
 	};
 
-	return send_psi(xfer->sk, &pi);
+	/* The pages of this entry go to the next stripe */
+	if (ps_nr_stripes && (flags & PE_PRESENT))
+		xfer->stripe = ps_stripe_next();
+
+	psi_batch[psi_batch_nr++] = pi;
+
+	/* The pages follow the entry, so it can't wait */
+	if ((flags & PE_PRESENT) || psi_batch_nr == PS_PSI_BATCH)
+		return flush_psi_batch(xfer->sk);
+
+	return 0;
 }
 
-static void close_server_xfer(struct page_xfer *xfer)
+static int close_server_xfer(struct page_xfer *xfer)
 {
+	int ret;
+
+	ret = flush_psi_batch(xfer->sk);
 	xfer->sk = -1;
+	return ret;
 }
 
 static int open_page_server_xfer(struct page_xfer *xfer, int fd_type, unsigned long img_id)
 {
-	char has_parent;
+	char reply;
 	struct page_server_iov pi = {
-		.cmd = PS_IOV_OPEN2,
+		.cmd = encode_ps_cmd(PS_IOV_OPEN2, (opts.compress_pages ? PS_OPEN_COMPRESS : 0) |
+							   (opts.pages_csum ? PS_OPEN_CSUM : 0)),
 	};
 
 	xfer->sk = page_server_sk;
@@ -225,14 +641,21 @@ static int open_page_server_xfer(struct page_xfer *xfer, int fd_type, unsigned l
 	/* Push the command NOW */
 	tcp_nodelay(xfer->sk, true);
 
-	if (__recv(xfer->sk, &has_parent, 1, 0) != 1) {
+	if (__recv(xfer->sk, &reply, 1, 0) != 1) {
 		pr_perror("The page server doesn't answer");
 		return -1;
 	}
 
-	if (has_parent)
+	if (reply & PS_OPEN_HAS_PARENT)
 		xfer->parent = (void *)1; /* This is required for generate_iovs() */
 
+	if (opts.compress_pages && !(reply & PS_OPEN_COMPRESSED))
+		pr_warn("Page server doesn't compress pages, they are stored raw\n");
+	if (opts.pages_csum && !(reply & PS_OPEN_CSUMMED)) {
+		pr_err("Page server doesn't checksum pages\n");
+		return -1;
+	}
+
 	return 0;
 }
 
@@ -242,6 +665,11 @@ static int write_pages_loc(struct page_xfer *xfer, int p, unsigned long len)
 	ssize_t ret;
 	ssize_t curr = 0;
 
+	if (xfer->csum)
+		return pages_csum_write(xfer->csum, p, len);
+	if (xfer->comp)
+		return pages_comp_write(xfer->comp, p, len);
+
 	while (1) {
 		ret = splice(p, NULL, img_raw_fd(xfer->pi), NULL, len - curr, SPLICE_F_MOVE);
 		if (ret == -1) {
@@ -330,35 +758,65 @@ static int write_pagemap_loc(struct page_xfer *xfer, struct iovec *iov, u32 flag
 		}
 	}
 
+	if (xfer->csum && (flags & PE_PRESENT))
+		return pages_csum_entry(xfer->csum, &pe);
+
 	if (pb_write_one(xfer->pmi, &pe, PB_PAGEMAP) < 0)
 		return -1;
 
 	return 0;
 }
 
-static void close_page_xfer(struct page_xfer *xfer)
+static int close_page_xfer(struct page_xfer *xfer)
 {
+	int ret = 0;
+
 	if (xfer->parent != NULL) {
 		xfer->parent->close(xfer->parent);
 		xfree(xfer->parent);
 		xfer->parent = NULL;
 	}
+	if (xfer->csum) {
+		ret = pages_csum_writer_close(xfer->csum);
+		xfer->csum = NULL;
+	}
+	if (xfer->comp) {
+		if (pages_comp_writer_close(xfer->comp))
+			ret = -1;
+		xfer->comp = NULL;
+	}
 	close_image(xfer->pi);
 	close_image(xfer->pmi);
+
+	return ret;
 }
 
-static int open_page_local_xfer(struct page_xfer *xfer, int fd_type, unsigned long img_id)
+static int open_page_local_xfer(struct page_xfer *xfer, int fd_type, unsigned long img_id, bool compress, bool csum)
 {
-	u32 pages_id;
+	u32 pages_id, comp = compress ? PAGES_COMP_ZSTD : PAGES_COMP_NONE;
 
 	xfer->pmi = open_image(fd_type, O_DUMP, img_id);
 	if (!xfer->pmi)
 		return -1;
 
-	xfer->pi = open_pages_image(O_DUMP, xfer->pmi, &pages_id);
+	xfer->pi = open_pages_image(O_DUMP, xfer->pmi, &pages_id, &comp);
 	if (!xfer->pi)
 		goto err_pmi;
 
+	xfer->comp = NULL;
+	if (compress) {
+		xfer->comp = pages_comp_writer_open(img_raw_fd(xfer->pi), pages_id);
+		if (!xfer->comp)
+			goto err_pi;
+	}
+
+	xfer->csum = NULL;
+	if (csum) {
+		xfer->csum = pages_csum_writer_open(xfer->pmi, img_raw_fd(xfer->pi), xfer->comp);
+		if (!xfer->csum)
+			goto err_pi;
+	}
+
 	/*
 	 * Open page-read for parent images (if it exists). It will
 	 * be used for two things:
@@ -405,6 +863,10 @@ out:
 	return 0;
 
 err_pi:
+	if (xfer->csum)
+		pages_csum_writer_close(xfer->csum);
+	if (xfer->comp)
+		pages_comp_writer_close(xfer->comp);
 	close_image(xfer->pi);
 err_pmi:
 	close_image(xfer->pmi);
@@ -419,7 +881,7 @@ int open_page_xfer(struct page_xfer *xfer, int fd_type, unsigned long img_id)
 	if (opts.use_page_server)
 		return open_page_server_xfer(xfer, fd_type, img_id);
 	else
-		return open_page_local_xfer(xfer, fd_type, img_id);
+		return open_page_local_xfer(xfer, fd_type, img_id, opts.compress_pages, opts.pages_csum);
 }
 
 static int page_xfer_dump_hole(struct page_xfer *xfer, struct iovec *hole, u32 flags)
@@ -653,98 +1115,540 @@ unsigned long handle_faulty_iov(int pid, struct iovec *riov, unsigned long fault
 		final_read_cnt += bytes_read;
 	}
 
-	return final_read_cnt;
+	return final_read_cnt;
+}
+
+/*
+ * This function will position start pointer to the latest
+ * successfully read iov in iovec.
+ */
+static unsigned long analyze_iov(ssize_t bytes_read, struct iovec *riov, unsigned long *index, struct iovec *aux_iov,
+				 unsigned long *aux_len)
+{
+	ssize_t processed_bytes = 0;
+
+	/* correlating iovs with read bytes */
+	while (processed_bytes < bytes_read) {
+		processed_bytes += riov[*index].iov_len;
+		aux_iov[*aux_len].iov_base = riov[*index].iov_base;
+		aux_iov[*aux_len].iov_len = riov[*index].iov_len;
+
+		(*aux_len) += 1;
+		(*index) += 1;
+	}
+
+	/* handling partially processed faulty iov*/
+	if (processed_bytes - bytes_read) {
+		unsigned long partial_read_bytes = 0;
+
+		(*index) -= 1;
+
+		partial_read_bytes = riov[*index].iov_len - (processed_bytes - bytes_read);
+		aux_iov[*aux_len - 1].iov_len = partial_read_bytes;
+		riov[*index].iov_base += partial_read_bytes;
+		riov[*index].iov_len -= partial_read_bytes;
+	}
+
+	return 0;
+}
+
+/*
+ * This function iterates over complete ppb->iov entries and pass
+ * them to process_vm_readv syscall.
+ *
+ * Since process_vm_readv returns count of successfully read bytes.
+ * It does not point to iovec entry associated to last successful
+ * byte read. The correlation between bytes read and corresponding
+ * iovec is setup through analyze_iov function.
+ *
+ * If all iovecs are not processed in one go, it means there exists
+ * some faulty iov entry(memory mapping modified after it was grabbed)
+ * in iovec. process_vm_readv syscall stops at such faulty iov and
+ * skip processing further any entry in iovec. This is handled by
+ * handle_faulty_iov function.
+ */
+static long fill_userbuf(int pid, struct page_pipe_buf *ppb, struct iovec *bufvec, struct iovec *aux_iov,
+			 unsigned long *aux_len)
+{
+	struct iovec *riov = ppb->iov;
+	ssize_t bytes_read;
+	unsigned long total_read = 0;
+	unsigned long start = 0;
+
+	while (start < ppb->nr_segs) {
+		bytes_read = process_vm_readv(pid, bufvec, 1, &riov[start], ppb->nr_segs - start, 0);
+		if (bytes_read == -1) {
+			if (errno == ESRCH) {
+				pr_debug("Target process PID:%d not found\n", pid);
+				return -ESRCH;
+			}
+			if (errno != EFAULT) {
+				pr_perror("process_vm_readv failed");
+				return -1;
+			}
+			/* Handling Case 1*/
+			if (riov[start].iov_len == PAGE_SIZE) {
+				cnt_sub(CNT_PAGES_WRITTEN, 1);
+				start += 1;
+				continue;
+			}
+			total_read += handle_faulty_iov(pid, riov, start, bufvec, aux_iov, aux_len);
+			start += 1;
+			continue;
+		}
+
+		if (bytes_read > 0) {
+			if (analyze_iov(bytes_read, riov, &start, aux_iov, aux_len) < 0)
+				return -1;
+			bufvec->iov_base += bytes_read;
+			bufvec->iov_len -= bytes_read;
+			total_read += bytes_read;
+		}
+	}
+
+	return total_read;
+}
+
+/*
+ * Batched pre-dump reading (--pre-dump-mode=read-batch)
+ * ======================================================
+ *
+ * The plain read mode above handles one page-pipe buffer at a time
+ * and, once process_vm_readv stumbles upon a missing page, walks the
+ * faulty iov page by page. For big tasks this stalls on every iov.
+ *
+ * Here a bunch of page-pipe buffers (up to PREDUMP_BATCH_PAGES) is read
+ * in one go. Before reading, every iov is clipped against the readable
+ * VMAs from /proc/pid/maps, so ranges unmapped or mprotect-ed since the
+ * pages were collected are skipped without touching them. The clipped
+ * segments are then split between several threads, each reading its
+ * part with process_vm_readv in IOV_MAX-sized vectors. A page that still
+ * faults (e.g. a truncated file mapping) is just marked as not read.
+ *
+ * After the threads are done, the read pages are vmspliced into the
+ * page-pipe buffers and written out in order, like the read mode does.
+ */
+
+#define PREDUMP_BATCH_PAGES (16 * PIPE_MAX_SIZE)
+#define PREDUMP_MAX_THREADS 8
+#define PREDUMP_IOV_BATCH   IOV_MAX
+
+struct vma_bound {
+	unsigned long start;
+	unsigned long end;
+};
+
+struct predump_batch {
+	int pid;
+	void *buf;
+	unsigned char *read; /* per-page marks, 1 if the page was read */
+
+	/* segments, clipped to readable VMAs */
+	struct iovec *riov;
+	unsigned long *buf_off;
+	struct page_pipe_buf **ppb;
+	unsigned long nr_segs;
+	unsigned long max_segs;
+	unsigned long nr_pages;
+};
+
+struct predump_worker {
+	struct predump_batch *b;
+	unsigned long first, last;
+	int err;
+	bool threaded;
+	pthread_t thread;
+};
+
+static int collect_vma_bounds(int pid, struct vma_bound **bounds, unsigned long *nr)
+{
+	struct vma_bound *vb = NULL;
+	unsigned long n = 0;
+	char line[512];
+	FILE *f;
+
+	f = fopen_proc(pid, "maps");
+	if (!f)
+		return -1;
+
+	while (fgets(line, sizeof(line), f)) {
+		unsigned long start, end;
+		char r;
+
+		if (sscanf(line, "%lx-%lx %c", &start, &end, &r) != 3) {
+			pr_err("Can't parse maps line: %s\n", line);
+			goto err;
+		}
+
+		/* process_vm_readv doesn't force access, skip unreadable ones */
+		if (r != 'r')
+			continue;
+
+		if (n && vb[n - 1].end == start) {
+			vb[n - 1].end = end;
+			continue;
+		}
+
+		if (!(n & (n - 1))) {
+			void *m = xrealloc(vb, (n ? n * 2 : 64) * sizeof(*vb));
+			if (!m)
+				goto err;
+			vb = m;
+		}
+
+		vb[n].start = start;
+		vb[n].end = end;
+		n++;
+	}
+
+	fclose(f);
+	*bounds = vb;
+	*nr = n;
+	return 0;
+
+err:
+	fclose(f);
+	xfree(vb);
+	return -1;
+}
+
+/* Find the first readable VMA that ends above @addr */
+static unsigned long find_vma_bound(struct vma_bound *vb, unsigned long nr, unsigned long addr)
+{
+	unsigned long lo = 0, hi = nr;
+
+	while (lo < hi) {
+		unsigned long mid = (lo + hi) / 2;
+
+		if (vb[mid].end <= addr)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	return lo;
+}
+
+static int predump_add_seg(struct predump_batch *b, struct page_pipe_buf *ppb, unsigned long start,
+			   unsigned long end)
+{
+	if (b->nr_segs == b->max_segs) {
+		unsigned long n = b->max_segs ? b->max_segs * 2 : 256;
+		void *m;
+
+		m = xrealloc(b->riov, n * sizeof(*b->riov));
+		if (!m)
+			return -1;
+		b->riov = m;
+		m = xrealloc(b->buf_off, n * sizeof(*b->buf_off));
+		if (!m)
+			return -1;
+		b->buf_off = m;
+		m = xrealloc(b->ppb, n * sizeof(*b->ppb));
+		if (!m)
+			return -1;
+		b->ppb = m;
+		b->max_segs = n;
+	}
+
+	b->riov[b->nr_segs].iov_base = (void *)start;
+	b->riov[b->nr_segs].iov_len = end - start;
+	b->buf_off[b->nr_segs] = b->nr_pages * PAGE_SIZE;
+	b->ppb[b->nr_segs] = ppb;
+	b->nr_segs++;
+	b->nr_pages += (end - start) / PAGE_SIZE;
+
+	return 0;
+}
+
+static int predump_clip_ppb(struct predump_batch *b, struct page_pipe_buf *ppb, struct vma_bound *vb,
+			    unsigned long nr_vb)
+{
+	unsigned long skipped = 0;
+	unsigned int i;
+
+	for (i = 0; i < ppb->nr_segs; i++) {
+		unsigned long start = (unsigned long)ppb->iov[i].iov_base;
+		unsigned long end = start + ppb->iov[i].iov_len;
+		unsigned long v = find_vma_bound(vb, nr_vb, start);
+
+		while (start < end) {
+			unsigned long s, e;
+
+			if (v >= nr_vb || vb[v].start >= end) {
+				skipped += end - start;
+				break;
+			}
+
+			s = max(start, vb[v].start);
+			e = min(end, vb[v].end);
+			skipped += s - start;
+
+			if (predump_add_seg(b, ppb, s, e))
+				return -1;
+
+			start = e;
+			v++;
+		}
+	}
+
+	if (skipped) {
+		pr_debug("Skipping %lu unreadable pages\n", skipped / PAGE_SIZE);
+		cnt_sub(CNT_PAGES_WRITTEN, skipped / PAGE_SIZE);
+	}
+
+	return 0;
+}
+
+/* Move the (seg, off) cursor by @len bytes, marking pages as @read */
+static void predump_advance(struct predump_batch *b, unsigned long *seg, unsigned long *off, unsigned long len,
+			    bool read)
+{
+	while (len) {
+		unsigned long chunk = min_t(unsigned long, len, b->riov[*seg].iov_len - *off);
+
+		if (read)
+			memset(b->read + (b->buf_off[*seg] + *off) / PAGE_SIZE, 1, chunk / PAGE_SIZE);
+
+		len -= chunk;
+		*off += chunk;
+		if (*off == b->riov[*seg].iov_len) {
+			(*seg)++;
+			*off = 0;
+		}
+	}
+}
+
+static void *predump_read_segs(void *arg)
+{
+	struct predump_worker *w = arg;
+	struct predump_batch *b = w->b;
+	struct iovec remote[PREDUMP_IOV_BATCH];
+	unsigned long seg = w->first, off = 0;
+
+	while (seg < w->last) {
+		struct iovec local;
+		unsigned long n, total;
+		ssize_t ret;
+
+		remote[0].iov_base = b->riov[seg].iov_base + off;
+		remote[0].iov_len = b->riov[seg].iov_len - off;
+		total = remote[0].iov_len;
+		for (n = 1; n < PREDUMP_IOV_BATCH && seg + n < w->last; n++) {
+			remote[n] = b->riov[seg + n];
+			total += remote[n].iov_len;
+		}
+
+		/* Segments are laid out back-to-back in the buffer */
+		local.iov_base = b->buf + b->buf_off[seg] + off;
+		local.iov_len = total;
+
+		ret = process_vm_readv(b->pid, &local, 1, remote, n, 0);
+		if (ret == -1) {
+			if (errno == ESRCH) {
+				w->err = -ESRCH;
+				return NULL;
+			}
+			if (errno != EFAULT) {
+				pr_perror("process_vm_readv failed");
+				w->err = -1;
+				return NULL;
+			}
+			ret = 0;
+		}
+
+		ret -= ret % PAGE_SIZE;
+		predump_advance(b, &seg, &off, ret, true);
+
+		/* The page under the cursor faulted, step over it */
+		if (ret < total)
+			predump_advance(b, &seg, &off, PAGE_SIZE, false);
+	}
+
+	return NULL;
+}
+
+static int predump_read_batch(struct predump_batch *b)
+{
+	struct predump_worker workers[PREDUMP_MAX_THREADS];
+	unsigned long seg = 0, per_worker, nr_cpus;
+	int i, nr = 0, ret = 0;
+
+	nr_cpus = max(sysconf(_SC_NPROCESSORS_ONLN), 1L);
+	per_worker = DIV_ROUND_UP(b->nr_pages, min(nr_cpus, (unsigned long)PREDUMP_MAX_THREADS));
+
+	memset(b->read, 0, b->nr_pages);
+
+	while (seg < b->nr_segs) {
+		struct predump_worker *w = &workers[nr];
+		unsigned long pages = 0;
+
+		w->b = b;
+		w->err = 0;
+		w->first = seg;
+		do
+			pages += b->riov[seg++].iov_len / PAGE_SIZE;
+		while (seg < b->nr_segs && (pages < per_worker || nr == PREDUMP_MAX_THREADS - 1));
+		w->last = seg;
+
+		/* The last chunk is read by ourselves */
+		w->threaded = false;
+		if (seg < b->nr_segs) {
+			w->threaded = !pthread_create(&w->thread, NULL, predump_read_segs, w);
+			if (!w->threaded)
+				pr_warn("Can't start pre-dump reader thread, reading inline\n");
+		}
+		if (!w->threaded)
+			predump_read_segs(w);
+		nr++;
+	}
+
+	for (i = 0; i < nr; i++) {
+		struct predump_worker *w = &workers[i];
+
+		if (w->threaded && pthread_join(w->thread, NULL)) {
+			pr_err("Can't join pre-dump reader thread\n");
+			ret = -1;
+		}
+		if (w->err == -ESRCH && ret == 0)
+			ret = -ESRCH;
+		else if (w->err)
+			ret = -1;
+	}
+
+	return ret;
 }
 
-/*
- * This function will position start pointer to the latest
- * successfully read iov in iovec.
- */
-static unsigned long analyze_iov(ssize_t bytes_read, struct iovec *riov, unsigned long *index, struct iovec *aux_iov,
-				 unsigned long *aux_len)
+static int predump_write_batch(struct predump_batch *b, struct page_xfer *xfer, struct page_pipe *pp,
+			       unsigned int *cur_hole)
 {
-	ssize_t processed_bytes = 0;
+	unsigned long seg, unread = 0;
+
+	for (seg = 0; seg < b->nr_segs; seg++) {
+		unsigned long pages = b->riov[seg].iov_len / PAGE_SIZE;
+		unsigned long first = b->buf_off[seg] / PAGE_SIZE;
+		unsigned long i = 0;
+
+		while (i < pages) {
+			struct page_pipe_buf *ppb = b->ppb[seg];
+			struct iovec iov, local;
+			unsigned long run;
+			ssize_t ret;
+
+			if (!b->read[first + i]) {
+				unread++;
+				i++;
+				continue;
+			}
 
-	/* correlating iovs with read bytes */
-	while (processed_bytes < bytes_read) {
-		processed_bytes += riov[*index].iov_len;
-		aux_iov[*aux_len].iov_base = riov[*index].iov_base;
-		aux_iov[*aux_len].iov_len = riov[*index].iov_len;
+			for (run = 1; i + run < pages && b->read[first + i + run]; run++)
+				;
 
-		(*aux_len) += 1;
-		(*index) += 1;
-	}
+			local.iov_base = b->buf + (first + i) * PAGE_SIZE;
+			local.iov_len = run * PAGE_SIZE;
+			ret = vmsplice(ppb->p[1], &local, 1, SPLICE_F_NONBLOCK | SPLICE_F_GIFT);
+			if (ret != local.iov_len) {
+				pr_err("vmsplice: Failed to splice user buffer to pipe %zd\n", ret);
+				return -1;
+			}
 
-	/* handling partially processed faulty iov*/
-	if (processed_bytes - bytes_read) {
-		unsigned long partial_read_bytes = 0;
+			iov.iov_base = b->riov[seg].iov_base + i * PAGE_SIZE;
+			iov.iov_len = local.iov_len;
 
-		(*index) -= 1;
+			if (dump_holes(xfer, pp, cur_hole, iov.iov_base))
+				return -1;
 
-		partial_read_bytes = riov[*index].iov_len - (processed_bytes - bytes_read);
-		aux_iov[*aux_len - 1].iov_len = partial_read_bytes;
-		riov[*index].iov_base += partial_read_bytes;
-		riov[*index].iov_len -= partial_read_bytes;
+			BUG_ON(iov.iov_base < (void *)xfer->offset);
+			iov.iov_base -= xfer->offset;
+			pr_debug("\t p %p [%lu]\n", iov.iov_base, run);
+
+			if (xfer->write_pagemap(xfer, &iov, ppb_xfer_flags(xfer, ppb)))
+				return -1;
+			if (xfer->write_pages(xfer, ppb->p[0], iov.iov_len))
+				return -1;
+
+			i += run;
+		}
+	}
+
+	if (unread) {
+		pr_debug("%lu pages faulted while reading\n", unread);
+		cnt_sub(CNT_PAGES_WRITTEN, unread);
 	}
 
 	return 0;
 }
 
-/*
- * This function iterates over complete ppb->iov entries and pass
- * them to process_vm_readv syscall.
- *
- * Since process_vm_readv returns count of successfully read bytes.
- * It does not point to iovec entry associated to last successful
- * byte read. The correlation between bytes read and corresponding
- * iovec is setup through analyze_iov function.
- *
- * If all iovecs are not processed in one go, it means there exists
- * some faulty iov entry(memory mapping modified after it was grabbed)
- * in iovec. process_vm_readv syscall stops at such faulty iov and
- * skip processing further any entry in iovec. This is handled by
- * handle_faulty_iov function.
- */
-static long fill_userbuf(int pid, struct page_pipe_buf *ppb, struct iovec *bufvec, struct iovec *aux_iov,
-			 unsigned long *aux_len)
+static int predump_pages_batched(int pid, struct page_xfer *xfer, struct page_pipe *pp)
 {
-	struct iovec *riov = ppb->iov;
-	ssize_t bytes_read;
-	unsigned long total_read = 0;
-	unsigned long start = 0;
+	struct predump_batch b = { .pid = pid };
+	struct page_pipe_buf *ppb, *first;
+	struct vma_bound *vb = NULL;
+	unsigned long nr_vb = 0;
+	unsigned int cur_hole = 0;
+	int ret = -1;
 
-	while (start < ppb->nr_segs) {
-		bytes_read = process_vm_readv(pid, bufvec, 1, &riov[start], ppb->nr_segs - start, 0);
-		if (bytes_read == -1) {
-			if (errno == ESRCH) {
-				pr_debug("Target process PID:%d not found\n", pid);
-				return -ESRCH;
-			}
-			if (errno != EFAULT) {
-				pr_perror("process_vm_readv failed");
-				return -1;
-			}
-			/* Handling Case 1*/
-			if (riov[start].iov_len == PAGE_SIZE) {
-				cnt_sub(CNT_PAGES_WRITTEN, 1);
-				start += 1;
-				continue;
-			}
-			total_read += handle_faulty_iov(pid, riov, start, bufvec, aux_iov, aux_len);
-			start += 1;
-			continue;
-		}
+	b.buf = mmap(NULL, PREDUMP_BATCH_PAGES * PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
+	if (b.buf == MAP_FAILED) {
+		pr_perror("Unable to mmap a buffer");
+		return -1;
+	}
 
-		if (bytes_read > 0) {
-			if (analyze_iov(bytes_read, riov, &start, aux_iov, aux_len) < 0)
-				return -1;
-			bufvec->iov_base += bytes_read;
-			bufvec->iov_len -= bytes_read;
-			total_read += bytes_read;
+	b.read = xmalloc(PREDUMP_BATCH_PAGES);
+	if (!b.read)
+		goto out;
+
+	if (collect_vma_bounds(pid, &vb, &nr_vb)) {
+		/* The task has gone, there's nothing to pre-dump */
+		if (errno == ENOENT || errno == ESRCH)
+			ret = 0;
+		goto out;
+	}
+
+	ppb = list_first_entry(&pp->bufs, struct page_pipe_buf, l);
+	while (&ppb->l != &pp->bufs) {
+		first = ppb;
+		b.nr_segs = 0;
+		b.nr_pages = 0;
+
+		/* Take as many buffers as fit the batch, but at least one */
+		do {
+			if (predump_clip_ppb(&b, ppb, vb, nr_vb))
+				goto out;
+			ppb = list_entry(ppb->l.next, struct page_pipe_buf, l);
+		} while (&ppb->l != &pp->bufs && b.nr_pages + ppb->pages_in <= PREDUMP_BATCH_PAGES);
+
+		pr_debug("Reading batch of %lu pages in %lu segments from %p\n", b.nr_pages, b.nr_segs,
+			 first->iov[0].iov_base);
+
+		timing_start(TIME_MEMDUMP);
+		ret = predump_read_batch(&b);
+		timing_stop(TIME_MEMDUMP);
+		if (ret == -ESRCH) {
+			pr_debug("Target process PID:%d not found\n", pid);
+			ret = 0;
+			goto out;
 		}
+		if (ret)
+			goto out;
+
+		timing_start(TIME_MEMWRITE);
+		ret = predump_write_batch(&b, xfer, pp, &cur_hole);
+		timing_stop(TIME_MEMWRITE);
+		if (ret)
+			goto out;
 	}
 
-	return total_read;
+	timing_start(TIME_MEMWRITE);
+	ret = dump_holes(xfer, pp, &cur_hole, NULL);
+out:
+	munmap(b.buf, PREDUMP_BATCH_PAGES * PAGE_SIZE);
+	xfree(b.read);
+	xfree(b.riov);
+	xfree(b.buf_off);
+	xfree(b.ppb);
+	xfree(vb);
+	return ret;
 }
 
 /*
@@ -769,6 +1673,9 @@ int page_xfer_predump_pages(int pid, struct page_xfer *xfer, struct page_pipe *p
 	unsigned long aux_len;
 	void *userbuf;
 
+	if (opts.pre_dump_mode == PRE_DUMP_READ_BATCH)
+		return predump_pages_batched(pid, xfer, pp);
+
 	userbuf_len = PIPE_MAX_BUFFER_SIZE;
 	userbuf = mmap(NULL, userbuf_len, PROT_READ | PROT_WRITE, MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
 	if (userbuf == MAP_FAILED) {
@@ -997,21 +1904,29 @@ static struct pipe_read_dest pipe_read_dest = {
 	.sink_fd = -1,
 };
 
-static void page_server_close(void)
+static int page_server_close(void)
 {
-	if (cxfer.dst_id != ~0)
-		cxfer.loc_xfer.close(&cxfer.loc_xfer);
+	int ret = 0;
+
+	if (cxfer.dst_id != ~0) {
+		ret = cxfer.loc_xfer.close(&cxfer.loc_xfer);
+		cxfer.dst_id = ~0;
+	}
 	if (pipe_read_dest.sink_fd != -1) {
 		close(pipe_read_dest.sink_fd);
 		close(pipe_read_dest.p[0]);
 		close(pipe_read_dest.p[1]);
+		pipe_read_dest.sink_fd = -1;
 	}
+
+	return ret;
 }
 
 static int page_server_open(int sk, struct page_server_iov *pi)
 {
 	int type;
 	unsigned long id;
+	bool compress = false, csum = false;
 
 	type = decode_pm(pi->dst_id, &id);
 	if (type == -1) {
@@ -1021,18 +1936,36 @@ static int page_server_open(int sk, struct page_server_iov *pi)
 
 	pr_info("Opening %d/%lu\n", type, id);
 
-	page_server_close();
+	if (page_server_close())
+		return -1;
+
+	/* Only PS_IOV_OPEN2 carries open flags */
+	if (sk >= 0 && (decode_ps_flags(pi->cmd) & PS_OPEN_COMPRESS)) {
+		compress = pages_comp_supported();
+		if (!compress)
+			pr_warn("Compression requested, but not supported, storing pages raw\n");
+		csum = decode_ps_flags(pi->cmd) & PS_OPEN_CSUM;
+	}
 
-	if (open_page_local_xfer(&cxfer.loc_xfer, type, id))
+	if (open_page_local_xfer(&cxfer.loc_xfer, type, id, compress, csum))
 		return -1;
 
 	cxfer.dst_id = pi->dst_id;
 
 	if (sk >= 0) {
-		char has_parent = !!cxfer.loc_xfer.parent;
-		if (__send(sk, &has_parent, 1, 0) != 1) {
+		char reply = 0;
+
+		if (cxfer.loc_xfer.parent)
+			reply |= PS_OPEN_HAS_PARENT;
+		if (compress)
+			reply |= PS_OPEN_COMPRESSED;
+		if (csum)
+			reply |= PS_OPEN_CSUMMED;
+
+		if (__send(sk, &reply, 1, 0) != 1) {
 			pr_perror("Unable to send response");
 			close_page_xfer(&cxfer.loc_xfer);
+			cxfer.dst_id = ~0;
 			return -1;
 		}
 	}
@@ -1067,6 +2000,9 @@ static int page_server_add(int sk, struct page_server_iov *pi, u32 flags)
 	if (!(flags & PE_PRESENT))
 		return 0;
 
+	if (ps_nr_stripes)
+		return lxfer->write_pages(lxfer, ps_stripes[ps_stripe_next()].p[0], iov.iov_len);
+
 	len = iov.iov_len;
 	while (len > 0) {
 		ssize_t chunk;
@@ -1089,14 +2025,26 @@ static int page_server_add(int sk, struct page_server_iov *pi, u32 flags)
 			return -1;
 		}
 
-		if (opts.tls) {
+		if (tls_user_rx()) {
 			if (tls_recv_data_to_fd(cxfer.p[1], chunk)) {
 				pr_err("Can't read from socket\n");
 				return -1;
 			}
 		} else {
-			chunk = splice(sk, NULL, cxfer.p[1], NULL, chunk, SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+			ssize_t ret;
+
+			ret = splice(sk, NULL, cxfer.p[1], NULL, chunk, SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+
+			/*
+			 * Kernel TLS may still wait for the rest of a record. The
+			 * socket polls readable as soon as a part of it is queued,
+			 * so polling again would only spin. The pipe is empty, thus
+			 * the blocking splice sleeps on the socket only.
+			 */
+			if (ret < 0 && errno == EAGAIN && opts.tls)
+				ret = splice(sk, NULL, cxfer.p[1], NULL, chunk, SPLICE_F_MOVE);
 
+			chunk = ret;
 			if (chunk < 0) {
 				pr_perror("Can't read from socket");
 				return -1;
@@ -1146,7 +2094,7 @@ static int page_server_get_pages(int sk, struct page_server_iov *pi)
 
 	len = pi->nr_pages * PAGE_SIZE;
 
-	if (opts.tls) {
+	if (tls_user_tx()) {
 		if (tls_send_data_from_fd(pipe_read_dest.p[0], len))
 			return -1;
 	} else {
@@ -1160,6 +2108,78 @@ static int page_server_get_pages(int sk, struct page_server_iov *pi)
 	return 0;
 }
 
+/*
+ * Requests from lazy-pages are queued while the socket has more of
+ * them, then the urgent ones are served first, the rest in order.
+ */
+struct ps_get_req {
+	struct page_server_iov pi;
+	struct list_head l;
+};
+
+static LIST_HEAD(ps_get_queue);
+
+static bool page_server_has_requests(int sk)
+{
+	int avail;
+
+	/* With TLS the data may be buffered in the session */
+	if (opts.tls)
+		return false;
+
+	if (ioctl(sk, FIONREAD, &avail) < 0) {
+		pr_perror("Can't check the socket queue");
+		return false;
+	}
+
+	return avail >= (int)sizeof(struct page_server_iov);
+}
+
+static int page_server_queue_get(struct page_server_iov *pi)
+{
+	struct ps_get_req *req;
+
+	req = xmalloc(sizeof(*req));
+	if (!req)
+		return -1;
+
+	req->pi = *pi;
+	list_add_tail(&req->l, &ps_get_queue);
+	return 0;
+}
+
+static int page_server_serve_queued(int sk)
+{
+	struct ps_get_req *req, *first = NULL;
+	int ret;
+
+	list_for_each_entry(req, &ps_get_queue, l) {
+		if (decode_ps_flags(req->pi.cmd) & PS_GET_URGENT) {
+			first = req;
+			break;
+		}
+	}
+
+	if (!first)
+		first = list_first_entry(&ps_get_queue, struct ps_get_req, l);
+
+	list_del(&first->l);
+	ret = page_server_get_pages(sk, &first->pi);
+	xfree(first);
+
+	return ret;
+}
+
+static void page_server_drop_queued(void)
+{
+	struct ps_get_req *req, *n;
+
+	list_for_each_entry_safe(req, n, &ps_get_queue, l) {
+		list_del(&req->l);
+		xfree(req);
+	}
+}
+
 static int page_server_serve(int sk)
 {
 	int ret = -1;
@@ -1191,6 +2211,13 @@ static int page_server_serve(int sk)
 		struct page_server_iov pi;
 		u32 cmd;
 
+		if (!list_empty(&ps_get_queue) && !page_server_has_requests(sk)) {
+			ret = page_server_serve_queued(sk);
+			if (ret)
+				break;
+			continue;
+		}
+
 		ret = __recv(sk, &pi, sizeof(pi), MSG_WAITALL);
 		if (!ret)
 			break;
@@ -1204,7 +2231,22 @@ static int page_server_serve(int sk)
 		flushed = false;
 		cmd = decode_ps_cmd(pi.cmd);
 
+		/* Whatever comes after the requests is handled after them */
+		while (cmd != PS_IOV_GET && !list_empty(&ps_get_queue)) {
+			ret = page_server_serve_queued(sk);
+			if (ret)
+				goto out;
+		}
+
+		/* Stripes can only be set up before anything else */
+		if (cmd != PS_IOV_STRIPE)
+			close_safe(&ps_listen_sk);
+
 		switch (cmd) {
+		case PS_IOV_STRIPE:
+			ret = page_server_stripe(sk, &pi);
+			close_safe(&ps_listen_sk);
+			break;
 		case PS_IOV_OPEN:
 			ret = page_server_open(-1, &pi);
 			break;
@@ -1231,10 +2273,19 @@ static int page_server_serve(int sk)
 		}
 		case PS_IOV_CLOSE:
 		case PS_IOV_FORCE_CLOSE: {
-			int32_t status = 0;
+			int32_t status;
 
 			ret = 0;
 
+			/*
+			 * Finish the images before answering, so that
+			 * a failure to flush them (e.g. the compressed
+			 * pages tail) is reported to the dumping side.
+			 */
+			status = page_server_close() ? -1 : 0;
+			if (ps_stripes_fini(false))
+				status = -1;
+
 			/*
 			 * An answer must be sent back to inform another side,
 			 * that all data were received
@@ -1248,7 +2299,7 @@ static int page_server_serve(int sk)
 			break;
 		}
 		case PS_IOV_GET:
-			ret = page_server_get_pages(sk, &pi);
+			ret = page_server_queue_get(&pi);
 			break;
 		default:
 			pr_err("Unknown command %u\n", pi.cmd);
@@ -1262,6 +2313,9 @@ static int page_server_serve(int sk)
 			break;
 	}
 
+out:
+	page_server_drop_queued();
+
 	if (receiving_pages && !ret && !flushed) {
 		pr_err("The data were not flushed\n");
 		ret = -1;
@@ -1283,6 +2337,8 @@ static int page_server_serve(int sk)
 	}
 
 	page_server_close();
+	ps_stripes_fini(true);
+	close_safe(&ps_listen_sk);
 
 	pr_info("Session over\n");
 
@@ -1290,9 +2346,47 @@ static int page_server_serve(int sk)
 	return ret;
 }
 
+/*
+ * Compressed images can't be spliced from, so the pages are
+ * decompressed into a bounce buffer and copied into the pipe.
+ */
+static int fill_ppb_compressed(struct page_read *pr, struct page_pipe_buf *ppb, off_t *off)
+{
+	void *buf;
+	int i, ret = -1;
+
+	buf = xmalloc(PAGES_COMP_BLOCK_SIZE);
+	if (!buf)
+		return -1;
+
+	for (i = 0; i < ppb->nr_segs; i++) {
+		size_t len = ppb->iov[i].iov_len;
+
+		while (len > 0) {
+			size_t chunk = min_t(size_t, len, PAGES_COMP_BLOCK_SIZE);
+
+			if (pages_comp_read(pr->comp, buf, chunk, *off))
+				goto out;
+			if (write(ppb->p[1], buf, chunk) != chunk) {
+				pr_perror("Can't write pages into pipe");
+				goto out;
+			}
+
+			*off += chunk;
+			len -= chunk;
+		}
+	}
+
+	ret = 0;
+out:
+	xfree(buf);
+	return ret;
+}
+
 static int fill_page_pipe(struct page_read *pr, struct page_pipe *pp)
 {
 	struct page_pipe_buf *ppb;
+	off_t off = 0;
 	int i, ret;
 
 	pr->reset(pr);
@@ -1313,6 +2407,12 @@ static int fill_page_pipe(struct page_read *pr, struct page_pipe *pp)
 	}
 
 	list_for_each_entry(ppb, &pp->bufs, l) {
+		if (pr->comp) {
+			if (fill_ppb_compressed(pr, ppb, &off))
+				return -1;
+			continue;
+		}
+
 		for (i = 0; i < ppb->nr_segs; i++) {
 			struct iovec iov = ppb->iov[i];
 
@@ -1427,9 +2527,24 @@ no_server:
 		}
 	}
 
+	/*
+	 * run_tcp_server() closes the listening socket after the first
+	 * connection, keep a copy to accept the stripes on.
+	 */
+	if (sk >= 0 && !opts.lazy_pages && !opts.tls) {
+		ps_listen_sk = dup(sk);
+		if (ps_listen_sk < 0) {
+			pr_perror("Can't keep the page server socket");
+			close(sk);
+			return -1;
+		}
+	}
+
 	ret = run_tcp_server(daemon_mode, &ask, cfd, sk);
-	if (ret != 0)
+	if (ret != 0) {
+		close_safe(&ps_listen_sk);
 		return ret > 0 ? 0 : -1;
+	}
 
 	if (tls_x509_init(ask, true)) {
 		close_safe(&sk);
@@ -1450,6 +2565,9 @@ static int connect_to_page_server(void)
 	if (!opts.use_page_server)
 		return 0;
 
+	/* Leftovers of a failed session must not leak into this one */
+	psi_batch_nr = 0;
+
 	if (opts.ps_socket != -1) {
 		page_server_sk = opts.ps_socket;
 		pr_info("Re-using ps socket %d\n", page_server_sk);
@@ -1476,7 +2594,23 @@ out:
 
 int connect_to_page_server_to_send(void)
 {
-	return connect_to_page_server();
+	if (connect_to_page_server())
+		return -1;
+
+	if (!opts.use_page_server || opts.ps_streams <= 1)
+		return 0;
+
+	if (opts.ps_socket != -1) {
+		pr_warn("Can't use several streams with --ps-socket, sending pages over one\n");
+		return 0;
+	}
+
+	if (ps_stripes_connect(opts.ps_streams)) {
+		close_safe(&page_server_sk);
+		return -1;
+	}
+
+	return 0;
 }
 
 int disconnect_from_page_server(void)
@@ -1493,6 +2627,10 @@ int disconnect_from_page_server(void)
 
 	pr_info("Disconnect from the page server\n");
 
+	/* All the pages must be in the stripes before the server is told to close */
+	if (ps_stripes_fini(false))
+		goto out;
+
 	if (opts.ps_socket != -1)
 		/*
 		 * The socket might not get closed (held by
@@ -1541,17 +2679,21 @@ static inline void async_read_set_goal(struct ps_async_read *ar, int nr_pages)
 	ar->nr_pages = nr_pages;
 }
 
-static void init_ps_async_read(struct ps_async_read *ar, void *buf, int nr_pages, ps_async_read_complete complete,
-			       void *priv)
+static void init_ps_async_read(struct ps_async_read *ar, unsigned long img_id, unsigned long vaddr, void *buf,
+			       int nr_pages, ps_async_read_complete complete, void *priv)
 {
 	ar->pages = buf;
 	ar->rb = 0;
 	ar->complete = complete;
 	ar->priv = priv;
+	/* The answer is matched by these two */
+	ar->pi.dst_id = img_id;
+	ar->pi.vaddr = vaddr;
 	async_read_set_goal(ar, nr_pages);
 }
 
-static int page_server_start_async_read(void *buf, int nr_pages, ps_async_read_complete complete, void *priv)
+static int page_server_start_async_read(unsigned long img_id, unsigned long vaddr, void *buf, int nr_pages,
+					ps_async_read_complete complete, void *priv)
 {
 	struct ps_async_read *ar;
 
@@ -1559,7 +2701,7 @@ static int page_server_start_async_read(void *buf, int nr_pages, ps_async_read_c
 	if (ar == NULL)
 		return -1;
 
-	init_ps_async_read(ar, buf, nr_pages, complete, priv);
+	init_ps_async_read(ar, img_id, vaddr, buf, nr_pages, complete, priv);
 	list_add_tail(&ar->l, &async_reads);
 	return 0;
 }
@@ -1568,10 +2710,10 @@ static int page_server_start_async_read(void *buf, int nr_pages, ps_async_read_c
  * There are two possible event types we need to handle:
  * - page info is available as a reply to request_remote_page
  * - page data is available, and it follows page info we've just received
- * Since the on dump side communications are completely synchronous,
- * we can return to epoll right after the reception of page info and
- * for sure the next time socket event will occur we'll get page data
- * related to info we've just received
+ * The data always follows its page info, so we can return to epoll
+ * right after the reception of page info and for sure the next time
+ * socket event will occur we'll get page data related to info we've
+ * just received
  */
 static int page_server_read(struct ps_async_read *ar, int flags)
 {
@@ -1612,17 +2754,68 @@ static int page_server_read(struct ps_async_read *ar, int flags)
 	return ar->complete((int)ar->pi.dst_id, (unsigned long)ar->pi.vaddr, (int)ar->pi.nr_pages, ar->priv);
 }
 
-static int page_server_async_read(struct epoll_rfd *f)
+/*
+ * Several requests may be in flight and the server answers the urgent
+ * ones first, so the answer is matched with the request by the image
+ * id and address. These are unique, as a range is never requested
+ * twice at a time.
+ */
+static struct ps_async_read *find_async_read(struct page_server_iov *pi)
 {
 	struct ps_async_read *ar;
+
+	list_for_each_entry(ar, &async_reads, l)
+		if (ar->pi.dst_id == pi->dst_id && ar->pi.vaddr == pi->vaddr)
+			return ar;
+
+	return NULL;
+}
+
+/* Page info being received and the request it answers */
+static struct page_server_iov async_pi;
+static unsigned long async_pi_rb;
+static struct ps_async_read *async_ar;
+
+static int page_server_async_read(struct epoll_rfd *f)
+{
+	struct ps_async_read *ar = async_ar;
 	int ret;
 
 	BUG_ON(list_empty(&async_reads));
-	ar = list_first_entry(&async_reads, struct ps_async_read, l);
+
+	if (!ar) {
+		ret = __recv(page_server_sk, (void *)&async_pi + async_pi_rb, sizeof(async_pi) - async_pi_rb,
+			     MSG_DONTWAIT);
+		if (ret < 0) {
+			if (errno == EAGAIN || errno == EINTR)
+				return 0;
+			pr_perror("Error reading data from page server");
+			return -1;
+		}
+
+		async_pi_rb += ret;
+		if (async_pi_rb < sizeof(async_pi))
+			return 0;
+		async_pi_rb = 0;
+
+		ar = find_async_read(&async_pi);
+		if (!ar) {
+			pr_err("Unexpected pages %" PRIx64 " for %" PRIu64 " from page server\n", async_pi.vaddr,
+			       async_pi.dst_id);
+			return -1;
+		}
+
+		ar->pi = async_pi;
+		ar->rb = sizeof(ar->pi);
+		async_ar = ar;
+	}
+
 	ret = page_server_read(ar, MSG_DONTWAIT);
 
 	if (ret > 0)
 		return 0;
+
+	async_ar = NULL;
 	if (!ret) {
 		list_del(&ar->l);
 		xfree(ar);
@@ -1651,10 +2844,10 @@ int connect_to_page_server_to_recv(int epfd)
 	return epoll_add_rfd(epfd, &ps_rfd);
 }
 
-int request_remote_pages(unsigned long img_id, unsigned long addr, int nr_pages)
+int request_remote_pages(unsigned long img_id, unsigned long addr, int nr_pages, unsigned flags)
 {
 	struct page_server_iov pi = {
-		.cmd = PS_IOV_GET,
+		.cmd = encode_ps_cmd(PS_IOV_GET, (flags & PR_URGENT) ? PS_GET_URGENT : 0),
 		.nr_pages = nr_pages,
 		.vaddr = addr,
 		.dst_id = img_id,
@@ -1668,21 +2861,23 @@ int request_remote_pages(unsigned long img_id, unsigned long addr, int nr_pages)
 	return 0;
 }
 
-static int page_server_start_sync_read(void *buf, int nr, ps_async_read_complete complete, void *priv)
+static int page_server_start_sync_read(unsigned long img_id, unsigned long vaddr, void *buf, int nr,
+				       ps_async_read_complete complete, void *priv)
 {
 	struct ps_async_read ar;
 	int ret = 1;
 
-	init_ps_async_read(&ar, buf, nr, complete, priv);
+	init_ps_async_read(&ar, img_id, vaddr, buf, nr, complete, priv);
 	while (ret == 1)
 		ret = page_server_read(&ar, MSG_WAITALL);
 	return ret;
 }
 
-int page_server_start_read(void *buf, int nr, ps_async_read_complete complete, void *priv, unsigned flags)
+int page_server_start_read(unsigned long img_id, unsigned long vaddr, void *buf, int nr,
+			   ps_async_read_complete complete, void *priv, unsigned flags)
 {
 	if (flags & PR_ASYNC)
-		return page_server_start_async_read(buf, nr, complete, priv);
+		return page_server_start_async_read(img_id, vaddr, buf, nr, complete, priv);
 	else
-		return page_server_start_sync_read(buf, nr, complete, priv);
+		return page_server_start_sync_read(img_id, vaddr, buf, nr, complete, priv);
 }
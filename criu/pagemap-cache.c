@@ -10,6 +10,8 @@
 #include "vma.h"
 #include "mem.h"
 #include "kerndat.h"
+#include "mem-track.h"
+#include "linux/pagemap-scan.h"
 
 #undef LOG_PREFIX
 #define LOG_PREFIX "pagemap-cache: "
@@ -22,6 +24,9 @@
 
 #define PAGEMAP_LEN(addr) (PAGE_PFN(addr) * sizeof(u64))
 
+/* How many ranges one PAGEMAP_SCAN call may report */
+#define PMC_SCAN_REGS 256
+
 /*
  * It's a workaround for a kernel bug. In the 3.19 kernel when pagemap are read
  * for a few vma-s for one read call, it returns incorrect data.
@@ -29,6 +34,9 @@
 */
 static bool pagemap_cache_disabled;
 
+/* Read the pagemap even if PAGEMAP_SCAN is there, to compare the two */
+static bool pagemap_scan_disabled;
+
 static inline void pmc_reset(pmc_t *pmc)
 {
 	memzero(pmc, sizeof(*pmc));
@@ -43,6 +51,8 @@ static inline void pmc_zap(pmc_t *pmc)
 int pmc_init(pmc_t *pmc, pid_t pid, const struct list_head *vma_head, size_t size)
 {
 	size_t map_size = max(size, (size_t)PMC_SIZE);
+	int ret;
+
 	pmc_reset(pmc);
 
 	BUG_ON(!vma_head);
@@ -55,8 +65,21 @@ int pmc_init(pmc_t *pmc, pid_t pid, const struct list_head *vma_head, size_t siz
 	if (!pmc->map)
 		goto err;
 
+	if (kdat.has_pagemap_scan && !pagemap_scan_disabled) {
+		pmc->regs = xmalloc(PMC_SCAN_REGS * sizeof(*pmc->regs));
+		if (!pmc->regs)
+			goto err;
+	}
+
+	ret = mem_track_wp(pid);
+	if (ret < 0)
+		goto err;
+	pmc->wp = ret;
+
 	if (pagemap_cache_disabled)
 		pr_warn_once("The pagemap cache is disabled\n");
+	if (pagemap_scan_disabled)
+		pr_warn_once("PAGEMAP_SCAN is disabled\n");
 
 	if (kdat.pmap == PM_DISABLED) {
 		/*
@@ -92,6 +115,70 @@ static inline u64 *__pmc_get_map(pmc_t *pmc, unsigned long addr)
 	return &pmc->map[PAGE_PFN(addr - pmc->start)];
 }
 
+static u64 pmc_region_pme(pmc_t *pmc, u64 categories)
+{
+	u64 dirty = pmc->wp ? PAGE_IS_WRITTEN : PAGE_IS_SOFT_DIRTY;
+	u64 pme = 0;
+
+	if (categories & PAGE_IS_PRESENT)
+		pme |= PME_PRESENT;
+	if (categories & PAGE_IS_SWAPPED)
+		pme |= PME_SWAP;
+	if (categories & PAGE_IS_FILE)
+		pme |= PME_FILE;
+	if (categories & dirty)
+		pme |= PME_SOFT_DIRTY;
+	/* That's the only PFN anyone looks at */
+	if ((categories & PAGE_IS_PFNZERO) && kdat.pmap == PM_FULL)
+		pme |= kdat.zero_page_pfn & PME_PFRAME_MASK;
+
+	return pme;
+}
+
+/*
+ * Fill the cache with one PAGEMAP_SCAN walk over the present and
+ * swapped pages instead of reading a pagemap entry for every page.
+ * The entries are built out of the reported ranges, the rest of the
+ * map stays zero, as pagemap would have it for the pages not there.
+ */
+static int pmc_scan(pmc_t *pmc, size_t size_map)
+{
+	struct pm_scan_arg arg = {
+		.size = sizeof(arg),
+		.start = pmc->start,
+		.end = pmc->end,
+		.vec = (unsigned long)pmc->regs,
+		.vec_len = PMC_SCAN_REGS,
+		.category_anyof_mask = PAGE_IS_PRESENT | PAGE_IS_SWAPPED,
+		.return_mask = PMC_SCAN_CATEGORIES,
+	};
+
+	memzero(pmc->map, size_map);
+
+	while (arg.start < arg.end) {
+		int nr, i;
+
+		nr = ioctl(pmc->fd, PAGEMAP_SCAN, &arg);
+		if (nr < 0) {
+			pr_perror("Can't scan %d's pagemap", pmc->pid);
+			return -1;
+		}
+
+		for (i = 0; i < nr; i++) {
+			struct page_region *reg = &pmc->regs[i];
+			u64 pme = pmc_region_pme(pmc, reg->categories);
+			unsigned long addr;
+
+			for (addr = reg->start; addr < reg->end; addr += PAGE_SIZE)
+				*__pmc_get_map(pmc, addr) = pme;
+		}
+
+		arg.start = arg.walk_end;
+	}
+
+	return 0;
+}
+
 static int pmc_fill_cache(pmc_t *pmc, const struct vma_area *vma)
 {
 	unsigned long low = vma->e->start & PMC_MASK;
@@ -153,7 +240,12 @@ static int pmc_fill_cache(pmc_t *pmc, const struct vma_area *vma)
 	BUG_ON(pmc->map_len < size_map);
 	BUG_ON(pmc->fd < 0);
 
-	if (pread(pmc->fd, pmc->map, size_map, PAGEMAP_PFN_OFF(pmc->start)) != size_map) {
+	if (pmc->regs) {
+		if (pmc_scan(pmc, size_map)) {
+			pmc_zap(pmc);
+			return -1;
+		}
+	} else if (pread(pmc->fd, pmc->map, size_map, PAGEMAP_PFN_OFF(pmc->start)) != size_map) {
 		pmc_zap(pmc);
 		pr_perror("Can't read %d's pagemap file", pmc->pid);
 		return -1;
@@ -182,10 +274,12 @@ void pmc_fini(pmc_t *pmc)
 {
 	close_safe(&pmc->fd);
 	xfree(pmc->map);
+	xfree(pmc->regs);
 	pmc_reset(pmc);
 }
 
 static void __attribute__((constructor)) pagemap_cache_init(void)
 {
 	pagemap_cache_disabled = (getenv("CRIU_PMC_OFF") != NULL);
+	pagemap_scan_disabled = (getenv("CRIU_PMC_NO_SCAN") != NULL);
 }
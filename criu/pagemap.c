@@ -3,6 +3,8 @@
 #include <unistd.h>
 #include <linux/falloc.h>
 #include <sys/uio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <limits.h>
 
 #include "types.h"
@@ -13,6 +15,8 @@
 #include "restorer.h"
 #include "rst-malloc.h"
 #include "page-xfer.h"
+#include "pages-comp.h"
+#include "pages-cache.h"
 
 #include "fault-injection.h"
 #include "xmalloc.h"
@@ -51,6 +55,10 @@ static int punch_hole(struct page_read *pr, unsigned long off, unsigned long len
 	int ret;
 	struct iovec *bunch = &pr->bunch;
 
+	/* Compressed blocks carry many pages each, nothing to punch */
+	if (pr->comp)
+		return 0;
+
 	if (!cleanup && can_extend_bunch(bunch, off, len)) {
 		pr_debug("pr%lu-%u:Extend bunch len from %zu to %lu\n", pr->img_id, pr->id, bunch->iov_len,
 			 bunch->iov_len + len);
@@ -249,6 +257,9 @@ static int read_local_page(struct page_read *pr, unsigned long vaddr, unsigned l
 	if (pr->sync(pr))
 		return -1;
 
+	if (pr->comp)
+		return pages_comp_read(pr->comp, buf, len, pr->pi_off);
+
 	pr_debug("\tpr%lu-%u Read page from self %lx/%" PRIx64 "\n", pr->img_id, pr->id, pr->cvaddr, pr->pi_off);
 	while (1) {
 		ret = pread(fd, buf + curr, len - curr, pr->pi_off + curr);
@@ -383,9 +394,10 @@ static int maybe_read_page_local(struct page_read *pr, unsigned long vaddr, int
 	 * There's no API in the kernel to start asynchronous
 	 * cached read (or write), so in case someone is asking
 	 * for us for urgent async read, just do the regular
-	 * cached read.
+	 * cached read. Compressed images are always read in
+	 * place, as there's no file range to preadv() from.
 	 */
-	if ((flags & (PR_ASYNC | PR_ASAP)) == PR_ASYNC)
+	if ((flags & (PR_ASYNC | PR_ASAP)) == PR_ASYNC && !pr->comp)
 		ret = pagemap_enqueue_iovec(pr, buf, len, &pr->async);
 	else {
 		ret = read_local_page(pr, vaddr, len, buf);
@@ -463,14 +475,115 @@ static int read_page_complete(unsigned long img_id, unsigned long vaddr, int nr_
 	return ret;
 }
 
+struct cached_read {
+	struct page_read *pr;
+	void *buf;
+	off_t off;
+	/* for the hits held in ->cache_held */
+	unsigned long vaddr;
+	int nr;
+	struct list_head l;
+};
+
+static int read_page_hit(struct page_read *pr, unsigned long vaddr, int nr, void *buf, off_t off)
+{
+	int ret;
+
+	pr_debug("pr%lu-%u Read %lx %u pages from cache\n", pr->img_id, pr->id, vaddr, nr);
+	ret = pages_cache_read(pr->cache, buf, nr * PAGE_SIZE, off);
+	if (!ret && pr->io_complete)
+		ret = pr->io_complete(pr, vaddr, nr);
+	return ret;
+}
+
+static int read_held_hits(struct page_read *pr)
+{
+	struct cached_read *cr, *n;
+	int ret = 0;
+
+	list_for_each_entry_safe(cr, n, &pr->cache_held, l) {
+		list_del(&cr->l);
+		if (!ret)
+			ret = read_page_hit(pr, cr->vaddr, cr->nr, cr->buf, cr->off);
+		xfree(cr);
+	}
+
+	return ret;
+}
+
+static int read_page_complete_cached(unsigned long img_id, unsigned long vaddr, int nr_pages, void *priv)
+{
+	struct cached_read *cr = priv;
+	struct page_read *pr = cr->pr;
+	int ret;
+
+	pages_cache_store(pr->cache, cr->buf, nr_pages * PAGE_SIZE, cr->off);
+	ret = read_page_complete(img_id, vaddr, nr_pages, pr);
+	pr->nr_remote--;
+	xfree(cr);
+
+	/*
+	 * The data of one remote read is received at a time, so the
+	 * buffer is free until the next one starts landing into it.
+	 */
+	if (!ret)
+		ret = read_held_hits(pr);
+
+	return ret;
+}
+
+/*
+ * Remote reads may be in flight and receiving into the very same buffer
+ * the hits would be read into, so the asynchronous hits are held until
+ * the next of them completes.
+ */
+static int maybe_read_page_cached(struct page_read *pr, unsigned long vaddr, int nr, void *buf, unsigned flags)
+{
+	unsigned long len = nr * PAGE_SIZE;
+	bool hit = pages_cache_has(pr->cache, pr->pi_off, len);
+	struct cached_read *cr;
+	int ret;
+
+	if (hit && (!pr->nr_remote || !(flags & PR_ASYNC)))
+		return read_page_hit(pr, vaddr, nr, buf, pr->pi_off);
+
+	cr = xmalloc(sizeof(*cr));
+	if (!cr)
+		return -1;
+
+	cr->pr = pr;
+	cr->buf = buf;
+	cr->off = pr->pi_off;
+
+	if (hit) {
+		cr->vaddr = vaddr;
+		cr->nr = nr;
+		list_add_tail(&cr->l, &pr->cache_held);
+		return 0;
+	}
+
+	pr->nr_remote++;
+	ret = request_remote_pages(pr->img_id, vaddr, nr, flags);
+	if (!ret)
+		ret = page_server_start_read(pr->img_id, vaddr, buf, nr, read_page_complete_cached, cr, flags);
+	if (ret) {
+		pr->nr_remote--;
+		xfree(cr);
+	}
+	return ret;
+}
+
 static int maybe_read_page_remote(struct page_read *pr, unsigned long vaddr, int nr, void *buf, unsigned flags)
 {
 	int ret;
 
+	if (pr->cache)
+		return maybe_read_page_cached(pr, vaddr, nr, buf, flags);
+
 	/* We always do PR_ASAP mode here (FIXME?) */
-	ret = request_remote_pages(pr->img_id, vaddr, nr);
+	ret = request_remote_pages(pr->img_id, vaddr, nr, flags);
 	if (!ret)
-		ret = page_server_start_read(buf, nr, read_page_complete, pr, flags);
+		ret = page_server_start_read(pr->img_id, vaddr, buf, nr, read_page_complete, pr, flags);
 	return ret;
 }
 
@@ -492,6 +605,90 @@ static int read_pagemap_page(struct page_read *pr, unsigned long vaddr, int nr,
 	return 1;
 }
 
+/*
+ * Finds the pages at vaddr in the mapped pages images, going to the
+ * parent snapshots if needed. The page_read must be seeked to vaddr.
+ * On return *nr is trimmed to the pages lying in a row in one image.
+ *
+ * Returns 1 with the address of the pages in *src, 0 if the pages can't
+ * be served from a mapping (e.g. the image is compressed) and -1 on error.
+ */
+int pagemap_map_pages(struct page_read *pr, unsigned long vaddr, int *nr, void **src)
+{
+	unsigned long left;
+
+	pagemap_bound_check(pr->pe, vaddr, 1);
+	left = (pr->pe->vaddr + pagemap_len(pr->pe) - vaddr) / PAGE_SIZE;
+	if (*nr > left)
+		*nr = left;
+
+	if (pagemap_in_parent(pr->pe)) {
+		struct page_read *ppr = pr->parent;
+
+		if (!ppr) {
+			pr_err("No parent for snapshot pagemap\n");
+			return -1;
+		}
+
+		if (ppr->seek_pagemap(ppr, vaddr) <= 0) {
+			pr_err("Missing %lx in parent pagemap\n", vaddr);
+			return -1;
+		}
+
+		return pagemap_map_pages(ppr, vaddr, nr, src);
+	}
+
+	if (!pr->mapped || !pagemap_present(pr->pe))
+		return 0;
+
+	if (pr->pi_off + *nr * PAGE_SIZE > pr->pi_map_len) {
+		pr_err("Pages at %lx are beyond the pages-%u image\n", vaddr, pr->pages_img_id);
+		return -1;
+	}
+
+	*src = pr->pi_map + pr->pi_off;
+	return 1;
+}
+
+/*
+ * Finds the page_read, which has the pages at vaddr in its own pages
+ * image at ->pi_off, going to the parent snapshots if needed. The
+ * page_read must be seeked to vaddr. On return *nr is trimmed to the
+ * pages lying in a row in that image.
+ */
+struct page_read *pagemap_locate_pages(struct page_read *pr, unsigned long vaddr, int *nr)
+{
+	unsigned long left;
+
+	pagemap_bound_check(pr->pe, vaddr, 1);
+	left = (pr->pe->vaddr + pagemap_len(pr->pe) - vaddr) / PAGE_SIZE;
+	if (*nr > left)
+		*nr = left;
+
+	if (pagemap_in_parent(pr->pe)) {
+		struct page_read *ppr = pr->parent;
+
+		if (!ppr) {
+			pr_err("No parent for snapshot pagemap\n");
+			return NULL;
+		}
+
+		if (ppr->seek_pagemap(ppr, vaddr) <= 0) {
+			pr_err("Missing %lx in parent pagemap\n", vaddr);
+			return NULL;
+		}
+
+		return pagemap_locate_pages(ppr, vaddr, nr);
+	}
+
+	if (!pagemap_present(pr->pe)) {
+		pr_err("Pages at %lx are not in pr%lu-%u images\n", vaddr, pr->img_id, pr->id);
+		return NULL;
+	}
+
+	return pr;
+}
+
 static void free_pagemaps(struct page_read *pr)
 {
 	int i;
@@ -608,6 +805,17 @@ static void close_page_read(struct page_read *pr)
 		xfree(pr->parent);
 	}
 
+	if (pr->comp)
+		pages_comp_reader_close(pr->comp);
+	if (pr->cache) {
+		struct cached_read *cr, *n;
+
+		list_for_each_entry_safe(cr, n, &pr->cache_held, l)
+			xfree(cr);
+		pages_cache_close(pr->cache);
+	}
+	if (pr->pi_map)
+		munmap(pr->pi_map, pr->pi_map_len);
 	if (pr->pmi)
 		close_image(pr->pmi);
 	if (pr->pi)
@@ -753,17 +961,52 @@ free_pagemaps:
 	return -1;
 }
 
+static int map_pages_image(struct page_read *pr)
+{
+	struct stat st;
+	int fd;
+
+	/*
+	 * Compressed images have no pages to point at, and dedup
+	 * punches holes in the image while we read it.
+	 */
+	if (pr->comp || opts.stream || opts.auto_dedup)
+		return 0;
+
+	fd = img_raw_fd(pr->pi);
+	if (fd < 0 || fstat(fd, &st)) {
+		pr_perror("Can't stat pages-%u image", pr->pages_img_id);
+		return -1;
+	}
+
+	if (st.st_size) {
+		pr->pi_map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+		if (pr->pi_map == MAP_FAILED) {
+			pr->pi_map = NULL;
+			pr_perror("Can't map pages-%u image", pr->pages_img_id);
+			return -1;
+		}
+		pr->pi_map_len = st.st_size;
+	}
+
+	pr->mapped = true;
+	return 0;
+}
+
 int open_page_read_at(int dfd, unsigned long img_id, struct page_read *pr, int pr_flags)
 {
 	int flags, i_typ;
 	static unsigned ids = 1;
 	bool remote = pr_flags & PR_REMOTE;
+	u32 comp;
 
 	/*
 	 * Only the top-most page-read can be remote, all the
 	 * others are always local.
 	 */
 	pr_flags &= ~PR_REMOTE;
+	if (remote)
+		pr_flags &= ~PR_MMAP;
 	if (opts.auto_dedup)
 		pr_flags |= PR_MOD;
 	if (pr_flags & PR_MOD)
@@ -784,6 +1027,8 @@ int open_page_read_at(int dfd, unsigned long img_id, struct page_read *pr, int p
 	}
 
 	INIT_LIST_HEAD(&pr->async);
+	INIT_LIST_HEAD(&pr->cache_held);
+	pr->nr_remote = 0;
 	pr->pe = NULL;
 	pr->parent = NULL;
 	pr->cvaddr = 0;
@@ -792,6 +1037,11 @@ int open_page_read_at(int dfd, unsigned long img_id, struct page_read *pr, int p
 	pr->bunch.iov_base = NULL;
 	pr->pmes = NULL;
 	pr->pieok = false;
+	pr->comp = NULL;
+	pr->cache = NULL;
+	pr->mapped = false;
+	pr->pi_map = NULL;
+	pr->pi_map_len = 0;
 
 	pr->pmi = open_image_at(dfd, i_typ, O_RSTR, img_id);
 	if (!pr->pmi)
@@ -807,17 +1057,35 @@ int open_page_read_at(int dfd, unsigned long img_id, struct page_read *pr, int p
 		return -1;
 	}
 
-	pr->pi = open_pages_image_at(dfd, flags, pr->pmi, &pr->pages_img_id);
+	pr->pi = open_pages_image_at(dfd, flags, pr->pmi, &pr->pages_img_id, &comp);
 	if (!pr->pi) {
 		close_page_read(pr);
 		return -1;
 	}
 
+	if (comp != PAGES_COMP_NONE) {
+		pr->comp = pages_comp_reader_open(dfd, img_raw_fd(pr->pi), pr->pages_img_id, comp);
+		if (!pr->comp) {
+			close_page_read(pr);
+			return -1;
+		}
+	}
+
 	if (init_pagemaps(pr)) {
 		close_page_read(pr);
 		return -1;
 	}
 
+	if ((pr_flags & PR_MMAP) && map_pages_image(pr)) {
+		close_page_read(pr);
+		return -1;
+	}
+
+	if (remote && opts.lazy_pages_cache && pages_cache_open(dfd, pr)) {
+		close_page_read(pr);
+		return -1;
+	}
+
 	pr->read_pages = read_pagemap_page;
 	pr->advance = advance;
 	pr->close = close_page_read;
@@ -835,7 +1103,7 @@ int open_page_read_at(int dfd, unsigned long img_id, struct page_read *pr, int p
 		pr->maybe_read_page = maybe_read_page_img_streamer;
 	else {
 		pr->maybe_read_page = maybe_read_page_local;
-		if (!pr->parent && !opts.lazy_pages)
+		if (!pr->parent && !opts.lazy_pages && !pr->comp)
 			pr->pieok = true;
 	}
 
@@ -858,6 +1126,8 @@ void dup_page_read(struct page_read *src, struct page_read *dst)
 
 	memcpy(dst, src, sizeof(*dst));
 	INIT_LIST_HEAD(&dst->async);
+	INIT_LIST_HEAD(&dst->cache_held);
+	dst->nr_remote = 0;
 	dst->id = src->id + DUP_IDS_BASE * dup_ids++;
 	dst->reset(dst);
 }
@@ -969,6 +1239,7 @@ static void convert_ctl_skip_page(struct convert_ctl *cc, unsigned long len)
 int open_convert_ctl(unsigned long img_id, struct convert_ctl *cc)
 {
 	int pfd;
+	u32 comp;
 	cc->pe = NULL;
 	cc->pmes = NULL;
 
@@ -990,11 +1261,16 @@ int open_convert_ctl(unsigned long img_id, struct convert_ctl *cc)
 		return -1;
 	}
 
-	cc->pi = open_pages_image(O_RSTR, cc->pmi, &cc->pages_img_id);
+	cc->pi = open_pages_image(O_RSTR, cc->pmi, &cc->pages_img_id, &comp);
 	if (!cc->pi) {
 		close_convert_ctl(cc);
 		return -1;
 	}
+	if (comp != PAGES_COMP_NONE) {
+		pr_err("Do not support compressed pages image for now!\n");
+		close_convert_ctl(cc);
+		return -1;
+	}
 
 	if (init_pagemaps_for_convert(cc)) {
 		close_convert_ctl(cc);
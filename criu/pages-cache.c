@@ -0,0 +1,334 @@
+#include <unistd.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/stat.h>
+
+#undef LOG_PREFIX
+#define LOG_PREFIX "pages-cache: "
+
+#include "types.h"
+#include "page.h"
+#include "cr_options.h"
+#include "image.h"
+#include "pagemap.h"
+#include "pages-cache.h"
+#include "protobuf.h"
+#include "xmalloc.h"
+#include "log.h"
+#include "images/inventory.pb-c.h"
+
+struct pages_cache {
+	int fd;		      /* sparse copy of the remote pages image */
+	char name[64];	      /* common part of the cache files names */
+	unsigned char *map;   /* a bit per page, set if the page is in fd */
+	unsigned long nr_pages;
+	bool dirty;
+	bool broken;	      /* a write failed, don't store more pages */
+	unsigned long nr_hit; /* pages read from the cache */
+	unsigned long nr_stored;
+};
+
+static inline size_t map_size(unsigned long nr_pages)
+{
+	return (nr_pages + 7) / 8;
+}
+
+static inline bool page_cached(struct pages_cache *c, unsigned long nr)
+{
+	return c->map[nr / 8] & (1 << (nr % 8));
+}
+
+static int get_dump_id(int dfd, u64 *id)
+{
+	static int have_id = -1;
+	static u64 dump_id;
+	struct cr_img *img;
+	InventoryEntry *he;
+
+	if (have_id < 0) {
+		img = open_image_at(dfd, CR_FD_INVENTORY, O_RSTR);
+		if (!img)
+			return -1;
+
+		if (pb_read_one(img, &he, PB_INVENTORY) < 0) {
+			close_image(img);
+			return -1;
+		}
+
+		have_id = he->has_dump_id;
+		dump_id = he->dump_id;
+
+		inventory_entry__free_unpacked(he, NULL);
+		close_image(img);
+
+		if (!have_id)
+			pr_warn("The images have no dump id, not caching remote pages\n");
+	}
+
+	*id = dump_id;
+	return have_id;
+}
+
+/*
+ * The pagemap alone tells where every page lives in the pages image,
+ * so two pagemaps with equal entries mean equal cache layouts.
+ */
+static u64 pagemap_csum(struct page_read *pr, unsigned long *nr_pages)
+{
+	u64 csum = 0xcbf29ce484222325ULL; /* FNV-1a */
+	int i;
+
+	*nr_pages = 0;
+	for (i = 0; i < pr->nr_pmes; i++) {
+		PagemapEntry *pe = pr->pmes[i];
+		u64 v[3] = { pe->vaddr, pe->nr_pages, pe->flags };
+		unsigned char *p = (unsigned char *)v;
+		unsigned int j;
+
+		for (j = 0; j < sizeof(v); j++) {
+			csum ^= p[j];
+			csum *= 0x100000001b3ULL;
+		}
+
+		if (pagemap_present(pe))
+			*nr_pages += pe->nr_pages;
+	}
+
+	return csum;
+}
+
+static int load_map(struct pages_cache *c, int dir)
+{
+	char path[PATH_MAX];
+	size_t size = map_size(c->nr_pages), curr = 0;
+	struct stat st;
+	int fd;
+
+	snprintf(path, sizeof(path), "%s.map", c->name);
+	fd = openat(dir, path, O_RDONLY);
+	if (fd < 0) {
+		if (errno == ENOENT)
+			return 0;
+		pr_perror("Can't open %s", path);
+		return -1;
+	}
+
+	if (fstat(fd, &st) || st.st_size != size) {
+		pr_warn("Ignoring stale %s\n", path);
+		close(fd);
+		return 0;
+	}
+
+	while (curr < size) {
+		ssize_t ret;
+
+		ret = read(fd, c->map + curr, size - curr);
+		if (ret <= 0) {
+			pr_perror("Can't read %s", path);
+			memset(c->map, 0, size);
+			close(fd);
+			return -1;
+		}
+		curr += ret;
+	}
+
+	close(fd);
+	return 0;
+}
+
+/*
+ * The map is replaced atomically and only after the data it points to
+ * is on disk, so a crashed daemon at worst loses some cached pages.
+ */
+static int save_map(struct pages_cache *c, int dir)
+{
+	char path[PATH_MAX], tmp[PATH_MAX];
+	size_t size = map_size(c->nr_pages), curr = 0;
+	int fd;
+
+	if (fdatasync(c->fd)) {
+		pr_perror("Can't sync %s.pages", c->name);
+		return -1;
+	}
+
+	snprintf(path, sizeof(path), "%s.map", c->name);
+	snprintf(tmp, sizeof(tmp), "%s.map.%d", c->name, getpid());
+	fd = openat(dir, tmp, O_WRONLY | O_CREAT | O_TRUNC, 0600);
+	if (fd < 0) {
+		pr_perror("Can't create %s", tmp);
+		return -1;
+	}
+
+	while (curr < size) {
+		ssize_t ret;
+
+		ret = write(fd, c->map + curr, size - curr);
+		if (ret < 0) {
+			pr_perror("Can't write %s", tmp);
+			goto err;
+		}
+		curr += ret;
+	}
+
+	if (fdatasync(fd)) {
+		pr_perror("Can't sync %s", tmp);
+		goto err;
+	}
+	close(fd);
+
+	if (renameat(dir, tmp, dir, path)) {
+		pr_perror("Can't rename %s", tmp);
+		unlinkat(dir, tmp, 0);
+		return -1;
+	}
+
+	return 0;
+err:
+	close(fd);
+	unlinkat(dir, tmp, 0);
+	return -1;
+}
+
+int pages_cache_open(int dfd, struct page_read *pr)
+{
+	struct pages_cache *c;
+	unsigned long nr_pages;
+	char path[PATH_MAX];
+	u64 dump_id, csum;
+	int dir, ret;
+
+	ret = get_dump_id(dfd, &dump_id);
+	if (ret <= 0)
+		return ret;
+
+	csum = pagemap_csum(pr, &nr_pages);
+	if (!nr_pages)
+		return 0;
+
+	c = xzalloc(sizeof(*c));
+	if (!c)
+		return -1;
+
+	c->fd = -1;
+	c->nr_pages = nr_pages;
+	snprintf(c->name, sizeof(c->name), "%016" PRIx64 "-%lu-%016" PRIx64, dump_id, pr->img_id, csum);
+
+	c->map = xzalloc(map_size(nr_pages));
+	if (!c->map)
+		goto err;
+
+	dir = open(opts.lazy_pages_cache, O_RDONLY | O_DIRECTORY);
+	if (dir < 0) {
+		pr_perror("Can't open %s", opts.lazy_pages_cache);
+		goto err;
+	}
+
+	snprintf(path, sizeof(path), "%s.pages", c->name);
+	c->fd = openat(dir, path, O_RDWR | O_CREAT, 0600);
+	if (c->fd < 0) {
+		pr_perror("Can't open %s", path);
+		close(dir);
+		goto err;
+	}
+
+	ret = load_map(c, dir);
+	close(dir);
+	if (ret)
+		goto err;
+
+	pr_debug("Caching %lu pages of pagemap-%lu in %s\n", nr_pages, pr->img_id, c->name);
+	pr->cache = c;
+	return 0;
+
+err:
+	if (c->fd >= 0)
+		close(c->fd);
+	xfree(c->map);
+	xfree(c);
+	return -1;
+}
+
+bool pages_cache_has(struct pages_cache *c, off_t off, unsigned long len)
+{
+	unsigned long nr = off / PAGE_SIZE, end = nr + len / PAGE_SIZE;
+
+	if (end > c->nr_pages)
+		return false;
+
+	for (; nr < end; nr++)
+		if (!page_cached(c, nr))
+			return false;
+
+	return true;
+}
+
+int pages_cache_read(struct pages_cache *c, void *buf, unsigned long len, off_t off)
+{
+	unsigned long curr = 0;
+
+	while (curr < len) {
+		ssize_t ret;
+
+		ret = pread(c->fd, buf + curr, len - curr, off + curr);
+		if (ret < 1) {
+			pr_perror("Can't read cached pages at %lx", (unsigned long)off + curr);
+			return -1;
+		}
+		curr += ret;
+	}
+
+	c->nr_hit += len / PAGE_SIZE;
+	return 0;
+}
+
+/*
+ * Failing to store pages only makes later restores slower, so this
+ * doesn't fail the current one.
+ */
+void pages_cache_store(struct pages_cache *c, void *buf, unsigned long len, off_t off)
+{
+	unsigned long nr = off / PAGE_SIZE, end = nr + len / PAGE_SIZE, curr = 0;
+
+	if (c->broken || end > c->nr_pages)
+		return;
+
+	while (curr < len) {
+		ssize_t ret;
+
+		ret = pwrite(c->fd, buf + curr, len - curr, off + curr);
+		if (ret < 0) {
+			pr_perror("Can't store pages at %lx, caching disabled", (unsigned long)off + curr);
+			c->broken = true;
+			return;
+		}
+		curr += ret;
+	}
+
+	for (; nr < end; nr++)
+		c->map[nr / 8] |= 1 << (nr % 8);
+
+	c->nr_stored += len / PAGE_SIZE;
+	c->dirty = true;
+}
+
+void pages_cache_close(struct pages_cache *c)
+{
+	int dir;
+
+	pr_info("%s: %lu pages read from the cache, %lu stored\n", c->name, c->nr_hit, c->nr_stored);
+
+	if (c->dirty) {
+		dir = open(opts.lazy_pages_cache, O_RDONLY | O_DIRECTORY);
+		if (dir < 0)
+			pr_perror("Can't open %s", opts.lazy_pages_cache);
+		else {
+			if (save_map(c, dir))
+				pr_warn("Pages stored in %s are lost\n", c->name);
+			close(dir);
+		}
+	}
+
+	close(c->fd);
+	xfree(c->map);
+	xfree(c);
+}
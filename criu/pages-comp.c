@@ -0,0 +1,569 @@
+#include <unistd.h>
+#include <string.h>
+#include <pthread.h>
+#include <signal.h>
+
+#undef LOG_PREFIX
+#define LOG_PREFIX "pages-comp: "
+
+#include "types.h"
+#include "page.h"
+#include "image.h"
+#include "pages-comp.h"
+#include "protobuf.h"
+#include "xmalloc.h"
+#include "log.h"
+#include "common/list.h"
+#include "images/pagemap.pb-c.h"
+
+#ifdef CONFIG_HAS_LIBZSTD
+
+#include <zstd.h>
+
+/*
+ * Blocks are compressed by a pool of worker threads, started once per
+ * process and shared by all the writers. A writer hands the blocks over
+ * to the pool as soon as they are filled from the pipes and keeps on
+ * draining, the compressed blocks are written out in order as they come
+ * back. Each writer has twice as many blocks as the pool has threads,
+ * so the workers have blocks to compress while the next ones are read.
+ */
+#define PAGES_COMP_MAX_THREADS 16
+
+enum {
+	BLOCK_FREE,   /* owned by the writer */
+	BLOCK_QUEUED, /* being compressed */
+	BLOCK_DONE,   /* compressed, to be written out */
+};
+
+struct pages_comp_block {
+	void *raw;
+	size_t raw_len;
+	void *out;
+	size_t out_cap;
+	size_t out_len;
+	bool failed;
+	int state; /* under comp_pool.lock */
+	struct list_head l;
+};
+
+struct pages_comp_writer {
+	int fd;
+	struct cr_img *idx;
+	off_t off; /* where the next block goes in the pages image */
+	int nr_blocks;
+	int head;      /* the oldest block not written out yet */
+	int nr_queued; /* blocks from head handed over to the pool */
+	bool failed;
+	struct pages_comp_block *blocks;
+};
+
+static struct {
+	pthread_mutex_t lock;
+	pthread_cond_t queued;
+	pthread_cond_t done;
+	struct list_head queue;
+	int nr_threads;
+	pid_t pid; /* the pool doesn't survive fork() */
+} comp_pool;
+
+static pthread_mutex_t comp_pool_start_lock = PTHREAD_MUTEX_INITIALIZER;
+
+struct pages_comp_reader {
+	int fd;
+	PagesBlockEntry **blocks;
+	unsigned long nr_blocks;
+	long cached; /* block that sits in ->raw, -1 if none */
+	void *raw;
+	void *buf;
+	size_t buf_cap;
+};
+
+bool pages_comp_supported(void)
+{
+	return true;
+}
+
+static void compress_block(struct pages_comp_block *b)
+{
+	size_t ret;
+
+	ret = ZSTD_compress(b->out, b->out_cap, b->raw, b->raw_len, ZSTD_CLEVEL_DEFAULT);
+	if (ZSTD_isError(ret)) {
+		pr_err("Can't compress block: %s\n", ZSTD_getErrorName(ret));
+		b->failed = true;
+		return;
+	}
+
+	b->out_len = ret;
+}
+
+static void *comp_worker(void *arg)
+{
+	pthread_mutex_lock(&comp_pool.lock);
+	while (1) {
+		struct pages_comp_block *b;
+
+		while (list_empty(&comp_pool.queue))
+			pthread_cond_wait(&comp_pool.queued, &comp_pool.lock);
+
+		b = list_first_entry(&comp_pool.queue, struct pages_comp_block, l);
+		list_del(&b->l);
+		pthread_mutex_unlock(&comp_pool.lock);
+
+		compress_block(b);
+
+		pthread_mutex_lock(&comp_pool.lock);
+		b->state = BLOCK_DONE;
+		pthread_cond_broadcast(&comp_pool.done);
+	}
+
+	return NULL;
+}
+
+static int start_comp_pool(void)
+{
+	sigset_t blockmask, oldmask;
+	long nr_cpus;
+	int i, ret = 0;
+
+	pthread_mutex_lock(&comp_pool_start_lock);
+	if (comp_pool.pid == getpid())
+		goto out;
+
+	pthread_mutex_init(&comp_pool.lock, NULL);
+	pthread_cond_init(&comp_pool.queued, NULL);
+	pthread_cond_init(&comp_pool.done, NULL);
+	INIT_LIST_HEAD(&comp_pool.queue);
+	comp_pool.nr_threads = 0;
+
+	/* The workers inherit the mask, signals are for the main thread */
+	sigfillset(&blockmask);
+	pthread_sigmask(SIG_SETMASK, &blockmask, &oldmask);
+
+	nr_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	for (i = 0; i < min_t(long, max_t(long, nr_cpus, 1), PAGES_COMP_MAX_THREADS); i++) {
+		pthread_t t;
+
+		if (pthread_create(&t, NULL, comp_worker, NULL)) {
+			pr_warn("Can't start compression thread %d\n", i);
+			break;
+		}
+		pthread_detach(t);
+		comp_pool.nr_threads++;
+	}
+
+	pthread_sigmask(SIG_SETMASK, &oldmask, NULL);
+
+	if (!comp_pool.nr_threads) {
+		pr_err("Can't start compression threads\n");
+		ret = -1;
+		goto out;
+	}
+
+	comp_pool.pid = getpid();
+	pr_debug("Started %d compression threads\n", comp_pool.nr_threads);
+out:
+	pthread_mutex_unlock(&comp_pool_start_lock);
+	return ret;
+}
+
+static int write_block(struct pages_comp_writer *w, struct pages_comp_block *b)
+{
+	PagesBlockEntry pbe = PAGES_BLOCK_ENTRY__INIT;
+	void *data = b->out;
+	size_t len = b->out_len, curr = 0;
+
+	/*
+	 * Blocks that don't shrink are stored as is, the reader sees
+	 * this by len == raw_len and doesn't decompress them.
+	 */
+	if (len >= b->raw_len) {
+		data = b->raw;
+		len = b->raw_len;
+	}
+
+	while (curr < len) {
+		ssize_t ret;
+
+		ret = pwrite(w->fd, data + curr, len - curr, w->off + curr);
+		if (ret < 0) {
+			pr_perror("Can't write compressed block");
+			return -1;
+		}
+		curr += ret;
+	}
+
+	pbe.off = w->off;
+	pbe.len = len;
+	pbe.raw_len = b->raw_len;
+	if (pb_write_one(w->idx, &pbe, PB_PAGES_BLOCK) < 0)
+		return -1;
+
+	w->off += len;
+	b->raw_len = 0;
+	b->out_len = 0;
+
+	return 0;
+}
+
+static void queue_block(struct pages_comp_writer *w)
+{
+	struct pages_comp_block *b = &w->blocks[(w->head + w->nr_queued) % w->nr_blocks];
+
+	b->failed = false;
+	w->nr_queued++;
+
+	pthread_mutex_lock(&comp_pool.lock);
+	b->state = BLOCK_QUEUED;
+	list_add_tail(&b->l, &comp_pool.queue);
+	pthread_cond_signal(&comp_pool.queued);
+	pthread_mutex_unlock(&comp_pool.lock);
+}
+
+/*
+ * Writes out the compressed blocks in order. Waits for the pool only if
+ * all the blocks are handed over to it, or if all is set. After an error
+ * the blocks are still collected, but not written.
+ */
+static int retire_blocks(struct pages_comp_writer *w, bool all)
+{
+	while (w->nr_queued) {
+		struct pages_comp_block *b = &w->blocks[w->head];
+		bool wait = all || w->nr_queued == w->nr_blocks;
+		int state;
+
+		pthread_mutex_lock(&comp_pool.lock);
+		while (wait && b->state != BLOCK_DONE)
+			pthread_cond_wait(&comp_pool.done, &comp_pool.lock);
+		state = b->state;
+		pthread_mutex_unlock(&comp_pool.lock);
+
+		if (state != BLOCK_DONE)
+			break;
+
+		if (!w->failed && (b->failed || write_block(w, b)))
+			w->failed = true;
+
+		b->state = BLOCK_FREE;
+		b->raw_len = 0;
+		b->out_len = 0;
+		w->head = (w->head + 1) % w->nr_blocks;
+		w->nr_queued--;
+	}
+
+	return w->failed ? -1 : 0;
+}
+
+struct pages_comp_writer *pages_comp_writer_open(int fd, u32 pages_id)
+{
+	struct pages_comp_writer *w;
+	int i;
+
+	if (start_comp_pool())
+		return NULL;
+
+	w = xzalloc(sizeof(*w));
+	if (!w)
+		return NULL;
+
+	w->fd = fd;
+	w->idx = open_image(CR_FD_PAGES_INDEX, O_DUMP, pages_id);
+	if (!w->idx)
+		goto err;
+
+	w->nr_blocks = 2 * comp_pool.nr_threads;
+	w->blocks = xzalloc(w->nr_blocks * sizeof(*w->blocks));
+	if (!w->blocks)
+		goto err_idx;
+
+	for (i = 0; i < w->nr_blocks; i++) {
+		struct pages_comp_block *b = &w->blocks[i];
+
+		b->out_cap = ZSTD_compressBound(PAGES_COMP_BLOCK_SIZE);
+		b->raw = xmalloc(PAGES_COMP_BLOCK_SIZE);
+		b->out = xmalloc(b->out_cap);
+		if (!b->raw || !b->out)
+			goto err_blocks;
+	}
+
+	pr_debug("Compressing pages-%u in %d blocks\n", pages_id, w->nr_blocks);
+	return w;
+
+err_blocks:
+	for (i = 0; i < w->nr_blocks; i++) {
+		xfree(w->blocks[i].raw);
+		xfree(w->blocks[i].out);
+	}
+	xfree(w->blocks);
+err_idx:
+	close_image(w->idx);
+err:
+	xfree(w);
+	return NULL;
+}
+
+/* The pages come either from the pipe p, or from buf if p is -1 */
+static int comp_fill(struct pages_comp_writer *w, int p, const void *buf, unsigned long len)
+{
+	while (len > 0) {
+		struct pages_comp_block *b = &w->blocks[(w->head + w->nr_queued) % w->nr_blocks];
+		size_t room = min_t(unsigned long, len, PAGES_COMP_BLOCK_SIZE - b->raw_len);
+		ssize_t ret;
+
+		if (p < 0) {
+			memcpy(b->raw + b->raw_len, buf, room);
+			buf += room;
+			ret = room;
+		} else {
+			ret = read(p, b->raw + b->raw_len, room);
+			if (ret < 0) {
+				pr_perror("Can't read pages from pipe");
+				return -1;
+			}
+			if (ret == 0) {
+				pr_err("A pipe was closed unexpectedly\n");
+				return -1;
+			}
+		}
+
+		b->raw_len += ret;
+		len -= ret;
+
+		if (b->raw_len < PAGES_COMP_BLOCK_SIZE)
+			continue;
+
+		queue_block(w);
+		if (retire_blocks(w, false))
+			return -1;
+	}
+
+	return 0;
+}
+
+int pages_comp_write(struct pages_comp_writer *w, int p, unsigned long len)
+{
+	return comp_fill(w, p, NULL, len);
+}
+
+int pages_comp_write_buf(struct pages_comp_writer *w, const void *buf, unsigned long len)
+{
+	return comp_fill(w, -1, buf, len);
+}
+
+int pages_comp_writer_close(struct pages_comp_writer *w)
+{
+	int i, ret;
+
+	/* The blocks must get back from the pool even on errors */
+	if (w->blocks[(w->head + w->nr_queued) % w->nr_blocks].raw_len)
+		queue_block(w);
+	ret = retire_blocks(w, true);
+
+	close_image(w->idx);
+	for (i = 0; i < w->nr_blocks; i++) {
+		xfree(w->blocks[i].raw);
+		xfree(w->blocks[i].out);
+	}
+	xfree(w->blocks);
+	xfree(w);
+
+	return ret;
+}
+
+struct pages_comp_reader *pages_comp_reader_open(int dfd, int fd, u32 pages_id, u32 algo)
+{
+	struct pages_comp_reader *r;
+	struct cr_img *idx;
+	unsigned long i;
+
+	if (algo != PAGES_COMP_ZSTD) {
+		pr_err("Unknown pages compression %u\n", algo);
+		return NULL;
+	}
+
+	r = xzalloc(sizeof(*r));
+	if (!r)
+		return NULL;
+
+	r->fd = fd;
+	r->cached = -1;
+
+	idx = open_image_at(dfd, CR_FD_PAGES_INDEX, O_RSTR, pages_id);
+	if (!idx)
+		goto err;
+
+	while (1) {
+		PagesBlockEntry *pbe, **blocks;
+		int ret;
+
+		ret = pb_read_one_eof(idx, &pbe, PB_PAGES_BLOCK);
+		if (ret < 0)
+			goto err_idx;
+		if (ret == 0)
+			break;
+
+		if (pbe->raw_len > PAGES_COMP_BLOCK_SIZE) {
+			pr_err("Corrupted block %lu in pages-index-%u\n", r->nr_blocks, pages_id);
+			pages_block_entry__free_unpacked(pbe, NULL);
+			goto err_idx;
+		}
+
+		blocks = xrealloc(r->blocks, (r->nr_blocks + 1) * sizeof(*blocks));
+		if (!blocks) {
+			pages_block_entry__free_unpacked(pbe, NULL);
+			goto err_idx;
+		}
+
+		r->blocks = blocks;
+		r->blocks[r->nr_blocks++] = pbe;
+	}
+	close_image(idx);
+
+	r->buf_cap = ZSTD_compressBound(PAGES_COMP_BLOCK_SIZE);
+	r->raw = xmalloc(PAGES_COMP_BLOCK_SIZE);
+	r->buf = xmalloc(r->buf_cap);
+	if (!r->raw || !r->buf)
+		goto err;
+
+	pr_debug("Opened compressed pages-%u with %lu blocks\n", pages_id, r->nr_blocks);
+	return r;
+
+err_idx:
+	close_image(idx);
+err:
+	for (i = 0; i < r->nr_blocks; i++)
+		pages_block_entry__free_unpacked(r->blocks[i], NULL);
+	xfree(r->blocks);
+	xfree(r->raw);
+	xfree(r->buf);
+	xfree(r);
+	return NULL;
+}
+
+static int load_block(struct pages_comp_reader *r, unsigned long nr)
+{
+	PagesBlockEntry *pbe = r->blocks[nr];
+	void *dst = pbe->len == pbe->raw_len ? r->raw : r->buf;
+	size_t curr = 0;
+
+	if (pbe->len > r->buf_cap) {
+		pr_err("Compressed block %lu is too long (%u)\n", nr, pbe->len);
+		return -1;
+	}
+
+	while (curr < pbe->len) {
+		ssize_t ret;
+
+		ret = pread(r->fd, dst + curr, pbe->len - curr, pbe->off + curr);
+		if (ret < 1) {
+			pr_perror("Can't read compressed block %lu", nr);
+			return -1;
+		}
+		curr += ret;
+	}
+
+	if (dst != r->raw) {
+		size_t ret;
+
+		ret = ZSTD_decompress(r->raw, PAGES_COMP_BLOCK_SIZE, r->buf, pbe->len);
+		if (ZSTD_isError(ret) || ret != pbe->raw_len) {
+			pr_err("Can't decompress block %lu\n", nr);
+			return -1;
+		}
+	}
+
+	r->cached = nr;
+	return 0;
+}
+
+int pages_comp_read(struct pages_comp_reader *r, void *buf, unsigned long len, off_t off)
+{
+	while (len > 0) {
+		unsigned long nr = off / PAGES_COMP_BLOCK_SIZE;
+		unsigned long boff = off % PAGES_COMP_BLOCK_SIZE;
+		unsigned long chunk;
+
+		if (nr >= r->nr_blocks) {
+			pr_err("Offset %lx is beyond the compressed image\n", (unsigned long)off);
+			return -1;
+		}
+
+		if (r->cached != nr && load_block(r, nr))
+			return -1;
+
+		if (boff >= r->blocks[nr]->raw_len) {
+			pr_err("Offset %lx is beyond block %lu\n", (unsigned long)off, nr);
+			return -1;
+		}
+
+		chunk = min_t(unsigned long, len, r->blocks[nr]->raw_len - boff);
+		memcpy(buf, r->raw + boff, chunk);
+
+		buf += chunk;
+		off += chunk;
+		len -= chunk;
+	}
+
+	return 0;
+}
+
+void pages_comp_reader_close(struct pages_comp_reader *r)
+{
+	unsigned long i;
+
+	for (i = 0; i < r->nr_blocks; i++)
+		pages_block_entry__free_unpacked(r->blocks[i], NULL);
+	xfree(r->blocks);
+	xfree(r->raw);
+	xfree(r->buf);
+	xfree(r);
+}
+
+#else /* CONFIG_HAS_LIBZSTD */
+
+bool pages_comp_supported(void)
+{
+	return false;
+}
+
+struct pages_comp_writer *pages_comp_writer_open(int fd, u32 pages_id)
+{
+	pr_err("CRIU was built without pages compression support\n");
+	return NULL;
+}
+
+int pages_comp_write(struct pages_comp_writer *w, int pipe, unsigned long len)
+{
+	BUG();
+	return -1;
+}
+
+int pages_comp_write_buf(struct pages_comp_writer *w, const void *buf, unsigned long len)
+{
+	BUG();
+	return -1;
+}
+
+int pages_comp_writer_close(struct pages_comp_writer *w)
+{
+	return 0;
+}
+
+struct pages_comp_reader *pages_comp_reader_open(int dfd, int fd, u32 pages_id, u32 algo)
+{
+	pr_err("Images are compressed, but CRIU was built without compression support\n");
+	return NULL;
+}
+
+int pages_comp_read(struct pages_comp_reader *r, void *buf, unsigned long len, off_t off)
+{
+	BUG();
+	return -1;
+}
+
+void pages_comp_reader_close(struct pages_comp_reader *r)
+{
+}
+
+#endif /* CONFIG_HAS_LIBZSTD */
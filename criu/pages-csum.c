@@ -0,0 +1,631 @@
+#include <unistd.h>
+#include <inttypes.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <dirent.h>
+#include <pthread.h>
+#include <sys/stat.h>
+
+#undef LOG_PREFIX
+#define LOG_PREFIX "pages-csum: "
+
+#include "types.h"
+#include "page.h"
+#include "image.h"
+#include "image-pack.h"
+#include "pagemap.h"
+#include "pages-comp.h"
+#include "pages-csum.h"
+#include "protobuf.h"
+#include "util.h"
+#include "xmalloc.h"
+#include "log.h"
+#include "images/pagemap.pb-c.h"
+
+/* Images are checked by that many threads at most */
+#define PAGES_CSUM_MAX_THREADS 16
+/* Pages are checksummed and checked by that many at once */
+#define PAGES_CSUM_BUF_PAGES 16
+
+/* crc32c (Castagnoli), the one SSE4.2 has an instruction for */
+#define CRC32C_POLY 0x82f63b78
+
+static u32 crc32c_table[8][256];
+static pthread_once_t crc32c_once = PTHREAD_ONCE_INIT;
+static u32 (*crc32c_fn)(u32 crc, const u8 *p, size_t len);
+
+static u32 crc32c_sw(u32 crc, const u8 *p, size_t len)
+{
+	while (len && ((unsigned long)p & 7)) {
+		crc = crc32c_table[0][(crc ^ *p++) & 0xff] ^ (crc >> 8);
+		len--;
+	}
+
+	/* Slicing-by-8 */
+	while (len >= 8) {
+		u64 v = *(const u64 *)p ^ crc;
+
+		crc = crc32c_table[7][v & 0xff] ^ crc32c_table[6][(v >> 8) & 0xff] ^
+		      crc32c_table[5][(v >> 16) & 0xff] ^ crc32c_table[4][(v >> 24) & 0xff] ^
+		      crc32c_table[3][(v >> 32) & 0xff] ^ crc32c_table[2][(v >> 40) & 0xff] ^
+		      crc32c_table[1][(v >> 48) & 0xff] ^ crc32c_table[0][v >> 56];
+		p += 8;
+		len -= 8;
+	}
+
+	while (len--)
+		crc = crc32c_table[0][(crc ^ *p++) & 0xff] ^ (crc >> 8);
+
+	return crc;
+}
+
+#ifdef CONFIG_X86_64
+__attribute__((target("sse4.2"))) static u32 crc32c_hw(u32 crc, const u8 *p, size_t len)
+{
+	u64 c = crc;
+
+	while (len && ((unsigned long)p & 7)) {
+		c = __builtin_ia32_crc32qi(c, *p++);
+		len--;
+	}
+
+	while (len >= 8) {
+		c = __builtin_ia32_crc32di(c, *(const u64 *)p);
+		p += 8;
+		len -= 8;
+	}
+
+	while (len--)
+		c = __builtin_ia32_crc32qi(c, *p++);
+
+	return c;
+}
+#endif
+
+static void crc32c_init(void)
+{
+	u32 i, j, crc;
+
+	for (i = 0; i < 256; i++) {
+		crc = i;
+		for (j = 0; j < 8; j++)
+			crc = (crc >> 1) ^ (crc & 1 ? CRC32C_POLY : 0);
+		crc32c_table[0][i] = crc;
+	}
+
+	for (i = 0; i < 256; i++)
+		for (j = 1; j < 8; j++)
+			crc32c_table[j][i] = crc32c_table[0][crc32c_table[j - 1][i] & 0xff] ^ (crc32c_table[j - 1][i] >> 8);
+
+	crc32c_fn = crc32c_sw;
+#ifdef CONFIG_X86_64
+	if (__builtin_cpu_supports("sse4.2"))
+		crc32c_fn = crc32c_hw;
+#endif
+	pr_debug("Using %s crc32c\n", crc32c_fn == crc32c_sw ? "table" : "sse4.2");
+}
+
+static u32 crc32c(const void *p, size_t len)
+{
+	return ~crc32c_fn(~0U, p, len);
+}
+
+
+struct pages_csum_writer {
+	struct cr_img *pmi;
+	int fd; /* of the pages image, unless it's compressed */
+	struct pages_comp_writer *comp;
+
+	/* The entry whose pages are being written */
+	PagemapEntry pe;
+	bool pending;
+	unsigned long csum_size;
+
+	/* Pages read from the pipes, the last one may be incomplete */
+	void *buf;
+	size_t buf_len;
+};
+
+struct pages_csum_writer *pages_csum_writer_open(struct cr_img *pmi, int fd, struct pages_comp_writer *comp)
+{
+	struct pages_csum_writer *w;
+
+	w = xzalloc(sizeof(*w));
+	if (!w)
+		return NULL;
+
+	w->buf = xmalloc(PAGES_CSUM_BUF_PAGES * PAGE_SIZE);
+	if (!w->buf) {
+		xfree(w);
+		return NULL;
+	}
+
+	w->pmi = pmi;
+	w->fd = fd;
+	w->comp = comp;
+	pthread_once(&crc32c_once, crc32c_init);
+
+	return w;
+}
+
+/* The present entry is written once all its pages are checksummed */
+int pages_csum_entry(struct pages_csum_writer *w, PagemapEntry *pe)
+{
+	u32 *csum = w->pe.csum;
+
+	if (w->pending) {
+		pr_err("Entry %#" PRIx64 " is left without pages\n", w->pe.vaddr);
+		return -1;
+	}
+
+	if (pe->nr_pages > w->csum_size) {
+		csum = xrealloc(csum, pe->nr_pages * sizeof(u32));
+		if (!csum)
+			return -1;
+		w->csum_size = pe->nr_pages;
+	}
+
+	w->pe = *pe;
+	w->pe.csum = csum;
+	w->pe.n_csum = 0;
+	w->pending = true;
+
+	return 0;
+}
+
+static int flush_pages(struct pages_csum_writer *w)
+{
+	size_t len = w->buf_len & PAGE_MASK, off;
+	int ret;
+
+	for (off = 0; off < len; off += PAGE_SIZE) {
+		if (!w->pending) {
+			pr_err("Pages come without an entry\n");
+			return -1;
+		}
+
+		w->pe.csum[w->pe.n_csum++] = crc32c(w->buf + off, PAGE_SIZE);
+		if (w->pe.n_csum < w->pe.nr_pages)
+			continue;
+
+		w->pending = false;
+		if (pb_write_one(w->pmi, &w->pe, PB_PAGEMAP) < 0)
+			return -1;
+	}
+
+	if (!len)
+		return 0;
+
+	if (w->comp)
+		ret = pages_comp_write_buf(w->comp, w->buf, len);
+	else if (write_all(w->fd, w->buf, len) != len) {
+		pr_perror("Can't write pages");
+		ret = -1;
+	} else
+		ret = 0;
+
+	w->buf_len -= len;
+	memmove(w->buf, w->buf + len, w->buf_len);
+	return ret;
+}
+
+int pages_csum_write(struct pages_csum_writer *w, int p, unsigned long len)
+{
+	while (len > 0) {
+		ssize_t ret;
+
+		ret = read(p, w->buf + w->buf_len, min_t(unsigned long, len, PAGES_CSUM_BUF_PAGES * PAGE_SIZE - w->buf_len));
+		if (ret < 0) {
+			pr_perror("Can't read pages from pipe");
+			return -1;
+		}
+		if (ret == 0) {
+			pr_err("A pipe was closed unexpectedly\n");
+			return -1;
+		}
+
+		w->buf_len += ret;
+		len -= ret;
+
+		if (flush_pages(w))
+			return -1;
+	}
+
+	return 0;
+}
+
+int pages_csum_writer_close(struct pages_csum_writer *w)
+{
+	int ret = 0;
+
+	if (w->pending || w->buf_len) {
+		pr_err("Pages of entry %#" PRIx64 " are cut short\n", w->pe.vaddr);
+		ret = -1;
+	}
+
+	xfree(w->pe.csum);
+	xfree(w->buf);
+	xfree(w);
+	return ret;
+}
+
+struct csum_job {
+	int type; /* of the pagemap image */
+	unsigned long id;
+	u32 pages_id;
+	struct cr_img *pi;
+	struct pages_comp_reader *comp;
+	unsigned long nr; /* pages in the pages image */
+	u32 *expected;
+	int ret;
+};
+
+struct csum_ctl {
+	int dfd;
+	struct csum_job *jobs;
+	int nr_jobs;
+	int next;
+	pthread_mutex_t lock;
+};
+
+static int read_pages(struct csum_job *job, void *buf, unsigned long len, off_t off)
+{
+	size_t curr = 0;
+
+	if (job->comp)
+		return pages_comp_read(job->comp, buf, len, off);
+
+	while (curr < len) {
+		ssize_t ret;
+
+		ret = pread(img_raw_fd(job->pi), buf + curr, len - curr, off + curr);
+		if (ret < 0) {
+			pr_perror("Can't read pages-%u.img at %#lx", job->pages_id, (unsigned long)(off + curr));
+			return -1;
+		}
+		if (ret == 0) {
+			pr_err("pages-%u.img is shorter than its pagemap\n", job->pages_id);
+			return -1;
+		}
+		curr += ret;
+	}
+
+	return 0;
+}
+
+/*
+ * Everything is allocated in advance, since this runs in background
+ * during restore and the tasks are clone()-d without the atfork
+ * handlers.
+ */
+static void check_job(struct csum_job *job, void *buf)
+{
+	unsigned long i, j, n, bad = 0;
+
+	for (i = 0; i < job->nr; i += n) {
+		n = min_t(unsigned long, job->nr - i, PAGES_CSUM_BUF_PAGES);
+		if (read_pages(job, buf, n * PAGE_SIZE, i * PAGE_SIZE)) {
+			job->ret = -1;
+			return;
+		}
+
+		for (j = 0; j < n; j++) {
+			if (crc32c(buf + j * PAGE_SIZE, PAGE_SIZE) == job->expected[i + j])
+				continue;
+			if (!bad++)
+				pr_err("pages-%u.img is corrupted at %#lx\n", job->pages_id, (i + j) * PAGE_SIZE);
+		}
+	}
+
+	if (bad) {
+		pr_err("pages-%u.img: %lu of %lu pages are corrupted\n", job->pages_id, bad, job->nr);
+		job->ret = -1;
+	}
+}
+
+static void *csum_worker(void *arg)
+{
+	struct csum_ctl *ctl = arg;
+	char buf[PAGES_CSUM_BUF_PAGES * PAGE_SIZE];
+
+	while (1) {
+		struct csum_job *job;
+
+		pthread_mutex_lock(&ctl->lock);
+		job = ctl->next < ctl->nr_jobs ? &ctl->jobs[ctl->next++] : NULL;
+		pthread_mutex_unlock(&ctl->lock);
+		if (!job)
+			break;
+
+		check_job(job, buf);
+	}
+
+	return NULL;
+}
+
+static int run_jobs(struct csum_ctl *ctl)
+{
+	pthread_t threads[PAGES_CSUM_MAX_THREADS];
+	int i, nr_threads, ret = 0;
+	long cpus;
+
+	cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	nr_threads = min_t(long, ctl->nr_jobs, min_t(long, max(cpus, 1L), PAGES_CSUM_MAX_THREADS));
+
+	ctl->next = 0;
+	pthread_mutex_init(&ctl->lock, NULL);
+
+	/* The caller is the first worker */
+	for (i = 1; i < nr_threads; i++) {
+		if (pthread_create(&threads[i], NULL, csum_worker, ctl)) {
+			pr_perror("Can't start checksum thread");
+			break;
+		}
+	}
+	nr_threads = i;
+
+	csum_worker(ctl);
+
+	for (i = 1; i < nr_threads; i++)
+		pthread_join(threads[i], NULL);
+
+	for (i = 0; i < ctl->nr_jobs; i++)
+		if (ctl->jobs[i].ret)
+			ret = -1;
+
+	return ret;
+}
+
+static int add_job(const char *name, void *data, size_t len, void *arg)
+{
+	struct csum_ctl *ctl = arg;
+	struct csum_job *j;
+	unsigned long id;
+	int type, end = 0;
+
+	if (sscanf(name, "pagemap-%lu.img%n", &id, &end) == 1 && !name[end])
+		type = CR_FD_PAGEMAP;
+	else if (sscanf(name, "pagemap-shmem-%lu.img%n", &id, &end) == 1 && !name[end])
+		type = CR_FD_SHMEM_PAGEMAP;
+	else
+		return 0;
+
+	j = xrealloc(ctl->jobs, (ctl->nr_jobs + 1) * sizeof(*j));
+	if (!j)
+		return -1;
+	ctl->jobs = j;
+
+	j = &ctl->jobs[ctl->nr_jobs++];
+	memset(j, 0, sizeof(*j));
+	j->type = type;
+	j->id = id;
+	return 0;
+}
+
+/* The pagemaps are looked for in the images dir and in its pack */
+static int collect_jobs(struct csum_ctl *ctl)
+{
+	struct dirent *de;
+	int fd, ret = 0;
+	DIR *d;
+
+	ctl->jobs = NULL;
+	ctl->nr_jobs = 0;
+
+	fd = dup(ctl->dfd);
+	d = fd >= 0 ? fdopendir(fd) : NULL;
+	if (!d) {
+		pr_perror("Can't open images dir");
+		close_safe(&fd);
+		return -1;
+	}
+	rewinddir(d);
+
+	while (!ret && (de = readdir(d)))
+		ret = add_job(de->d_name, NULL, 0, ctl);
+	closedir(d);
+
+	if (!ret)
+		ret = image_pack_for_each(ctl->dfd, add_job, ctl);
+
+	return ret;
+}
+
+static void release_job(struct csum_job *job)
+{
+	if (job->comp)
+		pages_comp_reader_close(job->comp);
+	if (job->pi)
+		close_image(job->pi);
+	xfree(job->expected);
+	memset(job, 0, sizeof(*job));
+}
+
+static void free_jobs(struct csum_ctl *ctl)
+{
+	int i;
+
+	for (i = 0; i < ctl->nr_jobs; i++)
+		release_job(&ctl->jobs[i]);
+	xfree(ctl->jobs);
+}
+
+/*
+ * Collects the checksums of the present pages from the pagemap and opens
+ * its pages image. Returns 0 if the pagemap has no checksums or no pages.
+ */
+static int prepare_job(int dfd, struct csum_job *job)
+{
+	unsigned long size = 0;
+	bool no_csum = false;
+	struct cr_img *pmi;
+	u32 comp;
+	int ret = -1;
+
+	pmi = open_image_at(dfd, job->type, O_RSTR, job->id);
+	if (!pmi)
+		return -1;
+
+	job->pi = open_pages_image_at(dfd, O_RSTR, pmi, &job->pages_id, &comp);
+	if (!job->pi)
+		goto out;
+
+	if (comp != PAGES_COMP_NONE) {
+		job->comp = pages_comp_reader_open(dfd, img_raw_fd(job->pi), job->pages_id, comp);
+		if (!job->comp)
+			goto out;
+	}
+
+	while (1) {
+		PagemapEntry *pe;
+		int r;
+
+		r = pb_read_one_eof(pmi, &pe, PB_PAGEMAP);
+		if (r <= 0) {
+			if (!r)
+				ret = 0;
+			break;
+		}
+
+		if (!pagemap_present(pe))
+			goto next;
+
+		if (pe->n_csum != pe->nr_pages) {
+			no_csum = true;
+			goto next;
+		}
+
+		if (job->nr + pe->nr_pages > size) {
+			u32 *e;
+
+			size = max(size * 2, job->nr + pe->nr_pages);
+			e = xrealloc(job->expected, size * sizeof(u32));
+			if (!e) {
+				pagemap_entry__free_unpacked(pe, NULL);
+				break;
+			}
+			job->expected = e;
+		}
+
+		memcpy(job->expected + job->nr, pe->csum, pe->nr_pages * sizeof(u32));
+		job->nr += pe->nr_pages;
+next:
+		pagemap_entry__free_unpacked(pe, NULL);
+	}
+
+	if (!ret && no_csum) {
+		pr_warn("pages-%u.img has no checksums\n", job->pages_id);
+		job->nr = 0;
+	}
+	if (!ret && job->nr)
+		ret = 1;
+out:
+	close_image(pmi);
+	return ret;
+}
+
+/* Collects the checksums of all pagemaps, the ones w/o them are dropped */
+static int prepare_verify(struct csum_ctl *ctl)
+{
+	int i, nr = 0;
+
+	if (collect_jobs(ctl)) {
+		free_jobs(ctl);
+		return -1;
+	}
+
+	for (i = 0; i < ctl->nr_jobs; i++) {
+		int ret;
+
+		ret = prepare_job(ctl->dfd, &ctl->jobs[i]);
+		if (ret < 0) {
+			free_jobs(ctl);
+			return -1;
+		}
+		if (!ret)
+			release_job(&ctl->jobs[i]);
+	}
+
+	for (i = 0; i < ctl->nr_jobs; i++)
+		if (ctl->jobs[i].nr)
+			ctl->jobs[nr++] = ctl->jobs[i];
+	ctl->nr_jobs = nr;
+
+	pthread_once(&crc32c_once, crc32c_init);
+	return 0;
+}
+
+static int finish_verify(struct csum_ctl *ctl, int ret)
+{
+	if (!ret)
+		pr_info("%d pages images are intact\n", ctl->nr_jobs);
+	else
+		pr_err("Pages images checksums don't match\n");
+	free_jobs(ctl);
+	return ret;
+}
+
+int pages_csum_verify(int dfd)
+{
+	struct csum_ctl ctl = { .dfd = dfd };
+
+	if (prepare_verify(&ctl))
+		return -1;
+
+	return finish_verify(&ctl, run_jobs(&ctl));
+}
+
+static struct csum_ctl verify_ctl;
+static pthread_t verify_thread;
+static bool verify_started;
+static int verify_ret;
+
+static void *verify_fn(void *arg)
+{
+	verify_ret = run_jobs(&verify_ctl);
+	return NULL;
+}
+
+/*
+ * The images are checked while the restore goes on, the restore waits
+ * for the result right before the tasks are let go. The check starts
+ * once criu has forked all it forks on restore, since the children would
+ * inherit the malloc and log locks held by the checking threads.
+ */
+int pages_csum_verify_start(int dfd)
+{
+	verify_ctl.dfd = fcntl(dfd, F_DUPFD_CLOEXEC, 0);
+	if (verify_ctl.dfd < 0) {
+		pr_perror("Can't dup images dir");
+		return -1;
+	}
+
+	if (prepare_verify(&verify_ctl))
+		goto err;
+
+	if (pthread_create(&verify_thread, NULL, verify_fn, NULL)) {
+		pr_perror("Can't start checksum thread");
+		free_jobs(&verify_ctl);
+		goto err;
+	}
+
+	verify_started = true;
+	return 0;
+
+err:
+	close_safe(&verify_ctl.dfd);
+	return -1;
+}
+
+int pages_csum_verify_wait(void)
+{
+	if (!verify_started)
+		return 0;
+
+	pthread_join(verify_thread, NULL);
+	verify_started = false;
+	close_safe(&verify_ctl.dfd);
+
+	return finish_verify(&verify_ctl, verify_ret);
+}
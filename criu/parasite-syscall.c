@@ -499,6 +499,28 @@ int parasite_get_proc_fd_seized(struct parasite_ctl *ctl)
 	return fd;
 }
 
+int parasite_get_uffd_seized(struct parasite_ctl *ctl)
+{
+	int ret, fd, sk;
+
+	ret = compel_rpc_call(PARASITE_CMD_GET_UFFD, ctl);
+	if (ret) {
+		pr_err("Parasite failed to get userfaultfd\n");
+		return ret;
+	}
+
+	sk = compel_rpc_sock(ctl);
+	fd = recv_fd(sk);
+	if (fd < 0)
+		pr_err("Can't retrieve userfaultfd from socket\n");
+	if (compel_rpc_sync(PARASITE_CMD_GET_UFFD, ctl)) {
+		close_safe(&fd);
+		return -1;
+	}
+
+	return fd;
+}
+
 /* This is officially the 50000'th line in the CRIU source code */
 
 int parasite_dump_cgroup(struct parasite_ctl *ctl, struct parasite_dump_cgroup_args *cgroup)
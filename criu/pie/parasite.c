@@ -8,6 +8,7 @@
 #include <sys/uio.h>
 
 #include "linux/rseq.h"
+#include "linux/userfaultfd.h"
 
 #include "common/config.h"
 #include "int.h"
@@ -580,6 +581,37 @@ static int parasite_get_proc_fd(void)
 	return ret;
 }
 
+/*
+ * The userfaultfd can only be created for the own mm, so the parasite
+ * makes one for write-protect tracking and hands it over to criu.
+ */
+static int parasite_get_uffd(void)
+{
+	struct uffdio_api api = {
+		.api = UFFD_API,
+		.features = UFFD_FEATURE_WP_ASYNC,
+	};
+	int fd, ret, tsock;
+
+	fd = sys_userfaultfd(UFFD_USER_MODE_ONLY | O_CLOEXEC | O_NONBLOCK);
+	if (fd < 0) {
+		pr_err("Can't create userfaultfd (%d)\n", fd);
+		return -1;
+	}
+
+	ret = sys_ioctl(fd, UFFDIO_API, (unsigned long)&api);
+	if (ret) {
+		pr_err("Can't enable async write-protect on userfaultfd (%d)\n", ret);
+		sys_close(fd);
+		return -1;
+	}
+
+	tsock = parasite_get_rpc_sock();
+	ret = send_fd(tsock, NULL, 0, fd);
+	sys_close(fd);
+	return ret;
+}
+
 static inline int tty_ioctl(int fd, int cmd, int *arg)
 {
 	int ret;
@@ -822,6 +854,9 @@ int parasite_daemon_cmd(int cmd, void *args)
 	case PARASITE_CMD_DUMP_CGROUP:
 		ret = parasite_dump_cgroup(args);
 		break;
+	case PARASITE_CMD_GET_UFFD:
+		ret = parasite_get_uffd();
+		break;
 	default:
 		pr_err("Unknown command in parasite daemon thread leader: %d\n", cmd);
 		ret = -1;
@@ -0,0 +1,5417 @@
+/* Autogenerated from criu/pie/restorer.built-in.o */
+#include <compel/infect.h>
+#define restorer_sym__export_unmap 0x1f40
+#define restorer_sym__export_parasite_service_cmd 0x80b8
+#define restorer_sym__export_restore_task 0x1fe0
+#define restorer_sym__export_unmap_compat 0xbc4
+#define restorer_sym__export_restore_thread 0x1a70
+#define restorer_sym__export_parasite_service_args_ptr 0x80b0
+#define restorer_sym__export_parasite_head_start 0x1c
+#define restorer_sym__export_parasite_head_start_compat 0x0
+static __maybe_unused compel_reloc_t restorer_relocs[] = {
+	{ .offset = 0x1       , .type = COMPEL_TYPE_INT,  .addend = 7       , .value = 0x0               , }, /* R_X86_64_32 */
+	{ .offset = 0x13      , .type = COMPEL_TYPE_INT,  .addend = 27      , .value = 0x0               , }, /* R_X86_64_32 */
+	{ .offset = 0xbc6     , .type = COMPEL_TYPE_INT,  .addend = 0       , .value = 0x8028            , }, /* R_X86_64_32 */
+	{ .offset = 0xbcc     , .type = COMPEL_TYPE_INT,  .addend = 0       , .value = 0x8020            , }, /* R_X86_64_32 */
+	{ .offset = 0xbd2     , .type = COMPEL_TYPE_INT,  .addend = 0       , .value = 0x8030            , }, /* R_X86_64_32 */
+	{ .offset = 0xca6     , .type = COMPEL_TYPE_INT,  .addend = 3245    , .value = 0x0               , }, /* R_X86_64_32 */
+	{ .offset = 0x70b6    , .type = COMPEL_TYPE_INT,  .addend = 28861   , .value = 0x0               , }, /* R_X86_64_32 */
+};
+static __maybe_unused const char restorer_blob[] = {
+	0xea,0x00,0x00,0x00,0x00,0x33,0x00,0xe8,
+	0x94,0x74,0x00,0x00,0x6a,0x23,0x4d,0x31,
+	0xdb,0x41,0xbb,0x00,0x00,0x00,0x00,0x41,
+	0x53,0x48,0xcb,0xcc,0xe8,0x7f,0x74,0x00,
+	0x00,0xcc,0x66,0x2e,0x0f,0x1f,0x84,0x00,
+	0x00,0x00,0x00,0x00,0x0f,0x1f,0x40,0x00,
+	0x41,0x54,0x49,0x89,0xcc,0x49,0x89,0xd0,
+	0x31,0xc0,0x55,0x48,0x89,0xf5,0x53,0x48,
+	0x8b,0x0e,0x48,0x89,0xd3,0x48,0x8d,0x35,
+	0x94,0x80,0x00,0x00,0x48,0x89,0xfa,0xbf,
+	0x04,0x00,0x00,0x00,0xe8,0x67,0x5f,0x00,
+	0x00,0x48,0x8b,0x7d,0x00,0x49,0x89,0xd8,
+	0x4c,0x89,0xe2,0xb9,0x03,0x00,0x00,0x00,
+	0x4c,0x89,0xe6,0xe8,0x7c,0x6b,0x00,0x00,
+	0x48,0x39,0xc3,0x75,0x0b,0x48,0x89,0x5d,
+	0x00,0x31,0xc0,0x5b,0x5d,0x41,0x5c,0xc3,
+	0x48,0x83,0xec,0x08,0x48,0x8d,0x15,0x70,
+	0x80,0x00,0x00,0x49,0x89,0xd9,0xb9,0x25,
+	0x00,0x00,0x00,0x50,0x4c,0x8b,0x45,0x00,
+	0x31,0xc0,0x48,0x8d,0x35,0x97,0x80,0x00,
+	0x00,0xbf,0x01,0x00,0x00,0x00,0xe8,0x15,
+	0x5f,0x00,0x00,0x58,0xb8,0xff,0xff,0xff,
+	0xff,0x5a,0xeb,0xc7,0x66,0x66,0x2e,0x0f,
+	0x1f,0x84,0x00,0x00,0x00,0x00,0x00,0x90,
+	0x48,0x8b,0x07,0x48,0x83,0xf8,0xff,0x74,
+	0x6f,0x80,0xbf,0x18,0x01,0x00,0x00,0x00,
+	0x75,0x36,0x48,0x8b,0x97,0x90,0x00,0x00,
+	0x00,0x48,0x83,0xfa,0xff,0x74,0x41,0x53,
+	0x48,0x8d,0x1c,0x10,0xbf,0x03,0x00,0x00,
+	0x00,0x31,0xc0,0x48,0x89,0xda,0x48,0x8d,
+	0x35,0x0b,0x81,0x00,0x00,0xe8,0xc6,0x5e,
+	0x00,0x00,0x48,0x89,0xdf,0x5b,0xe9,0x9d,
+	0x58,0x00,0x00,0x0f,0x1f,0x44,0x00,0x00,
+	0x48,0x8d,0x35,0x91,0x80,0x00,0x00,0xbf,
+	0x04,0x00,0x00,0x00,0x31,0xc0,0xe9,0xa5,
+	0x5e,0x00,0x00,0x0f,0x1f,0x44,0x00,0x00,
+	0x48,0x8d,0x35,0xb1,0x80,0x00,0x00,0xbf,
+	0x04,0x00,0x00,0x00,0x31,0xc0,0xe9,0x8d,
+	0x5e,0x00,0x00,0x0f,0x1f,0x44,0x00,0x00,
+	0x48,0x8d,0x35,0x31,0x80,0x00,0x00,0xbf,
+	0x04,0x00,0x00,0x00,0x31,0xc0,0xe9,0x75,
+	0x5e,0x00,0x00,0x0f,0x1f,0x44,0x00,0x00,
+	0x41,0x55,0x41,0x54,0x49,0x89,0xd4,0x48,
+	0x89,0xf2,0x48,0x89,0xfe,0x55,0x53,0x48,
+	0x89,0xfb,0x48,0x83,0xec,0x08,0x48,0x8b,
+	0x4f,0x10,0x4c,0x8b,0x6f,0x18,0x48,0x8d,
+	0x3d,0x9f,0x7f,0x00,0x00,0xe8,0xb6,0xfe,
+	0xff,0xff,0x89,0xc5,0x85,0xc0,0x74,0x10,
+	0x48,0x83,0xc4,0x08,0x89,0xe8,0x5b,0x5d,
+	0x41,0x5c,0x41,0x5d,0xc3,0x0f,0x1f,0x00,
+	0x31,0xff,0xe8,0x09,0x58,0x00,0x00,0x4d,
+	0x85,0xe4,0x75,0x1c,0x48,0x89,0xdf,0xe8,
+	0x1c,0xff,0xff,0xff,0x48,0x83,0xc4,0x08,
+	0x89,0xe8,0x5b,0x5d,0x41,0x5c,0x41,0x5d,
+	0xc3,0x0f,0x1f,0x80,0x00,0x00,0x00,0x00,
+	0x48,0x8d,0x73,0x08,0x4c,0x89,0xe9,0x4c,
+	0x89,0xe2,0x48,0x8d,0x3d,0x53,0x7f,0x00,
+	0x00,0xe8,0x62,0xfe,0xff,0xff,0x85,0xc0,
+	0x74,0xca,0x48,0x83,0xc4,0x08,0x89,0xc5,
+	0x5b,0x89,0xe8,0x5d,0x41,0x5c,0x41,0x5d,
+	0xc3,0x66,0x66,0x2e,0x0f,0x1f,0x84,0x00,
+	0x00,0x00,0x00,0x00,0x0f,0x1f,0x40,0x00,
+	0x55,0x53,0x48,0x89,0xfb,0x48,0x83,0xec,
+	0x08,0x48,0x83,0x7f,0x08,0xff,0x48,0x8b,
+	0x47,0x18,0x48,0x8b,0x4f,0x10,0x74,0x30,
+	0x48,0x8d,0x3c,0x08,0x48,0x39,0xd7,0x72,
+	0x67,0x80,0xbb,0x10,0x01,0x00,0x00,0x00,
+	0x48,0x8d,0x14,0x31,0x75,0x09,0x48,0x01,
+	0xf0,0x48,0x89,0xf2,0x48,0x89,0xc6,0x48,
+	0x83,0xc4,0x08,0x48,0x89,0xdf,0x5b,0x5d,
+	0xe9,0x1b,0xff,0xff,0xff,0x0f,0x1f,0x00,
+	0x48,0x39,0xd1,0x72,0x6f,0x48,0x89,0xf2,
+	0x48,0x89,0xfe,0x48,0x8d,0x3d,0xca,0x7e,
+	0x00,0x00,0xe8,0xe1,0xfd,0xff,0xff,0x89,
+	0xc5,0x85,0xc0,0x74,0x0b,0x48,0x83,0xc4,
+	0x08,0x89,0xe8,0x5b,0x5d,0xc3,0x66,0x90,
+	0x31,0xff,0xe8,0x39,0x57,0x00,0x00,0x48,
+	0x89,0xdf,0xe8,0x51,0xfe,0xff,0xff,0x48,
+	0x83,0xc4,0x08,0x89,0xe8,0x5b,0x5d,0xc3,
+	0x41,0xb9,0x77,0x00,0x00,0x00,0x4c,0x8d,
+	0x05,0x76,0x7e,0x00,0x00,0xb9,0x77,0x00,
+	0x00,0x00,0x31,0xc0,0x4c,0x89,0xc2,0xbf,
+	0x01,0x00,0x00,0x00,0x48,0x8d,0x35,0x95,
+	0x7f,0x00,0x00,0xe8,0x20,0x5d,0x00,0x00,
+	0x31,0xc0,0x48,0x89,0x04,0x25,0x00,0x00,
+	0x00,0x00,0x0f,0x0b,0x41,0xb9,0x73,0x00,
+	0x00,0x00,0x4c,0x8d,0x05,0x42,0x7e,0x00,
+	0x00,0xb9,0x73,0x00,0x00,0x00,0xeb,0xca,
+	0x41,0x57,0x66,0x0f,0xef,0xd2,0x66,0x0f,
+	0x76,0xc0,0x41,0x56,0x41,0x55,0x41,0x54,
+	0x55,0x53,0x48,0x81,0xec,0x58,0x01,0x00,
+	0x00,0x48,0xc7,0x44,0x24,0x30,0xff,0xff,
+	0xff,0xff,0x48,0xc7,0x44,0x24,0x70,0xff,
+	0xff,0xff,0xff,0x48,0xc7,0x84,0x24,0x98,
+	0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x48,
+	0xc7,0x84,0x24,0xc0,0x00,0x00,0x00,0xff,
+	0xff,0xff,0xff,0x48,0xc7,0x84,0x24,0xe8,
+	0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x48,
+	0xc7,0x84,0x24,0x10,0x01,0x00,0x00,0xff,
+	0xff,0xff,0xff,0x48,0xc7,0x84,0x24,0x38,
+	0x01,0x00,0x00,0xff,0xff,0xff,0xff,0xc6,
+	0x84,0x24,0x40,0x01,0x00,0x00,0x00,0x0f,
+	0x29,0x44,0x24,0x40,0x0f,0x29,0x54,0x24,
+	0x10,0x0f,0x29,0x54,0x24,0x20,0x0f,0x29,
+	0x54,0x24,0x50,0x0f,0x29,0x54,0x24,0x60,
+	0x0f,0x11,0x54,0x24,0x78,0x0f,0x11,0x94,
+	0x24,0x88,0x00,0x00,0x00,0x0f,0x29,0x94,
+	0x24,0xa0,0x00,0x00,0x00,0x0f,0x29,0x94,
+	0x24,0xb0,0x00,0x00,0x00,0x0f,0x11,0x94,
+	0x24,0xc8,0x00,0x00,0x00,0x0f,0x11,0x94,
+	0x24,0xd8,0x00,0x00,0x00,0x0f,0x29,0x94,
+	0x24,0xf0,0x00,0x00,0x00,0x0f,0x29,0x94,
+	0x24,0x00,0x01,0x00,0x00,0x0f,0x11,0x94,
+	0x24,0x18,0x01,0x00,0x00,0x0f,0x11,0x94,
+	0x24,0x28,0x01,0x00,0x00,0x48,0x85,0xc9,
+	0x0f,0x84,0x7a,0x02,0x00,0x00,0x49,0x89,
+	0xff,0x49,0x89,0xf4,0x48,0x89,0xd7,0x48,
+	0x89,0xce,0x45,0x89,0xcd,0x31,0xd2,0x31,
+	0xdb,0x31,0xed,0x31,0xc0,0xeb,0x1b,0x66,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0x80,0xe5,0x10,0x48,0x0f,0x45,0xd8,0x8d,
+	0x42,0x01,0x48,0x89,0xc2,0x48,0x39,0xf0,
+	0x73,0x22,0x48,0x8d,0x0c,0x40,0x48,0x8d,
+	0x04,0x88,0x48,0x8d,0x04,0xc7,0x8b,0x48,
+	0x40,0xf6,0xc1,0x08,0x74,0xda,0x48,0x89,
+	0xc5,0x8d,0x42,0x01,0x48,0x89,0xc2,0x48,
+	0x39,0xf0,0x72,0xde,0x48,0x89,0xe8,0x48,
+	0x09,0xd8,0x0f,0x84,0x18,0x02,0x00,0x00,
+	0x48,0x85,0xed,0x0f,0x84,0xc8,0x03,0x00,
+	0x00,0x49,0x83,0x3f,0xff,0x0f,0x84,0x7c,
+	0x03,0x00,0x00,0x48,0x8b,0x7d,0x18,0x48,
+	0x8b,0x75,0x20,0x41,0x0f,0xb6,0xc0,0x4c,
+	0x8d,0x74,0x24,0x40,0x89,0x44,0x24,0x0c,
+	0x4c,0x89,0xf2,0x48,0x29,0xfe,0x45,0x84,
+	0xc0,0x0f,0x85,0xf1,0x00,0x00,0x00,0xe8,
+	0x04,0x42,0x00,0x00,0x85,0xc0,0x0f,0x85,
+	0x41,0x03,0x00,0x00,0x48,0x85,0xdb,0x0f,
+	0x84,0xb3,0x01,0x00,0x00,0x4c,0x8b,0x4b,
+	0x20,0x4c,0x8b,0x43,0x18,0x48,0x8b,0x4d,
+	0x20,0x48,0x8b,0x55,0x18,0xbf,0x04,0x00,
+	0x00,0x00,0x31,0xc0,0x48,0x8d,0x35,0x9d,
+	0x7e,0x00,0x00,0xe8,0x50,0x5b,0x00,0x00,
+	0x41,0xc6,0x04,0x24,0x00,0x4c,0x8b,0x5d,
+	0x18,0x48,0x8b,0x75,0x20,0x49,0x8b,0x7f,
+	0x10,0x4c,0x29,0xde,0x48,0x39,0xfe,0x0f,
+	0x85,0xab,0x00,0x00,0x00,0x31,0xc0,0x31,
+	0xd2,0x48,0x8d,0x4c,0x24,0x70,0x4c,0x8b,
+	0x04,0x01,0x4d,0x8b,0x4c,0x07,0x40,0x4d,
+	0x39,0xc8,0x0f,0x85,0x98,0x01,0x00,0x00,
+	0x48,0x83,0xc2,0x01,0x48,0x83,0xc0,0x28,
+	0x48,0x83,0xfa,0x06,0x75,0xe0,0x48,0x85,
+	0xdb,0x0f,0x84,0xa9,0x01,0x00,0x00,0x49,
+	0x8b,0x57,0x18,0x48,0x83,0xfa,0xff,0x0f,
+	0x84,0x63,0x01,0x00,0x00,0x48,0x8b,0x4b,
+	0x18,0x48,0x8b,0x43,0x20,0x48,0x29,0xc8,
+	0x48,0x39,0xc2,0x0f,0x85,0xfb,0x01,0x00,
+	0x00,0x49,0x39,0xcb,0x0f,0x92,0xc0,0x41,
+	0x3a,0x87,0x10,0x01,0x00,0x00,0x0f,0x84,
+	0x3c,0x01,0x00,0x00,0x49,0x39,0xcb,0x48,
+	0x8d,0x05,0x26,0x7c,0x00,0x00,0x48,0x8d,
+	0x15,0x29,0x7c,0x00,0x00,0xbf,0x03,0x00,
+	0x00,0x00,0x48,0x0f,0x42,0xd0,0x48,0x8d,
+	0x35,0xb3,0x7e,0x00,0x00,0x31,0xc0,0xe8,
+	0xa4,0x5a,0x00,0x00,0x41,0xc6,0x04,0x24,
+	0x01,0xeb,0x3c,0x0f,0x1f,0x44,0x00,0x00,
+	0xe8,0xe3,0x48,0x00,0x00,0xe9,0x0a,0xff,
+	0xff,0xff,0x66,0x0f,0x1f,0x44,0x00,0x00,
+	0x48,0x89,0xf9,0x48,0x89,0xf2,0xbf,0x03,
+	0x00,0x00,0x00,0x31,0xc0,0x48,0x8d,0x35,
+	0xec,0x7d,0x00,0x00,0xe8,0x6f,0x5a,0x00,
+	0x00,0x41,0xc6,0x04,0x24,0x01,0x48,0x85,
+	0xdb,0x0f,0x84,0x17,0x01,0x00,0x00,0x48,
+	0x8b,0x5b,0x18,0x48,0x8d,0x35,0x2e,0x7f,
+	0x00,0x00,0xbf,0x03,0x00,0x00,0x00,0x31,
+	0xc0,0xe8,0x4a,0x5a,0x00,0x00,0x48,0x8b,
+	0x75,0x18,0x49,0x8b,0x3f,0x49,0x8d,0x57,
+	0x10,0x44,0x8b,0x44,0x24,0x0c,0x4c,0x89,
+	0xf1,0xe8,0x92,0x02,0x00,0x00,0x85,0xc0,
+	0x0f,0x85,0xd0,0x01,0x00,0x00,0x49,0x8b,
+	0x77,0x10,0x49,0x8b,0x3f,0xba,0x02,0x00,
+	0x00,0x00,0xe8,0x01,0x66,0x00,0x00,0x49,
+	0x8b,0x57,0x08,0x48,0x8b,0x4d,0x18,0x48,
+	0xbf,0x43,0x52,0x49,0x55,0x76,0x44,0x53,
+	0x4f,0x49,0x8b,0x07,0x48,0x89,0x50,0x20,
+	0xba,0x05,0x00,0x00,0x00,0x48,0x89,0x38,
+	0x48,0x89,0x48,0x08,0x48,0xc7,0x40,0x10,
+	0x03,0x00,0x00,0x00,0x48,0x89,0x58,0x18,
+	0x49,0x8b,0x77,0x10,0x49,0x8b,0x3f,0xe8,
+	0xc4,0x65,0x00,0x00,0x31,0xc0,0x48,0x81,
+	0xc4,0x58,0x01,0x00,0x00,0x5b,0x5d,0x41,
+	0x5c,0x41,0x5d,0x41,0x5e,0x41,0x5f,0xc3,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0x49,0xc7,0xc1,0xff,0xff,0xff,0xff,0x49,
+	0xc7,0xc0,0xff,0xff,0xff,0xff,0xe9,0x42,
+	0xfe,0xff,0xff,0x0f,0x1f,0x44,0x00,0x00,
+	0x48,0x8d,0x35,0x39,0x7c,0x00,0x00,0xbf,
+	0x03,0x00,0x00,0x00,0x31,0xc0,0xe8,0x95,
+	0x59,0x00,0x00,0xeb,0xb7,0x0f,0x1f,0x00,
+	0x45,0x84,0xed,0x74,0x4d,0x41,0xc6,0x04,
+	0x24,0x01,0xe9,0x20,0xff,0xff,0xff,0x90,
+	0x48,0x8d,0x04,0x92,0x48,0x8d,0x35,0x15,
+	0x7d,0x00,0x00,0xbf,0x03,0x00,0x00,0x00,
+	0x49,0x8d,0x4c,0xc6,0x10,0x31,0xc0,0xe8,
+	0x64,0x59,0x00,0x00,0xe9,0xf0,0xfe,0xff,
+	0xff,0x0f,0x1f,0x80,0x00,0x00,0x00,0x00,
+	0x45,0x84,0xed,0x0f,0x84,0x8e,0x00,0x00,
+	0x00,0x41,0xc6,0x04,0x24,0x01,0x48,0xc7,
+	0xc3,0xff,0xff,0xff,0xff,0xe9,0xe1,0xfe,
+	0xff,0xff,0x48,0x8d,0x35,0x67,0x7d,0x00,
+	0x00,0xbf,0x03,0x00,0x00,0x00,0x31,0xc0,
+	0xe8,0x2b,0x59,0x00,0x00,0x48,0x8b,0x7d,
+	0x18,0x48,0x8b,0x75,0x20,0x48,0x29,0xfe,
+	0xe8,0x0b,0x65,0x00,0x00,0x48,0x85,0xc0,
+	0x0f,0x85,0x02,0x01,0x00,0x00,0x48,0x8b,
+	0x7b,0x18,0x48,0x8b,0x73,0x20,0x48,0x29,
+	0xfe,0xe8,0xf2,0x64,0x00,0x00,0x48,0x85,
+	0xc0,0x0f,0x85,0x2b,0x01,0x00,0x00,0x48,
+	0x8b,0x53,0x18,0x48,0x8b,0x75,0x18,0x4c,
+	0x89,0xff,0xe8,0x79,0xfa,0xff,0xff,0xe9,
+	0x0a,0xff,0xff,0xff,0x48,0x89,0xf9,0x48,
+	0x89,0xf2,0xbf,0x03,0x00,0x00,0x00,0x31,
+	0xc0,0x48,0x8d,0x35,0xa8,0x7c,0x00,0x00,
+	0xe8,0xcb,0x58,0x00,0x00,0x41,0xc6,0x04,
+	0x24,0x01,0xe9,0x60,0xfe,0xff,0xff,0x48,
+	0x8d,0x35,0xea,0x7c,0x00,0x00,0xbf,0x03,
+	0x00,0x00,0x00,0x31,0xc0,0xe8,0xae,0x58,
+	0x00,0x00,0x48,0x8b,0x7d,0x18,0x48,0x8b,
+	0x75,0x20,0x48,0x29,0xfe,0xe8,0x8e,0x64,
+	0x00,0x00,0x48,0x85,0xc0,0x0f,0x85,0x85,
+	0x00,0x00,0x00,0x49,0x8b,0x4f,0x10,0x48,
+	0x8b,0x55,0x18,0x4c,0x89,0xfe,0x48,0x8d,
+	0x3d,0xd7,0x79,0x00,0x00,0xe8,0xee,0xf8,
+	0xff,0xff,0x85,0xc0,0x0f,0x85,0x9c,0xfe,
+	0xff,0xff,0x31,0xff,0x89,0x44,0x24,0x0c,
+	0xe8,0x4b,0x52,0x00,0x00,0x4c,0x89,0xff,
+	0xe8,0x63,0xf9,0xff,0xff,0x8b,0x44,0x24,
+	0x0c,0xe9,0x80,0xfe,0xff,0xff,0xb9,0xf0,
+	0x00,0x00,0x00,0x48,0x8d,0x15,0x89,0x79,
+	0x00,0x00,0x48,0x8d,0x35,0x57,0x7d,0x00,
+	0x00,0x31,0xc0,0xbf,0x01,0x00,0x00,0x00,
+	0xe8,0x3b,0x58,0x00,0x00,0xb8,0xff,0xff,
+	0xff,0xff,0xe9,0x57,0xfe,0xff,0xff,0xb9,
+	0x24,0x01,0x00,0x00,0x48,0x8d,0x15,0x60,
+	0x79,0x00,0x00,0x48,0x8d,0x35,0x16,0x7b,
+	0x00,0x00,0x31,0xc0,0xbf,0x01,0x00,0x00,
+	0x00,0xe8,0x12,0x58,0x00,0x00,0xeb,0xd5,
+	0xb9,0xcb,0x00,0x00,0x00,0x48,0x8d,0x15,
+	0x3f,0x79,0x00,0x00,0x48,0x8d,0x35,0x65,
+	0x7c,0x00,0x00,0x31,0xc0,0xbf,0x01,0x00,
+	0x00,0x00,0xe8,0xf1,0x57,0x00,0x00,0xeb,
+	0xb4,0xb9,0x18,0x01,0x00,0x00,0x48,0x8d,
+	0x15,0x1e,0x79,0x00,0x00,0x48,0x8d,0x35,
+	0x9c,0x7a,0x00,0x00,0x31,0xc0,0xbf,0x01,
+	0x00,0x00,0x00,0xe8,0xd0,0x57,0x00,0x00,
+	0xeb,0x93,0xb9,0xd4,0x00,0x00,0x00,0x48,
+	0x8d,0x15,0xfd,0x78,0x00,0x00,0x48,0x8d,
+	0x35,0x5b,0x7c,0x00,0x00,0x31,0xc0,0xbf,
+	0x01,0x00,0x00,0x00,0xe8,0xaf,0x57,0x00,
+	0x00,0xe9,0x6f,0xff,0xff,0xff,0x66,0x2e,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0x41,0x57,0x45,0x31,0xff,0x41,0x56,0x45,
+	0x89,0xc6,0x41,0x55,0x49,0x89,0xfd,0x41,
+	0x54,0x49,0x89,0xf4,0x55,0x48,0x8d,0x6a,
+	0x30,0x53,0x48,0x8d,0x59,0x30,0x48,0x83,
+	0xec,0x18,0xeb,0x47,0x0f,0x1f,0x40,0x00,
+	0xba,0x48,0xb8,0xff,0xff,0xb9,0xff,0xe0,
+	0xff,0xff,0x48,0x89,0xe6,0x48,0x89,0x44,
+	0x24,0x02,0x66,0x89,0x14,0x24,0xba,0x10,
+	0x00,0x00,0x00,0x66,0x89,0x4c,0x24,0x0a,
+	0xc7,0x44,0x24,0x0c,0xcc,0xcc,0xcc,0xcc,
+	0xe8,0xd7,0x62,0x00,0x00,0x41,0x83,0xc7,
+	0x01,0x48,0x83,0xc5,0x28,0x48,0x83,0xc3,
+	0x28,0x41,0x83,0xff,0x06,0x0f,0x84,0x85,
+	0x00,0x00,0x00,0x48,0x8b,0x0b,0x48,0x83,
+	0xf9,0xff,0x74,0x6c,0x48,0x83,0xec,0x08,
+	0x4d,0x89,0xe8,0x48,0x8d,0x35,0x66,0x7c,
+	0x00,0x00,0x31,0xc0,0x41,0x57,0x4c,0x8b,
+	0x4d,0x00,0xbf,0x04,0x00,0x00,0x00,0x4c,
+	0x89,0xe2,0xe8,0x09,0x57,0x00,0x00,0x48,
+	0x8b,0x3b,0x48,0x8b,0x45,0x00,0x5e,0x41,
+	0x58,0x4c,0x01,0xe7,0x4c,0x01,0xe8,0x45,
+	0x84,0xf6,0x0f,0x84,0x78,0xff,0xff,0xff,
+	0x89,0x44,0x24,0x01,0x48,0x89,0xe6,0xb8,
+	0xff,0xe0,0xff,0xff,0xba,0x0b,0x00,0x00,
+	0x00,0xc6,0x04,0x24,0xb8,0x66,0x89,0x44,
+	0x24,0x05,0xc7,0x44,0x24,0x07,0xcc,0xcc,
+	0xcc,0xcc,0xe8,0x55,0x62,0x00,0x00,0xe9,
+	0x79,0xff,0xff,0xff,0x0f,0x1f,0x40,0x00,
+	0x80,0x7b,0xe0,0x00,0x0f,0x84,0x6b,0xff,
+	0xff,0xff,0xeb,0x88,0x0f,0x1f,0x40,0x00,
+	0x48,0x83,0xc4,0x18,0x31,0xc0,0x5b,0x5d,
+	0x41,0x5c,0x41,0x5d,0x41,0x5e,0x41,0x5f,
+	0xc3,0x66,0x2e,0x0f,0x1f,0x84,0x00,0x00,
+	0x00,0x00,0x00,0x0f,0x1f,0x44,0x00,0x00,
+	0x55,0x89,0xf0,0x48,0x8d,0x15,0x03,0x7c,
+	0x00,0x00,0x48,0x89,0xf9,0x53,0x48,0x89,
+	0xfb,0xbf,0x04,0x00,0x00,0x00,0x48,0x83,
+	0xec,0x08,0xf6,0xd8,0x48,0x8d,0x05,0xdf,
+	0x7b,0x00,0x00,0x19,0xed,0x81,0xc5,0x03,
+	0x20,0x00,0x00,0x40,0x84,0xf6,0x48,0x8d,
+	0x35,0xdf,0x7b,0x00,0x00,0x48,0x0f,0x45,
+	0xd0,0x31,0xc0,0xe8,0x50,0x56,0x00,0x00,
+	0x48,0x89,0xde,0x89,0xef,0xe8,0xbe,0x64,
+	0x00,0x00,0x48,0x83,0xc4,0x08,0x5b,0x5d,
+	0xc3,0x66,0x66,0x2e,0x0f,0x1f,0x84,0x00,
+	0x00,0x00,0x00,0x00,0x0f,0x1f,0x40,0x00,
+	0x53,0x48,0x8b,0xb7,0xc0,0x00,0x00,0x00,
+	0x48,0x89,0xfb,0xbf,0x02,0x10,0x00,0x00,
+	0xe8,0x93,0x64,0x00,0x00,0x48,0x85,0xc0,
+	0x75,0x1e,0x48,0x8b,0xb3,0xc8,0x00,0x00,
+	0x00,0xbf,0x01,0x10,0x00,0x00,0xe8,0x7d,
+	0x64,0x00,0x00,0x48,0x85,0xc0,0x75,0x25,
+	0x31,0xc0,0x5b,0xc3,0x0f,0x1f,0x40,0x00,
+	0x48,0x89,0xc2,0x48,0x8d,0x35,0x8a,0x7b,
+	0x00,0x00,0xbf,0x03,0x00,0x00,0x00,0x31,
+	0xc0,0xe8,0xe2,0x55,0x00,0x00,0xb8,0xff,
+	0xff,0xff,0xff,0x5b,0xc3,0x48,0x89,0xc2,
+	0x48,0x8d,0x35,0x7e,0x7b,0x00,0x00,0xbf,
+	0x03,0x00,0x00,0x00,0x31,0xc0,0xe8,0xc5,
+	0x55,0x00,0x00,0xeb,0xe1,0x0f,0x1f,0x00,
+	0x31,0xd2,0x41,0x57,0x89,0xf1,0xb8,0x37,
+	0x01,0x00,0x00,0x41,0x56,0x89,0xd6,0x41,
+	0x55,0x41,0x54,0x53,0x89,0xfb,0x89,0xd7,
+	0x48,0x81,0xec,0x80,0x00,0x00,0x00,0x55,
+	0xbd,0x00,0x00,0x00,0x00,0xcd,0x80,0x5d,
+	0x48,0x81,0xc4,0x80,0x00,0x00,0x00,0x5b,
+	0x41,0x5c,0x41,0x5d,0x41,0x5e,0x41,0x5f,
+	0xc3,0x0f,0x1f,0x80,0x00,0x00,0x00,0x00,
+	0x41,0x57,0x41,0xbf,0xf3,0x00,0x00,0x00,
+	0x41,0x56,0x49,0x89,0xfe,0x41,0x55,0x49,
+	0x89,0xfd,0x41,0x54,0x45,0x31,0xe4,0x55,
+	0x31,0xed,0x53,0x48,0x83,0xec,0x08,0x89,
+	0xe8,0x48,0xc1,0xe0,0x04,0x41,0xf6,0x44,
+	0x06,0x0c,0x20,0x75,0x27,0x4d,0x85,0xe4,
+	0x0f,0x84,0x8a,0x00,0x00,0x00,0xba,0x10,
+	0x00,0x00,0x00,0x4c,0x89,0xee,0x4c,0x89,
+	0xe7,0xe8,0xc6,0x60,0x00,0x00,0x44,0x89,
+	0xf8,0x44,0x89,0xe3,0xcd,0x80,0x89,0xc2,
+	0x85,0xd2,0x75,0x3c,0x83,0xc5,0x01,0x49,
+	0x83,0xc5,0x10,0x83,0xfd,0x03,0x75,0xbf,
+	0x4d,0x85,0xe4,0x74,0x16,0xbe,0x00,0x10,
+	0x00,0x00,0x4c,0x89,0xe7,0xe8,0xfe,0x60,
+	0x00,0x00,0x48,0x85,0xc0,0x0f,0x85,0xa5,
+	0x00,0x00,0x00,0x48,0x83,0xc4,0x08,0x5b,
+	0x5d,0x41,0x5c,0x41,0x5d,0x41,0x5e,0x41,
+	0x5f,0xc3,0x66,0x0f,0x1f,0x44,0x00,0x00,
+	0x45,0x8b,0x45,0x00,0x41,0x89,0xd1,0xb9,
+	0x6a,0x00,0x00,0x00,0x31,0xc0,0x48,0x8d,
+	0x15,0x99,0x7a,0x00,0x00,0x48,0x8d,0x35,
+	0x54,0x7b,0x00,0x00,0xbf,0x01,0x00,0x00,
+	0x00,0xe8,0xca,0x54,0x00,0x00,0xeb,0x9c,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x31,0xc9,0xb9,0x62,0x00,0x00,0x00,
+	0xba,0x03,0x00,0x00,0x00,0x31,0xff,0x49,
+	0xc7,0xc0,0xff,0xff,0xff,0xff,0xbe,0x00,
+	0x10,0x00,0x00,0xe8,0x80,0x60,0x00,0x00,
+	0x49,0x89,0xc4,0xa9,0xff,0x0f,0x00,0x00,
+	0x75,0x6e,0x48,0x85,0xc0,0x0f,0x85,0x43,
+	0xff,0xff,0xff,0x41,0x58,0xb9,0x42,0x00,
+	0x00,0x00,0x5b,0xbf,0x01,0x00,0x00,0x00,
+	0x5d,0x48,0x8d,0x15,0x36,0x7a,0x00,0x00,
+	0x41,0x5c,0x31,0xc0,0x41,0x5d,0x48,0x8d,
+	0x35,0xab,0x7a,0x00,0x00,0x41,0x5e,0x41,
+	0x5f,0xe9,0x62,0x54,0x00,0x00,0x66,0x90,
+	0x48,0x83,0xc4,0x08,0x49,0x89,0xc1,0x4d,
+	0x89,0xe0,0xb9,0x21,0x00,0x00,0x00,0x5b,
+	0x48,0x8d,0x15,0x21,0x7a,0x00,0x00,0x5d,
+	0xbf,0x01,0x00,0x00,0x00,0x41,0x5c,0x48,
+	0x8d,0x35,0xfa,0x7a,0x00,0x00,0x41,0x5d,
+	0x31,0xc0,0x41,0x5e,0x41,0x5f,0xe9,0x2d,
+	0x54,0x00,0x00,0x0f,0x1f,0x44,0x00,0x00,
+	0x41,0x89,0xc0,0xb9,0x16,0x00,0x00,0x00,
+	0x31,0xc0,0xbf,0x01,0x00,0x00,0x00,0x41,
+	0xf7,0xd8,0x48,0x8d,0x15,0xe7,0x79,0x00,
+	0x00,0x48,0x8d,0x35,0x08,0x7a,0x00,0x00,
+	0xe8,0x03,0x54,0x00,0x00,0xe9,0x71,0xff,
+	0xff,0xff,0x66,0x90,0x8b,0x1d,0x00,0x00,
+	0x00,0x00,0x8b,0x0d,0x00,0x00,0x00,0x00,
+	0x2b,0x0d,0x00,0x00,0x00,0x00,0xb8,0x5b,
+	0x00,0x00,0x00,0xcd,0x80,0xcc,0x66,0x90,
+	0x89,0xd6,0xba,0x00,0x00,0x00,0x00,0xb8,
+	0xae,0x00,0x00,0x00,0xcd,0x80,0xc3,0x90,
+	0x41,0x57,0xb8,0xfe,0xff,0xff,0xff,0x41,
+	0x56,0x41,0x55,0x41,0x54,0x55,0x53,0x48,
+	0x83,0xec,0x08,0x48,0x39,0xf8,0x72,0x48,
+	0x89,0xf3,0x48,0x89,0xd6,0xba,0x14,0x00,
+	0x00,0x00,0x48,0x89,0xfd,0xe8,0x32,0x5f,
+	0x00,0x00,0x31,0xd2,0xb8,0xae,0x00,0x00,
+	0x00,0x89,0xe9,0xbe,0x08,0x00,0x00,0x00,
+	0x89,0xd7,0x48,0x81,0xec,0x80,0x00,0x00,
+	0x00,0x55,0xbd,0x00,0x00,0x00,0x00,0xcd,
+	0x80,0x5d,0x48,0x81,0xc4,0x80,0x00,0x00,
+	0x00,0x48,0x83,0xc4,0x08,0x5b,0x5d,0x41,
+	0x5c,0x41,0x5d,0x41,0x5e,0x41,0x5f,0xc3,
+	0x31,0xc0,0xb9,0x24,0x00,0x00,0x00,0x48,
+	0x8d,0x15,0x62,0x7a,0x00,0x00,0xbf,0x01,
+	0x00,0x00,0x00,0x48,0x8d,0x35,0x7e,0x7a,
+	0x00,0x00,0xe8,0x51,0x53,0x00,0x00,0xb8,
+	0xff,0xff,0xff,0xff,0xeb,0xcb,0x66,0x2e,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0x80,0xbe,0x40,0x37,0x00,0x00,0x00,0x74,
+	0x17,0x48,0x89,0xf8,0x48,0x89,0xc4,0xb8,
+	0x0f,0x00,0x00,0x00,0x0f,0x05,0xc3,0x66,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0x6a,0x23,0x48,0x31,0xc0,0xb8,0x00,0x00,
+	0x00,0x00,0x50,0x48,0xcb,0x89,0xfc,0xb8,
+	0xad,0x00,0x00,0x00,0xcd,0x80,0xc3,0x66,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0x53,0x8b,0x87,0x98,0x00,0x00,0x00,0x85,
+	0xc0,0x0f,0x84,0xb1,0x00,0x00,0x00,0x48,
+	0x63,0xb7,0x9c,0x00,0x00,0x00,0x48,0x89,
+	0xfb,0x45,0x31,0xc0,0x31,0xc9,0x31,0xd2,
+	0x83,0xfe,0x01,0x76,0x5b,0x31,0xf6,0xbf,
+	0x03,0x00,0x00,0x00,0xe8,0x3b,0x61,0x00,
+	0x00,0x44,0x8b,0x83,0x9c,0x00,0x00,0x00,
+	0x41,0x39,0xc0,0x74,0x3c,0x48,0x8d,0x1d,
+	0x1d,0x7a,0x00,0x00,0x41,0x89,0xc1,0x31,
+	0xc0,0xb9,0x7c,0x01,0x00,0x00,0x48,0x89,
+	0xda,0x48,0x8d,0x35,0xa8,0x7d,0x00,0x00,
+	0xbf,0x02,0x00,0x00,0x00,0xe8,0x9e,0x52,
+	0x00,0x00,0x45,0x31,0xc0,0x31,0xc9,0x31,
+	0xd2,0x31,0xf6,0xbf,0x04,0x00,0x00,0x00,
+	0xe8,0xf7,0x60,0x00,0x00,0x85,0xc0,0x75,
+	0x6a,0x31,0xc0,0x5b,0xc3,0x0f,0x1f,0x00,
+	0xbf,0x04,0x00,0x00,0x00,0xe8,0xe2,0x60,
+	0x00,0x00,0x85,0xc0,0x74,0xeb,0x41,0x89,
+	0xc0,0xb9,0x6d,0x01,0x00,0x00,0x31,0xc0,
+	0xbf,0x01,0x00,0x00,0x00,0x48,0x8d,0x15,
+	0xbd,0x79,0x00,0x00,0x48,0x8d,0x35,0x1d,
+	0x7d,0x00,0x00,0xe8,0x50,0x52,0x00,0x00,
+	0xb8,0xff,0xff,0xff,0xff,0x5b,0xc3,0x66,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0x31,0xc0,0xb9,0x66,0x01,0x00,0x00,0x48,
+	0x8d,0x15,0x93,0x79,0x00,0x00,0xbf,0x02,
+	0x00,0x00,0x00,0x48,0x8d,0x35,0xb6,0x7c,
+	0x00,0x00,0xe8,0x21,0x52,0x00,0x00,0x31,
+	0xc0,0xeb,0x98,0x41,0x89,0xc0,0xb9,0x81,
+	0x01,0x00,0x00,0x48,0x89,0xda,0xbf,0x01,
+	0x00,0x00,0x00,0x48,0x8d,0x35,0xce,0x7c,
+	0x00,0x00,0x31,0xc0,0xe8,0xff,0x51,0x00,
+	0x00,0xeb,0xad,0x66,0x66,0x2e,0x0f,0x1f,
+	0x84,0x00,0x00,0x00,0x00,0x00,0x66,0x90,
+	0x55,0x53,0x48,0x89,0xfb,0x48,0x83,0xec,
+	0x18,0x48,0x8b,0xbf,0x08,0x01,0x00,0x00,
+	0xe8,0xd7,0x60,0x00,0x00,0x8b,0xb3,0x18,
+	0x01,0x00,0x00,0x85,0xf6,0x74,0x51,0x48,
+	0x8b,0x83,0x28,0x01,0x00,0x00,0x48,0x8b,
+	0xbb,0x10,0x01,0x00,0x00,0x80,0xb8,0xec,
+	0x03,0x00,0x00,0x00,0x0f,0x85,0xf6,0x00,
+	0x00,0x00,0xe8,0x3d,0x61,0x00,0x00,0x85,
+	0xc0,0x74,0x2d,0x41,0x89,0xc0,0xb9,0x34,
+	0x02,0x00,0x00,0x31,0xc0,0xbf,0x01,0x00,
+	0x00,0x00,0x48,0x8d,0x15,0xf8,0x78,0x00,
+	0x00,0x48,0x8d,0x35,0x00,0x7d,0x00,0x00,
+	0xe8,0x8b,0x51,0x00,0x00,0xbd,0xff,0xff,
+	0xff,0xff,0xe9,0xb0,0x00,0x00,0x00,0x90,
+	0x8b,0x8b,0x20,0x01,0x00,0x00,0x44,0x8b,
+	0x83,0x24,0x01,0x00,0x00,0x31,0xc0,0x48,
+	0x8d,0x35,0x12,0x7d,0x00,0x00,0x8b,0x93,
+	0x1c,0x01,0x00,0x00,0xbf,0x03,0x00,0x00,
+	0x00,0xe8,0x5a,0x51,0x00,0x00,0x8b,0x93,
+	0x20,0x01,0x00,0x00,0x31,0xf6,0x31,0xff,
+	0xe8,0x9f,0x5f,0x00,0x00,0x8b,0x83,0x24,
+	0x01,0x00,0x00,0x8b,0xb3,0x1c,0x01,0x00,
+	0x00,0x31,0xff,0x48,0x8d,0x54,0x24,0x0c,
+	0x89,0x44,0x24,0x0c,0xe8,0x8f,0x5f,0x00,
+	0x00,0x48,0x8d,0x7b,0x10,0xe8,0xf6,0xfa,
+	0xff,0xff,0x89,0xc5,0x85,0xc0,0x75,0x95,
+	0x48,0x8d,0xbb,0x30,0x01,0x00,0x00,0xe8,
+	0x94,0xfb,0xff,0xff,0x48,0x8b,0x93,0x60,
+	0x01,0x00,0x00,0x48,0x85,0xd2,0x74,0x58,
+	0x8b,0x8b,0x6c,0x01,0x00,0x00,0x48,0x8d,
+	0x35,0xcb,0x7c,0x00,0x00,0xbf,0x04,0x00,
+	0x00,0x00,0x31,0xc0,0xe8,0xef,0x50,0x00,
+	0x00,0x8b,0x8b,0x6c,0x01,0x00,0x00,0x8b,
+	0xb3,0x68,0x01,0x00,0x00,0x31,0xd2,0x48,
+	0x8b,0xbb,0x60,0x01,0x00,0x00,0xe8,0x99,
+	0x61,0x00,0x00,0x85,0xc0,0x75,0x3d,0x48,
+	0x83,0xc4,0x18,0x89,0xe8,0x5b,0x5d,0xc3,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0xe8,0xfb,0xfa,0xff,0xff,0xe9,0x05,0xff,
+	0xff,0xff,0x66,0x0f,0x1f,0x44,0x00,0x00,
+	0x31,0xc0,0x48,0x8d,0x35,0x1c,0x78,0x00,
+	0x00,0xbf,0x04,0x00,0x00,0x00,0xe8,0x9d,
+	0x50,0x00,0x00,0x48,0x83,0xc4,0x18,0x89,
+	0xe8,0x5b,0x5d,0xc3,0x48,0x83,0xec,0x08,
+	0xb9,0xc3,0x01,0x00,0x00,0x48,0x8d,0x15,
+	0xe5,0x77,0x00,0x00,0xbf,0x01,0x00,0x00,
+	0x00,0x50,0x8b,0x83,0x6c,0x01,0x00,0x00,
+	0x48,0x8d,0x35,0x71,0x7c,0x00,0x00,0x50,
+	0x31,0xc0,0x6a,0x00,0x44,0x8b,0x8b,0x68,
+	0x01,0x00,0x00,0x4c,0x8b,0x83,0x60,0x01,
+	0x00,0x00,0xe8,0x59,0x50,0x00,0x00,0x48,
+	0x83,0xc4,0x20,0xe9,0xc5,0xfe,0xff,0xff,
+	0x85,0xf6,0x0f,0x8e,0xe9,0x00,0x00,0x00,
+	0x41,0x57,0x48,0x63,0xf6,0x41,0x56,0x48,
+	0xc1,0xe6,0x07,0x4c,0x8d,0x35,0xc5,0x77,
+	0x00,0x00,0x41,0x55,0x41,0x89,0xd5,0x41,
+	0x54,0x44,0x0f,0xb6,0xe2,0x55,0x48,0x8d,
+	0x2c,0x37,0x53,0x48,0x89,0xfb,0x48,0x83,
+	0xec,0x18,0xeb,0x2a,0x0f,0x1f,0x40,0x00,
+	0x44,0x8b,0x3b,0xe8,0x9c,0x5c,0x00,0x00,
+	0x48,0x89,0xda,0x44,0x89,0xfe,0x89,0xc7,
+	0xe8,0x33,0x5e,0x00,0x00,0x85,0xc0,0x75,
+	0x4e,0x48,0x83,0xeb,0x80,0x48,0x39,0xeb,
+	0x0f,0x84,0x82,0x00,0x00,0x00,0x8b,0x13,
+	0x31,0xc0,0x44,0x89,0xe1,0x4c,0x89,0xf6,
+	0xbf,0x03,0x00,0x00,0x00,0xe8,0xde,0x4f,
+	0x00,0x00,0x45,0x84,0xed,0x75,0xc1,0x8b,
+	0x13,0x89,0x54,0x24,0x0c,0xe8,0x76,0x5e,
+	0x00,0x00,0x49,0x89,0xc7,0xe8,0x52,0x5c,
+	0x00,0x00,0x8b,0x54,0x24,0x0c,0x48,0x89,
+	0xd9,0x44,0x89,0xfe,0x89,0xc7,0xe8,0xa1,
+	0x5f,0x00,0x00,0x85,0xc0,0x74,0xb2,0x48,
+	0x83,0xec,0x08,0x44,0x8b,0x4b,0x08,0x48,
+	0x8d,0x15,0x03,0x77,0x00,0x00,0xb9,0xad,
+	0x01,0x00,0x00,0x50,0x44,0x8b,0x03,0x31,
+	0xc0,0x48,0x8d,0x35,0xc8,0x7b,0x00,0x00,
+	0xbf,0x01,0x00,0x00,0x00,0xe8,0x86,0x4f,
+	0x00,0x00,0x58,0x5a,0xb8,0xff,0xff,0xff,
+	0xff,0x48,0x83,0xc4,0x18,0x5b,0x5d,0x41,
+	0x5c,0x41,0x5d,0x41,0x5e,0x41,0x5f,0xc3,
+	0x48,0x83,0xc4,0x18,0x31,0xc0,0x5b,0x5d,
+	0x41,0x5c,0x41,0x5d,0x41,0x5e,0x41,0x5f,
+	0xc3,0x31,0xc0,0xc3,0x66,0x66,0x2e,0x0f,
+	0x1f,0x84,0x00,0x00,0x00,0x00,0x00,0x90,
+	0x41,0x57,0x49,0x89,0xff,0x41,0x56,0x41,
+	0x55,0x41,0x54,0x55,0x53,0x48,0x83,0xec,
+	0x18,0xe8,0xe2,0x5d,0x00,0x00,0x45,0x8b,
+	0x87,0x88,0x01,0x00,0x00,0x48,0x89,0x44,
+	0x24,0x08,0x41,0x89,0xc4,0x41,0x83,0xf8,
+	0x01,0x74,0x55,0x41,0x83,0xf8,0x02,0x0f,
+	0x84,0xbb,0x00,0x00,0x00,0x45,0x85,0xc0,
+	0x0f,0x84,0x92,0x00,0x00,0x00,0x44,0x8b,
+	0x4c,0x24,0x08,0xb9,0x11,0x02,0x00,0x00,
+	0x31,0xc0,0x48,0x8d,0x15,0x60,0x76,0x00,
+	0x00,0x48,0x8d,0x35,0xd0,0x7c,0x00,0x00,
+	0xbf,0x01,0x00,0x00,0x00,0xe8,0xee,0x4e,
+	0x00,0x00,0xbb,0xff,0xff,0xff,0xff,0x48,
+	0x83,0xc4,0x18,0x89,0xd8,0x5b,0x5d,0x41,
+	0x5c,0x41,0x5d,0x41,0x5e,0x41,0x5f,0xc3,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0x31,0xff,0xe8,0xa9,0x48,0x00,0x00,0x45,
+	0x31,0xc0,0x31,0xc9,0x31,0xd2,0xbe,0x01,
+	0x00,0x00,0x00,0xbf,0x16,0x00,0x00,0x00,
+	0xe8,0x1f,0x5d,0x00,0x00,0x89,0xc3,0x85,
+	0xc0,0x0f,0x88,0x29,0x01,0x00,0x00,0x75,
+	0xbe,0x45,0x8b,0x87,0x88,0x01,0x00,0x00,
+	0x44,0x89,0xe1,0x44,0x89,0xc2,0x48,0x8d,
+	0x35,0xab,0x7c,0x00,0x00,0x31,0xc0,0xbf,
+	0x04,0x00,0x00,0x00,0x31,0xdb,0xe8,0x85,
+	0x4e,0x00,0x00,0xeb,0x9a,0x0f,0x1f,0x00,
+	0x89,0xc1,0x31,0xd2,0x48,0x8d,0x35,0x20,
+	0x76,0x00,0x00,0xbf,0x04,0x00,0x00,0x00,
+	0x31,0xc0,0x31,0xdb,0xe8,0x67,0x4e,0x00,
+	0x00,0xe9,0x79,0xff,0xff,0xff,0x66,0x90,
+	0x41,0x8b,0x87,0xa8,0x01,0x00,0x00,0x41,
+	0x0f,0xb6,0xaf,0xac,0x01,0x00,0x00,0x85,
+	0xc0,0x74,0xad,0x45,0x31,0xed,0x4c,0x8d,
+	0x35,0x03,0x7b,0x00,0x00,0xeb,0x11,0x90,
+	0x41,0x8b,0x87,0xa8,0x01,0x00,0x00,0x49,
+	0x83,0xc5,0x01,0x49,0x39,0xc5,0x73,0x89,
+	0x49,0x8b,0x97,0x98,0x01,0x00,0x00,0x4c,
+	0x89,0xf6,0x45,0x89,0xe9,0x45,0x89,0xe0,
+	0x4b,0x8d,0x44,0x6d,0x00,0xbf,0x04,0x00,
+	0x00,0x00,0x48,0x8d,0x1c,0xc2,0xba,0x01,
+	0x00,0x00,0x00,0x31,0xc0,0x8b,0x4b,0x10,
+	0x09,0xe9,0xe8,0x01,0x4e,0x00,0x00,0x8b,
+	0x73,0x10,0x48,0x89,0xda,0xbf,0x01,0x00,
+	0x00,0x00,0x09,0xee,0xe8,0x93,0x5d,0x00,
+	0x00,0x85,0xc0,0x79,0xab,0x83,0xf8,0xda,
+	0x0f,0x85,0x92,0x00,0x00,0x00,0x48,0x8d,
+	0x35,0xdb,0x7a,0x00,0x00,0xbf,0x04,0x00,
+	0x00,0x00,0x31,0xc0,0xe8,0xcf,0x4d,0x00,
+	0x00,0x45,0x31,0xc0,0x31,0xc9,0x48,0x89,
+	0xda,0xbe,0x02,0x00,0x00,0x00,0xbf,0x16,
+	0x00,0x00,0x00,0xe8,0x24,0x5c,0x00,0x00,
+	0x85,0xc0,0x0f,0x84,0x70,0xff,0xff,0xff,
+	0x44,0x8b,0x4c,0x24,0x08,0x41,0x89,0xc0,
+	0x31,0xc0,0xb9,0xdf,0x01,0x00,0x00,0x48,
+	0x8d,0x15,0xfb,0x74,0x00,0x00,0x48,0x8d,
+	0x35,0xe3,0x7a,0x00,0x00,0xbf,0x01,0x00,
+	0x00,0x00,0xe8,0x89,0x4d,0x00,0x00,0xe9,
+	0x96,0xfe,0xff,0xff,0x0f,0x1f,0x40,0x00,
+	0x44,0x8b,0x4c,0x24,0x08,0x41,0x89,0xc0,
+	0x31,0xc0,0xb9,0x0a,0x02,0x00,0x00,0x48,
+	0x8d,0x15,0xcb,0x74,0x00,0x00,0x48,0x8d,
+	0x35,0xdb,0x79,0x00,0x00,0xbf,0x01,0x00,
+	0x00,0x00,0xe8,0x59,0x4d,0x00,0x00,0xe9,
+	0x6b,0xfe,0xff,0xff,0x0f,0x1f,0x40,0x00,
+	0x44,0x8b,0x4c,0x24,0x08,0x41,0x89,0xc0,
+	0x31,0xc0,0xb9,0xe3,0x01,0x00,0x00,0x48,
+	0x8d,0x15,0x9b,0x74,0x00,0x00,0x48,0x8d,
+	0x35,0xc3,0x7a,0x00,0x00,0xbf,0x01,0x00,
+	0x00,0x00,0xe8,0x29,0x4d,0x00,0x00,0xe9,
+	0x36,0xfe,0xff,0xff,0x0f,0x1f,0x40,0x00,
+	0x48,0x85,0xff,0x0f,0x84,0xb7,0x00,0x00,
+	0x00,0x41,0x55,0x48,0x89,0xf9,0x31,0xc0,
+	0x41,0x54,0x41,0x89,0xd4,0x48,0x89,0xf2,
+	0x55,0x48,0x89,0xf5,0x48,0x8d,0x35,0x3d,
+	0x7b,0x00,0x00,0x53,0x48,0x89,0xfb,0xbf,
+	0x03,0x00,0x00,0x00,0x48,0x81,0xec,0x08,
+	0x01,0x00,0x00,0xe8,0xe8,0x4c,0x00,0x00,
+	0x49,0x89,0xe5,0xe8,0x88,0x5b,0x00,0x00,
+	0x48,0x89,0xe9,0x48,0x8d,0x35,0x9d,0x74,
+	0x00,0x00,0x4c,0x89,0xef,0x48,0x89,0xc2,
+	0x31,0xc0,0xe8,0x59,0x50,0x00,0x00,0x31,
+	0xc9,0xba,0x01,0x00,0x00,0x00,0x4c,0x89,
+	0xee,0x44,0x89,0xe7,0xe8,0x1f,0x5c,0x00,
+	0x00,0x89,0xc5,0x85,0xc0,0x78,0x7d,0x31,
+	0xd2,0x80,0x3b,0x00,0xb8,0x01,0x00,0x00,
+	0x00,0x74,0x13,0x0f,0x1f,0x44,0x00,0x00,
+	0x48,0x89,0xc2,0x48,0x83,0xc0,0x01,0x80,
+	0x7c,0x03,0xff,0x00,0x75,0xf2,0x48,0x89,
+	0xde,0x89,0xef,0xe8,0x48,0x58,0x00,0x00,
+	0x89,0xef,0x48,0x89,0xc3,0xe8,0x4e,0x58,
+	0x00,0x00,0x85,0xdb,0x78,0x1d,0x31,0xc0,
+	0x48,0x81,0xc4,0x08,0x01,0x00,0x00,0x5b,
+	0x5d,0x41,0x5c,0x41,0x5d,0xc3,0x66,0x2e,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0x31,0xc0,0xc3,0x41,0x89,0xd8,0xb9,0xb9,
+	0x00,0x00,0x00,0xbf,0x01,0x00,0x00,0x00,
+	0x31,0xc0,0x48,0x8d,0x15,0xa8,0x73,0x00,
+	0x00,0x48,0x8d,0x35,0xc8,0x7a,0x00,0x00,
+	0xe8,0x3b,0x4c,0x00,0x00,0xb8,0xff,0xff,
+	0xff,0xff,0xeb,0xbc,0x41,0x89,0xc0,0xb9,
+	0xaf,0x00,0x00,0x00,0x31,0xc0,0xbf,0x01,
+	0x00,0x00,0x00,0x48,0x8d,0x15,0x7f,0x73,
+	0x00,0x00,0x48,0x8d,0x35,0x77,0x7a,0x00,
+	0x00,0xe8,0x12,0x4c,0x00,0x00,0xeb,0xd5,
+	0x41,0x57,0x41,0x56,0x41,0x55,0x41,0x54,
+	0x55,0x48,0x89,0xfd,0x53,0x89,0xcb,0x48,
+	0x83,0xec,0x48,0x89,0x74,0x24,0x08,0x48,
+	0x8b,0xb7,0xe8,0x00,0x00,0x00,0x89,0x54,
+	0x24,0x0c,0x48,0x85,0xf6,0x74,0x13,0x8b,
+	0xbf,0x80,0x00,0x00,0x00,0xe8,0x8a,0x59,
+	0x00,0x00,0x85,0xc0,0x0f,0x85,0x02,0x03,
+	0x00,0x00,0x85,0xdb,0x0f,0x84,0xae,0x01,
+	0x00,0x00,0x8b,0x55,0x28,0x8b,0x75,0x20,
+	0x8b,0x7d,0x18,0xe8,0x78,0x59,0x00,0x00,
+	0x85,0xc0,0x0f,0x85,0xbd,0x02,0x00,0x00,
+	0x8b,0x7d,0x30,0xe8,0xa4,0x59,0x00,0x00,
+	0xbf,0xff,0xff,0xff,0xff,0xe8,0x9a,0x59,
+	0x00,0x00,0x48,0x89,0xc2,0x8b,0x45,0x30,
+	0x48,0x39,0xc2,0x0f,0x85,0x36,0x02,0x00,
+	0x00,0x8b,0x55,0x2c,0x8b,0x75,0x24,0x8b,
+	0x7d,0x1c,0xe8,0x59,0x59,0x00,0x00,0x85,
+	0xc0,0x0f,0x85,0x62,0x02,0x00,0x00,0x8b,
+	0x7d,0x34,0xe8,0x79,0x59,0x00,0x00,0xbf,
+	0xff,0xff,0xff,0xff,0xe8,0x6f,0x59,0x00,
+	0x00,0x48,0x89,0xc2,0x8b,0x45,0x34,0x48,
+	0x39,0xc2,0x0f,0x85,0x20,0x02,0x00,0x00,
+	0x85,0xdb,0x0f,0x84,0x80,0x01,0x00,0x00,
+	0x4c,0x8d,0xad,0xd4,0x00,0x00,0x00,0x45,
+	0x31,0xf6,0x41,0xbc,0x01,0x00,0x00,0x00,
+	0x31,0xdb,0xeb,0x38,0x0f,0x1f,0x40,0x00,
+	0x44,0x89,0xe0,0x89,0xd9,0xd3,0xe0,0x41,
+	0x23,0x45,0x00,0x75,0x1d,0x45,0x31,0xc0,
+	0x31,0xc9,0x31,0xd2,0xbf,0x18,0x00,0x00,
+	0x00,0x4a,0x8d,0x34,0x33,0xe8,0x8a,0x59,
+	0x00,0x00,0x85,0xc0,0x0f,0x85,0x86,0x01,
+	0x00,0x00,0x48,0x83,0xc3,0x01,0x48,0x83,
+	0xfb,0x20,0x74,0x0d,0x46,0x8d,0x3c,0x33,
+	0x44,0x39,0xbd,0xb8,0x00,0x00,0x00,0x73,
+	0xbf,0x49,0x83,0xc5,0x04,0x49,0x83,0xfe,
+	0x20,0x74,0x0d,0x41,0xbe,0x20,0x00,0x00,
+	0x00,0xeb,0xa5,0x0f,0x1f,0x44,0x00,0x00,
+	0x66,0x0f,0x6e,0x8d,0xbc,0x00,0x00,0x00,
+	0x66,0x0f,0x6e,0x95,0xd0,0x00,0x00,0x00,
+	0x48,0x8d,0x74,0x24,0x20,0x48,0x8d,0x7c,
+	0x24,0x18,0x66,0x0f,0x6e,0x85,0xcc,0x00,
+	0x00,0x00,0x66,0x0f,0x6e,0x9d,0xc4,0x00,
+	0x00,0x00,0x48,0xc7,0x44,0x24,0x18,0x22,
+	0x05,0x08,0x20,0x66,0x0f,0x62,0xca,0x66,
+	0x0f,0x62,0xc3,0x66,0x0f,0x6c,0xc1,0xf3,
+	0x0f,0x7e,0x8d,0xbc,0x00,0x00,0x00,0x0f,
+	0x29,0x44,0x24,0x20,0xf3,0x0f,0x7e,0x85,
+	0xc4,0x00,0x00,0x00,0x66,0x0f,0x62,0xc1,
+	0x66,0x0f,0x70,0xc0,0x4e,0x66,0x0f,0xd6,
+	0x44,0x24,0x30,0xe8,0xa4,0x58,0x00,0x00,
+	0x85,0xc0,0x0f,0x85,0xcb,0x01,0x00,0x00,
+	0x83,0x7c,0x24,0x0c,0x01,0x74,0x1f,0x48,
+	0x8b,0xbd,0xe0,0x00,0x00,0x00,0x8b,0x54,
+	0x24,0x08,0x48,0x8d,0x35,0x47,0x72,0x00,
+	0x00,0xe8,0x3a,0xfd,0xff,0xff,0x85,0xc0,
+	0x0f,0x88,0xe7,0x00,0x00,0x00,0x48,0x8b,
+	0xbd,0xf0,0x00,0x00,0x00,0x8b,0x54,0x24,
+	0x08,0x48,0x8d,0x35,0x1d,0x72,0x00,0x00,
+	0xe8,0x1b,0xfd,0xff,0xff,0xc1,0xf8,0x1f,
+	0x48,0x83,0xc4,0x48,0x5b,0x5d,0x41,0x5c,
+	0x41,0x5d,0x41,0x5e,0x41,0x5f,0xc3,0x66,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x31,0xc0,0x31,0xc9,0x31,0xd2,0xbe,
+	0x04,0x00,0x00,0x00,0xbf,0x1c,0x00,0x00,
+	0x00,0xe8,0x76,0x58,0x00,0x00,0x85,0xc0,
+	0x0f,0x84,0x34,0xfe,0xff,0xff,0x41,0x89,
+	0xc0,0xb9,0xde,0x00,0x00,0x00,0x31,0xc0,
+	0xbf,0x01,0x00,0x00,0x00,0x48,0x8d,0x15,
+	0x4d,0x71,0x00,0x00,0x48,0x8d,0x35,0xd5,
+	0x78,0x00,0x00,0xe8,0xe0,0x49,0x00,0x00,
+	0xeb,0x73,0x66,0x0f,0x1f,0x44,0x00,0x00,
+	0x8b,0x75,0x78,0x45,0x31,0xc0,0x31,0xc9,
+	0x31,0xd2,0xbf,0x1c,0x00,0x00,0x00,0xe8,
+	0x30,0x58,0x00,0x00,0x85,0xc0,0x0f,0x84,
+	0x64,0xfe,0xff,0xff,0x41,0x89,0xc0,0xb9,
+	0x09,0x01,0x00,0x00,0x31,0xc0,0xbf,0x01,
+	0x00,0x00,0x00,0x48,0x8d,0x15,0x07,0x71,
+	0x00,0x00,0x48,0x8d,0x35,0xaf,0x79,0x00,
+	0x00,0xe8,0x9a,0x49,0x00,0x00,0xeb,0x2d,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0x41,0x89,0xc1,0x45,0x89,0xf8,0xb9,0x1c,
+	0x01,0x00,0x00,0xbf,0x01,0x00,0x00,0x00,
+	0x48,0x8d,0x15,0xda,0x70,0x00,0x00,0x48,
+	0x8d,0x35,0xba,0x79,0x00,0x00,0x31,0xc0,
+	0xe8,0x6b,0x49,0x00,0x00,0xb8,0xff,0xff,
+	0xff,0xff,0xe9,0x29,0xff,0xff,0xff,0xb9,
+	0xf1,0x00,0x00,0x00,0x48,0x8d,0x15,0xb6,
+	0x70,0x00,0x00,0x48,0x8d,0x35,0xc6,0x78,
+	0x00,0x00,0x31,0xc0,0xbf,0x01,0x00,0x00,
+	0x00,0xe8,0x42,0x49,0x00,0x00,0xeb,0xd5,
+	0xb9,0xfd,0x00,0x00,0x00,0x48,0x8d,0x15,
+	0x95,0x70,0x00,0x00,0x48,0x8d,0x35,0x15,
+	0x79,0x00,0x00,0x31,0xc0,0xbf,0x01,0x00,
+	0x00,0x00,0xe8,0x21,0x49,0x00,0x00,0xeb,
+	0xb4,0x41,0x89,0xc0,0xb9,0xf7,0x00,0x00,
+	0x00,0x31,0xc0,0xbf,0x01,0x00,0x00,0x00,
+	0x48,0x8d,0x15,0x6a,0x70,0x00,0x00,0x48,
+	0x8d,0x35,0xa2,0x78,0x00,0x00,0xe8,0xfd,
+	0x48,0x00,0x00,0xeb,0x90,0x41,0x89,0xc0,
+	0xb9,0xeb,0x00,0x00,0x00,0x31,0xc0,0xbf,
+	0x01,0x00,0x00,0x00,0x48,0x8d,0x15,0x46,
+	0x70,0x00,0x00,0x48,0x8d,0x35,0x0e,0x78,
+	0x00,0x00,0xe8,0xd9,0x48,0x00,0x00,0xe9,
+	0x69,0xff,0xff,0xff,0x41,0x89,0xc0,0xb9,
+	0xd1,0x00,0x00,0x00,0x31,0xc0,0xbf,0x01,
+	0x00,0x00,0x00,0x48,0x8d,0x15,0x1f,0x70,
+	0x00,0x00,0x48,0x8d,0x35,0x6f,0x77,0x00,
+	0x00,0xe8,0xb2,0x48,0x00,0x00,0xe9,0x42,
+	0xff,0xff,0xff,0x41,0x89,0xc0,0xb9,0x34,
+	0x01,0x00,0x00,0x31,0xc0,0xbf,0x01,0x00,
+	0x00,0x00,0x48,0x8d,0x15,0xf8,0x6f,0x00,
+	0x00,0x48,0x8d,0x35,0x10,0x79,0x00,0x00,
+	0xe8,0x8b,0x48,0x00,0x00,0xe9,0x1b,0xff,
+	0xff,0xff,0x66,0x0f,0x1f,0x44,0x00,0x00,
+	0x55,0x48,0x89,0xfd,0x53,0x89,0xf3,0x48,
+	0x83,0xec,0x08,0x0f,0x1f,0x44,0x00,0x00,
+	0x8b,0x45,0x00,0x39,0xc3,0x75,0x31,0x45,
+	0x31,0xc9,0x45,0x31,0xc0,0x31,0xc9,0x31,
+	0xf6,0x89,0xda,0x48,0x89,0xef,0xe8,0x09,
+	0x57,0x00,0x00,0x85,0xc0,0x79,0xe1,0x83,
+	0xf8,0xf5,0x74,0xdc,0x48,0xc7,0x04,0x25,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x0f,0x0b,0x66,0x0f,0x1f,0x44,0x00,0x00,
+	0x48,0x83,0xc4,0x08,0x5b,0x5d,0xc3,0x90,
+	0x48,0x83,0xec,0x08,0xf0,0xff,0x0f,0x45,
+	0x31,0xc9,0x45,0x31,0xc0,0x31,0xc9,0xba,
+	0xff,0xff,0xff,0x7f,0xbe,0x01,0x00,0x00,
+	0x00,0xe8,0xc6,0x56,0x00,0x00,0x48,0x85,
+	0xc0,0x78,0x0d,0x48,0x83,0xc4,0x08,0xc3,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0x48,0xc7,0x04,0x25,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x0f,0x0b,0x66,0x90,
+	0x48,0x83,0xec,0x08,0xc7,0x07,0x00,0x00,
+	0x00,0x00,0x45,0x31,0xc9,0x45,0x31,0xc0,
+	0x31,0xc9,0xba,0x01,0x00,0x00,0x00,0xbe,
+	0x01,0x00,0x00,0x00,0xe8,0x83,0x56,0x00,
+	0x00,0x48,0x85,0xc0,0x78,0x0a,0x48,0x83,
+	0xc4,0x08,0xc3,0x0f,0x1f,0x44,0x00,0x00,
+	0x48,0xc7,0x04,0x25,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x0f,0x0b,0x66,0x90,
+	0x41,0x55,0x41,0x54,0x55,0x53,0x89,0xfb,
+	0x48,0x81,0xec,0x88,0x30,0x00,0x00,0x44,
+	0x8b,0x2d,0x3e,0x85,0x00,0x00,0x4c,0x8d,
+	0x64,0x24,0x10,0x48,0x8d,0x6c,0x24,0x08,
+	0xeb,0x1d,0x66,0x0f,0x1f,0x44,0x00,0x00,
+	0x74,0x6c,0x48,0x8d,0x74,0x24,0x20,0xba,
+	0x60,0x30,0x00,0x00,0x89,0xdf,0xe8,0x2d,
+	0x53,0x00,0x00,0x85,0xc0,0x78,0x71,0x66,
+	0x0f,0xef,0xc0,0x4c,0x89,0xe2,0x41,0xb8,
+	0x80,0x00,0x00,0x00,0x31,0xc9,0xbe,0x01,
+	0x00,0x00,0x00,0x48,0x89,0xef,0x89,0x5c,
+	0x24,0x08,0x44,0x89,0x6c,0x24,0x0c,0x0f,
+	0x29,0x44,0x24,0x10,0xe8,0x93,0x57,0x00,
+	0x00,0x89,0xc2,0x85,0xc0,0x79,0xb9,0x41,
+	0x89,0xc0,0xb9,0xac,0x05,0x00,0x00,0x31,
+	0xc0,0xbf,0x01,0x00,0x00,0x00,0x48,0x8d,
+	0x15,0x8c,0x6e,0x00,0x00,0x48,0x8d,0x35,
+	0xdc,0x77,0x00,0x00,0xe8,0x1f,0x47,0x00,
+	0x00,0xba,0xff,0xff,0xff,0xff,0x48,0x81,
+	0xc4,0x88,0x30,0x00,0x00,0x89,0xd0,0x5b,
+	0x5d,0x41,0x5c,0x41,0x5d,0xc3,0x66,0x2e,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0xb9,0xb4,0x05,0x00,0x00,0x48,0x8d,0x15,
+	0x55,0x6e,0x00,0x00,0x48,0x8d,0x35,0xdd,
+	0x77,0x00,0x00,0x31,0xc0,0xbf,0x01,0x00,
+	0x00,0x00,0xe8,0xe1,0x46,0x00,0x00,0xeb,
+	0xc0,0x66,0x66,0x2e,0x0f,0x1f,0x84,0x00,
+	0x00,0x00,0x00,0x00,0x0f,0x1f,0x40,0x00,
+	0x48,0x63,0x0d,0x79,0x67,0x00,0x00,0x8b,
+	0x56,0x10,0x85,0xc9,0x7e,0x22,0x48,0x8b,
+	0x05,0x73,0x67,0x00,0x00,0x48,0x8d,0x0c,
+	0x88,0xeb,0x0e,0x0f,0x1f,0x44,0x00,0x00,
+	0x48,0x83,0xc0,0x04,0x48,0x39,0xc8,0x74,
+	0x07,0x39,0x10,0x75,0xf3,0xc3,0x66,0x90,
+	0x48,0x63,0x0d,0x3d,0x67,0x00,0x00,0x85,
+	0xc9,0x7e,0x25,0x48,0x8b,0x05,0x36,0x67,
+	0x00,0x00,0x48,0x8d,0x0c,0x88,0xeb,0x11,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0x48,0x83,0xc0,0x04,0x48,0x39,0xc1,0x74,
+	0x07,0x39,0x10,0x75,0xf3,0xeb,0xce,0x90,
+	0x48,0x83,0xec,0x08,0x8b,0x46,0x08,0x48,
+	0x8d,0x0d,0x52,0x6e,0x00,0x00,0x83,0xf8,
+	0x01,0x74,0x33,0x48,0x8d,0x0d,0x93,0x6e,
+	0x00,0x00,0x83,0xf8,0x04,0x74,0x27,0x0f,
+	0x8f,0x99,0x00,0x00,0x00,0x48,0x8d,0x0d,
+	0x55,0x6e,0x00,0x00,0x83,0xf8,0x02,0x74,
+	0x15,0x83,0xf8,0x03,0x48,0x8d,0x0d,0x57,
+	0x6e,0x00,0x00,0x48,0x8d,0x05,0x2e,0x6e,
+	0x00,0x00,0x48,0x0f,0x45,0xc8,0x44,0x8b,
+	0x46,0x18,0xbf,0x03,0x00,0x00,0x00,0x31,
+	0xc0,0x48,0x8d,0x35,0x6f,0x6e,0x00,0x00,
+	0xe8,0x13,0x46,0x00,0x00,0x45,0x31,0xc9,
+	0x45,0x31,0xc0,0x31,0xc9,0x48,0x8b,0x3d,
+	0xcc,0x66,0x00,0x00,0xba,0xff,0xff,0xff,
+	0x7f,0xbe,0x01,0x00,0x00,0x00,0xc7,0x47,
+	0x0c,0xff,0xff,0xff,0xff,0x48,0x83,0xc7,
+	0x0c,0xe8,0x9e,0x54,0x00,0x00,0x48,0x85,
+	0xc0,0x78,0x25,0xe8,0x6c,0x52,0x00,0x00,
+	0xbe,0x13,0x00,0x00,0x00,0x48,0x89,0xc7,
+	0xe8,0x07,0x53,0x00,0x00,0xbf,0x01,0x00,
+	0x00,0x00,0x48,0x83,0xc4,0x08,0xe9,0x21,
+	0x55,0x00,0x00,0x0f,0x1f,0x44,0x00,0x00,
+	0x48,0xc7,0x04,0x25,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x0f,0x0b,0x83,0xf8,
+	0x05,0x48,0x8d,0x0d,0xf2,0x6d,0x00,0x00,
+	0x48,0x8d,0x05,0xa1,0x6d,0x00,0x00,0x48,
+	0x0f,0x45,0xc8,0xe9,0x6e,0xff,0xff,0xff,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0x39,0x3d,0x2a,0x66,0x00,0x00,0x0f,0x94,
+	0xc0,0xc3,0x66,0x0f,0x1f,0x44,0x00,0x00,
+	0x31,0xc0,0xc3,0x66,0x66,0x2e,0x0f,0x1f,
+	0x84,0x00,0x00,0x00,0x00,0x00,0x66,0x90,
+	0x31,0xc0,0xc3,0x66,0x66,0x2e,0x0f,0x1f,
+	0x84,0x00,0x00,0x00,0x00,0x00,0x66,0x90,
+	0xc3,0x66,0x66,0x2e,0x0f,0x1f,0x84,0x00,
+	0x00,0x00,0x00,0x00,0x0f,0x1f,0x40,0x00,
+	0x41,0x55,0x41,0x54,0x55,0x53,0x48,0x89,
+	0xfb,0x48,0x83,0xec,0x18,0xe8,0xe6,0x53,
+	0x00,0x00,0x44,0x8b,0x4b,0x08,0x41,0x39,
+	0xc1,0x0f,0x84,0x99,0x00,0x00,0x00,0x48,
+	0x8d,0x2d,0x8b,0x6c,0x00,0x00,0x41,0x89,
+	0xc0,0x31,0xc0,0xb9,0xc0,0x02,0x00,0x00,
+	0x48,0x89,0xea,0x48,0x8d,0x35,0x36,0x76,
+	0x00,0x00,0xbf,0x01,0x00,0x00,0x00,0xe8,
+	0x0c,0x45,0x00,0x00,0xe8,0x93,0x51,0x00,
+	0x00,0xb9,0x01,0x03,0x00,0x00,0x48,0x89,
+	0xea,0x48,0x8d,0x35,0x10,0x77,0x00,0x00,
+	0x49,0x89,0xc0,0xbf,0x01,0x00,0x00,0x00,
+	0x31,0xc0,0xe8,0xe9,0x44,0x00,0x00,0x45,
+	0x31,0xc9,0x45,0x31,0xc0,0x31,0xc9,0x48,
+	0x8b,0x3d,0xa2,0x65,0x00,0x00,0xba,0xff,
+	0xff,0xff,0x7f,0xbe,0x01,0x00,0x00,0x00,
+	0xc7,0x47,0x0c,0xff,0xff,0xff,0xff,0x48,
+	0x83,0xc7,0x0c,0xe8,0x74,0x53,0x00,0x00,
+	0x48,0x85,0xc0,0x0f,0x88,0x07,0x01,0x00,
+	0x00,0xbf,0x01,0x00,0x00,0x00,0xe8,0x09,
+	0x54,0x00,0x00,0x48,0x83,0xc4,0x18,0x48,
+	0xc7,0xc0,0xff,0xff,0xff,0xff,0x5b,0x5d,
+	0x41,0x5c,0x41,0x5d,0xc3,0x0f,0x1f,0x00,
+	0x31,0xd2,0x48,0x8d,0x74,0x24,0x08,0xb9,
+	0x08,0x00,0x00,0x00,0xbf,0x02,0x00,0x00,
+	0x00,0x48,0xc7,0x44,0x24,0x08,0xff,0xff,
+	0xff,0xff,0xe8,0x81,0x50,0x00,0x00,0x85,
+	0xc0,0x0f,0x85,0x01,0x01,0x00,0x00,0x83,
+	0xbb,0xc0,0x01,0x00,0x00,0xff,0x4c,0x8b,
+	0x23,0x0f,0x85,0xc1,0x00,0x00,0x00,0x48,
+	0x89,0xdf,0xe8,0x69,0xf2,0xff,0xff,0x85,
+	0xc0,0x0f,0x85,0x6e,0x01,0x00,0x00,0x45,
+	0x31,0xc0,0x31,0xc9,0x31,0xd2,0xbf,0x0f,
+	0x00,0x00,0x00,0x48,0x8d,0xb3,0xad,0x01,
+	0x00,0x00,0xe8,0xa5,0x52,0x00,0x00,0x85,
+	0xc0,0x0f,0x85,0x01,0x02,0x00,0x00,0xe8,
+	0xd4,0x52,0x00,0x00,0x48,0x8d,0x35,0x8b,
+	0x6c,0x00,0x00,0xbf,0x03,0x00,0x00,0x00,
+	0x48,0x89,0xc2,0x31,0xc0,0xe8,0x16,0x44,
+	0x00,0x00,0x48,0x8b,0x05,0xd7,0x64,0x00,
+	0x00,0x48,0x8d,0x78,0x0c,0xf0,0xff,0x0f,
+	0x45,0x31,0xc9,0x45,0x31,0xc0,0x31,0xc9,
+	0xba,0xff,0xff,0xff,0x7f,0xbe,0x01,0x00,
+	0x00,0x00,0xe8,0xa5,0x52,0x00,0x00,0x48,
+	0x8b,0x2d,0xb2,0x64,0x00,0x00,0x4c,0x8d,
+	0x6d,0x10,0x48,0x85,0xc0,0x78,0x31,0x90,
+	0x8b,0x45,0x10,0x83,0xf8,0x03,0x0f,0x85,
+	0x04,0x01,0x00,0x00,0x45,0x31,0xc9,0x45,
+	0x31,0xc0,0x31,0xc9,0x31,0xf6,0xba,0x03,
+	0x00,0x00,0x00,0x4c,0x89,0xef,0xe8,0x71,
+	0x52,0x00,0x00,0x85,0xc0,0x79,0xd9,0x83,
+	0xf8,0xf5,0x74,0xd4,0x0f,0x1f,0x40,0x00,
+	0x48,0xc7,0x04,0x25,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x0f,0x0b,0x66,0x90,
+	0x48,0x8d,0x2d,0xfa,0x6a,0x00,0x00,0xb9,
+	0xd0,0x02,0x00,0x00,0x48,0x8d,0x35,0x0d,
+	0x75,0x00,0x00,0x31,0xc0,0x48,0x89,0xea,
+	0xbf,0x01,0x00,0x00,0x00,0xe8,0x7e,0x43,
+	0x00,0x00,0xe9,0x6d,0xfe,0xff,0xff,0x66,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0x48,0x8d,0x2d,0xca,0x6a,0x00,0x00,0x41,
+	0x89,0xc0,0x31,0xc0,0xb9,0xc8,0x02,0x00,
+	0x00,0x48,0x89,0xea,0x48,0x8d,0x35,0xa5,
+	0x74,0x00,0x00,0xbf,0x01,0x00,0x00,0x00,
+	0xe8,0x4b,0x43,0x00,0x00,0xe9,0x3a,0xfe,
+	0xff,0xff,0x66,0x0f,0x1f,0x44,0x00,0x00,
+	0x48,0x8b,0x05,0x01,0x64,0x00,0x00,0x8b,
+	0x40,0x10,0xf0,0xff,0x0d,0xef,0x63,0x00,
+	0x00,0x45,0x31,0xc9,0x45,0x31,0xc0,0x31,
+	0xc9,0xba,0xff,0xff,0xff,0x7f,0xbe,0x01,
+	0x00,0x00,0x00,0x48,0x8d,0x3d,0xd6,0x63,
+	0x00,0x00,0xe8,0xc5,0x51,0x00,0x00,0x48,
+	0x85,0xc0,0x0f,0x88,0x58,0xff,0xff,0xff,
+	0x41,0x80,0xbc,0x24,0xc0,0xb7,0x00,0x00,
+	0x01,0x49,0x8d,0xb4,0x24,0x80,0x80,0x00,
+	0x00,0x48,0x19,0xc0,0x48,0x83,0xe0,0xfc,
+	0x49,0x8d,0xbc,0x04,0x88,0x80,0x00,0x00,
+	0xe8,0xa3,0xef,0xff,0xff,0x48,0x8d,0x2d,
+	0x3d,0x6a,0x00,0x00,0xe9,0xcb,0xfd,0xff,
+	0xff,0x0f,0x1f,0x80,0x00,0x00,0x00,0x00,
+	0x48,0x8b,0x05,0x91,0x63,0x00,0x00,0x8b,
+	0xb3,0x78,0x01,0x00,0x00,0x31,0xd2,0x48,
+	0x8d,0x2d,0x1b,0x6a,0x00,0x00,0x48,0x8b,
+	0xbb,0x70,0x01,0x00,0x00,0x8b,0x40,0x10,
+	0xe8,0x5b,0xf2,0xff,0xff,0x85,0xc0,0x0f,
+	0x85,0x97,0xfd,0xff,0xff,0x48,0x8b,0x05,
+	0x64,0x63,0x00,0x00,0x48,0x8d,0x78,0x0c,
+	0xf0,0xff,0x0f,0x45,0x31,0xc9,0x45,0x31,
+	0xc0,0x31,0xc9,0xba,0xff,0xff,0xff,0x7f,
+	0xbe,0x01,0x00,0x00,0x00,0xe8,0x32,0x51,
+	0x00,0x00,0x48,0x8b,0x2d,0x3f,0x63,0x00,
+	0x00,0x4c,0x8d,0x6d,0x10,0x48,0x85,0xc0,
+	0x0f,0x88,0xba,0xfe,0xff,0xff,0x66,0x2e,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0x8b,0x45,0x10,0x83,0xf8,0x04,0x75,0x58,
+	0x45,0x31,0xc9,0x45,0x31,0xc0,0x31,0xc9,
+	0x31,0xf6,0xba,0x04,0x00,0x00,0x00,0x4c,
+	0x89,0xef,0xe8,0xf5,0x50,0x00,0x00,0x85,
+	0xc0,0x79,0xdd,0x83,0xf8,0xf5,0x74,0xd8,
+	0xe9,0x83,0xfe,0xff,0xff,0x0f,0x1f,0x00,
+	0x48,0x8d,0x2d,0x8a,0x69,0x00,0x00,0x41,
+	0x89,0xc0,0x31,0xc0,0xb9,0xdf,0x02,0x00,
+	0x00,0x48,0x89,0xea,0x48,0x8d,0x35,0xc5,
+	0x73,0x00,0x00,0xbf,0x01,0x00,0x00,0x00,
+	0xe8,0x0b,0x42,0x00,0x00,0xe9,0xfa,0xfc,
+	0xff,0xff,0x66,0x0f,0x1f,0x44,0x00,0x00,
+	0x48,0x8b,0x05,0xc1,0x62,0x00,0x00,0x48,
+	0x89,0xdf,0x8b,0x40,0x10,0xe8,0x9e,0xf2,
+	0xff,0xff,0x85,0xc0,0x0f,0x85,0x39,0x01,
+	0x00,0x00,0x48,0x8b,0x83,0x28,0x01,0x00,
+	0x00,0x48,0x8b,0xbb,0x80,0x01,0x00,0x00,
+	0x8b,0x88,0x48,0x05,0x00,0x00,0x8b,0x90,
+	0x2c,0x05,0x00,0x00,0x8b,0xb0,0xe4,0x03,
+	0x00,0x00,0xe8,0xb1,0xf5,0xff,0xff,0x85,
+	0xc0,0x0f,0x85,0x03,0x01,0x00,0x00,0x48,
+	0x8b,0x83,0x28,0x01,0x00,0x00,0x48,0x8d,
+	0xb8,0xb8,0x01,0x00,0x00,0xe8,0xa6,0xee,
+	0xff,0xff,0x85,0xc0,0x0f,0x85,0xe8,0x00,
+	0x00,0x00,0x8b,0x83,0x7c,0x01,0x00,0x00,
+	0x85,0xc0,0x74,0x18,0x45,0x31,0xc0,0x31,
+	0xc9,0x31,0xd2,0x48,0x63,0xf0,0xbf,0x01,
+	0x00,0x00,0x00,0xe8,0xec,0x4f,0x00,0x00,
+	0x85,0xc0,0x75,0x6d,0x48,0x8b,0x05,0x3d,
+	0x62,0x00,0x00,0x48,0x8d,0x78,0x0c,0xf0,
+	0xff,0x0f,0x45,0x31,0xc9,0x45,0x31,0xc0,
+	0x31,0xc9,0xba,0xff,0xff,0xff,0x7f,0xbe,
+	0x01,0x00,0x00,0x00,0xe8,0x0b,0x50,0x00,
+	0x00,0x48,0x8b,0x1d,0x18,0x62,0x00,0x00,
+	0x48,0x8d,0x6b,0x10,0x48,0x85,0xc0,0x0f,
+	0x88,0x93,0xfd,0xff,0xff,0x0f,0x1f,0x00,
+	0x8b,0x43,0x10,0x83,0xf8,0x05,0x0f,0x85,
+	0xf4,0xfd,0xff,0xff,0x45,0x31,0xc9,0x45,
+	0x31,0xc0,0x31,0xc9,0x31,0xf6,0xba,0x05,
+	0x00,0x00,0x00,0x48,0x89,0xef,0xe8,0xd1,
+	0x4f,0x00,0x00,0x85,0xc0,0x79,0xd9,0x83,
+	0xf8,0xf5,0x74,0xd4,0xe9,0x5f,0xfd,0xff,
+	0xff,0x48,0x8d,0x2d,0x69,0x68,0x00,0x00,
+	0x44,0x8b,0x83,0x7c,0x01,0x00,0x00,0x41,
+	0x89,0xc1,0xb9,0x59,0x01,0x00,0x00,0x48,
+	0x89,0xea,0x48,0x8d,0x35,0xcf,0x72,0x00,
+	0x00,0xbf,0x01,0x00,0x00,0x00,0x31,0xc0,
+	0xe8,0xe3,0x40,0x00,0x00,0x41,0xb9,0xf7,
+	0x02,0x00,0x00,0x4c,0x8d,0x05,0x37,0x68,
+	0x00,0x00,0xb9,0xf7,0x02,0x00,0x00,0x48,
+	0x89,0xea,0x48,0x8d,0x35,0x3c,0x69,0x00,
+	0x00,0xbf,0x01,0x00,0x00,0x00,0x31,0xc0,
+	0xe8,0xbb,0x40,0x00,0x00,0xe9,0x06,0xfd,
+	0xff,0xff,0x48,0x8d,0x2d,0x10,0x68,0x00,
+	0x00,0xeb,0xca,0x4c,0x8d,0x05,0x07,0x68,
+	0x00,0x00,0x41,0xb9,0xf1,0x02,0x00,0x00,
+	0xb9,0xf1,0x02,0x00,0x00,0x4c,0x89,0xc2,
+	0xeb,0xc8,0x66,0x0f,0x1f,0x44,0x00,0x00,
+	0xe9,0xdb,0x4c,0x00,0x00,0x66,0x66,0x2e,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0x48,0x8b,0x3d,0xe1,0x60,0x00,0x00,0x8b,
+	0x35,0xd3,0x60,0x00,0x00,0x48,0x2b,0x35,
+	0xdc,0x60,0x00,0x00,0xe9,0x57,0x4c,0x00,
+	0x00,0x0f,0x1f,0x80,0x00,0x00,0x00,0x00,
+	0x8b,0x87,0x08,0x01,0x00,0x00,0x85,0xc0,
+	0x74,0x73,0x41,0x55,0x4c,0x8d,0x2d,0x9d,
+	0x72,0x00,0x00,0x41,0x54,0x49,0x89,0xfc,
+	0x55,0x53,0x31,0xdb,0x48,0x83,0xec,0x08,
+	0xeb,0x14,0x66,0x0f,0x1f,0x44,0x00,0x00,
+	0x48,0x83,0xc3,0x01,0x41,0x3b,0x9c,0x24,
+	0x08,0x01,0x00,0x00,0x73,0x3a,0x49,0x8b,
+	0x84,0x24,0x00,0x01,0x00,0x00,0xbf,0x04,
+	0x00,0x00,0x00,0x4c,0x89,0xee,0x8b,0x2c,
+	0x98,0x31,0xc0,0x89,0xea,0xe8,0x0e,0x40,
+	0x00,0x00,0x89,0xef,0xe8,0x57,0xf8,0xff,
+	0xff,0x85,0xc0,0x74,0xcb,0x48,0x83,0xc4,
+	0x08,0xb8,0xff,0xff,0xff,0xff,0x5b,0x5d,
+	0x41,0x5c,0x41,0x5d,0xc3,0x0f,0x1f,0x00,
+	0x48,0x83,0xc4,0x08,0x31,0xc0,0x5b,0x5d,
+	0x41,0x5c,0x41,0x5d,0xc3,0x31,0xc0,0xc3,
+	0x41,0x57,0x41,0x56,0x41,0x55,0x41,0x54,
+	0x55,0x53,0x48,0x89,0xfb,0x48,0x81,0xec,
+	0x88,0x01,0x00,0x00,0xe8,0x53,0x4c,0x00,
+	0x00,0x48,0x8d,0x0d,0x80,0xec,0xff,0xff,
+	0x31,0xd2,0x48,0x8d,0xb4,0x24,0xa0,0x00,
+	0x00,0x00,0x49,0x89,0xc5,0x48,0x8b,0x83,
+	0x48,0x01,0x00,0x00,0xbf,0x11,0x00,0x00,
+	0x00,0x48,0x89,0x05,0x08,0x60,0x00,0x00,
+	0x48,0x8b,0x83,0x50,0x01,0x00,0x00,0x89,
+	0x05,0xf3,0x5f,0x00,0x00,0x48,0x8b,0x83,
+	0xf0,0x03,0x00,0x00,0x48,0x89,0x05,0xf5,
+	0x5f,0x00,0x00,0x8b,0x83,0x28,0x05,0x00,
+	0x00,0x89,0x05,0x19,0x60,0x00,0x00,0x48,
+	0x8b,0x43,0x48,0x48,0x89,0x05,0x36,0x60,
+	0x00,0x00,0x48,0x8b,0x83,0xe0,0x00,0x00,
+	0x00,0x48,0x89,0x05,0x18,0x60,0x00,0x00,
+	0x8b,0x83,0xe8,0x00,0x00,0x00,0x89,0x05,
+	0x04,0x60,0x00,0x00,0x48,0x8b,0x83,0xf0,
+	0x00,0x00,0x00,0x48,0x89,0x05,0xee,0x5f,
+	0x00,0x00,0x8b,0x83,0xf8,0x00,0x00,0x00,
+	0x89,0x05,0xde,0x5f,0x00,0x00,0x48,0x8b,
+	0x83,0x20,0x05,0x00,0x00,0x48,0x89,0x08,
+	0x48,0x8d,0x05,0x59,0xf8,0xff,0xff,0xb9,
+	0x08,0x00,0x00,0x00,0x48,0x89,0x84,0x24,
+	0xa0,0x00,0x00,0x00,0x48,0x8d,0x05,0xc1,
+	0x4a,0x00,0x00,0x48,0xc7,0x84,0x24,0xb8,
+	0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x48,
+	0xc7,0x84,0x24,0xa8,0x00,0x00,0x00,0x04,
+	0x00,0x00,0x14,0x48,0x89,0x84,0x24,0xb0,
+	0x00,0x00,0x00,0xe8,0xf0,0x4a,0x00,0x00,
+	0x48,0x85,0xc0,0x0f,0x85,0x77,0x05,0x00,
+	0x00,0x48,0x8d,0x44,0x24,0x78,0x31,0xd2,
+	0xb9,0x08,0x00,0x00,0x00,0xbf,0x01,0x00,
+	0x00,0x00,0x48,0x89,0xc6,0x48,0x89,0x44,
+	0x24,0x08,0x48,0xc7,0x44,0x24,0x78,0x00,
+	0x00,0x01,0x00,0xe8,0xc8,0x4a,0x00,0x00,
+	0x48,0x85,0xc0,0x0f,0x85,0xff,0x01,0x00,
+	0x00,0x8b,0x7b,0x0c,0x44,0x89,0x6c,0x24,
+	0x14,0xe8,0x4a,0x38,0x00,0x00,0x8b,0x7b,
+	0x10,0xe8,0x62,0x38,0x00,0x00,0x48,0x8d,
+	0x7b,0x18,0xe8,0x69,0x38,0x00,0x00,0x44,
+	0x89,0xea,0xbf,0x03,0x00,0x00,0x00,0x31,
+	0xc0,0x48,0x8d,0x35,0x1a,0x67,0x00,0x00,
+	0xe8,0x83,0x3e,0x00,0x00,0x48,0x8b,0x15,
+	0xe4,0x5e,0x00,0x00,0x31,0xc0,0x4c,0x8b,
+	0x05,0xe3,0x5e,0x00,0x00,0x8b,0x0d,0xcd,
+	0x5e,0x00,0x00,0x48,0x8d,0x35,0x3e,0x71,
+	0x00,0x00,0xbf,0x04,0x00,0x00,0x00,0xe8,
+	0x5c,0x3e,0x00,0x00,0x8b,0x53,0x28,0x85,
+	0xd2,0x78,0x13,0x48,0x8d,0x35,0xfd,0x66,
+	0x00,0x00,0xbf,0x04,0x00,0x00,0x00,0x31,
+	0xc0,0xe8,0x42,0x3e,0x00,0x00,0x80,0xbb,
+	0xed,0x03,0x00,0x00,0x00,0x75,0x7d,0x48,
+	0x83,0xbb,0xf8,0x03,0x00,0x00,0xff,0x74,
+	0x73,0x0f,0xb6,0x93,0xec,0x03,0x00,0x00,
+	0x84,0xd2,0x0f,0x85,0x68,0x05,0x00,0x00,
+	0x8b,0x4b,0x68,0x85,0xc9,0x74,0x3b,0x48,
+	0x8d,0x34,0x49,0x48,0x8b,0x43,0x60,0x48,
+	0x8d,0x0c,0xb1,0x48,0x8d,0x34,0xc8,0xb9,
+	0x01,0x00,0x00,0x00,0x0f,0x1f,0x40,0x00,
+	0xf6,0x40,0x41,0x10,0x0f,0x45,0xd1,0x48,
+	0x83,0xc0,0x68,0x48,0x39,0xc6,0x75,0xf0,
+	0x84,0xd2,0x74,0x0e,0x48,0x83,0xbb,0x00,
+	0x04,0x00,0x00,0xff,0x0f,0x84,0x4e,0x07,
+	0x00,0x00,0x48,0x8b,0xb3,0x18,0x05,0x00,
+	0x00,0x48,0x8b,0x15,0x40,0x5e,0x00,0x00,
+	0x48,0x8d,0xbb,0xf8,0x03,0x00,0x00,0xe8,
+	0xf4,0xdf,0xff,0xff,0x85,0xc0,0x0f,0x85,
+	0x26,0x01,0x00,0x00,0x48,0x8b,0xbb,0x38,
+	0x05,0x00,0x00,0x48,0x85,0xff,0x0f,0x85,
+	0x6c,0x04,0x00,0x00,0x4c,0x8b,0x8b,0x20,
+	0x01,0x00,0x00,0x4c,0x8b,0x83,0x18,0x01,
+	0x00,0x00,0x48,0x8b,0xab,0x10,0x01,0x00,
+	0x00,0x44,0x8b,0x25,0xf0,0x5d,0x00,0x00,
+	0x4c,0x89,0xc8,0x4c,0x8b,0x35,0xee,0x5d,
+	0x00,0x00,0x4c,0x09,0xc0,0x48,0x89,0x44,
+	0x24,0x28,0x0f,0x85,0x8d,0x0b,0x00,0x00,
+	0x31,0xff,0x4c,0x89,0xf6,0xe8,0x5e,0x49,
+	0x00,0x00,0x85,0xc0,0x0f,0x85,0x9f,0x0b,
+	0x00,0x00,0x4d,0x01,0xf4,0x48,0x89,0xee,
+	0x4c,0x29,0xe6,0x4c,0x89,0xe7,0xe8,0x45,
+	0x49,0x00,0x00,0x89,0x44,0x24,0x18,0x85,
+	0xc0,0x0f,0x85,0xb5,0x0b,0x00,0x00,0x48,
+	0x8d,0x84,0x24,0x90,0x00,0x00,0x00,0x31,
+	0xf6,0x48,0x89,0xc7,0x48,0x89,0x44,0x24,
+	0x20,0xe8,0xba,0x4a,0x00,0x00,0x80,0xbb,
+	0xed,0x03,0x00,0x00,0x00,0x0f,0x85,0x05,
+	0x04,0x00,0x00,0x48,0x8d,0xab,0xf8,0x03,
+	0x00,0x00,0x48,0x89,0xef,0xe8,0x16,0xde,
+	0xff,0xff,0x8b,0x4b,0x68,0x85,0xc9,0x0f,
+	0x84,0x8f,0x0a,0x00,0x00,0x48,0x8b,0x53,
+	0x60,0x48,0x8d,0x34,0x49,0x48,0x8d,0x0c,
+	0xb1,0x48,0x89,0xd0,0x48,0x8d,0x0c,0xca,
+	0xeb,0x13,0x66,0x0f,0x1f,0x44,0x00,0x00,
+	0x48,0x83,0xc0,0x68,0x48,0x39,0xc1,0x0f,
+	0x84,0x53,0x04,0x00,0x00,0xf6,0x40,0x43,
+	0x40,0x74,0xed,0xb9,0x47,0x06,0x00,0x00,
+	0x48,0x8d,0x15,0x32,0x64,0x00,0x00,0x48,
+	0x8d,0x35,0xe2,0x70,0x00,0x00,0x31,0xc0,
+	0xbf,0x01,0x00,0x00,0x00,0xe8,0xbe,0x3c,
+	0x00,0x00,0xeb,0x26,0x0f,0x1f,0x40,0x00,
+	0x49,0x89,0xc0,0xb9,0x0c,0x06,0x00,0x00,
+	0x31,0xc0,0xbf,0x01,0x00,0x00,0x00,0x48,
+	0x8d,0x15,0x03,0x64,0x00,0x00,0x48,0x8d,
+	0x35,0x43,0x6f,0x00,0x00,0xe8,0x96,0x3c,
+	0x00,0x00,0x48,0x8b,0x3d,0x57,0x5d,0x00,
+	0x00,0x45,0x31,0xc9,0x45,0x31,0xc0,0x31,
+	0xc9,0xba,0xff,0xff,0xff,0x7f,0xbe,0x01,
+	0x00,0x00,0x00,0xc7,0x47,0x0c,0xff,0xff,
+	0xff,0xff,0x48,0x83,0xc7,0x0c,0xe8,0x21,
+	0x4b,0x00,0x00,0x48,0x85,0xc0,0x0f,0x88,
+	0xe4,0x02,0x00,0x00,0xe8,0xeb,0x48,0x00,
+	0x00,0xb9,0x10,0x08,0x00,0x00,0xbf,0x01,
+	0x00,0x00,0x00,0x48,0x8d,0x15,0xaf,0x63,
+	0x00,0x00,0x49,0x89,0xc0,0x48,0x8d,0x35,
+	0x8c,0x79,0x00,0x00,0x31,0xc0,0xe8,0x3d,
+	0x3c,0x00,0x00,0xbf,0x01,0x00,0x00,0x00,
+	0xe8,0x8f,0x4b,0x00,0x00,0x48,0x81,0xc4,
+	0x88,0x01,0x00,0x00,0x48,0xc7,0xc0,0xff,
+	0xff,0xff,0xff,0x5b,0x5d,0x41,0x5c,0x41,
+	0x5d,0x41,0x5e,0x41,0x5f,0xc3,0x66,0x2e,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0x48,0x8b,0x74,0x24,0x50,0x4c,0x89,0xff,
+	0x4c,0x8b,0x6c,0x24,0x40,0xe8,0xee,0x47,
+	0x00,0x00,0x8b,0x7c,0x24,0x48,0xe8,0xc5,
+	0x47,0x00,0x00,0x49,0x8b,0x46,0x08,0x48,
+	0x8d,0x50,0xe0,0x48,0x8b,0x84,0x24,0x10,
+	0x01,0x00,0x00,0x49,0x8d,0x75,0x20,0x48,
+	0x8d,0x78,0x20,0xe8,0x64,0x47,0x00,0x00,
+	0x49,0x8b,0x76,0x08,0x4d,0x8b,0x06,0xb9,
+	0x03,0x00,0x00,0x00,0x48,0x8b,0xbc,0x24,
+	0x10,0x01,0x00,0x00,0x48,0x89,0xf2,0xe8,
+	0xe8,0x47,0x00,0x00,0x48,0x89,0x84,0x24,
+	0x10,0x01,0x00,0x00,0x49,0x3b,0x06,0x0f,
+	0x85,0x29,0x0a,0x00,0x00,0x48,0x8b,0x4c,
+	0x24,0x30,0x48,0x83,0x44,0x24,0x18,0x01,
+	0x48,0x8b,0x44,0x24,0x18,0x3b,0x81,0xc8,
+	0x00,0x00,0x00,0x0f,0x82,0x07,0x06,0x00,
+	0x00,0x48,0x89,0xcb,0x8b,0x7b,0x68,0x31,
+	0xed,0x85,0xff,0x74,0x30,0x48,0x8d,0x44,
+	0x6d,0x00,0x48,0x8d,0x54,0x85,0x00,0x48,
+	0x8b,0x43,0x60,0x4c,0x8d,0x2c,0xd0,0x41,
+	0x8b,0x4d,0x50,0x85,0xc9,0x74,0x0d,0x49,
+	0x8b,0x45,0x58,0x48,0x85,0xc0,0x0f,0x85,
+	0x71,0x08,0x00,0x00,0x48,0x83,0xc5,0x01,
+	0x3b,0x6b,0x68,0x72,0xd0,0x48,0x8b,0x7c,
+	0x24,0x20,0xe8,0x69,0x21,0x00,0x00,0x48,
+	0x89,0xc1,0x48,0x85,0xc0,0x0f,0x88,0xa7,
+	0xfe,0xff,0xff,0x8b,0x54,0x24,0x14,0x48,
+	0x8d,0x35,0x9a,0x71,0x00,0x00,0xbf,0x04,
+	0x00,0x00,0x00,0x31,0xc0,0xe8,0x26,0x3b,
+	0x00,0x00,0x48,0x8d,0xb3,0xd4,0x03,0x00,
+	0x00,0x31,0xc9,0x31,0xd2,0x45,0x31,0xc0,
+	0xbf,0x0f,0x00,0x00,0x00,0xe8,0x7a,0x49,
+	0x00,0x00,0x49,0x89,0xc1,0x48,0x85,0xc0,
+	0x0f,0x85,0xc0,0x0b,0x00,0x00,0x66,0x0f,
+	0x6e,0x73,0x08,0x66,0x0f,0x6f,0xbb,0xd0,
+	0x01,0x00,0x00,0x4c,0x8d,0xa3,0x70,0x02,
+	0x00,0x00,0x45,0x31,0xc0,0x48,0x8b,0x54,
+	0x24,0x38,0xb9,0x68,0x00,0x00,0x00,0xbe,
+	0x0e,0x00,0x00,0x00,0x66,0x0f,0x6e,0x8b,
+	0xd0,0x03,0x00,0x00,0x66,0x0f,0x6f,0x83,
+	0xf0,0x01,0x00,0x00,0x48,0x8b,0x83,0x20,
+	0x02,0x00,0x00,0x0f,0x29,0xbc,0x24,0x10,
+	0x01,0x00,0x00,0xbf,0x23,0x00,0x00,0x00,
+	0x66,0x0f,0x62,0xce,0x66,0x0f,0x6f,0xbb,
+	0x10,0x02,0x00,0x00,0x66,0x0f,0x6f,0xb3,
+	0xe0,0x01,0x00,0x00,0x4c,0x89,0xa4,0x24,
+	0x68,0x01,0x00,0x00,0x66,0x0f,0x6f,0xd0,
+	0x48,0x89,0x84,0x24,0x60,0x01,0x00,0x00,
+	0x66,0x0f,0xc6,0x93,0x00,0x02,0x00,0x00,
+	0x01,0x66,0x0f,0xc6,0x83,0x00,0x02,0x00,
+	0x00,0x02,0x0f,0x29,0xb4,0x24,0x20,0x01,
+	0x00,0x00,0x0f,0x29,0x94,0x24,0x30,0x01,
+	0x00,0x00,0x0f,0x29,0x84,0x24,0x40,0x01,
+	0x00,0x00,0x0f,0x29,0xbc,0x24,0x50,0x01,
+	0x00,0x00,0x66,0x0f,0xd6,0x8c,0x24,0x70,
+	0x01,0x00,0x00,0xe8,0xbc,0x48,0x00,0x00,
+	0x48,0x89,0xc5,0x48,0x85,0xc0,0x0f,0x85,
+	0x10,0x09,0x00,0x00,0x8b,0x7b,0x08,0xe8,
+	0x0c,0x46,0x00,0x00,0x83,0xbb,0x2c,0x05,
+	0x00,0x00,0x01,0x48,0x8b,0x3b,0x0f,0x84,
+	0x8e,0x0c,0x00,0x00,0x48,0x8b,0x07,0x48,
+	0x89,0x44,0x24,0x38,0xe8,0x2f,0xe8,0xff,
+	0xff,0x89,0x44,0x24,0x40,0x85,0xc0,0x0f,
+	0x85,0x7d,0xfd,0xff,0xff,0x48,0x8b,0x7c,
+	0x24,0x20,0x31,0xf6,0xe8,0x8f,0x47,0x00,
+	0x00,0x83,0x7b,0x30,0x01,0x0f,0x8e,0x05,
+	0x0b,0x00,0x00,0x80,0xbb,0x34,0x05,0x00,
+	0x00,0x00,0x4c,0x8b,0x63,0x40,0x0f,0x85,
+	0x7e,0x0c,0x00,0x00,0x8b,0xbb,0xe4,0x03,
+	0x00,0x00,0x31,0xc9,0xba,0x02,0x00,0x00,
+	0x00,0x48,0x8d,0x35,0x1b,0x64,0x00,0x00,
+	0xe8,0x3b,0x49,0x00,0x00,0x49,0x89,0xc0,
+	0x89,0xc5,0x85,0xc0,0x0f,0x88,0x65,0x1c,
+	0x00,0x00,0x48,0x8b,0x05,0x87,0x5a,0x00,
+	0x00,0x41,0xbe,0x01,0x00,0x00,0x00,0x4c,
+	0x8d,0x68,0x1c,0x44,0x89,0xf0,0xf0,0x41,
+	0x0f,0xc1,0x45,0x00,0x8d,0x50,0x01,0x85,
+	0xc0,0x0f,0x84,0x3b,0x0c,0x00,0x00,0x45,
+	0x31,0xc9,0x45,0x31,0xc0,0x31,0xc9,0x31,
+	0xf6,0x4c,0x89,0xef,0xe8,0x43,0x48,0x00,
+	0x00,0x85,0xc0,0x79,0xd6,0x83,0xf8,0xf5,
+	0x74,0xd1,0x66,0x0f,0x1f,0x44,0x00,0x00,
+	0x48,0xc7,0x04,0x25,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x0f,0x0b,0x66,0x90,
+	0x49,0x89,0xc0,0xb9,0x04,0x06,0x00,0x00,
+	0x31,0xc0,0xbf,0x01,0x00,0x00,0x00,0x48,
+	0x8d,0x15,0xbb,0x60,0x00,0x00,0x48,0x8d,
+	0x35,0xcb,0x6b,0x00,0x00,0xe8,0x4e,0x39,
+	0x00,0x00,0xe9,0xb3,0xfc,0xff,0xff,0x66,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0x8b,0x8b,0x44,0x05,0x00,0x00,0x8b,0xb3,
+	0x40,0x05,0x00,0x00,0xba,0x01,0x00,0x00,
+	0x00,0xe8,0xee,0x49,0x00,0x00,0xe9,0x79,
+	0xfb,0xff,0xff,0x0f,0x1f,0x44,0x00,0x00,
+	0x0f,0xb6,0xb3,0xec,0x03,0x00,0x00,0x48,
+	0x8b,0xbb,0x18,0x05,0x00,0x00,0xe8,0x7d,
+	0xe2,0xff,0xff,0x85,0xc0,0x0f,0x88,0xf3,
+	0x05,0x00,0x00,0x48,0x8b,0x83,0x10,0x04,
+	0x00,0x00,0x48,0x8b,0x93,0x18,0x05,0x00,
+	0x00,0x48,0x83,0xf8,0xff,0x0f,0x84,0x3d,
+	0x02,0x00,0x00,0x80,0xbb,0x08,0x05,0x00,
+	0x00,0x00,0x0f,0x84,0x50,0x05,0x00,0x00,
+	0x48,0x8b,0x83,0x08,0x04,0x00,0x00,0x66,
+	0x48,0x0f,0x6e,0xc2,0x48,0x01,0xd0,0x66,
+	0x48,0x0f,0x6e,0xe0,0x66,0x0f,0x6c,0xc4,
+	0x0f,0x11,0x83,0xf8,0x03,0x00,0x00,0xe9,
+	0x97,0xfb,0xff,0xff,0x0f,0x1f,0x40,0x00,
+	0xb9,0x25,0x06,0x00,0x00,0x48,0x8d,0x15,
+	0x0d,0x60,0x00,0x00,0x48,0x8d,0x35,0xa5,
+	0x6b,0x00,0x00,0x31,0xc0,0xbf,0x01,0x00,
+	0x00,0x00,0xe8,0x99,0x38,0x00,0x00,0xe9,
+	0xfe,0xfb,0xff,0xff,0x0f,0x1f,0x40,0x00,
+	0x44,0x8b,0x63,0x28,0x45,0x85,0xe4,0x78,
+	0x50,0x80,0x7b,0x2c,0x00,0x74,0x1b,0x45,
+	0x31,0xc0,0x31,0xc9,0x31,0xd2,0x31,0xf6,
+	0xbf,0x29,0x00,0x00,0x00,0xe8,0xda,0x46,
+	0x00,0x00,0x85,0xc0,0x0f,0x85,0x54,0x06,
+	0x00,0x00,0x8b,0x53,0x28,0x48,0x8d,0x35,
+	0x20,0x61,0x00,0x00,0xbf,0x04,0x00,0x00,
+	0x00,0x31,0xc0,0xe8,0x50,0x38,0x00,0x00,
+	0x8b,0x7b,0x28,0xe8,0x18,0x44,0x00,0x00,
+	0x44,0x8b,0x5b,0x68,0x45,0x85,0xdb,0x0f,
+	0x84,0xdd,0x01,0x00,0x00,0x48,0x8b,0x53,
+	0x60,0x4c,0x89,0x6c,0x24,0x30,0x45,0x31,
+	0xe4,0x48,0x89,0x6c,0x24,0x38,0xeb,0x6e,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0x48,0x81,0xfe,0xff,0xff,0xff,0x7f,0x74,
+	0x4b,0x41,0xbf,0x00,0x10,0x00,0x00,0xf6,
+	0xc1,0x04,0x74,0x0c,0x83,0xe1,0xfb,0x44,
+	0x8b,0x7c,0x24,0x18,0x41,0x89,0x4e,0x38,
+	0x89,0xf2,0xbf,0x03,0x00,0x00,0x00,0x48,
+	0x8d,0x35,0xd3,0x60,0x00,0x00,0x31,0xc0,
+	0x48,0x89,0xe9,0xe8,0xe8,0x37,0x00,0x00,
+	0x41,0x8b,0x7e,0x48,0x44,0x89,0xfa,0x48,
+	0x89,0xee,0xe8,0x29,0x44,0x00,0x00,0x4d,
+	0x8b,0x46,0x18,0x49,0x39,0xc0,0x0f,0x85,
+	0x5c,0x04,0x00,0x00,0x49,0x83,0xc4,0x01,
+	0x44,0x3b,0x63,0x68,0x0f,0x83,0x56,0x01,
+	0x00,0x00,0x48,0x8b,0x53,0x60,0x4b,0x8d,
+	0x04,0x64,0x49,0x8d,0x04,0x84,0x4c,0x8d,
+	0x34,0xc2,0x41,0x8b,0x46,0x40,0xf6,0xc4,
+	0x10,0x74,0xd9,0x41,0x8b,0x4e,0x38,0x41,
+	0x8b,0x56,0x3c,0x49,0x8b,0x76,0x48,0x49,
+	0x8b,0x6e,0x18,0x41,0x89,0xcd,0xf6,0xc4,
+	0x04,0x0f,0x85,0x69,0xff,0xff,0xff,0x41,
+	0x89,0xd7,0x89,0xc7,0x41,0x83,0xcf,0x10,
+	0x81,0xe7,0x00,0x20,0x00,0x00,0xf6,0xc4,
+	0x01,0x0f,0x84,0xa1,0x00,0x00,0x00,0x48,
+	0x83,0xfe,0xff,0x0f,0x84,0xc7,0x03,0x00,
+	0x00,0x41,0x89,0xd7,0x41,0x83,0xe7,0xdf,
+	0x45,0x89,0xf9,0x41,0x83,0xcf,0x30,0x41,
+	0x83,0xc9,0x10,0x85,0xff,0x45,0x0f,0x44,
+	0xf9,0x83,0xe2,0x01,0x75,0x13,0x41,0x89,
+	0xc8,0x41,0x83,0xc8,0x02,0xa9,0x00,0x00,
+	0x00,0x20,0x41,0x0f,0x44,0xc8,0x41,0x89,
+	0xcd,0x48,0x83,0xec,0x08,0x49,0x8b,0x4e,
+	0x20,0x45,0x89,0xf9,0x45,0x89,0xe8,0x56,
+	0x48,0x89,0xea,0x48,0x8d,0x35,0x1c,0x60,
+	0x00,0x00,0xbf,0x04,0x00,0x00,0x00,0x31,
+	0xc0,0xe8,0x12,0x37,0x00,0x00,0x49,0x8b,
+	0x7e,0x18,0x49,0x8b,0x76,0x20,0x49,0x63,
+	0xcf,0x4d,0x8b,0x4e,0x28,0x4d,0x8b,0x46,
+	0x48,0x49,0x63,0xd5,0x48,0x29,0xfe,0xe8,
+	0xd4,0x42,0x00,0x00,0x49,0x8b,0x7e,0x48,
+	0x41,0x59,0x49,0x89,0xc7,0x41,0x5a,0x48,
+	0x83,0xff,0xff,0x74,0x0b,0x41,0xf6,0x46,
+	0x43,0x10,0x0f,0x85,0x28,0x03,0x00,0x00,
+	0x4c,0x89,0xf8,0xe9,0xf7,0xfe,0xff,0xff,
+	0x41,0x89,0xd1,0x41,0x83,0xc9,0x30,0x85,
+	0xff,0x45,0x0f,0x45,0xf9,0x48,0x83,0xfe,
+	0xff,0x0f,0x85,0x6a,0xff,0xff,0xff,0xe9,
+	0x6a,0xff,0xff,0xff,0x0f,0x1f,0x40,0x00,
+	0x48,0x89,0x93,0xf8,0x03,0x00,0x00,0x48,
+	0xc7,0x83,0x00,0x04,0x00,0x00,0xff,0xff,
+	0xff,0xff,0xe9,0x74,0xf9,0xff,0xff,0x66,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0xb9,0x5d,0x05,0x00,0x00,0x48,0x8d,0x15,
+	0xe5,0x5d,0x00,0x00,0x48,0x8d,0x35,0xbd,
+	0x69,0x00,0x00,0x31,0xc0,0xbf,0x02,0x00,
+	0x00,0x00,0xe8,0x71,0x36,0x00,0x00,0xe9,
+	0x8e,0xf8,0xff,0xff,0x0f,0x1f,0x40,0x00,
+	0x4c,0x8b,0x6c,0x24,0x30,0x48,0x8b,0x6c,
+	0x24,0x38,0x66,0x41,0x0f,0x6e,0xc5,0x66,
+	0x0f,0x6e,0x9b,0x54,0x05,0x00,0x00,0xbe,
+	0x05,0x1c,0x08,0x40,0x48,0x8d,0x84,0x24,
+	0x10,0x01,0x00,0x00,0x8b,0xbb,0x58,0x05,
+	0x00,0x00,0x48,0x89,0xc2,0x48,0x89,0x44,
+	0x24,0x38,0x66,0x0f,0x62,0xc3,0x66,0x0f,
+	0xd6,0x84,0x24,0x10,0x01,0x00,0x00,0xe8,
+	0x3c,0x42,0x00,0x00,0x85,0xc0,0x0f,0x85,
+	0xdc,0x02,0x00,0x00,0x48,0x8b,0x7c,0x24,
+	0x20,0xe8,0x32,0x1c,0x00,0x00,0x48,0x85,
+	0xc0,0x0f,0x88,0x73,0xf9,0xff,0xff,0x8b,
+	0xbb,0x58,0x05,0x00,0x00,0xe8,0xce,0x41,
+	0x00,0x00,0x8b,0x7b,0x6c,0x83,0xff,0xff,
+	0x74,0x05,0xe8,0xc1,0x41,0x00,0x00,0x45,
+	0x31,0xc9,0x8b,0x4b,0x68,0x83,0x3d,0x84,
+	0x56,0x00,0x00,0x7f,0x48,0x89,0xef,0x48,
+	0x8b,0x53,0x60,0x41,0x0f,0x94,0xc1,0x48,
+	0x8d,0x74,0x24,0x73,0x44,0x0f,0xb6,0x83,
+	0xec,0x03,0x00,0x00,0xe8,0xc7,0xd8,0xff,
+	0xff,0x85,0xc0,0x0f,0x85,0x29,0xf9,0xff,
+	0xff,0x80,0x7c,0x24,0x73,0x00,0x75,0x0b,
+	0x48,0xc7,0x05,0x1d,0x56,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x48,0xc7,0x44,0x24,0x18,
+	0x00,0x00,0x00,0x00,0x44,0x8b,0x83,0xc8,
+	0x00,0x00,0x00,0x45,0x85,0xc0,0x0f,0x84,
+	0x08,0xfa,0xff,0xff,0x48,0x89,0x5c,0x24,
+	0x30,0x0f,0x1f,0x80,0x00,0x00,0x00,0x00,
+	0x48,0x8b,0x4c,0x24,0x30,0x48,0x8b,0x44,
+	0x24,0x18,0x48,0x8b,0x74,0x24,0x38,0x48,
+	0x8b,0x91,0xc0,0x00,0x00,0x00,0x48,0x8d,
+	0x04,0x40,0x4c,0x8d,0x34,0xc2,0x4d,0x8b,
+	0x2e,0x45,0x8b,0x65,0x08,0x41,0x8b,0x6d,
+	0x0c,0x48,0xc7,0x84,0x24,0x10,0x01,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x41,0x8b,0x7e,
+	0x10,0xe8,0x16,0x44,0x00,0x00,0x85,0xc0,
+	0x0f,0x88,0xe7,0x03,0x00,0x00,0x49,0x8b,
+	0x4e,0x08,0x41,0x89,0xe8,0x48,0x8b,0x84,
+	0x24,0x10,0x01,0x00,0x00,0x48,0x8d,0x51,
+	0xe0,0x41,0x8b,0x4d,0x04,0x8b,0x78,0x04,
+	0x48,0x89,0xd6,0x48,0xc1,0xee,0x05,0x41,
+	0x39,0xec,0x45,0x0f,0x43,0xc4,0x41,0x39,
+	0xc8,0x0f,0x83,0xa5,0x02,0x00,0x00,0x39,
+	0xf1,0x0f,0x85,0x9d,0x02,0x00,0x00,0x39,
+	0xf9,0x0f,0x85,0x95,0x02,0x00,0x00,0x44,
+	0x89,0xe1,0x09,0xe9,0x0f,0x84,0x11,0xf9,
+	0xff,0xff,0x31,0xd2,0xbe,0x01,0x00,0x00,
+	0x00,0x48,0x8d,0x3d,0x03,0x5e,0x00,0x00,
+	0xe8,0xab,0x40,0x00,0x00,0x89,0x44,0x24,
+	0x48,0x49,0x89,0xc7,0x85,0xc0,0x0f,0x88,
+	0x60,0x09,0x00,0x00,0x45,0x8b,0x55,0x04,
+	0x44,0x39,0xe5,0xb9,0x22,0x00,0x00,0x00,
+	0x49,0xc7,0xc0,0xff,0xff,0xff,0xff,0xba,
+	0x03,0x00,0x00,0x00,0x42,0x8d,0x44,0x15,
+	0x00,0x0f,0x42,0xe8,0x41,0x83,0xea,0x01,
+	0x41,0x39,0xea,0x44,0x0f,0x47,0xd5,0x45,
+	0x31,0xc9,0x31,0xff,0x42,0x8d,0x04,0xd5,
+	0x40,0x00,0x00,0x00,0x44,0x89,0x54,0x24,
+	0x40,0x48,0x89,0xc6,0x48,0x89,0x44,0x24,
+	0x50,0xe8,0x6a,0x40,0x00,0x00,0x44,0x8b,
+	0x54,0x24,0x40,0x48,0x3d,0x00,0xf0,0xff,
+	0xff,0x49,0x89,0xc0,0x48,0x8d,0x58,0x40,
+	0x0f,0x87,0x3c,0x02,0x00,0x00,0x44,0x89,
+	0x78,0x14,0xbe,0x01,0x00,0x00,0x00,0x48,
+	0x8d,0x84,0x24,0xc0,0x00,0x00,0x00,0x49,
+	0x89,0x40,0x18,0x49,0xc7,0x40,0x20,0x01,
+	0x00,0x00,0x00,0x66,0x41,0x89,0x70,0x10,
+	0x45,0x85,0xd2,0x7e,0x1f,0x41,0x8d,0x4a,
+	0xff,0x48,0x89,0xd8,0x49,0x8d,0x4c,0xc8,
+	0x48,0x0f,0x1f,0x80,0x00,0x00,0x00,0x00,
+	0x4c,0x89,0x00,0x48,0x83,0xc0,0x08,0x48,
+	0x39,0xc8,0x75,0xf4,0x45,0x31,0xff,0x4c,
+	0x89,0x6c,0x24,0x40,0x48,0x8b,0xbc,0x24,
+	0x10,0x01,0x00,0x00,0x45,0x89,0xfd,0x4d,
+	0x89,0xc7,0xeb,0x25,0x0f,0x1f,0x40,0x00,
+	0x41,0x01,0xc5,0x44,0x89,0xe0,0x48,0x8b,
+	0xbc,0x24,0x10,0x01,0x00,0x00,0x45,0x39,
+	0xe5,0x41,0x0f,0x46,0xc5,0x89,0x47,0x08,
+	0x44,0x39,0xed,0x0f,0x8e,0xdf,0xf7,0xff,
+	0xff,0x89,0xee,0x48,0x89,0xda,0x44,0x29,
+	0xee,0x48,0x63,0xf6,0xe8,0xc3,0x42,0x00,
+	0x00,0x85,0xc0,0x79,0xcb,0x41,0x89,0xc0,
+	0xb9,0xb1,0x03,0x00,0x00,0x31,0xc0,0xbf,
+	0x01,0x00,0x00,0x00,0x48,0x8d,0x15,0x26,
+	0x5b,0x00,0x00,0x48,0x8d,0x35,0x8e,0x69,
+	0x00,0x00,0xe8,0xb9,0x33,0x00,0x00,0xe9,
+	0x1e,0xf7,0xff,0xff,0x0f,0x1f,0x40,0x00,
+	0xe8,0x7b,0x3f,0x00,0x00,0xe9,0xce,0xfc,
+	0xff,0xff,0x66,0x0f,0x1f,0x44,0x00,0x00,
+	0x83,0xca,0x30,0x85,0xff,0x44,0x0f,0x45,
+	0xfa,0xe9,0x48,0xfc,0xff,0xff,0x66,0x90,
+	0x48,0x01,0xd0,0x66,0x48,0x0f,0x6e,0xea,
+	0x66,0x48,0x0f,0x6e,0xc0,0x66,0x0f,0x6c,
+	0xc5,0x0f,0x11,0x83,0xf8,0x03,0x00,0x00,
+	0xe9,0x4e,0xf6,0xff,0xff,0x0f,0x1f,0x00,
+	0x49,0x89,0xc1,0xb9,0x6f,0x06,0x00,0x00,
+	0x31,0xc0,0xbf,0x01,0x00,0x00,0x00,0x48,
+	0x8d,0x15,0xbb,0x5a,0x00,0x00,0x48,0x8d,
+	0x35,0xd3,0x67,0x00,0x00,0xe8,0x4e,0x33,
+	0x00,0x00,0xe9,0xb3,0xf6,0xff,0xff,0x66,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x89,0xe9,0xb9,0x7a,0x06,0x00,0x00,
+	0xbf,0x01,0x00,0x00,0x00,0x31,0xc0,0x44,
+	0x8b,0x83,0x54,0x05,0x00,0x00,0x48,0x8d,
+	0x15,0x84,0x5a,0x00,0x00,0x48,0x8d,0x35,
+	0xd4,0x67,0x00,0x00,0xe8,0x17,0x33,0x00,
+	0x00,0xe9,0x7c,0xf6,0xff,0xff,0x41,0x89,
+	0xc0,0xb9,0x79,0x05,0x00,0x00,0x31,0xc0,
+	0xbf,0x01,0x00,0x00,0x00,0x48,0x8d,0x15,
+	0x5d,0x5a,0x00,0x00,0x48,0x8d,0x35,0xe5,
+	0x66,0x00,0x00,0xe8,0xf0,0x32,0x00,0x00,
+	0xe9,0x55,0xf6,0xff,0xff,0x45,0x31,0xe4,
+	0xeb,0x18,0x66,0x0f,0x1f,0x44,0x00,0x00,
+	0x49,0x83,0xc4,0x01,0x49,0x83,0xfc,0x40,
+	0x0f,0x84,0x76,0xf7,0xff,0xff,0x49,0x8b,
+	0x45,0x58,0x4c,0x0f,0xa3,0xe0,0x73,0xe8,
+	0x49,0x8b,0x7d,0x18,0x49,0x8b,0x75,0x20,
+	0x44,0x89,0xe2,0x48,0x29,0xfe,0xe8,0xf9,
+	0x3e,0x00,0x00,0x48,0x85,0xc0,0x74,0xd0,
+	0x4d,0x8b,0x45,0x18,0x4d,0x8b,0x4d,0x20,
+	0x50,0x31,0xc0,0x41,0x54,0x48,0x8d,0x15,
+	0xfd,0x59,0x00,0x00,0xb9,0xba,0x06,0x00,
+	0x00,0x48,0x8d,0x35,0xc0,0x68,0x00,0x00,
+	0x4d,0x29,0xc1,0xbf,0x01,0x00,0x00,0x00,
+	0xe8,0x83,0x32,0x00,0x00,0x58,0x5a,0xe9,
+	0xe6,0xf5,0xff,0xff,0x8b,0x43,0x28,0x85,
+	0xc0,0x0f,0x89,0xea,0xf9,0xff,0xff,0xe9,
+	0x0e,0xfc,0xff,0xff,0x56,0x45,0x89,0xe1,
+	0x41,0x89,0xe8,0x48,0x8d,0x15,0xbf,0x59,
+	0x00,0x00,0x57,0x48,0x8d,0x35,0x76,0x67,
+	0x00,0x00,0xbf,0x01,0x00,0x00,0x00,0x51,
+	0x41,0x8b,0x46,0x10,0xb9,0x7a,0x03,0x00,
+	0x00,0x50,0x31,0xc0,0xe8,0x3f,0x32,0x00,
+	0x00,0x48,0x83,0xc4,0x20,0xe9,0xa0,0xf5,
+	0xff,0xff,0xb9,0xa1,0x03,0x00,0x00,0x48,
+	0x8d,0x15,0x8b,0x59,0x00,0x00,0x48,0x8d,
+	0x35,0xc3,0x67,0x00,0x00,0x31,0xc0,0xbf,
+	0x01,0x00,0x00,0x00,0xe8,0x17,0x32,0x00,
+	0x00,0xe9,0x7c,0xf5,0xff,0xff,0x41,0x89,
+	0xc0,0xb9,0x52,0x06,0x00,0x00,0x31,0xc0,
+	0xbf,0x01,0x00,0x00,0x00,0x48,0x8d,0x15,
+	0x5d,0x59,0x00,0x00,0x48,0x8d,0x35,0x45,
+	0x66,0x00,0x00,0xe8,0xf0,0x31,0x00,0x00,
+	0xe9,0x55,0xf5,0xff,0xff,0xb9,0xfb,0x04,
+	0x00,0x00,0x48,0x8d,0x15,0x40,0x59,0x00,
+	0x00,0x48,0x8d,0x35,0x58,0x65,0x00,0x00,
+	0x31,0xc0,0xbf,0x01,0x00,0x00,0x00,0xe8,
+	0xcc,0x31,0x00,0x00,0xe9,0x31,0xf5,0xff,
+	0xff,0x48,0x83,0xec,0x08,0x4d,0x89,0xf1,
+	0x45,0x31,0xc0,0xb9,0x01,0x05,0x00,0x00,
+	0x50,0x48,0x8d,0x15,0x11,0x59,0x00,0x00,
+	0x48,0x8d,0x35,0x69,0x65,0x00,0x00,0xbf,
+	0x01,0x00,0x00,0x00,0x31,0xc0,0xe8,0x9d,
+	0x31,0x00,0x00,0x41,0x5d,0x41,0x5e,0xe9,
+	0xfe,0xf4,0xff,0xff,0x48,0x83,0xec,0x08,
+	0x49,0x89,0xe9,0x4d,0x89,0xe0,0xb9,0x07,
+	0x05,0x00,0x00,0x50,0xeb,0xcb,0x49,0x89,
+	0xc0,0xb9,0xd8,0x03,0x00,0x00,0x31,0xc0,
+	0xbf,0x01,0x00,0x00,0x00,0x48,0x8d,0x15,
+	0xcd,0x58,0x00,0x00,0x48,0x8d,0x35,0x65,
+	0x67,0x00,0x00,0xe8,0x60,0x31,0x00,0x00,
+	0xe9,0xc5,0xf4,0xff,0xff,0x41,0x89,0xc0,
+	0xb9,0x73,0x03,0x00,0x00,0x31,0xc0,0xbf,
+	0x01,0x00,0x00,0x00,0x48,0x8d,0x15,0xa6,
+	0x58,0x00,0x00,0x48,0x8d,0x35,0x2e,0x66,
+	0x00,0x00,0xe8,0x39,0x31,0x00,0x00,0xe9,
+	0x9e,0xf4,0xff,0xff,0x89,0xc2,0x48,0x8d,
+	0x35,0x03,0x68,0x00,0x00,0x31,0xc0,0x45,
+	0x31,0xed,0xbf,0x04,0x00,0x00,0x00,0x4c,
+	0x8d,0x35,0x36,0x5b,0x00,0x00,0xe8,0x15,
+	0x31,0x00,0x00,0x48,0x8b,0x94,0x24,0x10,
+	0x01,0x00,0x00,0x31,0xc0,0x48,0x8d,0x35,
+	0x29,0x5a,0x00,0x00,0xbf,0x04,0x00,0x00,
+	0x00,0xe8,0xfa,0x30,0x00,0x00,0x48,0x8b,
+	0x94,0x24,0x18,0x01,0x00,0x00,0x31,0xc0,
+	0x48,0x8d,0x35,0x23,0x5a,0x00,0x00,0xbf,
+	0x04,0x00,0x00,0x00,0xe8,0xdf,0x30,0x00,
+	0x00,0x48,0x8b,0x94,0x24,0x20,0x01,0x00,
+	0x00,0x31,0xc0,0x48,0x8d,0x35,0x1b,0x5a,
+	0x00,0x00,0xbf,0x04,0x00,0x00,0x00,0xe8,
+	0xc4,0x30,0x00,0x00,0x48,0x8b,0x94,0x24,
+	0x28,0x01,0x00,0x00,0x31,0xc0,0x48,0x8d,
+	0x35,0x15,0x5a,0x00,0x00,0xbf,0x04,0x00,
+	0x00,0x00,0xe8,0xa9,0x30,0x00,0x00,0x48,
+	0x8b,0x94,0x24,0x40,0x01,0x00,0x00,0x31,
+	0xc0,0x48,0x8d,0x35,0x0d,0x5a,0x00,0x00,
+	0xbf,0x04,0x00,0x00,0x00,0xe8,0x8e,0x30,
+	0x00,0x00,0x48,0x8b,0x94,0x24,0x30,0x01,
+	0x00,0x00,0x31,0xc0,0x48,0x8d,0x35,0x08,
+	0x5a,0x00,0x00,0xbf,0x04,0x00,0x00,0x00,
+	0xe8,0x73,0x30,0x00,0x00,0x48,0x8b,0x94,
+	0x24,0x38,0x01,0x00,0x00,0x31,0xc0,0x48,
+	0x8d,0x35,0x01,0x5a,0x00,0x00,0xbf,0x04,
+	0x00,0x00,0x00,0xe8,0x58,0x30,0x00,0x00,
+	0x48,0x8b,0x94,0x24,0x48,0x01,0x00,0x00,
+	0x31,0xc0,0x48,0x8d,0x35,0xf4,0x59,0x00,
+	0x00,0xbf,0x04,0x00,0x00,0x00,0xe8,0x3d,
+	0x30,0x00,0x00,0x48,0x8b,0x94,0x24,0x50,
+	0x01,0x00,0x00,0x31,0xc0,0x48,0x8d,0x35,
+	0xed,0x59,0x00,0x00,0xbf,0x04,0x00,0x00,
+	0x00,0xe8,0x22,0x30,0x00,0x00,0x48,0x8b,
+	0x94,0x24,0x58,0x01,0x00,0x00,0x31,0xc0,
+	0x48,0x8d,0x35,0xe4,0x59,0x00,0x00,0xbf,
+	0x04,0x00,0x00,0x00,0xe8,0x07,0x30,0x00,
+	0x00,0x48,0x8b,0x94,0x24,0x60,0x01,0x00,
+	0x00,0x31,0xc0,0x48,0x8d,0x35,0xdd,0x59,
+	0x00,0x00,0xbf,0x04,0x00,0x00,0x00,0xe8,
+	0xec,0x2f,0x00,0x00,0x8b,0x94,0x24,0x70,
+	0x01,0x00,0x00,0x31,0xc0,0x48,0x8d,0x35,
+	0xd5,0x59,0x00,0x00,0xbf,0x04,0x00,0x00,
+	0x00,0xe8,0xd2,0x2f,0x00,0x00,0x8b,0x84,
+	0x24,0x70,0x01,0x00,0x00,0xc1,0xe8,0x03,
+	0x74,0x31,0x48,0x8b,0x84,0x24,0x68,0x01,
+	0x00,0x00,0x44,0x89,0xea,0x4c,0x89,0xf6,
+	0xbf,0x04,0x00,0x00,0x00,0x4a,0x8b,0x0c,
+	0xe8,0x31,0xc0,0x49,0x83,0xc5,0x01,0xe8,
+	0xa4,0x2f,0x00,0x00,0x8b,0x84,0x24,0x70,
+	0x01,0x00,0x00,0xc1,0xe8,0x03,0x49,0x39,
+	0xc5,0x72,0xcf,0x8b,0x94,0x24,0x74,0x01,
+	0x00,0x00,0x31,0xc0,0xbf,0x04,0x00,0x00,
+	0x00,0x48,0x8d,0x35,0x8c,0x59,0x00,0x00,
+	0xe8,0x7b,0x2f,0x00,0x00,0x48,0x83,0xfd,
+	0xea,0x0f,0x84,0x60,0x04,0x00,0x00,0x41,
+	0x89,0xe8,0xb9,0x0f,0x07,0x00,0x00,0xbf,
+	0x01,0x00,0x00,0x00,0x31,0xc0,0x48,0x8d,
+	0x15,0xbc,0x56,0x00,0x00,0x48,0x8d,0x35,
+	0x84,0x66,0x00,0x00,0xe8,0x4f,0x2f,0x00,
+	0x00,0x8b,0x7b,0x08,0xe8,0x17,0x3b,0x00,
+	0x00,0xe9,0xac,0xf2,0xff,0xff,0x41,0xb8,
+	0xcc,0x06,0x00,0x00,0xb9,0xcc,0x06,0x00,
+	0x00,0x31,0xc0,0xbf,0x01,0x00,0x00,0x00,
+	0x48,0x8d,0x15,0x8a,0x56,0x00,0x00,0x48,
+	0x8d,0x35,0xca,0x65,0x00,0x00,0xe8,0x1d,
+	0x2f,0x00,0x00,0xe9,0x82,0xf2,0xff,0xff,
+	0x8b,0x6c,0x24,0x18,0x48,0x8b,0x05,0xd5,
+	0x4f,0x00,0x00,0x48,0x8d,0x78,0x1c,0xe8,
+	0x14,0xe7,0xff,0xff,0x83,0xfd,0xff,0x74,
+	0x07,0x89,0xef,0xe8,0xc8,0x3a,0x00,0x00,
+	0x4c,0x8b,0x7c,0x24,0x20,0x4c,0x89,0xff,
+	0xe8,0x0b,0x15,0x00,0x00,0x48,0x89,0xc1,
+	0x48,0x85,0xc0,0x0f,0x88,0x49,0xf2,0xff,
+	0xff,0x8b,0x54,0x24,0x14,0x48,0x8d,0x35,
+	0x04,0x67,0x00,0x00,0x31,0xc0,0x31,0xed,
+	0xbf,0x04,0x00,0x00,0x00,0x4c,0x8d,0xa4,
+	0x24,0xc0,0x00,0x00,0x00,0xe8,0xbe,0x2e,
+	0x00,0x00,0x31,0xf6,0x4c,0x89,0xff,0xe8,
+	0x3c,0x3c,0x00,0x00,0xeb,0x26,0x48,0x89,
+	0xe8,0x4c,0x89,0xe6,0x48,0x83,0xc5,0x01,
+	0x48,0xc1,0xe0,0x04,0x48,0x03,0x83,0xd0,
+	0x00,0x00,0x00,0xf3,0x0f,0x6f,0x38,0x0f,
+	0x29,0xbc,0x24,0xc0,0x00,0x00,0x00,0xe8,
+	0x10,0x3d,0x00,0x00,0x89,0xef,0x3b,0xab,
+	0xd8,0x00,0x00,0x00,0x72,0xd0,0x45,0x31,
+	0xe4,0x48,0x8d,0xac,0x24,0xc0,0x00,0x00,
+	0x00,0x44,0x3b,0xa3,0x88,0x00,0x00,0x00,
+	0x0f,0x83,0xb0,0x06,0x00,0x00,0x4d,0x6b,
+	0xf4,0x48,0x48,0x8b,0x93,0x80,0x00,0x00,
+	0x00,0x4c,0x8d,0xbc,0x24,0x88,0x00,0x00,
+	0x00,0x4a,0x8d,0x04,0x32,0x8b,0x48,0x10,
+	0x89,0x8c,0x24,0xcc,0x00,0x00,0x00,0x8b,
+	0x48,0x0c,0x89,0x8c,0x24,0xc8,0x00,0x00,
+	0x00,0x8b,0x48,0x14,0x89,0x8c,0x24,0xd0,
+	0x00,0x00,0x00,0x48,0x8b,0x40,0x18,0x48,
+	0x89,0x84,0x24,0xc0,0x00,0x00,0x00,0xeb,
+	0x45,0x48,0x63,0x94,0x24,0x88,0x00,0x00,
+	0x00,0x48,0x8b,0x83,0x80,0x00,0x00,0x00,
+	0x48,0x89,0xd7,0x4a,0x3b,0x14,0x30,0x0f,
+	0x84,0x48,0x06,0x00,0x00,0xe8,0x4a,0x3d,
+	0x00,0x00,0x49,0x89,0xc5,0x85,0xc0,0x0f,
+	0x88,0x09,0x06,0x00,0x00,0x48,0x8b,0x93,
+	0x80,0x00,0x00,0x00,0x48,0x63,0x84,0x24,
+	0x88,0x00,0x00,0x00,0x4a,0x3b,0x04,0x32,
+	0x0f,0x8f,0xaa,0x05,0x00,0x00,0x42,0x8b,
+	0x7c,0x32,0x08,0x48,0x89,0xee,0x4c,0x89,
+	0xfa,0xe8,0xe6,0x3c,0x00,0x00,0x49,0x89,
+	0xc5,0x85,0xc0,0x79,0xa4,0x45,0x89,0xe0,
+	0xb9,0xab,0x04,0x00,0x00,0xbf,0x01,0x00,
+	0x00,0x00,0x31,0xc0,0x48,0x8d,0x2d,0x16,
+	0x55,0x00,0x00,0x48,0x8d,0x35,0x1e,0x66,
+	0x00,0x00,0x48,0x89,0xea,0xe8,0xa6,0x2d,
+	0x00,0x00,0x4d,0x63,0xc5,0xe9,0x8c,0x05,
+	0x00,0x00,0x48,0x8b,0x87,0x80,0x01,0x00,
+	0x00,0x8b,0x93,0xe4,0x03,0x00,0x00,0x48,
+	0x8d,0x35,0x72,0x55,0x00,0x00,0x48,0x8b,
+	0xb8,0xe0,0x00,0x00,0x00,0xe8,0x5e,0xe0,
+	0xff,0xff,0x85,0xc0,0x0f,0x88,0xe0,0xf0,
+	0xff,0xff,0x48,0x8b,0x3b,0xe9,0x42,0xf3,
+	0xff,0xff,0x83,0xcd,0xff,0xe9,0xa0,0xf3,
+	0xff,0xff,0x45,0x31,0xff,0x49,0x83,0xc4,
+	0x08,0x83,0x7b,0x30,0x00,0x44,0x89,0x7c,
+	0x24,0x30,0x0f,0x8e,0x3c,0xfe,0xff,0xff,
+	0x89,0x6c,0x24,0x18,0xe9,0x0e,0x01,0x00,
+	0x00,0x31,0xc0,0xb9,0x14,0x00,0x00,0x00,
+	0x48,0x8d,0xbc,0x24,0xc0,0x00,0x00,0x00,
+	0x49,0x81,0xee,0x00,0x80,0x00,0x00,0xf3,
+	0xab,0x66,0x49,0x0f,0x6e,0xc4,0x48,0x8d,
+	0x35,0xcb,0x64,0x00,0x00,0xbf,0x04,0x00,
+	0x00,0x00,0x4c,0x8d,0xac,0x24,0xe8,0x00,
+	0x00,0x00,0x41,0x8b,0x04,0x24,0x4c,0x89,
+	0xb4,0x24,0xe8,0x00,0x00,0x00,0x48,0xc7,
+	0x84,0x24,0xc0,0x00,0x00,0x00,0x00,0x0f,
+	0x05,0x00,0x89,0x44,0x24,0x74,0x48,0x8d,
+	0x44,0x24,0x74,0x48,0x89,0x84,0x24,0x00,
+	0x01,0x00,0x00,0x48,0x8d,0x84,0x24,0x80,
+	0x00,0x00,0x00,0x66,0x48,0x0f,0x6e,0xf0,
+	0x31,0xc0,0x48,0xc7,0x84,0x24,0x08,0x01,
+	0x00,0x00,0x01,0x00,0x00,0x00,0x48,0xc7,
+	0x84,0x24,0xf0,0x00,0x00,0x00,0x00,0x80,
+	0x00,0x00,0x66,0x0f,0x6c,0xc6,0x0f,0x29,
+	0x84,0x24,0xd0,0x00,0x00,0x00,0xe8,0xb5,
+	0x2c,0x00,0x00,0x41,0xb8,0x50,0x00,0x00,
+	0x00,0x48,0x8b,0x6b,0x38,0x4c,0x8d,0x8c,
+	0x24,0xc0,0x00,0x00,0x00,0x4c,0x8b,0xb4,
+	0x24,0xf0,0x00,0x00,0x00,0x49,0x8b,0x75,
+	0x00,0x4c,0x89,0xf0,0x48,0x83,0x2c,0x06,
+	0x10,0x4c,0x89,0xff,0x48,0x89,0x7c,0x06,
+	0x08,0x48,0x89,0xef,0x48,0x89,0x3c,0x06,
+	0x4c,0x8b,0x2e,0x4c,0x89,0xcf,0x4c,0x89,
+	0xc6,0xb8,0xb3,0x01,0x00,0x00,0x0f,0x05,
+	0x48,0x85,0xc0,0x74,0x05,0x49,0x89,0xc0,
+	0xeb,0x07,0x48,0x31,0xed,0x58,0x5f,0xff,
+	0xd0,0x49,0x63,0x04,0x24,0x4c,0x39,0xc0,
+	0x0f,0x85,0x02,0x01,0x00,0x00,0x83,0x44,
+	0x24,0x30,0x01,0x49,0x81,0xc4,0x00,0x02,
+	0x00,0x00,0x8b,0x44,0x24,0x30,0x39,0x43,
+	0x30,0x0f,0x8e,0x21,0xfd,0xff,0xff,0x48,
+	0x8b,0x13,0x41,0x8b,0x04,0x24,0x4d,0x8d,
+	0x7c,0x24,0xf8,0x3b,0x42,0x08,0x74,0xd6,
+	0x49,0x8b,0x4c,0x24,0xf8,0x4c,0x8d,0xb1,
+	0x7f,0x80,0x00,0x00,0x49,0x83,0xe6,0xf0,
+	0x80,0xbb,0x34,0x05,0x00,0x00,0x00,0x0f,
+	0x85,0xc4,0xfe,0xff,0xff,0x4c,0x8d,0x8c,
+	0x24,0xc0,0x00,0x00,0x00,0x8d,0x50,0xff,
+	0xbe,0x10,0x00,0x00,0x00,0x4c,0x89,0xcf,
+	0x48,0x8d,0x8c,0x24,0x88,0x00,0x00,0x00,
+	0xe8,0xfb,0x25,0x00,0x00,0x8b,0x6c,0x24,
+	0x18,0x31,0xd2,0x31,0xf6,0x41,0x89,0xc5,
+	0x89,0xef,0xe8,0xb1,0x37,0x00,0x00,0x48,
+	0x8b,0xb4,0x24,0x88,0x00,0x00,0x00,0x49,
+	0x63,0xd5,0x89,0xef,0xe8,0x87,0x37,0x00,
+	0x00,0x49,0x89,0xc0,0x48,0x85,0xc0,0x0f,
+	0x88,0x7e,0x0e,0x00,0x00,0x4c,0x8d,0x84,
+	0x24,0x80,0x00,0x00,0x00,0x4c,0x89,0xf6,
+	0x48,0x83,0xee,0x10,0x4c,0x89,0xff,0x48,
+	0x89,0x7e,0x08,0x48,0x8b,0x7b,0x38,0x48,
+	0x89,0x3e,0x48,0xc7,0xc7,0x00,0x0f,0x05,
+	0x00,0x4c,0x89,0xc2,0x4d,0x89,0xe2,0xb8,
+	0x38,0x00,0x00,0x00,0x0f,0x05,0x48,0x85,
+	0xc0,0x74,0x05,0x49,0x89,0xc0,0xeb,0x07,
+	0x48,0x31,0xed,0x58,0x5f,0xff,0xd0,0xe9,
+	0x15,0xff,0xff,0xff,0xb9,0x85,0x03,0x00,
+	0x00,0x48,0x8d,0x15,0xc9,0x52,0x00,0x00,
+	0x48,0x8d,0x35,0xd1,0x60,0x00,0x00,0x31,
+	0xc0,0xbf,0x01,0x00,0x00,0x00,0xe8,0x55,
+	0x2b,0x00,0x00,0xe9,0xba,0xee,0xff,0xff,
+	0xb9,0x7a,0x07,0x00,0x00,0xbf,0x01,0x00,
+	0x00,0x00,0x31,0xc0,0x8b,0x6c,0x24,0x18,
+	0x48,0x8d,0x15,0x9a,0x52,0x00,0x00,0x48,
+	0x8d,0x35,0x32,0x63,0x00,0x00,0xe8,0x2d,
+	0x2b,0x00,0x00,0x89,0xef,0xe8,0xf6,0x36,
+	0x00,0x00,0x48,0x8b,0x05,0xe7,0x4b,0x00,
+	0x00,0x48,0x8d,0x78,0x1c,0xe8,0x26,0xe3,
+	0xff,0xff,0xe9,0x7b,0xee,0xff,0xff,0x45,
+	0x31,0xc0,0x31,0xc9,0xbe,0x01,0x00,0x00,
+	0x00,0xbf,0x23,0x00,0x00,0x00,0x48,0x8b,
+	0x93,0xd0,0x01,0x00,0x00,0xe8,0x62,0x39,
+	0x00,0x00,0x49,0x89,0xc5,0x48,0x85,0xc0,
+	0x0f,0x85,0x5c,0x0d,0x00,0x00,0x45,0x31,
+	0xc0,0x31,0xc9,0xbe,0x02,0x00,0x00,0x00,
+	0xbf,0x23,0x00,0x00,0x00,0x48,0x8b,0x93,
+	0xd8,0x01,0x00,0x00,0xe8,0x3b,0x39,0x00,
+	0x00,0x49,0x89,0xc6,0x48,0x85,0xc0,0x0f,
+	0x85,0x08,0x0d,0x00,0x00,0x45,0x31,0xc0,
+	0x31,0xc9,0xbe,0x03,0x00,0x00,0x00,0xbf,
+	0x23,0x00,0x00,0x00,0x48,0x8b,0x93,0xe0,
+	0x01,0x00,0x00,0xe8,0x14,0x39,0x00,0x00,
+	0x49,0x89,0xc7,0x48,0x85,0xc0,0x0f,0x85,
+	0xb4,0x0c,0x00,0x00,0x45,0x31,0xc0,0x31,
+	0xc9,0xbe,0x04,0x00,0x00,0x00,0xbf,0x23,
+	0x00,0x00,0x00,0x48,0x8b,0x93,0xe8,0x01,
+	0x00,0x00,0xe8,0xed,0x38,0x00,0x00,0x48,
+	0x89,0x44,0x24,0x18,0x48,0x85,0xc0,0x0f,
+	0x85,0x5e,0x0c,0x00,0x00,0x45,0x31,0xc0,
+	0x31,0xc9,0xbe,0x05,0x00,0x00,0x00,0xbf,
+	0x23,0x00,0x00,0x00,0x48,0x8b,0x93,0xf0,
+	0x01,0x00,0x00,0xe8,0xc4,0x38,0x00,0x00,
+	0x48,0x89,0x44,0x24,0x30,0x48,0x85,0xc0,
+	0x0f,0x85,0x08,0x0c,0x00,0x00,0x45,0x31,
+	0xc0,0x31,0xc9,0xbe,0x06,0x00,0x00,0x00,
+	0xbf,0x23,0x00,0x00,0x00,0x48,0x8b,0x93,
+	0xf8,0x01,0x00,0x00,0xe8,0x9b,0x38,0x00,
+	0x00,0x48,0x89,0x44,0x24,0x38,0x48,0x85,
+	0xc0,0x0f,0x85,0xb2,0x0b,0x00,0x00,0x45,
+	0x31,0xc0,0x31,0xc9,0xbe,0x07,0x00,0x00,
+	0x00,0xbf,0x23,0x00,0x00,0x00,0x48,0x8b,
+	0x93,0x00,0x02,0x00,0x00,0xe8,0x72,0x38,
+	0x00,0x00,0x48,0x89,0x44,0x24,0x40,0x48,
+	0x85,0xc0,0x0f,0x85,0x72,0x0d,0x00,0x00,
+	0x45,0x31,0xc0,0x31,0xc9,0xbe,0x08,0x00,
+	0x00,0x00,0xbf,0x23,0x00,0x00,0x00,0x48,
+	0x8b,0x93,0x08,0x02,0x00,0x00,0xe8,0x49,
+	0x38,0x00,0x00,0x48,0x89,0x44,0x24,0x48,
+	0x48,0x85,0xc0,0x0f,0x85,0x1c,0x0d,0x00,
+	0x00,0x45,0x31,0xc0,0x31,0xc9,0xbe,0x09,
+	0x00,0x00,0x00,0xbf,0x23,0x00,0x00,0x00,
+	0x48,0x8b,0x93,0x10,0x02,0x00,0x00,0xe8,
+	0x20,0x38,0x00,0x00,0x48,0x89,0x44,0x24,
+	0x50,0x48,0x85,0xc0,0x0f,0x85,0xc6,0x0c,
+	0x00,0x00,0x45,0x31,0xc0,0x31,0xc9,0xbe,
+	0x0a,0x00,0x00,0x00,0xbf,0x23,0x00,0x00,
+	0x00,0x48,0x8b,0x93,0x18,0x02,0x00,0x00,
+	0xe8,0xf7,0x37,0x00,0x00,0x48,0x89,0x44,
+	0x24,0x58,0x48,0x85,0xc0,0x0f,0x85,0x70,
+	0x0c,0x00,0x00,0x45,0x31,0xc0,0x31,0xc9,
+	0xbe,0x0b,0x00,0x00,0x00,0xbf,0x23,0x00,
+	0x00,0x00,0x48,0x8b,0x93,0x20,0x02,0x00,
+	0x00,0xe8,0xce,0x37,0x00,0x00,0x48,0x89,
+	0x44,0x24,0x60,0x48,0x85,0xc0,0x0f,0x85,
+	0x69,0x0d,0x00,0x00,0x45,0x31,0xc0,0x4c,
+	0x89,0xe2,0xbe,0x0c,0x00,0x00,0x00,0xbf,
+	0x23,0x00,0x00,0x00,0x8b,0x8b,0xd0,0x03,
+	0x00,0x00,0xe8,0xa5,0x37,0x00,0x00,0x49,
+	0x89,0xc1,0x48,0x85,0xc0,0x0f,0x85,0xd4,
+	0x0c,0x00,0x00,0x44,0x8b,0x63,0x08,0x48,
+	0x8d,0x35,0x51,0x53,0x00,0x00,0xbf,0x03,
+	0x00,0x00,0x00,0x31,0xc0,0xe8,0x16,0x29,
+	0x00,0x00,0x45,0x31,0xc0,0x31,0xc9,0xbe,
+	0x0d,0x00,0x00,0x00,0x49,0x63,0xd4,0xbf,
+	0x23,0x00,0x00,0x00,0xe8,0x6b,0x37,0x00,
+	0x00,0x49,0x89,0xc1,0x48,0x85,0xc0,0x75,
+	0x59,0x44,0x89,0xe7,0xe8,0xbf,0x34,0x00,
+	0x00,0x4c,0x89,0xe8,0x48,0x8b,0x4c,0x24,
+	0x18,0x4c,0x09,0xf0,0x4c,0x09,0xf8,0x48,
+	0x09,0xc8,0x48,0x8b,0x4c,0x24,0x30,0x48,
+	0x09,0xc8,0x48,0x8b,0x4c,0x24,0x38,0x48,
+	0x09,0xc8,0x48,0x8b,0x4c,0x24,0x40,0x48,
+	0x09,0xc8,0x48,0x8b,0x4c,0x24,0x48,0x48,
+	0x09,0xc8,0x48,0x8b,0x4c,0x24,0x50,0x48,
+	0x09,0xc8,0x48,0x8b,0x4c,0x24,0x58,0x48,
+	0x09,0xc8,0x48,0x0b,0x44,0x24,0x60,0x0f,
+	0x84,0x67,0xee,0xff,0xff,0xe9,0x08,0xec,
+	0xff,0xff,0x48,0x89,0x44,0x24,0x68,0x48,
+	0x8d,0x2d,0xf3,0x4f,0x00,0x00,0x31,0xc0,
+	0x41,0xb8,0x0c,0x03,0x00,0x00,0xb9,0x0c,
+	0x03,0x00,0x00,0x48,0x89,0xea,0xbf,0x01,
+	0x00,0x00,0x00,0x48,0x8d,0x35,0x1e,0x5f,
+	0x00,0x00,0xe8,0x71,0x28,0x00,0x00,0x4c,
+	0x8b,0x4c,0x24,0x68,0x45,0x89,0xc8,0x45,
+	0x85,0xc9,0x0f,0x84,0x69,0xff,0xff,0xff,
+	0xb9,0x0e,0x03,0x00,0x00,0x48,0x89,0xea,
+	0xbf,0x01,0x00,0x00,0x00,0x31,0xc0,0x48,
+	0x8d,0x35,0x4a,0x5f,0x00,0x00,0xe8,0x45,
+	0x28,0x00,0x00,0x44,0x89,0xe7,0xe8,0x0d,
+	0x34,0x00,0x00,0xe9,0xa2,0xeb,0xff,0xff,
+	0x48,0x8d,0x2d,0x92,0x4f,0x00,0x00,0xb9,
+	0xb9,0x04,0x00,0x00,0x48,0x8d,0x35,0xfd,
+	0x60,0x00,0x00,0x31,0xc0,0x48,0x89,0xea,
+	0xbf,0x01,0x00,0x00,0x00,0xe8,0x16,0x28,
+	0x00,0x00,0x49,0x83,0xc8,0xff,0xb9,0x92,
+	0x07,0x00,0x00,0x48,0x89,0xea,0xbf,0x01,
+	0x00,0x00,0x00,0x31,0xc0,0x48,0x8d,0x35,
+	0x24,0x61,0x00,0x00,0xe8,0xf7,0x27,0x00,
+	0x00,0xe9,0x5c,0xeb,0xff,0xff,0x44,0x8b,
+	0x84,0x24,0x88,0x00,0x00,0x00,0x48,0x8d,
+	0x2d,0x44,0x4f,0x00,0x00,0x31,0xc0,0xb9,
+	0xb4,0x04,0x00,0x00,0x48,0x89,0xea,0x48,
+	0x8d,0x35,0x72,0x60,0x00,0x00,0xbf,0x01,
+	0x00,0x00,0x00,0xe8,0xc8,0x27,0x00,0x00,
+	0x4d,0x63,0xc5,0xeb,0xb1,0x49,0x83,0xc4,
+	0x01,0xe9,0x43,0xf9,0xff,0xff,0x31,0xed,
+	0x4c,0x8d,0xbc,0x24,0xc0,0x00,0x00,0x00,
+	0xeb,0x0d,0x48,0x83,0xc5,0x01,0x45,0x85,
+	0xc9,0x0f,0x85,0xd0,0x00,0x00,0x00,0x41,
+	0x89,0xec,0x3b,0xab,0x98,0x00,0x00,0x00,
+	0x0f,0x83,0xf9,0x00,0x00,0x00,0x4c,0x6b,
+	0xed,0x38,0x4c,0x03,0xab,0x90,0x00,0x00,
+	0x00,0x44,0x89,0xe1,0x31,0xc0,0x41,0x8b,
+	0x55,0x04,0x48,0x8d,0x35,0xd1,0x51,0x00,
+	0x00,0xbf,0x04,0x00,0x00,0x00,0xe8,0x6d,
+	0x27,0x00,0x00,0x41,0x8b,0x75,0x0c,0x40,
+	0xf6,0xc6,0x01,0x74,0x55,0x41,0x8b,0x7d,
+	0x08,0x4c,0x89,0xfe,0xe8,0xa7,0x36,0x00,
+	0x00,0x48,0x85,0xc0,0x0f,0x85,0xbd,0x0b,
+	0x00,0x00,0x48,0x8b,0x8c,0x24,0xc0,0x00,
+	0x00,0x00,0x4d,0x8b,0x4d,0x28,0xbf,0x04,
+	0x00,0x00,0x00,0x31,0xc0,0x48,0x8d,0x35,
+	0xb4,0x60,0x00,0x00,0x49,0x01,0xc9,0x4d,
+	0x89,0x4d,0x28,0x41,0x52,0x41,0xff,0x75,
+	0x30,0x4c,0x8b,0x84,0x24,0xd8,0x00,0x00,
+	0x00,0x41,0x8b,0x55,0x00,0xe8,0x16,0x27,
+	0x00,0x00,0x41,0x8b,0x75,0x0c,0x41,0x5b,
+	0x41,0x5e,0x41,0x8b,0x7d,0x04,0x31,0xc9,
+	0x49,0x8d,0x55,0x18,0xe8,0xc7,0x36,0x00,
+	0x00,0x49,0x83,0x7d,0x10,0x00,0x49,0x89,
+	0xc6,0x41,0x89,0xc1,0x0f,0x84,0x40,0xff,
+	0xff,0xff,0x41,0x8b,0x7d,0x04,0x49,0x8d,
+	0x55,0x10,0xbe,0x00,0x54,0x08,0x40,0xe8,
+	0xf4,0x32,0x00,0x00,0x45,0x89,0xf1,0x41,
+	0x09,0xc1,0xe9,0x23,0xff,0xff,0xff,0x45,
+	0x89,0xe0,0xb9,0x91,0x04,0x00,0x00,0xbf,
+	0x01,0x00,0x00,0x00,0x31,0xc0,0x48,0x8d,
+	0x2d,0x1c,0x4e,0x00,0x00,0x48,0x8d,0x35,
+	0x74,0x60,0x00,0x00,0x44,0x89,0x4c,0x24,
+	0x18,0x48,0x89,0xea,0xe8,0xa7,0x26,0x00,
+	0x00,0x4c,0x63,0x44,0x24,0x18,0x4d,0x85,
+	0xc0,0x0f,0x88,0x2e,0x0b,0x00,0x00,0xe8,
+	0x20,0x33,0x00,0x00,0x48,0x8d,0x35,0xf3,
+	0x4e,0x00,0x00,0x31,0xed,0xbf,0x03,0x00,
+	0x00,0x00,0x48,0x89,0xc2,0x31,0xc0,0x4c,
+	0x8d,0xac,0x24,0xc0,0x00,0x00,0x00,0xe8,
+	0x74,0x26,0x00,0x00,0x48,0x8b,0x05,0x35,
+	0x47,0x00,0x00,0x48,0x8d,0x78,0x0c,0xe8,
+	0x34,0xde,0xff,0xff,0x48,0x8b,0x05,0x25,
+	0x47,0x00,0x00,0xbe,0x03,0x00,0x00,0x00,
+	0x48,0x8d,0x78,0x10,0xe8,0xcf,0xdd,0xff,
+	0xff,0x48,0x8b,0x05,0x10,0x47,0x00,0x00,
+	0x8b,0x40,0x10,0xeb,0x42,0x48,0x8b,0x83,
+	0xe0,0x00,0x00,0x00,0x31,0xc9,0x31,0xd2,
+	0x4c,0x89,0xee,0x44,0x8b,0x24,0xa8,0x44,
+	0x89,0xe7,0xe8,0x51,0x33,0x00,0x00,0x48,
+	0x83,0xf8,0xf6,0x74,0x1e,0x8b,0x84,0x24,
+	0xc0,0x00,0x00,0x00,0x0f,0xb6,0xcc,0x41,
+	0x89,0xc9,0x83,0xe0,0x7f,0x0f,0x85,0x2d,
+	0x07,0x00,0x00,0x85,0xc9,0x0f,0x85,0x25,
+	0x07,0x00,0x00,0x48,0x83,0xc5,0x01,0x3b,
+	0xab,0xe8,0x00,0x00,0x00,0x72,0xb6,0x44,
+	0x8b,0x74,0x24,0x40,0x4c,0x8d,0xa4,0x24,
+	0xc0,0x00,0x00,0x00,0x4c,0x8d,0x2d,0x7d,
+	0x60,0x00,0x00,0xeb,0x31,0x48,0x8b,0x83,
+	0xf0,0x00,0x00,0x00,0x42,0x8b,0x2c,0xb8,
+	0x45,0x85,0xc9,0x0f,0x88,0x1c,0x07,0x00,
+	0x00,0xe8,0x56,0x32,0x00,0x00,0x89,0xe9,
+	0x4c,0x89,0xee,0xbf,0x04,0x00,0x00,0x00,
+	0x48,0x89,0xc2,0x31,0xc0,0xe8,0xb6,0x25,
+	0x00,0x00,0x41,0x83,0xc6,0x01,0x44,0x3b,
+	0xb3,0xf8,0x00,0x00,0x00,0x0f,0x83,0x90,
+	0x00,0x00,0x00,0x48,0x8b,0x05,0x66,0x46,
+	0x00,0x00,0x4d,0x63,0xfe,0x45,0x31,0xc0,
+	0x31,0xd2,0xb9,0x04,0x00,0x00,0x01,0xbf,
+	0x01,0x00,0x00,0x00,0x8b,0x68,0x0c,0x48,
+	0x8b,0x83,0xf0,0x00,0x00,0x00,0x42,0x8b,
+	0x34,0xb8,0xe8,0xed,0x34,0x00,0x00,0x49,
+	0x89,0xc1,0x83,0xf8,0xf6,0x75,0x8e,0x48,
+	0x8b,0x05,0x32,0x46,0x00,0x00,0x31,0xf6,
+	0x48,0xc7,0x84,0x24,0xc0,0x00,0x00,0x00,
+	0x78,0x00,0x00,0x00,0x48,0x89,0xb4,0x24,
+	0xc8,0x00,0x00,0x00,0x8b,0x50,0x0c,0x85,
+	0xd2,0x0f,0x88,0xdb,0x01,0x00,0x00,0x39,
+	0xd5,0x0f,0x85,0xd3,0x01,0x00,0x00,0x45,
+	0x31,0xc9,0x45,0x31,0xc0,0x31,0xf6,0x4c,
+	0x89,0xe1,0x48,0x8d,0x78,0x0c,0xe8,0xe1,
+	0x33,0x00,0x00,0x83,0xf8,0x92,0x74,0xb7,
+	0x83,0xf8,0xfc,0x74,0xb2,0x83,0xf8,0xf5,
+	0x74,0xad,0x85,0xc0,0x79,0xa9,0xe9,0x95,
+	0xeb,0xff,0xff,0x48,0x8b,0x74,0x24,0x08,
+	0xb9,0x08,0x00,0x00,0x00,0x31,0xd2,0xbf,
+	0x02,0x00,0x00,0x00,0x48,0xc7,0x44,0x24,
+	0x78,0xff,0xff,0xff,0xff,0xe8,0xfe,0x30,
+	0x00,0x00,0x49,0x89,0xc0,0x48,0x85,0xc0,
+	0x0f,0x85,0x79,0x05,0x00,0x00,0x48,0x89,
+	0xdf,0xe8,0x82,0xe4,0xff,0xff,0x85,0xc0,
+	0x0f,0x85,0x44,0xe8,0xff,0xff,0x80,0xbb,
+	0xec,0x03,0x00,0x00,0x00,0x0f,0x85,0xf5,
+	0x04,0x00,0x00,0x48,0x8d,0xb3,0x28,0x01,
+	0x00,0x00,0xb9,0x08,0x00,0x00,0x00,0x31,
+	0xd2,0xbf,0x11,0x00,0x00,0x00,0xe8,0xb5,
+	0x30,0x00,0x00,0x49,0x89,0xc0,0x4d,0x85,
+	0xc0,0x0f,0x85,0x2d,0x02,0x00,0x00,0x8b,
+	0xb3,0xa8,0x00,0x00,0x00,0x48,0x8b,0xbb,
+	0xa0,0x00,0x00,0x00,0xba,0x01,0x00,0x00,
+	0x00,0xe8,0x42,0xd4,0xff,0xff,0x85,0xc0,
+	0x0f,0x85,0xf4,0xe7,0xff,0xff,0x48,0x8b,
+	0x03,0x31,0xd2,0x8b,0xb0,0x78,0x01,0x00,
+	0x00,0x48,0x8b,0xb8,0x70,0x01,0x00,0x00,
+	0xe8,0x23,0xd4,0xff,0xff,0x85,0xc0,0x0f,
+	0x85,0xd5,0xe7,0xff,0xff,0x48,0x8b,0x05,
+	0x2c,0x45,0x00,0x00,0x31,0xed,0x4c,0x8d,
+	0x2d,0x63,0x60,0x00,0x00,0x4c,0x8d,0x35,
+	0xcb,0x4e,0x00,0x00,0x4c,0x8d,0x3d,0x85,
+	0x60,0x00,0x00,0x48,0x8d,0x78,0x0c,0xe8,
+	0x14,0xdc,0xff,0xff,0x48,0x8b,0x05,0x05,
+	0x45,0x00,0x00,0xbe,0x04,0x00,0x00,0x00,
+	0x48,0x8d,0x78,0x10,0xe8,0xaf,0xdb,0xff,
+	0xff,0x48,0x8b,0x05,0xf0,0x44,0x00,0x00,
+	0x8b,0x40,0x10,0xeb,0x30,0x41,0x8b,0x3c,
+	0x24,0x41,0xb8,0x04,0x00,0x00,0x00,0xba,
+	0x02,0x00,0x00,0x00,0x48,0x8d,0x8c,0x24,
+	0x88,0x00,0x00,0x00,0xbe,0x01,0x00,0x00,
+	0x00,0xe8,0xfa,0x30,0x00,0x00,0x49,0x89,
+	0xc0,0x85,0xc0,0x0f,0x88,0x92,0x00,0x00,
+	0x00,0x48,0x83,0xc5,0x01,0x3b,0xab,0xb8,
+	0x00,0x00,0x00,0x0f,0x83,0xa6,0x00,0x00,
+	0x00,0x48,0x8b,0x83,0xb0,0x00,0x00,0x00,
+	0x4c,0x89,0xee,0xbf,0x04,0x00,0x00,0x00,
+	0x4c,0x8d,0x24,0xe8,0x31,0xc0,0x41,0x0f,
+	0xb6,0x4c,0x24,0x04,0x89,0x8c,0x24,0x88,
+	0x00,0x00,0x00,0x41,0x8b,0x14,0x24,0xe8,
+	0xbc,0x23,0x00,0x00,0x31,0xc9,0x41,0x8b,
+	0x3c,0x24,0xba,0x13,0x00,0x00,0x00,0x89,
+	0x8c,0x24,0xc0,0x00,0x00,0x00,0x41,0xb8,
+	0x04,0x00,0x00,0x00,0x48,0x8d,0x8c,0x24,
+	0xc0,0x00,0x00,0x00,0xbe,0x06,0x00,0x00,
+	0x00,0xe8,0x8a,0x30,0x00,0x00,0x85,0xc0,
+	0x0f,0x89,0x67,0xff,0xff,0xff,0xb9,0x4f,
+	0x00,0x00,0x00,0x4c,0x89,0xf2,0x4c,0x89,
+	0xfe,0xbf,0x01,0x00,0x00,0x00,0x31,0xc0,
+	0xe8,0x73,0x23,0x00,0x00,0xe9,0x4b,0xff,
+	0xff,0xff,0x41,0x83,0xee,0x01,0xe9,0xaf,
+	0xfd,0xff,0xff,0xb9,0xe8,0x03,0x00,0x00,
+	0x48,0x8d,0x15,0xba,0x4a,0x00,0x00,0x48,
+	0x8d,0x35,0xca,0x5f,0x00,0x00,0x31,0xc0,
+	0xbf,0x01,0x00,0x00,0x00,0xe8,0x46,0x23,
+	0x00,0x00,0xe9,0x4a,0xff,0xff,0xff,0x48,
+	0x8b,0x3b,0xe8,0xe9,0xd3,0xff,0xff,0x85,
+	0xc0,0x0f,0x85,0x9b,0xe6,0xff,0xff,0x48,
+	0x8b,0x03,0x8b,0x8b,0x48,0x05,0x00,0x00,
+	0x8b,0x93,0x2c,0x05,0x00,0x00,0x8b,0xb3,
+	0xe4,0x03,0x00,0x00,0x48,0x8b,0xb8,0x80,
+	0x01,0x00,0x00,0xe8,0x00,0xd7,0xff,0xff,
+	0x85,0xc0,0x0f,0x84,0xb0,0x00,0x00,0x00,
+	0x8b,0x43,0x30,0x45,0x31,0xc9,0x45,0x31,
+	0xc0,0x31,0xc9,0xba,0xff,0xff,0xff,0x7f,
+	0xbe,0x01,0x00,0x00,0x00,0x48,0x8d,0x3d,
+	0xac,0x43,0x00,0x00,0x89,0x05,0xa6,0x43,
+	0x00,0x00,0xe8,0x95,0x31,0x00,0x00,0x48,
+	0x85,0xc0,0x0f,0x88,0x58,0xe9,0xff,0xff,
+	0x48,0x8b,0x05,0x99,0x43,0x00,0x00,0x48,
+	0x8d,0x78,0x0c,0xe8,0x98,0xda,0xff,0xff,
+	0x48,0x8b,0x05,0x89,0x43,0x00,0x00,0xbe,
+	0x05,0x00,0x00,0x00,0x48,0x8d,0x78,0x10,
+	0xe8,0x33,0xda,0xff,0xff,0x41,0xb9,0xe2,
+	0x07,0x00,0x00,0xb9,0xe2,0x07,0x00,0x00,
+	0x48,0x8b,0x05,0x69,0x43,0x00,0x00,0x4c,
+	0x8d,0x05,0xfb,0x49,0x00,0x00,0x48,0x8d,
+	0x35,0x08,0x4b,0x00,0x00,0xbf,0x01,0x00,
+	0x00,0x00,0x8b,0x40,0x10,0x4c,0x89,0xc2,
+	0x31,0xc0,0xe8,0x81,0x22,0x00,0x00,0xe9,
+	0xfc,0xe8,0xff,0xff,0xb9,0xbc,0x07,0x00,
+	0x00,0x48,0x8d,0x15,0xd1,0x49,0x00,0x00,
+	0x48,0x8d,0x35,0x41,0x5e,0x00,0x00,0x31,
+	0xc0,0xbf,0x01,0x00,0x00,0x00,0xe8,0x5d,
+	0x22,0x00,0x00,0xe9,0xc2,0xe5,0xff,0xff,
+	0x48,0x8d,0xbb,0xb8,0x01,0x00,0x00,0xe8,
+	0x4c,0xcf,0xff,0xff,0x85,0xc0,0x0f,0x85,
+	0x3c,0xff,0xff,0xff,0x48,0x8b,0x2b,0x8b,
+	0x85,0x7c,0x01,0x00,0x00,0x85,0xc0,0x74,
+	0x1f,0x48,0x63,0xf0,0x45,0x31,0xc0,0x31,
+	0xc9,0x31,0xd2,0xbf,0x01,0x00,0x00,0x00,
+	0xe8,0x8f,0x30,0x00,0x00,0x49,0x89,0xc1,
+	0x85,0xc0,0x0f,0x85,0xe1,0x00,0x00,0x00,
+	0x8b,0xab,0x30,0x05,0x00,0x00,0x85,0xed,
+	0x74,0x1f,0x48,0x63,0xf5,0x45,0x31,0xc0,
+	0x31,0xc9,0x31,0xd2,0xbf,0x24,0x00,0x00,
+	0x00,0xe8,0x66,0x30,0x00,0x00,0x49,0x89,
+	0xc1,0x85,0xc0,0x0f,0x85,0xe3,0x00,0x00,
+	0x00,0x8b,0x43,0x30,0x48,0x8d,0x2d,0xa5,
+	0x42,0x00,0x00,0x45,0x31,0xc9,0x45,0x31,
+	0xc0,0x31,0xc9,0xba,0xff,0xff,0xff,0x7f,
+	0xbe,0x01,0x00,0x00,0x00,0x48,0x89,0xef,
+	0x89,0x05,0x8a,0x42,0x00,0x00,0xe8,0x79,
+	0x30,0x00,0x00,0x48,0x85,0xc0,0x0f,0x88,
+	0x3c,0xe8,0xff,0xff,0x48,0x8b,0x05,0x7d,
+	0x42,0x00,0x00,0x4c,0x8d,0xa4,0x24,0xc0,
+	0x00,0x00,0x00,0x48,0x8d,0x78,0x0c,0xe8,
+	0x74,0xd9,0xff,0xff,0x48,0x8b,0x05,0x65,
+	0x42,0x00,0x00,0xbe,0x05,0x00,0x00,0x00,
+	0x48,0x8d,0x78,0x10,0xe8,0x0f,0xd9,0xff,
+	0xff,0x48,0x8b,0x05,0x50,0x42,0x00,0x00,
+	0x8b,0x40,0x10,0x48,0xc7,0x84,0x24,0xc0,
+	0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x31,
+	0xd2,0x48,0x89,0x94,0x24,0xc8,0x00,0x00,
+	0x00,0x8b,0x55,0x00,0x8d,0x42,0xfe,0x3d,
+	0xfd,0xff,0xff,0x7f,0x77,0x7d,0x45,0x31,
+	0xc9,0x45,0x31,0xc0,0x31,0xf6,0x4c,0x89,
+	0xe1,0x48,0x89,0xef,0xe8,0x03,0x30,0x00,
+	0x00,0x83,0xf8,0x92,0x74,0xc5,0x83,0xf8,
+	0xfc,0x74,0xc0,0x83,0xf8,0xf5,0x74,0xbb,
+	0x85,0xc0,0x79,0xb7,0xe9,0xb7,0xe7,0xff,
+	0xff,0x44,0x8b,0x85,0x7c,0x01,0x00,0x00,
+	0xb9,0x59,0x01,0x00,0x00,0x31,0xc0,0x48,
+	0x8d,0x15,0x83,0x48,0x00,0x00,0x48,0x8d,
+	0x35,0xfb,0x52,0x00,0x00,0xbf,0x01,0x00,
+	0x00,0x00,0xe8,0x11,0x21,0x00,0x00,0xe9,
+	0x04,0xfe,0xff,0xff,0x41,0x89,0xe8,0xb9,
+	0x6b,0x05,0x00,0x00,0xbf,0x01,0x00,0x00,
+	0x00,0x31,0xc0,0x48,0x8d,0x15,0x57,0x48,
+	0x00,0x00,0x48,0x8d,0x35,0xaf,0x5d,0x00,
+	0x00,0xe8,0xea,0x20,0x00,0x00,0xe9,0xdd,
+	0xfd,0xff,0xff,0x8b,0xbb,0xe4,0x03,0x00,
+	0x00,0xe8,0xaa,0x2c,0x00,0x00,0x83,0xcf,
+	0xff,0xe8,0x72,0x1a,0x00,0x00,0x48,0x83,
+	0xbb,0x58,0x01,0x00,0x00,0x00,0x75,0x0a,
+	0x48,0x83,0xbb,0x60,0x01,0x00,0x00,0x00,
+	0x74,0x10,0x48,0x8d,0xb3,0x58,0x01,0x00,
+	0x00,0x31,0xd2,0x31,0xff,0xe8,0x2e,0x2d,
+	0x00,0x00,0x48,0x83,0xbb,0x78,0x01,0x00,
+	0x00,0x00,0x75,0x0a,0x48,0x83,0xbb,0x80,
+	0x01,0x00,0x00,0x00,0x74,0x13,0x48,0x8d,
+	0xb3,0x78,0x01,0x00,0x00,0x31,0xd2,0xbf,
+	0x01,0x00,0x00,0x00,0xe8,0x07,0x2d,0x00,
+	0x00,0x48,0x83,0xbb,0x98,0x01,0x00,0x00,
+	0x00,0x0f,0x85,0xed,0x01,0x00,0x00,0x48,
+	0x83,0xbb,0xa0,0x01,0x00,0x00,0x00,0x0f,
+	0x85,0xdf,0x01,0x00,0x00,0x48,0x8b,0x6c,
+	0x24,0x28,0xeb,0x1e,0x48,0x6b,0xc5,0x48,
+	0x48,0x03,0x83,0x80,0x00,0x00,0x00,0x31,
+	0xc9,0x31,0xf6,0x8b,0x38,0x48,0x8d,0x50,
+	0x20,0x48,0x83,0xc5,0x01,0xe8,0x66,0x2f,
+	0x00,0x00,0x3b,0xab,0x88,0x00,0x00,0x00,
+	0x72,0xda,0x48,0x8b,0x7c,0x24,0x20,0xe8,
+	0x54,0x06,0x00,0x00,0x48,0x89,0xc1,0x48,
+	0x85,0xc0,0x0f,0x88,0x92,0xe3,0xff,0xff,
+	0x8b,0x54,0x24,0x14,0x31,0xc0,0xbf,0x04,
+	0x00,0x00,0x00,0x48,0x8d,0x35,0x16,0x5d,
+	0x00,0x00,0xe8,0x11,0x20,0x00,0x00,0x48,
+	0x8b,0x73,0x58,0x48,0x8b,0x7b,0x50,0xe8,
+	0xf4,0x2b,0x00,0x00,0x48,0x8b,0x4c,0x24,
+	0x38,0x80,0xb9,0xc0,0xb7,0x00,0x00,0x01,
+	0x48,0x8d,0xb1,0x80,0x80,0x00,0x00,0x48,
+	0x19,0xc0,0x48,0x83,0xe0,0xfc,0x48,0x8d,
+	0xbc,0x01,0x88,0x80,0x00,0x00,0xe8,0x9d,
+	0xcc,0xff,0xff,0xe9,0x42,0xe3,0xff,0xff,
+	0x45,0x31,0xc9,0x49,0x83,0xc8,0xff,0xb9,
+	0x62,0x00,0x00,0x00,0x31,0xff,0xba,0x03,
+	0x00,0x00,0x00,0xbe,0x00,0x10,0x00,0x00,
+	0xe8,0x9b,0x2b,0x00,0x00,0x49,0x89,0xc4,
+	0xa9,0xff,0x0f,0x00,0x00,0x0f,0x85,0x84,
+	0x00,0x00,0x00,0x48,0x85,0xc0,0x0f,0x84,
+	0xa0,0x00,0x00,0x00,0x48,0x8d,0x93,0x28,
+	0x01,0x00,0x00,0xbe,0x11,0x00,0x00,0x00,
+	0x48,0x89,0xc7,0xe8,0xc0,0xcb,0xff,0xff,
+	0xbe,0x00,0x10,0x00,0x00,0x4c,0x89,0xe7,
+	0x89,0xc5,0xe8,0x71,0x2b,0x00,0x00,0x49,
+	0x89,0xc1,0x48,0x85,0xc0,0x75,0x2c,0x4c,
+	0x63,0xc5,0xe9,0xbf,0xfa,0xff,0xff,0xb9,
+	0xa8,0x07,0x00,0x00,0x48,0x8d,0x15,0xc6,
+	0x46,0x00,0x00,0x48,0x8d,0x35,0x1e,0x5a,
+	0x00,0x00,0x31,0xc0,0xbf,0x01,0x00,0x00,
+	0x00,0xe8,0x52,0x1f,0x00,0x00,0xe9,0xb7,
+	0xe2,0xff,0xff,0x4d,0x89,0xe0,0xb9,0x21,
+	0x00,0x00,0x00,0xbf,0x01,0x00,0x00,0x00,
+	0x31,0xc0,0x48,0x8d,0x15,0x27,0x5a,0x00,
+	0x00,0x48,0x8d,0x35,0xc8,0x5a,0x00,0x00,
+	0xe8,0x2b,0x1f,0x00,0x00,0xeb,0xb0,0x41,
+	0x89,0xc0,0xb9,0x16,0x00,0x00,0x00,0x31,
+	0xc0,0xbf,0x01,0x00,0x00,0x00,0x41,0xf7,
+	0xd8,0x48,0x8d,0x15,0x00,0x5a,0x00,0x00,
+	0x48,0x8d,0x35,0x21,0x5a,0x00,0x00,0xe8,
+	0x04,0x1f,0x00,0x00,0xb9,0xb5,0x07,0x00,
+	0x00,0x48,0x8d,0x15,0x59,0x46,0x00,0x00,
+	0x48,0x8d,0x35,0x49,0x5a,0x00,0x00,0x31,
+	0xc0,0xbf,0x01,0x00,0x00,0x00,0xe8,0xe5,
+	0x1e,0x00,0x00,0xe9,0x4a,0xe2,0xff,0xff,
+	0x57,0x45,0x89,0xe0,0xb9,0x1c,0x05,0x00,
+	0x00,0x48,0x8d,0x15,0x31,0x46,0x00,0x00,
+	0x50,0x48,0x8d,0x35,0xf8,0x58,0x00,0x00,
+	0xbf,0x01,0x00,0x00,0x00,0x31,0xc0,0xe8,
+	0xbc,0x1e,0x00,0x00,0x41,0x58,0x41,0x59,
+	0xe9,0x1d,0xe2,0xff,0xff,0x41,0x89,0xe8,
+	0xb9,0x38,0x05,0x00,0x00,0xbf,0x01,0x00,
+	0x00,0x00,0x31,0xc0,0x48,0x8d,0x15,0xfe,
+	0x45,0x00,0x00,0x48,0x8d,0x35,0xfe,0x58,
+	0x00,0x00,0xe8,0x91,0x1e,0x00,0x00,0xe9,
+	0xf6,0xe1,0xff,0xff,0x48,0x8d,0xb3,0x98,
+	0x01,0x00,0x00,0x31,0xd2,0xbf,0x02,0x00,
+	0x00,0x00,0xe8,0xf9,0x2a,0x00,0x00,0x48,
+	0x8b,0x6c,0x24,0x28,0xe9,0x29,0xfe,0xff,
+	0xff,0x49,0x89,0xc1,0x41,0xb8,0xfe,0x06,
+	0x00,0x00,0x31,0xc0,0xb9,0xfe,0x06,0x00,
+	0x00,0x48,0x8d,0x15,0xb9,0x45,0x00,0x00,
+	0x48,0x8d,0x35,0xf9,0x54,0x00,0x00,0xbf,
+	0x01,0x00,0x00,0x00,0xe8,0x47,0x1e,0x00,
+	0x00,0xe9,0x21,0xf4,0xff,0xff,0x49,0x89,
+	0xc1,0x41,0xb8,0xfd,0x06,0x00,0x00,0x31,
+	0xc0,0xb9,0xfd,0x06,0x00,0x00,0x48,0x8d,
+	0x15,0x8c,0x45,0x00,0x00,0x48,0x8d,0x35,
+	0xcc,0x54,0x00,0x00,0xbf,0x01,0x00,0x00,
+	0x00,0xe8,0x1a,0x1e,0x00,0x00,0xe9,0xcb,
+	0xf3,0xff,0xff,0x49,0x89,0xc1,0x41,0xb8,
+	0xfc,0x06,0x00,0x00,0x31,0xc0,0xb9,0xfc,
+	0x06,0x00,0x00,0x48,0x8d,0x15,0x5f,0x45,
+	0x00,0x00,0x48,0x8d,0x35,0x9f,0x54,0x00,
+	0x00,0xbf,0x01,0x00,0x00,0x00,0xe8,0xed,
+	0x1d,0x00,0x00,0xe9,0x75,0xf3,0xff,0xff,
+	0x49,0x89,0xc1,0x41,0xb8,0xfb,0x06,0x00,
+	0x00,0x31,0xc0,0xb9,0xfb,0x06,0x00,0x00,
+	0x48,0x8d,0x15,0x32,0x45,0x00,0x00,0x48,
+	0x8d,0x35,0x72,0x54,0x00,0x00,0xbf,0x01,
+	0x00,0x00,0x00,0xe8,0xc0,0x1d,0x00,0x00,
+	0xe9,0x1f,0xf3,0xff,0xff,0x49,0x89,0xc1,
+	0x41,0xb8,0xfa,0x06,0x00,0x00,0x31,0xc0,
+	0xb9,0xfa,0x06,0x00,0x00,0x48,0x8d,0x15,
+	0x05,0x45,0x00,0x00,0x48,0x8d,0x35,0x45,
+	0x54,0x00,0x00,0xbf,0x01,0x00,0x00,0x00,
+	0xe8,0x93,0x1d,0x00,0x00,0xe9,0xcb,0xf2,
+	0xff,0xff,0x49,0x89,0xc1,0x41,0xb8,0xf9,
+	0x06,0x00,0x00,0x31,0xc0,0xb9,0xf9,0x06,
+	0x00,0x00,0x48,0x8d,0x15,0xd8,0x44,0x00,
+	0x00,0x48,0x8d,0x35,0x18,0x54,0x00,0x00,
+	0xbf,0x01,0x00,0x00,0x00,0xe8,0x66,0x1d,
+	0x00,0x00,0xe9,0x77,0xf2,0xff,0xff,0xb9,
+	0x48,0x07,0x00,0x00,0x48,0x8d,0x15,0xb6,
+	0x44,0x00,0x00,0x48,0x8d,0x35,0xc6,0x54,
+	0x00,0x00,0x31,0xc0,0xbf,0x01,0x00,0x00,
+	0x00,0xe8,0x42,0x1d,0x00,0x00,0xe9,0xa7,
+	0xe0,0xff,0xff,0xb9,0x6a,0x07,0x00,0x00,
+	0xbf,0x01,0x00,0x00,0x00,0x31,0xc0,0x8b,
+	0x6c,0x24,0x18,0x4c,0x8b,0x8c,0x24,0x88,
+	0x00,0x00,0x00,0x48,0x8d,0x15,0x7f,0x44,
+	0x00,0x00,0x48,0x8d,0x35,0xe7,0x54,0x00,
+	0x00,0xe8,0x12,0x1d,0x00,0x00,0xe9,0xe0,
+	0xf1,0xff,0xff,0x49,0x89,0xc1,0x41,0xb8,
+	0x02,0x07,0x00,0x00,0x31,0xc0,0xb9,0x02,
+	0x07,0x00,0x00,0x48,0x8d,0x15,0x57,0x44,
+	0x00,0x00,0x48,0x8d,0x35,0x97,0x53,0x00,
+	0x00,0xbf,0x01,0x00,0x00,0x00,0xe8,0xe5,
+	0x1c,0x00,0x00,0xe9,0x63,0xf3,0xff,0xff,
+	0x49,0x89,0xc1,0x41,0xb8,0x01,0x07,0x00,
+	0x00,0x31,0xc0,0xb9,0x01,0x07,0x00,0x00,
+	0x48,0x8d,0x15,0x2a,0x44,0x00,0x00,0x48,
+	0x8d,0x35,0x6a,0x53,0x00,0x00,0xbf,0x01,
+	0x00,0x00,0x00,0xe8,0xb8,0x1c,0x00,0x00,
+	0xe9,0x0d,0xf3,0xff,0xff,0x49,0x89,0xc1,
+	0x41,0xb8,0x00,0x07,0x00,0x00,0x31,0xc0,
+	0xb9,0x00,0x07,0x00,0x00,0x48,0x8d,0x15,
+	0xfd,0x43,0x00,0x00,0x48,0x8d,0x35,0x3d,
+	0x53,0x00,0x00,0xbf,0x01,0x00,0x00,0x00,
+	0xe8,0x8b,0x1c,0x00,0x00,0xe9,0xb7,0xf2,
+	0xff,0xff,0x49,0x89,0xc1,0x41,0xb8,0xff,
+	0x06,0x00,0x00,0x31,0xc0,0xb9,0xff,0x06,
+	0x00,0x00,0x48,0x8d,0x15,0xd0,0x43,0x00,
+	0x00,0x48,0x8d,0x35,0x10,0x53,0x00,0x00,
+	0xbf,0x01,0x00,0x00,0x00,0xe8,0x5e,0x1c,
+	0x00,0x00,0xe9,0x61,0xf2,0xff,0xff,0x48,
+	0x8d,0x2d,0xb3,0x43,0x00,0x00,0x4c,0x8d,
+	0x2d,0xf3,0x52,0x00,0x00,0x41,0xb8,0x04,
+	0x07,0x00,0x00,0x31,0xc0,0xb9,0x04,0x07,
+	0x00,0x00,0x48,0x89,0xea,0x4c,0x89,0xee,
+	0xbf,0x01,0x00,0x00,0x00,0xe8,0x2e,0x1c,
+	0x00,0x00,0x44,0x8b,0x63,0x08,0xbf,0x03,
+	0x00,0x00,0x00,0x31,0xc0,0x48,0x8d,0x35,
+	0x4b,0x46,0x00,0x00,0xe8,0x17,0x1c,0x00,
+	0x00,0x49,0x63,0xd4,0x45,0x31,0xc0,0x31,
+	0xc9,0xbe,0x0d,0x00,0x00,0x00,0xbf,0x23,
+	0x00,0x00,0x00,0xe8,0x6c,0x2a,0x00,0x00,
+	0x48,0x89,0xc3,0x48,0x85,0xc0,0x75,0x3a,
+	0x44,0x89,0xe7,0xe8,0xc0,0x27,0x00,0x00,
+	0xe9,0x55,0xdf,0xff,0xff,0x49,0x89,0xc1,
+	0x41,0xb8,0x03,0x07,0x00,0x00,0x31,0xc0,
+	0xb9,0x03,0x07,0x00,0x00,0x48,0x8d,0x15,
+	0x35,0x43,0x00,0x00,0x48,0x8d,0x35,0x75,
+	0x52,0x00,0x00,0xbf,0x01,0x00,0x00,0x00,
+	0xe8,0xc3,0x1b,0x00,0x00,0xe9,0x6a,0xf2,
+	0xff,0xff,0x49,0x89,0xc1,0x41,0xb8,0x0c,
+	0x03,0x00,0x00,0xb9,0x0c,0x03,0x00,0x00,
+	0x31,0xc0,0x48,0x89,0xea,0x4c,0x89,0xee,
+	0xbf,0x01,0x00,0x00,0x00,0xe8,0x9e,0x1b,
+	0x00,0x00,0x41,0x89,0xd8,0x85,0xdb,0x0f,
+	0x85,0x33,0xf3,0xff,0xff,0xeb,0x99,0x48,
+	0x8d,0x2d,0xeb,0x42,0x00,0x00,0xb9,0x81,
+	0x04,0x00,0x00,0x48,0x8d,0x35,0xd6,0x54,
+	0x00,0x00,0x31,0xc0,0x48,0x89,0xea,0xbf,
+	0x01,0x00,0x00,0x00,0xe8,0x6f,0x1b,0x00,
+	0x00,0x49,0x83,0xc8,0xff,0xb9,0x98,0x07,
+	0x00,0x00,0x48,0x89,0xea,0xbf,0x01,0x00,
+	0x00,0x00,0x31,0xc0,0x48,0x8d,0x35,0x55,
+	0x55,0x00,0x00,0xe8,0x50,0x1b,0x00,0x00,
+	0xe9,0xb5,0xde,0xff,0xff,0x66,0x66,0x2e,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0x53,0x48,0x8d,0x1d,0x99,0x42,0x00,0x00,
+	0xe8,0xbf,0x27,0x00,0x00,0x48,0x89,0xda,
+	0xb9,0x1b,0x08,0x00,0x00,0x48,0x8d,0x35,
+	0x94,0x58,0x00,0x00,0x49,0x89,0xc0,0xbf,
+	0x01,0x00,0x00,0x00,0x31,0xc0,0xe8,0x15,
+	0x1b,0x00,0x00,0xbf,0x01,0x00,0x00,0x00,
+	0xe8,0x67,0x2a,0x00,0x00,0x41,0xb9,0x1d,
+	0x08,0x00,0x00,0x49,0x89,0xd8,0x31,0xc0,
+	0xb9,0x1d,0x08,0x00,0x00,0x48,0x89,0xda,
+	0xbf,0x01,0x00,0x00,0x00,0x48,0x8d,0x35,
+	0x61,0x43,0x00,0x00,0xe8,0xe7,0x1a,0x00,
+	0x00,0x48,0xc7,0x04,0x25,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x0f,0x0b,0x66,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0x48,0x83,0xec,0x18,0x89,0x54,0x24,0x08,
+	0x48,0x8d,0x54,0x24,0x08,0x89,0x74,0x24,
+	0x0c,0xbe,0x05,0x1c,0x08,0x40,0xe8,0xcd,
+	0x26,0x00,0x00,0x48,0x83,0xc4,0x18,0xc3,
+	0x41,0x54,0x31,0xd2,0xbe,0x00,0x00,0x01,
+	0x00,0x55,0x53,0x48,0x89,0xfb,0xe8,0x65,
+	0x26,0x00,0x00,0x48,0x89,0xc5,0x41,0x89,
+	0xc4,0x85,0xc0,0x78,0x2b,0xbe,0x02,0x00,
+	0x00,0x00,0x48,0x89,0xdf,0xe8,0x22,0x29,
+	0x00,0x00,0x85,0xc0,0x75,0x42,0x48,0x89,
+	0xdf,0xe8,0xde,0x27,0x00,0x00,0x85,0xc0,
+	0x75,0x6f,0x44,0x89,0xe0,0x5b,0x5d,0x41,
+	0x5c,0xc3,0x66,0x0f,0x1f,0x44,0x00,0x00,
+	0x41,0x89,0xc1,0x49,0x89,0xd8,0xb9,0x23,
+	0x00,0x00,0x00,0xbf,0x01,0x00,0x00,0x00,
+	0x48,0x8d,0x15,0xf9,0x57,0x00,0x00,0x48,
+	0x8d,0x35,0x02,0x58,0x00,0x00,0x31,0xc0,
+	0xe8,0x43,0x1a,0x00,0x00,0xeb,0xae,0x90,
+	0x41,0x89,0xc1,0x49,0x89,0xd8,0xb9,0x27,
+	0x00,0x00,0x00,0xbf,0x01,0x00,0x00,0x00,
+	0x48,0x8d,0x15,0xd1,0x57,0x00,0x00,0x48,
+	0x8d,0x35,0x0a,0x58,0x00,0x00,0x31,0xc0,
+	0xe8,0x1b,0x1a,0x00,0x00,0x85,0xed,0x78,
+	0x08,0x44,0x89,0xe7,0xe8,0xdf,0x25,0x00,
+	0x00,0x41,0xbc,0xff,0xff,0xff,0xff,0xeb,
+	0x91,0x41,0x89,0xc1,0x49,0x89,0xd8,0xb9,
+	0x2d,0x00,0x00,0x00,0xbf,0x01,0x00,0x00,
+	0x00,0x48,0x8d,0x15,0x98,0x57,0x00,0x00,
+	0x48,0x8d,0x35,0x01,0x58,0x00,0x00,0x31,
+	0xc0,0xe8,0xe2,0x19,0x00,0x00,0xeb,0xc5,
+	0x53,0x31,0xf6,0x48,0x89,0xfb,0x48,0x83,
+	0xec,0x10,0x48,0x89,0xe7,0xe8,0x56,0x27,
+	0x00,0x00,0x85,0xc0,0x75,0x21,0x48,0x69,
+	0x04,0x24,0x40,0x42,0x0f,0x00,0x48,0x03,
+	0x44,0x24,0x08,0x48,0x69,0x13,0x40,0x42,
+	0x0f,0x00,0x48,0x03,0x53,0x08,0x48,0x29,
+	0xd0,0x48,0x83,0xc4,0x10,0x5b,0xc3,0x31,
+	0xc0,0xb9,0x41,0x00,0x00,0x00,0x48,0x8d,
+	0x15,0x43,0x57,0x00,0x00,0xbf,0x01,0x00,
+	0x00,0x00,0x48,0x8d,0x35,0xd7,0x57,0x00,
+	0x00,0xe8,0x8a,0x19,0x00,0x00,0x48,0xc7,
+	0xc0,0xff,0xff,0xff,0xff,0xeb,0xd2,0x90,
+	0x41,0x57,0x31,0xc0,0x41,0x56,0x41,0x55,
+	0x41,0x54,0x4c,0x8d,0x24,0x3e,0x48,0x8d,
+	0x35,0xda,0x57,0x00,0x00,0x55,0x4c,0x89,
+	0xe1,0x48,0x89,0xfd,0x53,0x48,0x81,0xec,
+	0x88,0x00,0x00,0x00,0x48,0x89,0x54,0x24,
+	0x28,0x48,0x89,0xfa,0xbf,0x04,0x00,0x00,
+	0x00,0xe8,0x4a,0x19,0x00,0x00,0x48,0x89,
+	0xe8,0x48,0x83,0xc0,0x3f,0x0f,0x92,0xc2,
+	0x4c,0x39,0xe0,0x0f,0x83,0x57,0x06,0x00,
+	0x00,0x0f,0xb6,0xd2,0x48,0x85,0xd2,0x0f,
+	0x85,0x4b,0x06,0x00,0x00,0xba,0x10,0x00,
+	0x00,0x00,0x48,0x8d,0x35,0xcf,0x5a,0x00,
+	0x00,0x48,0x89,0xef,0xe8,0xd7,0x23,0x00,
+	0x00,0x89,0x44,0x24,0x4c,0x85,0xc0,0x0f,
+	0x85,0x76,0x06,0x00,0x00,0x31,0xd2,0x48,
+	0x89,0xe8,0x48,0x03,0x45,0x20,0x0f,0x92,
+	0xc2,0x4c,0x39,0xe0,0x0f,0x83,0x16,0x06,
+	0x00,0x00,0x48,0x85,0xd2,0x0f,0x85,0x0d,
+	0x06,0x00,0x00,0x0f,0xb7,0x55,0x38,0x66,
+	0x85,0xd2,0x0f,0x84,0x08,0x07,0x00,0x00,
+	0x48,0x8d,0x48,0x37,0x4c,0x39,0xe1,0x0f,
+	0x83,0xf3,0x05,0x00,0x00,0x48,0x39,0xe9,
+	0x0f,0x82,0xea,0x05,0x00,0x00,0x8d,0x4a,
+	0xff,0x48,0x83,0xc0,0x6f,0x45,0x31,0xed,
+	0x45,0x31,0xff,0x48,0x8d,0x14,0xcd,0x00,
+	0x00,0x00,0x00,0x48,0x29,0xca,0x48,0x8d,
+	0x34,0xd0,0xeb,0x32,0x0f,0x1f,0x40,0x00,
+	0x83,0xfa,0x02,0x75,0x0c,0x4d,0x85,0xff,
+	0x0f,0x85,0x31,0x06,0x00,0x00,0x49,0x89,
+	0xcf,0x48,0x39,0xc6,0x74,0x35,0x4c,0x39,
+	0xe0,0x0f,0x93,0xc2,0x48,0x39,0xe8,0x0f,
+	0x92,0xc1,0x48,0x83,0xc0,0x38,0x08,0xca,
+	0x0f,0x85,0x9a,0x05,0x00,0x00,0x8b,0x50,
+	0x91,0x48,0x8d,0x48,0x91,0x83,0xfa,0x01,
+	0x75,0xc6,0x4d,0x85,0xed,0x0f,0x85,0x1d,
+	0x06,0x00,0x00,0x49,0x89,0xcd,0x48,0x39,
+	0xc6,0x75,0xcb,0x4d,0x85,0xff,0x0f,0x84,
+	0x7c,0x06,0x00,0x00,0x4d,0x85,0xed,0x0f,
+	0x84,0x73,0x06,0x00,0x00,0x49,0x8b,0x55,
+	0x10,0x31,0xc0,0x48,0x8d,0x35,0xdc,0x56,
+	0x00,0x00,0x48,0x89,0xeb,0xbf,0x04,0x00,
+	0x00,0x00,0xe8,0x31,0x18,0x00,0x00,0x31,
+	0xc0,0x49,0x03,0x5f,0x08,0x0f,0x92,0xc0,
+	0x4c,0x39,0xe3,0x0f,0x83,0xfd,0x00,0x00,
+	0x00,0x48,0x85,0xc0,0x0f,0x85,0xf4,0x00,
+	0x00,0x00,0x49,0x8b,0x57,0x20,0x48,0x89,
+	0xd0,0x48,0xc1,0xe8,0x04,0x0f,0x84,0x09,
+	0x06,0x00,0x00,0x48,0x8d,0x43,0x0f,0x48,
+	0x39,0xe8,0x0f,0x82,0xd6,0x00,0x00,0x00,
+	0x4c,0x39,0xe0,0x0f,0x83,0xcd,0x00,0x00,
+	0x00,0x31,0xf6,0x45,0x31,0xdb,0x31,0xff,
+	0x45,0x31,0xc9,0x45,0x31,0xc0,0x4c,0x89,
+	0x0c,0x24,0x48,0x83,0xc3,0x1f,0x41,0xbe,
+	0x01,0x00,0x00,0x00,0x4c,0x89,0x44,0x24,
+	0x08,0x48,0x8d,0x0d,0x58,0x59,0x00,0x00,
+	0x48,0x89,0x74,0x24,0x10,0x48,0x89,0x7c,
+	0x24,0x18,0x4c,0x89,0x5c,0x24,0x20,0x4c,
+	0x89,0x6c,0x24,0x30,0x49,0x89,0xdd,0x4c,
+	0x89,0xf3,0x66,0x0f,0x1f,0x44,0x00,0x00,
+	0x49,0x8b,0x45,0xe1,0x4d,0x8d,0x75,0xe1,
+	0x48,0x85,0xc0,0x0f,0x84,0xf7,0x00,0x00,
+	0x00,0x48,0x83,0xe8,0x04,0x48,0x83,0xf8,
+	0x07,0x77,0x3d,0x48,0x63,0x04,0x81,0x48,
+	0x01,0xc8,0xff,0xe0,0x0f,0x1f,0x40,0x00,
+	0x49,0x8b,0x56,0x08,0x48,0x8d,0x35,0x2f,
+	0x56,0x00,0x00,0xbf,0x04,0x00,0x00,0x00,
+	0x31,0xc0,0xe8,0x69,0x17,0x00,0x00,0x4c,
+	0x89,0x74,0x24,0x18,0x49,0x8b,0x57,0x20,
+	0x48,0x8d,0x0d,0xe9,0x58,0x00,0x00,0x66,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0x48,0x89,0xd0,0x48,0xc1,0xe8,0x04,0x48,
+	0x39,0xc3,0x0f,0x83,0xa0,0x00,0x00,0x00,
+	0x4d,0x39,0xe5,0x0f,0x93,0xc0,0x49,0x39,
+	0xed,0x40,0x0f,0x92,0xc6,0x49,0x83,0xc5,
+	0x10,0x48,0x83,0xc3,0x01,0x40,0x08,0xf0,
+	0x0f,0x84,0x7a,0xff,0xff,0xff,0xb9,0xc8,
+	0x00,0x00,0x00,0x48,0x8d,0x15,0x9f,0x55,
+	0x00,0x00,0x48,0x8d,0x35,0xef,0x57,0x00,
+	0x00,0x31,0xc0,0xbf,0x01,0x00,0x00,0x00,
+	0xe8,0x03,0x17,0x00,0x00,0xc7,0x44,0x24,
+	0x4c,0xf2,0xff,0xff,0xff,0x8b,0x44,0x24,
+	0x4c,0x48,0x81,0xc4,0x88,0x00,0x00,0x00,
+	0x5b,0x5d,0x41,0x5c,0x41,0x5d,0x41,0x5e,
+	0x41,0x5f,0xc3,0x0f,0x1f,0x44,0x00,0x00,
+	0x49,0x8b,0x56,0x08,0x31,0xc0,0xbf,0x04,
+	0x00,0x00,0x00,0x48,0x8d,0x35,0xc9,0x55,
+	0x00,0x00,0xe8,0xc9,0x16,0x00,0x00,0x49,
+	0x8b,0x57,0x20,0x4c,0x89,0x74,0x24,0x08,
+	0x48,0x8d,0x0d,0x49,0x58,0x00,0x00,0x48,
+	0x89,0xd0,0x48,0xc1,0xe8,0x04,0x48,0x39,
+	0xc3,0x0f,0x82,0x69,0xff,0xff,0xff,0x66,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0x4c,0x8b,0x5c,0x24,0x20,0x4c,0x8b,0x0c,
+	0x24,0x4c,0x8b,0x44,0x24,0x08,0x48,0x8b,
+	0x74,0x24,0x10,0x48,0x8b,0x7c,0x24,0x18,
+	0x4c,0x8b,0x6c,0x24,0x30,0x4d,0x85,0xdb,
+	0x0f,0x84,0x7e,0x04,0x00,0x00,0x48,0x85,
+	0xff,0x0f,0x84,0x75,0x04,0x00,0x00,0x4d,
+	0x85,0xc9,0x0f,0x94,0xc0,0x4d,0x85,0xc0,
+	0x0f,0x94,0xc2,0x08,0xd0,0x0f,0x85,0x61,
+	0x04,0x00,0x00,0x48,0x85,0xf6,0x0f,0x84,
+	0x58,0x04,0x00,0x00,0x48,0x8b,0x5f,0x08,
+	0x48,0x89,0xe8,0x49,0x2b,0x45,0x10,0x4c,
+	0x89,0x1c,0x24,0x48,0x01,0xc3,0x48,0x89,
+	0x5c,0x24,0x08,0x4c,0x39,0xe3,0x0f,0x83,
+	0x14,0x04,0x00,0x00,0x48,0x39,0xeb,0x0f,
+	0x82,0x0b,0x04,0x00,0x00,0x48,0x03,0x46,
+	0x08,0x4c,0x39,0xe0,0x0f,0x83,0xfe,0x03,
+	0x00,0x00,0x48,0x39,0xe8,0x0f,0x82,0xf5,
+	0x03,0x00,0x00,0x48,0x8d,0x50,0x03,0x4c,
+	0x39,0xe2,0x0f,0x83,0xe8,0x03,0x00,0x00,
+	0x48,0x39,0xea,0x0f,0x82,0xdf,0x03,0x00,
+	0x00,0x48,0x8d,0x15,0x32,0x55,0x00,0x00,
+	0x8b,0x30,0x8b,0x48,0x04,0x4c,0x8d,0x40,
+	0x08,0x66,0x48,0x0f,0x6e,0xca,0x4c,0x89,
+	0x44,0x24,0x40,0x48,0x8d,0x5c,0x24,0x50,
+	0x48,0x8d,0x3d,0xfe,0x54,0x00,0x00,0x66,
+	0x48,0x0f,0x6e,0xc7,0x48,0x8d,0x15,0x29,
+	0x55,0x00,0x00,0x48,0x8d,0x3d,0x0e,0x55,
+	0x00,0x00,0x49,0x89,0xcf,0x66,0x0f,0x6c,
+	0xc1,0x66,0x48,0x0f,0x6e,0xd2,0x48,0x8d,
+	0x15,0x2e,0x55,0x00,0x00,0x89,0x74,0x24,
+	0x48,0x0f,0x29,0x44,0x24,0x50,0x66,0x48,
+	0x0f,0x6e,0xc7,0x66,0x48,0x0f,0x6e,0xda,
+	0x48,0x8d,0x3d,0x01,0x55,0x00,0x00,0x66,
+	0x0f,0x6c,0xc2,0x8d,0x56,0x02,0x4c,0x8d,
+	0x34,0x90,0x0f,0x29,0x44,0x24,0x60,0x66,
+	0x48,0x0f,0x6e,0xc7,0x89,0xf2,0x66,0x0f,
+	0x6c,0xc3,0x4d,0x89,0xf1,0x48,0x8d,0x35,
+	0x8c,0x56,0x00,0x00,0x31,0xc0,0xbf,0x04,
+	0x00,0x00,0x00,0x0f,0x29,0x44,0x24,0x70,
+	0xe8,0x63,0x15,0x00,0x00,0x48,0x8b,0x44,
+	0x24,0x28,0x4d,0x89,0xe9,0x48,0x8b,0x33,
+	0x4d,0x89,0xe5,0x4c,0x8b,0x1c,0x24,0x49,
+	0x89,0xec,0x48,0x83,0xc0,0x10,0x48,0x89,
+	0x44,0x24,0x18,0x48,0x8d,0x84,0x24,0x80,
+	0x00,0x00,0x00,0x48,0x89,0x44,0x24,0x38,
+	0xb8,0x5f,0x00,0x00,0x00,0x89,0xc2,0x84,
+	0xd2,0x0f,0x84,0xad,0x01,0x00,0x00,0x66,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0x49,0x89,0xf2,0x31,0xc0,0x0f,0x1f,0x00,
+	0x48,0xc1,0xe0,0x04,0x49,0x83,0xc2,0x01,
+	0x48,0x89,0xc1,0x0f,0xb6,0xc2,0x48,0x01,
+	0xc8,0x48,0x89,0xc2,0x81,0xe2,0x00,0x00,
+	0x00,0xf0,0x48,0x89,0xd1,0x48,0xc1,0xe9,
+	0x18,0x48,0x31,0xc1,0x48,0x85,0xd2,0x48,
+	0xf7,0xd2,0x48,0x0f,0x45,0xc1,0x48,0x21,
+	0xd0,0x41,0x0f,0xb6,0x12,0x84,0xd2,0x75,
+	0xc7,0x31,0xd2,0xf7,0x74,0x24,0x48,0x48,
+	0x8b,0x44,0x24,0x40,0x48,0x8d,0x04,0x90,
+	0x8b,0x00,0x44,0x39,0xf8,0x0f,0x83,0x20,
+	0x01,0x00,0x00,0x85,0xc0,0x0f,0x84,0x18,
+	0x01,0x00,0x00,0x48,0x89,0x74,0x24,0x20,
+	0x48,0x89,0x5c,0x24,0x28,0x4c,0x89,0xf3,
+	0x4d,0x89,0xee,0x4d,0x89,0xdd,0x66,0x2e,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0x89,0xc5,0x48,0x8d,0x44,0x6d,0x00,0x4d,
+	0x8d,0x04,0xc4,0x4d,0x2b,0x41,0x10,0x4d,
+	0x03,0x45,0x08,0x4d,0x39,0xf0,0x0f,0x83,
+	0xcc,0x01,0x00,0x00,0x4d,0x39,0xe0,0x0f,
+	0x82,0xc3,0x01,0x00,0x00,0x49,0x8d,0x40,
+	0x17,0x4c,0x39,0xf0,0x0f,0x83,0xb6,0x01,
+	0x00,0x00,0x4c,0x39,0xe0,0x0f,0x82,0xad,
+	0x01,0x00,0x00,0x41,0x0f,0xb6,0x40,0x04,
+	0x89,0xc2,0x83,0xe2,0x0f,0x80,0xfa,0x02,
+	0x74,0x0b,0xc0,0xe8,0x04,0x3c,0x01,0x0f,
+	0x85,0x93,0x01,0x00,0x00,0x41,0x8b,0x38,
+	0x48,0x8b,0x44,0x24,0x08,0x4c,0x89,0x04,
+	0x24,0x48,0x01,0xc7,0x4c,0x39,0xf7,0x0f,
+	0x83,0x7b,0x01,0x00,0x00,0x4c,0x39,0xe7,
+	0x0f,0x82,0x72,0x01,0x00,0x00,0x48,0x8d,
+	0x47,0x1e,0x4c,0x39,0xf0,0x0f,0x83,0x65,
+	0x01,0x00,0x00,0x4c,0x39,0xe0,0x0f,0x82,
+	0x5c,0x01,0x00,0x00,0x48,0x8b,0x74,0x24,
+	0x20,0xba,0x1f,0x00,0x00,0x00,0x4c,0x89,
+	0x4c,0x24,0x10,0x48,0x89,0x7c,0x24,0x30,
+	0xe8,0x4b,0x1f,0x00,0x00,0x4c,0x8b,0x4c,
+	0x24,0x10,0x85,0xc0,0x0f,0x85,0x36,0x01,
+	0x00,0x00,0x48,0x8b,0x7c,0x24,0x30,0xba,
+	0x1f,0x00,0x00,0x00,0x48,0x8b,0x2c,0x24,
+	0x4c,0x89,0x6c,0x24,0x10,0x4c,0x89,0x0c,
+	0x24,0x4d,0x89,0xf5,0x49,0x89,0xde,0x48,
+	0x8b,0x5c,0x24,0x28,0x48,0x89,0xfe,0x48,
+	0x8b,0x7c,0x24,0x18,0xe8,0x4b,0x1f,0x00,
+	0x00,0x4c,0x8b,0x0c,0x24,0x48,0x8b,0x74,
+	0x24,0x18,0x48,0x8b,0x45,0x08,0x4c,0x8b,
+	0x5c,0x24,0x10,0x49,0x2b,0x41,0x10,0x48,
+	0x89,0x46,0x20,0x48,0x8b,0x44,0x24,0x38,
+	0x48,0x83,0xc3,0x08,0x48,0x83,0x44,0x24,
+	0x18,0x28,0x48,0x39,0xc3,0x0f,0x84,0x92,
+	0xfc,0xff,0xff,0x48,0x8b,0x03,0x48,0x8b,
+	0x33,0x0f,0xb6,0x10,0x84,0xd2,0x0f,0x85,
+	0x5c,0xfe,0xff,0xff,0x48,0x8b,0x44,0x24,
+	0x40,0xe9,0xa2,0xfe,0xff,0xff,0x66,0x90,
+	0x49,0x8b,0x56,0x08,0x48,0x8d,0x35,0x4b,
+	0x52,0x00,0x00,0xbf,0x04,0x00,0x00,0x00,
+	0x31,0xc0,0xe8,0x59,0x13,0x00,0x00,0x4c,
+	0x89,0x34,0x24,0x49,0x8b,0x57,0x20,0x48,
+	0x8d,0x0d,0xda,0x54,0x00,0x00,0xe9,0xf5,
+	0xfb,0xff,0xff,0x0f,0x1f,0x44,0x00,0x00,
+	0x49,0x8b,0x56,0x08,0x48,0x8d,0x35,0x05,
+	0x52,0x00,0x00,0xbf,0x04,0x00,0x00,0x00,
+	0x31,0xc0,0xe8,0x29,0x13,0x00,0x00,0x4c,
+	0x89,0x74,0x24,0x20,0x49,0x8b,0x57,0x20,
+	0x48,0x8d,0x0d,0xa9,0x54,0x00,0x00,0xe9,
+	0xc4,0xfb,0xff,0xff,0x0f,0x1f,0x40,0x00,
+	0x49,0x8b,0x56,0x08,0x48,0x8d,0x35,0x16,
+	0x52,0x00,0x00,0xbf,0x04,0x00,0x00,0x00,
+	0x31,0xc0,0xe8,0xf9,0x12,0x00,0x00,0x4c,
+	0x89,0x74,0x24,0x10,0x49,0x8b,0x57,0x20,
+	0x48,0x8d,0x0d,0x79,0x54,0x00,0x00,0xe9,
+	0x94,0xfb,0xff,0xff,0x0f,0x1f,0x40,0x00,
+	0xb9,0x8f,0x00,0x00,0x00,0x48,0x8d,0x15,
+	0x5d,0x51,0x00,0x00,0x48,0x8d,0x35,0xf5,
+	0x52,0x00,0x00,0x31,0xc0,0xbf,0x01,0x00,
+	0x00,0x00,0xe8,0xc1,0x12,0x00,0x00,0xe9,
+	0xb9,0xfb,0xff,0xff,0x0f,0x1f,0x40,0x00,
+	0x8b,0x04,0xab,0x44,0x39,0xf8,0x73,0x08,
+	0x85,0xc0,0x0f,0x85,0x08,0xfe,0xff,0xff,
+	0x4d,0x89,0xeb,0x4d,0x89,0xf5,0x49,0x89,
+	0xde,0x48,0x8b,0x5c,0x24,0x28,0xe9,0xf0,
+	0xfe,0xff,0xff,0xb9,0x5c,0x00,0x00,0x00,
+	0x48,0x8d,0x15,0x12,0x51,0x00,0x00,0x48,
+	0x8d,0x35,0x1a,0x52,0x00,0x00,0x31,0xc0,
+	0xbf,0x01,0x00,0x00,0x00,0xe8,0x76,0x12,
+	0x00,0x00,0xc7,0x44,0x24,0x4c,0xea,0xff,
+	0xff,0xff,0xe9,0x6e,0xfb,0xff,0xff,0xb9,
+	0x7e,0x00,0x00,0x00,0x48,0x8d,0x15,0xe6,
+	0x50,0x00,0x00,0x48,0x8d,0x35,0x1e,0x52,
+	0x00,0x00,0x31,0xc0,0xbf,0x01,0x00,0x00,
+	0x00,0xe8,0x4a,0x12,0x00,0x00,0xeb,0xd2,
+	0xb9,0x85,0x00,0x00,0x00,0x48,0x8d,0x15,
+	0xc5,0x50,0x00,0x00,0x48,0x8d,0x35,0x2d,
+	0x52,0x00,0x00,0x31,0xc0,0xbf,0x01,0x00,
+	0x00,0x00,0xe8,0x29,0x12,0x00,0x00,0xeb,
+	0xb1,0x0f,0x1f,0x80,0x00,0x00,0x00,0x00,
+	0xb9,0x3e,0x01,0x00,0x00,0x48,0x8d,0x15,
+	0x9d,0x50,0x00,0x00,0x48,0x8d,0x35,0x5d,
+	0x53,0x00,0x00,0x31,0xc0,0xbf,0x01,0x00,
+	0x00,0x00,0xe8,0x01,0x12,0x00,0x00,0xe9,
+	0xf9,0xfa,0xff,0xff,0xb9,0xc1,0x00,0x00,
+	0x00,0x48,0x8d,0x15,0x79,0x50,0x00,0x00,
+	0x48,0x8d,0x35,0x89,0x52,0x00,0x00,0x31,
+	0xc0,0xbf,0x01,0x00,0x00,0x00,0xe8,0xdd,
+	0x11,0x00,0x00,0xe9,0x62,0xff,0xff,0xff,
+	0xb9,0x20,0x01,0x00,0x00,0x48,0x8d,0x15,
+	0x55,0x50,0x00,0x00,0x48,0x8d,0x35,0x1d,
+	0x52,0x00,0x00,0x31,0xc0,0xbf,0x01,0x00,
+	0x00,0x00,0xe8,0xb9,0x11,0x00,0x00,0xe9,
+	0x3e,0xff,0xff,0xff,0x0f,0x1f,0x40,0x00,
+	0x41,0x57,0x31,0xc0,0x41,0x56,0x41,0x55,
+	0x41,0x54,0x4c,0x8d,0x24,0x3e,0x48,0x8d,
+	0x35,0x5b,0x53,0x00,0x00,0x55,0x4c,0x89,
+	0xe1,0x48,0x89,0xfd,0x53,0x48,0x81,0xec,
+	0x88,0x00,0x00,0x00,0x48,0x89,0x54,0x24,
+	0x28,0x48,0x89,0xfa,0xbf,0x04,0x00,0x00,
+	0x00,0xe8,0x7a,0x11,0x00,0x00,0x48,0x89,
+	0xe8,0x48,0x83,0xc0,0x33,0x0f,0x92,0xc2,
+	0x4c,0x39,0xe0,0x0f,0x83,0x6f,0x06,0x00,
+	0x00,0x0f,0xb6,0xd2,0x48,0x85,0xd2,0x0f,
+	0x85,0x63,0x06,0x00,0x00,0xba,0x10,0x00,
+	0x00,0x00,0x48,0x8d,0x35,0x4f,0x56,0x00,
+	0x00,0x48,0x89,0xef,0xe8,0x07,0x1c,0x00,
+	0x00,0x89,0x44,0x24,0x4c,0x85,0xc0,0x0f,
+	0x85,0x93,0x06,0x00,0x00,0x8b,0x45,0x1c,
+	0x31,0xd2,0x48,0x01,0xe8,0x0f,0x92,0xc2,
+	0x4c,0x39,0xe0,0x0f,0x83,0x2f,0x06,0x00,
+	0x00,0x48,0x85,0xd2,0x0f,0x85,0x26,0x06,
+	0x00,0x00,0x0f,0xb7,0x55,0x2c,0x66,0x85,
+	0xd2,0x0f,0x84,0x29,0x07,0x00,0x00,0x48,
+	0x8d,0x48,0x1f,0x4c,0x39,0xe1,0x0f,0x83,
+	0x0c,0x06,0x00,0x00,0x48,0x39,0xe9,0x0f,
+	0x82,0x03,0x06,0x00,0x00,0x8d,0x7a,0xff,
+	0x48,0x83,0xc0,0x3f,0x45,0x31,0xed,0x31,
+	0xc9,0x48,0xc1,0xe7,0x05,0x48,0x01,0xc7,
+	0xeb,0x36,0x66,0x0f,0x1f,0x44,0x00,0x00,
+	0x83,0xfa,0x02,0x75,0x0c,0x48,0x85,0xc9,
+	0x0f,0x85,0x56,0x06,0x00,0x00,0x48,0x89,
+	0xf1,0x48,0x39,0xc7,0x74,0x37,0x4c,0x39,
+	0xe0,0x0f,0x93,0xc2,0x48,0x39,0xe8,0x40,
+	0x0f,0x92,0xc6,0x48,0x83,0xc0,0x20,0x40,
+	0x08,0xf2,0x0f,0x85,0xb8,0x05,0x00,0x00,
+	0x8b,0x50,0xc1,0x48,0x8d,0x70,0xc1,0x83,
+	0xfa,0x01,0x75,0xc4,0x4d,0x85,0xed,0x0f,
+	0x85,0x40,0x06,0x00,0x00,0x49,0x89,0xf5,
+	0x48,0x39,0xc7,0x75,0xc9,0x48,0x85,0xc9,
+	0x0f,0x84,0xa2,0x06,0x00,0x00,0x4d,0x85,
+	0xed,0x0f,0x84,0x99,0x06,0x00,0x00,0x41,
+	0x8b,0x55,0x08,0x31,0xc0,0xbf,0x04,0x00,
+	0x00,0x00,0x48,0x89,0x0c,0x24,0x48,0x8d,
+	0x35,0x60,0x52,0x00,0x00,0xe8,0x66,0x10,
+	0x00,0x00,0x48,0x8b,0x0c,0x24,0x31,0xc0,
+	0x8b,0x59,0x04,0x48,0x01,0xeb,0x0f,0x92,
+	0xc0,0x4c,0x39,0xe3,0x0f,0x83,0xf6,0x00,
+	0x00,0x00,0x48,0x85,0xc0,0x0f,0x85,0xed,
+	0x00,0x00,0x00,0x8b,0x51,0x10,0x89,0xd0,
+	0xc1,0xe8,0x03,0x0f,0x84,0x2b,0x06,0x00,
+	0x00,0x48,0x8d,0x43,0x07,0x48,0x39,0xe8,
+	0x0f,0x82,0xd2,0x00,0x00,0x00,0x4c,0x39,
+	0xe0,0x0f,0x83,0xc9,0x00,0x00,0x00,0x31,
+	0xf6,0x45,0x31,0xdb,0x31,0xff,0x45,0x31,
+	0xd2,0x45,0x31,0xc9,0x48,0x83,0xc3,0x0f,
+	0x4c,0x89,0x54,0x24,0x08,0x41,0xbe,0x01,
+	0x00,0x00,0x00,0x4c,0x89,0x0c,0x24,0x48,
+	0x89,0xd8,0x4c,0x8d,0x05,0xd7,0x54,0x00,
+	0x00,0x4c,0x89,0xf3,0x4c,0x89,0x5c,0x24,
+	0x10,0x49,0x89,0xc6,0x48,0x89,0x7c,0x24,
+	0x18,0x48,0x89,0x74,0x24,0x20,0x4c,0x89,
+	0x6c,0x24,0x30,0x49,0x89,0xcd,0x66,0x2e,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0x41,0x8b,0x46,0xf1,0x4d,0x8d,0x7e,0xf1,
+	0x85,0xc0,0x0f,0x84,0xe0,0x00,0x00,0x00,
+	0x83,0xe8,0x04,0x83,0xf8,0x07,0x77,0x38,
+	0x49,0x63,0x04,0x80,0x4c,0x01,0xc0,0xff,
+	0xe0,0x0f,0x1f,0x80,0x00,0x00,0x00,0x00,
+	0x41,0x8b,0x57,0x04,0x48,0x8d,0x35,0xae,
+	0x51,0x00,0x00,0xbf,0x04,0x00,0x00,0x00,
+	0x31,0xc0,0xe8,0x91,0x0f,0x00,0x00,0x4c,
+	0x89,0x7c,0x24,0x18,0x41,0x8b,0x55,0x10,
+	0x4c,0x8d,0x05,0x61,0x54,0x00,0x00,0x90,
+	0x89,0xd0,0xc1,0xe8,0x03,0x48,0x39,0xc3,
+	0x0f,0x83,0x92,0x00,0x00,0x00,0x4d,0x39,
+	0xe6,0x0f,0x93,0xc0,0x49,0x39,0xee,0x40,
+	0x0f,0x92,0xc6,0x49,0x83,0xc6,0x08,0x48,
+	0x83,0xc3,0x01,0x40,0x08,0xf0,0x74,0x88,
+	0xb9,0xc8,0x00,0x00,0x00,0x48,0x8d,0x15,
+	0x26,0x51,0x00,0x00,0x48,0x8d,0x35,0x75,
+	0x53,0x00,0x00,0x31,0xc0,0xbf,0x01,0x00,
+	0x00,0x00,0xe8,0x39,0x0f,0x00,0x00,0xc7,
+	0x44,0x24,0x4c,0xf2,0xff,0xff,0xff,0x8b,
+	0x44,0x24,0x4c,0x48,0x81,0xc4,0x88,0x00,
+	0x00,0x00,0x5b,0x5d,0x41,0x5c,0x41,0x5d,
+	0x41,0x5e,0x41,0x5f,0xc3,0x0f,0x1f,0x00,
+	0x41,0x8b,0x57,0x04,0x31,0xc0,0xbf,0x04,
+	0x00,0x00,0x00,0x48,0x8d,0x35,0x58,0x51,
+	0x00,0x00,0xe8,0x01,0x0f,0x00,0x00,0x41,
+	0x8b,0x55,0x10,0x4c,0x89,0x3c,0x24,0x4c,
+	0x8d,0x05,0xd2,0x53,0x00,0x00,0x89,0xd0,
+	0xc1,0xe8,0x03,0x48,0x39,0xc3,0x0f,0x82,
+	0x72,0xff,0xff,0xff,0x0f,0x1f,0x40,0x00,
+	0x4c,0x8b,0x5c,0x24,0x10,0x4c,0x8b,0x6c,
+	0x24,0x30,0x4c,0x8b,0x0c,0x24,0x4c,0x8b,
+	0x54,0x24,0x08,0x48,0x8b,0x7c,0x24,0x18,
+	0x48,0x8b,0x74,0x24,0x20,0x4d,0x85,0xdb,
+	0x0f,0x84,0xae,0x04,0x00,0x00,0x48,0x85,
+	0xff,0x0f,0x84,0xa5,0x04,0x00,0x00,0x4d,
+	0x85,0xd2,0x0f,0x94,0xc0,0x4d,0x85,0xc9,
+	0x0f,0x94,0xc2,0x08,0xd0,0x0f,0x85,0x91,
+	0x04,0x00,0x00,0x48,0x85,0xf6,0x0f,0x84,
+	0x88,0x04,0x00,0x00,0x41,0x8b,0x45,0x08,
+	0x44,0x8b,0x7f,0x04,0x48,0x89,0xea,0x4c,
+	0x89,0x5c,0x24,0x20,0x48,0x29,0xc2,0x49,
+	0x8d,0x04,0x17,0x48,0x89,0x04,0x24,0x4c,
+	0x39,0xe0,0x0f,0x83,0x40,0x04,0x00,0x00,
+	0x48,0x39,0xe8,0x0f,0x82,0x37,0x04,0x00,
+	0x00,0x8b,0x46,0x04,0x48,0x01,0xd0,0x4c,
+	0x39,0xe0,0x0f,0x83,0x28,0x04,0x00,0x00,
+	0x48,0x39,0xe8,0x0f,0x82,0x1f,0x04,0x00,
+	0x00,0x48,0x8d,0x50,0x03,0x4c,0x39,0xe2,
+	0x0f,0x83,0x12,0x04,0x00,0x00,0x48,0x39,
+	0xea,0x0f,0x82,0x09,0x04,0x00,0x00,0x48,
+	0x8d,0x15,0xc3,0x50,0x00,0x00,0x8b,0x38,
+	0x8b,0x48,0x04,0x4c,0x8d,0x40,0x08,0x66,
+	0x48,0x0f,0x6e,0xca,0x4c,0x89,0x44,0x24,
+	0x40,0x4c,0x8d,0x7c,0x24,0x50,0x48,0x8d,
+	0x35,0x8f,0x50,0x00,0x00,0x66,0x48,0x0f,
+	0x6e,0xc6,0x48,0x8d,0x15,0xba,0x50,0x00,
+	0x00,0x48,0x8d,0x35,0x9f,0x50,0x00,0x00,
+	0x89,0x7c,0x24,0x48,0x66,0x0f,0x6c,0xc1,
+	0x66,0x48,0x0f,0x6e,0xd2,0x48,0x8d,0x15,
+	0xbe,0x50,0x00,0x00,0x89,0x4c,0x24,0x10,
+	0x0f,0x29,0x44,0x24,0x50,0x66,0x48,0x0f,
+	0x6e,0xc6,0x66,0x48,0x0f,0x6e,0xda,0x48,
+	0x8d,0x35,0x91,0x50,0x00,0x00,0x66,0x0f,
+	0x6c,0xc2,0x8d,0x57,0x02,0x0f,0x29,0x44,
+	0x24,0x60,0x66,0x48,0x0f,0x6e,0xc6,0x4c,
+	0x8d,0x0c,0x90,0x89,0xfa,0x66,0x0f,0x6c,
+	0xc3,0x31,0xc0,0xbf,0x04,0x00,0x00,0x00,
+	0x4c,0x89,0x4c,0x24,0x08,0x48,0x8d,0x35,
+	0x0c,0x52,0x00,0x00,0x0f,0x29,0x44,0x24,
+	0x70,0xe8,0x9a,0x0d,0x00,0x00,0x4c,0x8b,
+	0x74,0x24,0x28,0x4c,0x8b,0x4c,0x24,0x08,
+	0x48,0x8d,0x84,0x24,0x80,0x00,0x00,0x00,
+	0x48,0x89,0x44,0x24,0x38,0xb8,0x5f,0x00,
+	0x00,0x00,0x4c,0x8b,0x5c,0x24,0x20,0x49,
+	0x83,0xc6,0x10,0x89,0xc2,0x4c,0x89,0xe0,
+	0x49,0x89,0xec,0x4c,0x89,0xfd,0x4c,0x89,
+	0x74,0x24,0x18,0x4d,0x89,0xef,0x44,0x8b,
+	0x74,0x24,0x10,0x48,0x8b,0x75,0x00,0x49,
+	0x89,0xc5,0x84,0xd2,0x0f,0x84,0xb6,0x01,
+	0x00,0x00,0x66,0x0f,0x1f,0x44,0x00,0x00,
+	0x49,0x89,0xf0,0x31,0xc0,0x0f,0x1f,0x00,
+	0x48,0xc1,0xe0,0x04,0x49,0x83,0xc0,0x01,
+	0x48,0x89,0xc1,0x0f,0xb6,0xc2,0x48,0x01,
+	0xc8,0x48,0x89,0xc2,0x81,0xe2,0x00,0x00,
+	0x00,0xf0,0x48,0x89,0xd1,0x48,0xc1,0xe9,
+	0x18,0x48,0x31,0xc1,0x48,0x85,0xd2,0x48,
+	0xf7,0xd2,0x48,0x0f,0x45,0xc1,0x48,0x21,
+	0xd0,0x41,0x0f,0xb6,0x10,0x84,0xd2,0x75,
+	0xc7,0x31,0xd2,0xf7,0x74,0x24,0x48,0x48,
+	0x8b,0x44,0x24,0x40,0x48,0x8d,0x04,0x90,
+	0x8b,0x00,0x44,0x39,0xf0,0x0f,0x83,0x2d,
+	0x01,0x00,0x00,0x85,0xc0,0x0f,0x84,0x25,
+	0x01,0x00,0x00,0x48,0x89,0x74,0x24,0x20,
+	0x48,0x89,0x6c,0x24,0x28,0x4c,0x89,0xfd,
+	0x45,0x89,0xf7,0x4d,0x89,0xee,0x4d,0x89,
+	0xcd,0x0f,0x1f,0x80,0x00,0x00,0x00,0x00,
+	0x41,0x89,0xc0,0x8b,0x45,0x08,0x4c,0x89,
+	0xc3,0x48,0xc1,0xe3,0x04,0x4c,0x01,0xe3,
+	0x48,0x29,0xc3,0x41,0x8b,0x43,0x04,0x48,
+	0x01,0xc3,0x4c,0x39,0xf3,0x0f,0x83,0xd5,
+	0x01,0x00,0x00,0x4c,0x39,0xe3,0x0f,0x82,
+	0xcc,0x01,0x00,0x00,0x48,0x8d,0x43,0x0f,
+	0x4c,0x39,0xf0,0x0f,0x83,0xbf,0x01,0x00,
+	0x00,0x4c,0x39,0xe0,0x0f,0x82,0xb6,0x01,
+	0x00,0x00,0x0f,0xb6,0x43,0x0c,0x89,0xc2,
+	0x83,0xe2,0x0f,0x80,0xfa,0x02,0x74,0x0b,
+	0xc0,0xe8,0x04,0x3c,0x01,0x0f,0x85,0x9d,
+	0x01,0x00,0x00,0x8b,0x3b,0x48,0x8b,0x04,
+	0x24,0x48,0x01,0xc7,0x4c,0x39,0xf7,0x0f,
+	0x83,0x8b,0x01,0x00,0x00,0x4c,0x39,0xe7,
+	0x0f,0x82,0x82,0x01,0x00,0x00,0x48,0x8d,
+	0x47,0x1e,0x4c,0x39,0xf0,0x0f,0x83,0x75,
+	0x01,0x00,0x00,0x4c,0x39,0xe0,0x0f,0x82,
+	0x6c,0x01,0x00,0x00,0x48,0x8b,0x74,0x24,
+	0x20,0xba,0x1f,0x00,0x00,0x00,0x4c,0x89,
+	0x5c,0x24,0x10,0x4c,0x89,0x44,0x24,0x08,
+	0x48,0x89,0x7c,0x24,0x30,0xe8,0x6e,0x17,
+	0x00,0x00,0x4c,0x8b,0x44,0x24,0x08,0x4c,
+	0x8b,0x5c,0x24,0x10,0x85,0xc0,0x0f,0x85,
+	0x3c,0x01,0x00,0x00,0x48,0x8b,0x7c,0x24,
+	0x30,0x4c,0x89,0x6c,0x24,0x10,0xba,0x1f,
+	0x00,0x00,0x00,0x4d,0x89,0xf5,0x45,0x89,
+	0xfe,0x49,0x89,0xef,0x4c,0x89,0x5c,0x24,
+	0x08,0x48,0x8b,0x6c,0x24,0x28,0x48,0x89,
+	0xfe,0x48,0x8b,0x7c,0x24,0x18,0xe8,0x69,
+	0x17,0x00,0x00,0x8b,0x43,0x04,0x41,0x8b,
+	0x57,0x08,0x48,0x8b,0x7c,0x24,0x18,0x4c,
+	0x8b,0x5c,0x24,0x08,0x48,0x29,0xd0,0x4c,
+	0x8b,0x4c,0x24,0x10,0x48,0x89,0x47,0x20,
+	0x48,0x83,0x44,0x24,0x18,0x28,0x48,0x83,
+	0xc5,0x08,0x48,0x39,0x6c,0x24,0x38,0x0f,
+	0x84,0x7a,0xfc,0xff,0xff,0x48,0x8b,0x45,
+	0x00,0x48,0x8b,0x75,0x00,0x0f,0xb6,0x10,
+	0x84,0xd2,0x0f,0x85,0x50,0xfe,0xff,0xff,
+	0x48,0x8b,0x44,0x24,0x40,0xe9,0x96,0xfe,
+	0xff,0xff,0x66,0x0f,0x1f,0x44,0x00,0x00,
+	0x41,0x8b,0x57,0x04,0x48,0x8d,0x35,0xba,
+	0x4d,0x00,0x00,0xbf,0x04,0x00,0x00,0x00,
+	0x31,0xc0,0xe8,0x71,0x0b,0x00,0x00,0x4c,
+	0x89,0x7c,0x24,0x08,0x41,0x8b,0x55,0x10,
+	0x4c,0x8d,0x05,0x41,0x50,0x00,0x00,0xe9,
+	0xdc,0xfb,0xff,0xff,0x0f,0x1f,0x40,0x00,
+	0x41,0x8b,0x57,0x04,0x48,0x8d,0x35,0x74,
+	0x4d,0x00,0x00,0xbf,0x04,0x00,0x00,0x00,
+	0x31,0xc0,0xe8,0x41,0x0b,0x00,0x00,0x4c,
+	0x89,0x7c,0x24,0x10,0x41,0x8b,0x55,0x10,
+	0x4c,0x8d,0x05,0x11,0x50,0x00,0x00,0xe9,
+	0xac,0xfb,0xff,0xff,0x0f,0x1f,0x40,0x00,
+	0x41,0x8b,0x57,0x04,0x48,0x8d,0x35,0x85,
+	0x4d,0x00,0x00,0xbf,0x04,0x00,0x00,0x00,
+	0x31,0xc0,0xe8,0x11,0x0b,0x00,0x00,0x4c,
+	0x89,0x7c,0x24,0x20,0x41,0x8b,0x55,0x10,
+	0x4c,0x8d,0x05,0xe1,0x4f,0x00,0x00,0xe9,
+	0x7c,0xfb,0xff,0xff,0x0f,0x1f,0x40,0x00,
+	0xb9,0x8f,0x00,0x00,0x00,0x48,0x8d,0x15,
+	0xc6,0x4c,0x00,0x00,0x48,0x8d,0x35,0x5d,
+	0x4e,0x00,0x00,0x31,0xc0,0xbf,0x01,0x00,
+	0x00,0x00,0xe8,0xd9,0x0a,0x00,0x00,0xe9,
+	0x9b,0xfb,0xff,0xff,0x0f,0x1f,0x40,0x00,
+	0x43,0x8b,0x44,0x85,0x00,0x44,0x39,0xf8,
+	0x73,0x08,0x85,0xc0,0x0f,0x85,0xf6,0xfd,
+	0xff,0xff,0x4d,0x89,0xe9,0x4d,0x89,0xf5,
+	0x45,0x89,0xfe,0x49,0x89,0xef,0x48,0x8b,
+	0x6c,0x24,0x28,0xe9,0xe8,0xfe,0xff,0xff,
+	0xb9,0x5c,0x00,0x00,0x00,0x48,0x8d,0x15,
+	0x76,0x4c,0x00,0x00,0x48,0x8d,0x35,0x7d,
+	0x4d,0x00,0x00,0x31,0xc0,0xbf,0x01,0x00,
+	0x00,0x00,0xe8,0x89,0x0a,0x00,0x00,0xc7,
+	0x44,0x24,0x4c,0xea,0xff,0xff,0xff,0xe9,
+	0x4b,0xfb,0xff,0xff,0xb9,0x7e,0x00,0x00,
+	0x00,0x48,0x8d,0x15,0x4a,0x4c,0x00,0x00,
+	0x48,0x8d,0x35,0x81,0x4d,0x00,0x00,0x31,
+	0xc0,0xbf,0x01,0x00,0x00,0x00,0xe8,0x5d,
+	0x0a,0x00,0x00,0xeb,0xd2,0xb9,0x85,0x00,
+	0x00,0x00,0x48,0x8d,0x15,0x29,0x4c,0x00,
+	0x00,0x48,0x8d,0x35,0x90,0x4d,0x00,0x00,
+	0x31,0xc0,0xbf,0x01,0x00,0x00,0x00,0xe8,
+	0x3c,0x0a,0x00,0x00,0xeb,0xb1,0x66,0x2e,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0xb9,0x3e,0x01,0x00,0x00,0x48,0x8d,0x15,
+	0xfe,0x4b,0x00,0x00,0x48,0x8d,0x35,0xbd,
+	0x4e,0x00,0x00,0x31,0xc0,0xbf,0x01,0x00,
+	0x00,0x00,0xe8,0x11,0x0a,0x00,0x00,0xe9,
+	0xd3,0xfa,0xff,0xff,0xb9,0xc1,0x00,0x00,
+	0x00,0x48,0x8d,0x15,0xda,0x4b,0x00,0x00,
+	0x48,0x8d,0x35,0xe9,0x4d,0x00,0x00,0x31,
+	0xc0,0xbf,0x01,0x00,0x00,0x00,0xe8,0xed,
+	0x09,0x00,0x00,0xe9,0x5f,0xff,0xff,0xff,
+	0xb9,0x20,0x01,0x00,0x00,0x48,0x8d,0x15,
+	0xb6,0x4b,0x00,0x00,0x48,0x8d,0x35,0x7d,
+	0x4d,0x00,0x00,0x31,0xc0,0xbf,0x01,0x00,
+	0x00,0x00,0xe8,0xc9,0x09,0x00,0x00,0xe9,
+	0x3b,0xff,0xff,0xff,0x0f,0x1f,0x40,0x00,
+	0x48,0x8b,0x87,0x00,0x01,0x00,0x00,0x48,
+	0x89,0xc2,0x48,0x29,0xfa,0x48,0x81,0xfa,
+	0xff,0x00,0x00,0x00,0x7f,0x4a,0x40,0x88,
+	0x30,0x48,0x8b,0x97,0x00,0x01,0x00,0x00,
+	0x48,0x8d,0x42,0x01,0x48,0x89,0x87,0x00,
+	0x01,0x00,0x00,0x48,0x29,0xf8,0x48,0x3d,
+	0xfd,0x00,0x00,0x00,0x7e,0x2a,0xc6,0x42,
+	0x01,0x3e,0x48,0x8b,0x87,0x00,0x01,0x00,
+	0x00,0xc6,0x40,0x01,0x0a,0x48,0x8b,0x87,
+	0x10,0x01,0x00,0x00,0x48,0x83,0x87,0x00,
+	0x01,0x00,0x00,0x02,0x48,0x85,0xc0,0x74,
+	0x07,0xff,0xe0,0x0f,0x1f,0x44,0x00,0x00,
+	0xc3,0x66,0x66,0x2e,0x0f,0x1f,0x84,0x00,
+	0x00,0x00,0x00,0x00,0x0f,0x1f,0x40,0x00,
+	0x48,0x63,0x87,0x08,0x01,0x00,0x00,0x48,
+	0x8b,0x97,0x00,0x01,0x00,0x00,0x48,0x01,
+	0xf8,0x48,0x39,0xc2,0x74,0x2a,0x53,0x48,
+	0x29,0xfa,0x48,0x89,0xfb,0x48,0x89,0xfe,
+	0x8b,0x3d,0x6e,0x29,0x00,0x00,0xe8,0xe5,
+	0x14,0x00,0x00,0x48,0x63,0x83,0x08,0x01,
+	0x00,0x00,0x48,0x01,0xd8,0x48,0x89,0x83,
+	0x00,0x01,0x00,0x00,0x5b,0xc3,0x66,0x90,
+	0xc3,0x66,0x66,0x2e,0x0f,0x1f,0x84,0x00,
+	0x00,0x00,0x00,0x00,0x0f,0x1f,0x40,0x00,
+	0x0f,0xb6,0x07,0x84,0xc0,0x0f,0x84,0x85,
+	0x00,0x00,0x00,0x55,0x48,0x89,0xfd,0x53,
+	0x48,0x89,0xf3,0x48,0x83,0xec,0x08,0x66,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0x48,0x8b,0x93,0x00,0x01,0x00,0x00,0x48,
+	0x89,0xd1,0x48,0x29,0xd9,0x48,0x81,0xf9,
+	0xff,0x00,0x00,0x00,0x7f,0x47,0x88,0x02,
+	0x48,0x8b,0x93,0x00,0x01,0x00,0x00,0x48,
+	0x8d,0x42,0x01,0x48,0x89,0x83,0x00,0x01,
+	0x00,0x00,0x48,0x29,0xd8,0x48,0x3d,0xfd,
+	0x00,0x00,0x00,0x7e,0x28,0xc6,0x42,0x01,
+	0x3e,0x48,0x8b,0x83,0x00,0x01,0x00,0x00,
+	0xc6,0x40,0x01,0x0a,0x48,0x8b,0x83,0x10,
+	0x01,0x00,0x00,0x48,0x83,0x83,0x00,0x01,
+	0x00,0x00,0x02,0x48,0x85,0xc0,0x74,0x05,
+	0x48,0x89,0xdf,0xff,0xd0,0x0f,0xb6,0x45,
+	0x01,0x48,0x83,0xc5,0x01,0x84,0xc0,0x75,
+	0x97,0x48,0x83,0xc4,0x08,0x5b,0x5d,0xc3,
+	0xc3,0x66,0x66,0x2e,0x0f,0x1f,0x84,0x00,
+	0x00,0x00,0x00,0x00,0x0f,0x1f,0x40,0x00,
+	0x48,0x89,0xf9,0x48,0x8d,0x15,0x66,0x4d,
+	0x00,0x00,0x48,0x83,0xec,0x28,0x48,0x89,
+	0xf8,0x83,0xe1,0x0f,0x4c,0x8d,0x44,0x24,
+	0x0f,0xc6,0x44,0x24,0x12,0x00,0x0f,0xb6,
+	0x0c,0x0a,0x88,0x4c,0x24,0x11,0x48,0x89,
+	0xf9,0x31,0xff,0x48,0xc1,0xe9,0x04,0x83,
+	0xe1,0x0f,0x0f,0xb6,0x0c,0x0a,0x80,0xf9,
+	0x30,0x88,0x4c,0x24,0x10,0x48,0x89,0xc1,
+	0x40,0x0f,0x94,0xc7,0x48,0xc1,0xe9,0x08,
+	0x83,0xe1,0x0f,0x48,0x8d,0x7c,0x3c,0x10,
+	0x0f,0xb6,0x0c,0x0a,0x80,0xf9,0x30,0x88,
+	0x4c,0x24,0x0f,0x48,0x89,0xc1,0x49,0x0f,
+	0x45,0xf8,0x48,0xc1,0xe9,0x0c,0x4c,0x8d,
+	0x44,0x24,0x0e,0x83,0xe1,0x0f,0x0f,0xb6,
+	0x0c,0x0a,0x80,0xf9,0x30,0x88,0x4c,0x24,
+	0x0e,0x48,0x89,0xc1,0x49,0x0f,0x45,0xf8,
+	0x48,0xc1,0xe9,0x10,0x4c,0x8d,0x44,0x24,
+	0x0d,0x83,0xe1,0x0f,0x0f,0xb6,0x0c,0x0a,
+	0x80,0xf9,0x30,0x88,0x4c,0x24,0x0d,0x48,
+	0x89,0xc1,0x49,0x0f,0x45,0xf8,0x48,0xc1,
+	0xe9,0x14,0x4c,0x8d,0x44,0x24,0x0c,0x83,
+	0xe1,0x0f,0x0f,0xb6,0x0c,0x0a,0x80,0xf9,
+	0x30,0x88,0x4c,0x24,0x0c,0x48,0x89,0xc1,
+	0x49,0x0f,0x45,0xf8,0x48,0xc1,0xe9,0x18,
+	0x4c,0x8d,0x44,0x24,0x0b,0x83,0xe1,0x0f,
+	0x0f,0xb6,0x0c,0x0a,0x80,0xf9,0x30,0x88,
+	0x4c,0x24,0x0b,0x89,0xc1,0x49,0x0f,0x45,
+	0xf8,0xc1,0xe9,0x1c,0x4c,0x8d,0x44,0x24,
+	0x0a,0x0f,0xb6,0x0c,0x0a,0x80,0xf9,0x30,
+	0x88,0x4c,0x24,0x0a,0x48,0x89,0xc1,0x49,
+	0x0f,0x45,0xf8,0x48,0xc1,0xe9,0x20,0x4c,
+	0x8d,0x44,0x24,0x09,0x83,0xe1,0x0f,0x0f,
+	0xb6,0x0c,0x0a,0x80,0xf9,0x30,0x88,0x4c,
+	0x24,0x09,0x48,0x89,0xc1,0x49,0x0f,0x45,
+	0xf8,0x48,0xc1,0xe9,0x24,0x4c,0x8d,0x44,
+	0x24,0x08,0x83,0xe1,0x0f,0x0f,0xb6,0x0c,
+	0x0a,0x80,0xf9,0x30,0x88,0x4c,0x24,0x08,
+	0x48,0x89,0xc1,0x49,0x0f,0x45,0xf8,0x48,
+	0xc1,0xe9,0x28,0x4c,0x8d,0x44,0x24,0x07,
+	0x83,0xe1,0x0f,0x0f,0xb6,0x0c,0x0a,0x80,
+	0xf9,0x30,0x88,0x4c,0x24,0x07,0x48,0x89,
+	0xc1,0x49,0x0f,0x45,0xf8,0x48,0xc1,0xe9,
+	0x2c,0x4c,0x8d,0x44,0x24,0x06,0x83,0xe1,
+	0x0f,0x0f,0xb6,0x0c,0x0a,0x80,0xf9,0x30,
+	0x88,0x4c,0x24,0x06,0x48,0x89,0xc1,0x49,
+	0x0f,0x45,0xf8,0x48,0xc1,0xe9,0x30,0x4c,
+	0x8d,0x44,0x24,0x05,0x83,0xe1,0x0f,0x0f,
+	0xb6,0x0c,0x0a,0x80,0xf9,0x30,0x88,0x4c,
+	0x24,0x05,0x48,0x89,0xc1,0x49,0x0f,0x45,
+	0xf8,0x48,0xc1,0xe9,0x34,0x4c,0x8d,0x44,
+	0x24,0x04,0x83,0xe1,0x0f,0x0f,0xb6,0x0c,
+	0x0a,0x80,0xf9,0x30,0x88,0x4c,0x24,0x04,
+	0x48,0x89,0xc1,0x49,0x0f,0x45,0xf8,0x48,
+	0xc1,0xe9,0x38,0x4c,0x8d,0x44,0x24,0x03,
+	0x83,0xe1,0x0f,0x0f,0xb6,0x0c,0x0a,0x80,
+	0xf9,0x30,0x88,0x4c,0x24,0x03,0x49,0x0f,
+	0x45,0xf8,0x48,0xc1,0xe8,0x3c,0x0f,0xb6,
+	0x04,0x02,0x48,0x8d,0x54,0x24,0x02,0x3c,
+	0x30,0x88,0x44,0x24,0x02,0x0f,0xb7,0x05,
+	0xc8,0x4c,0x00,0x00,0x48,0x0f,0x45,0xfa,
+	0x66,0x89,0x47,0xfe,0x48,0x83,0xef,0x02,
+	0xe8,0x73,0xfd,0xff,0xff,0x48,0x83,0xc4,
+	0x28,0xc3,0x66,0x66,0x2e,0x0f,0x1f,0x84,
+	0x00,0x00,0x00,0x00,0x00,0x0f,0x1f,0x00,
+	0x53,0x89,0xfb,0x8b,0x3d,0x9b,0x26,0x00,
+	0x00,0xe8,0x22,0x12,0x00,0x00,0x89,0x1d,
+	0x90,0x26,0x00,0x00,0x5b,0xc3,0x66,0x2e,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0x89,0x3d,0x7a,0x26,0x00,0x00,0xc3,0x66,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0xf3,0x0f,0x6f,0x07,0x0f,0x29,0x05,0x05,
+	0x27,0x00,0x00,0xc3,0x0f,0x1f,0x40,0x00,
+	0x48,0x89,0x3d,0xe9,0x26,0x00,0x00,0xc3,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0x48,0x8b,0x05,0xd9,0x26,0x00,0x00,0x48,
+	0x85,0xc0,0x74,0x04,0xff,0xe0,0x66,0x90,
+	0x48,0x83,0xec,0x08,0xe8,0x7f,0x13,0x00,
+	0x00,0x48,0x83,0xc4,0x08,0xc3,0x66,0x90,
+	0x49,0x89,0xca,0x48,0x63,0xce,0x49,0x89,
+	0xf8,0x89,0xf0,0x48,0x8d,0x4c,0x0f,0xff,
+	0xc6,0x01,0x00,0x48,0x8d,0x79,0xff,0x85,
+	0xd2,0x78,0x7d,0x41,0xbb,0x00,0x00,0x00,
+	0x00,0x74,0x5d,0x41,0xb9,0xcd,0xcc,0xcc,
+	0xcc,0x0f,0x1f,0x80,0x00,0x00,0x00,0x00,
+	0x89,0xd1,0x49,0x0f,0xaf,0xc9,0x48,0xc1,
+	0xe9,0x23,0x8d,0x34,0x89,0x01,0xf6,0x29,
+	0xf2,0x48,0x89,0xfe,0x48,0x8d,0x7f,0xff,
+	0x83,0xc2,0x30,0x88,0x57,0x01,0x89,0xca,
+	0x85,0xc9,0x75,0xdc,0x45,0x85,0xdb,0x75,
+	0x0f,0x49,0x89,0x32,0x83,0xe8,0x01,0x4c,
+	0x29,0xc6,0x29,0xf0,0xc3,0x0f,0x1f,0x00,
+	0x48,0x89,0xfe,0xc6,0x07,0x2d,0x83,0xe8,
+	0x01,0x49,0x89,0x32,0x4c,0x29,0xc6,0x29,
+	0xf0,0xc3,0x66,0x0f,0x1f,0x44,0x00,0x00,
+	0x48,0x89,0xfe,0xc6,0x41,0xff,0x30,0x83,
+	0xe8,0x01,0x49,0x89,0x32,0x4c,0x29,0xc6,
+	0x29,0xf0,0xc3,0x0f,0x1f,0x44,0x00,0x00,
+	0xf7,0xda,0x41,0xbb,0x01,0x00,0x00,0x00,
+	0xeb,0x81,0x66,0x66,0x2e,0x0f,0x1f,0x84,
+	0x00,0x00,0x00,0x00,0x00,0x0f,0x1f,0x00,
+	0x0f,0xb6,0x06,0x84,0xc0,0x0f,0x84,0x34,
+	0x05,0x00,0x00,0x41,0x55,0x49,0x89,0xd5,
+	0x41,0x54,0x55,0x48,0x8d,0x2d,0x6e,0x4a,
+	0x00,0x00,0x53,0x48,0x89,0xfb,0x48,0x83,
+	0xec,0x38,0x66,0x0f,0x1f,0x44,0x00,0x00,
+	0x4c,0x8d,0x66,0x01,0x3c,0x25,0x0f,0x85,
+	0xdc,0x00,0x00,0x00,0x0f,0xb6,0x46,0x01,
+	0x3c,0x6c,0x0f,0x84,0xf8,0x00,0x00,0x00,
+	0x3c,0x7a,0x0f,0x84,0x28,0x01,0x00,0x00,
+	0x83,0xe8,0x64,0x3c,0x14,0x77,0x11,0x0f,
+	0xb6,0xc0,0x48,0x63,0x44,0x85,0x00,0x48,
+	0x01,0xe8,0xff,0xe0,0x0f,0x1f,0x40,0x00,
+	0x48,0x89,0xde,0x48,0x8d,0x3d,0xfe,0x49,
+	0x00,0x00,0xe8,0xd1,0xfb,0xff,0xff,0x41,
+	0x0f,0xbe,0x34,0x24,0x48,0x89,0xdf,0xe8,
+	0x04,0xfb,0xff,0xff,0x48,0x83,0xc4,0x38,
+	0x48,0x89,0xdf,0xbe,0x0a,0x00,0x00,0x00,
+	0x5b,0x5d,0x41,0x5c,0x41,0x5d,0xe9,0xed,
+	0xfa,0xff,0xff,0x0f,0x1f,0x44,0x00,0x00,
+	0x41,0x8b,0x45,0x00,0x83,0xf8,0x2f,0x0f,
+	0x87,0xfb,0x00,0x00,0x00,0x89,0xc2,0x83,
+	0xc0,0x08,0x49,0x03,0x55,0x10,0x41,0x89,
+	0x45,0x00,0x48,0x8b,0x3a,0x48,0x89,0xde,
+	0xe8,0x23,0xfc,0xff,0xff,0x41,0x0f,0xb6,
+	0x44,0x24,0x01,0x49,0x8d,0x74,0x24,0x01,
+	0x84,0xc0,0x0f,0x85,0x58,0xff,0xff,0xff,
+	0x48,0x83,0xc4,0x38,0x5b,0x5d,0x41,0x5c,
+	0x41,0x5d,0xc3,0x0f,0x1f,0x44,0x00,0x00,
+	0x41,0x8b,0x45,0x00,0x83,0xf8,0x2f,0x0f,
+	0x87,0xcb,0x00,0x00,0x00,0x89,0xc2,0x83,
+	0xc0,0x08,0x49,0x03,0x55,0x10,0x41,0x89,
+	0x45,0x00,0x48,0x8b,0x3a,0x48,0x89,0xde,
+	0xe8,0x3b,0xfb,0xff,0xff,0xeb,0xb6,0x66,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0x0f,0xbe,0xf0,0x48,0x89,0xdf,0xe8,0x65,
+	0xfa,0xff,0xff,0x4c,0x89,0xe6,0x0f,0xb6,
+	0x06,0x84,0xc0,0x0f,0x85,0xff,0xfe,0xff,
+	0xff,0x48,0x83,0xc4,0x38,0x5b,0x5d,0x41,
+	0x5c,0x41,0x5d,0xc3,0x0f,0x1f,0x40,0x00,
+	0x0f,0xb6,0x46,0x02,0x4c,0x8d,0x66,0x02,
+	0x3c,0x6c,0x75,0x08,0x0f,0xb6,0x46,0x03,
+	0x4c,0x8d,0x66,0x03,0x83,0xe8,0x64,0x3c,
+	0x14,0x0f,0x87,0x09,0xff,0xff,0xff,0x48,
+	0x8d,0x15,0x7e,0x49,0x00,0x00,0x0f,0xb6,
+	0xc0,0x48,0x63,0x04,0x82,0x48,0x01,0xd0,
+	0xff,0xe0,0x66,0x0f,0x1f,0x44,0x00,0x00,
+	0x0f,0xb6,0x46,0x02,0x4c,0x8d,0x66,0x02,
+	0x83,0xe8,0x64,0x3c,0x14,0x0f,0x87,0xdd,
+	0xfe,0xff,0xff,0x48,0x8d,0x15,0xa6,0x49,
+	0x00,0x00,0x0f,0xb6,0xc0,0x48,0x63,0x04,
+	0x82,0x48,0x01,0xd0,0xff,0xe0,0x66,0x2e,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0x49,0x8b,0x55,0x08,0x48,0x8d,0x42,0x08,
+	0x49,0x89,0x45,0x08,0xe9,0x01,0xff,0xff,
+	0xff,0x0f,0x1f,0x80,0x00,0x00,0x00,0x00,
+	0x49,0x8b,0x55,0x08,0x48,0x8d,0x42,0x08,
+	0x49,0x89,0x45,0x08,0xe9,0x31,0xff,0xff,
+	0xff,0x0f,0x1f,0x80,0x00,0x00,0x00,0x00,
+	0x41,0x8b,0x45,0x00,0x83,0xf8,0x2f,0x0f,
+	0x87,0xbb,0x02,0x00,0x00,0x89,0xc2,0x83,
+	0xc0,0x08,0x49,0x03,0x55,0x10,0x41,0x89,
+	0x45,0x00,0x8b,0x02,0x48,0x8d,0x15,0x5d,
+	0x48,0x00,0x00,0x31,0xff,0x48,0x8d,0x74,
+	0x24,0x17,0xc6,0x44,0x24,0x1a,0x00,0x89,
+	0xc1,0x83,0xe1,0x0f,0x0f,0xb6,0x0c,0x0a,
+	0x88,0x4c,0x24,0x19,0x89,0xc1,0xc1,0xe9,
+	0x04,0x83,0xe1,0x0f,0x0f,0xb6,0x0c,0x0a,
+	0x80,0xf9,0x30,0x88,0x4c,0x24,0x18,0x89,
+	0xc1,0x40,0x0f,0x94,0xc7,0xc1,0xe9,0x08,
+	0x83,0xe1,0x0f,0x48,0x8d,0x7c,0x3c,0x18,
+	0x0f,0xb6,0x0c,0x0a,0x80,0xf9,0x30,0x88,
+	0x4c,0x24,0x17,0x89,0xc1,0x48,0x0f,0x45,
+	0xfe,0xc1,0xe9,0x0c,0x48,0x8d,0x74,0x24,
+	0x16,0x83,0xe1,0x0f,0x0f,0xb6,0x0c,0x0a,
+	0x80,0xf9,0x30,0x88,0x4c,0x24,0x16,0x89,
+	0xc1,0x48,0x0f,0x45,0xfe,0xc1,0xe9,0x10,
+	0x48,0x8d,0x74,0x24,0x15,0x83,0xe1,0x0f,
+	0x0f,0xb6,0x0c,0x0a,0x80,0xf9,0x30,0x88,
+	0x4c,0x24,0x15,0x89,0xc1,0x48,0x0f,0x45,
+	0xfe,0xc1,0xe9,0x14,0x48,0x8d,0x74,0x24,
+	0x14,0x83,0xe1,0x0f,0x0f,0xb6,0x0c,0x0a,
+	0x80,0xf9,0x30,0x88,0x4c,0x24,0x14,0x89,
+	0xc1,0x48,0x0f,0x45,0xfe,0xc1,0xe9,0x18,
+	0x48,0x8d,0x74,0x24,0x13,0x83,0xe1,0x0f,
+	0x0f,0xb6,0x0c,0x0a,0x80,0xf9,0x30,0x88,
+	0x4c,0x24,0x13,0x48,0x0f,0x45,0xfe,0xc1,
+	0xe8,0x1c,0x48,0x89,0xde,0x0f,0xb6,0x04,
+	0x02,0x48,0x8d,0x54,0x24,0x12,0x3c,0x30,
+	0x88,0x44,0x24,0x12,0x0f,0xb7,0x05,0xb9,
+	0x48,0x00,0x00,0x48,0x0f,0x45,0xfa,0x66,
+	0x89,0x47,0xfe,0x48,0x83,0xef,0x02,0xe8,
+	0x64,0xf9,0xff,0xff,0xe9,0xdc,0xfd,0xff,
+	0xff,0x0f,0x1f,0x80,0x00,0x00,0x00,0x00,
+	0x41,0x8b,0x45,0x00,0x83,0xf8,0x2f,0x0f,
+	0x87,0x8b,0x01,0x00,0x00,0x89,0xc2,0x83,
+	0xc0,0x08,0x49,0x03,0x55,0x10,0x41,0x89,
+	0x45,0x00,0x8b,0x32,0xc6,0x44,0x24,0x25,
+	0x00,0x48,0x8d,0x7c,0x24,0x25,0x49,0xb8,
+	0xcd,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0x48,0x89,0xf0,0x48,0x83,0xef,0x01,0x49,
+	0xf7,0xe0,0x48,0x89,0xf0,0x48,0xc1,0xea,
+	0x03,0x48,0x8d,0x0c,0x92,0x48,0x01,0xc9,
+	0x48,0x29,0xc8,0x83,0xc0,0x30,0x88,0x07,
+	0x48,0x89,0xf0,0x48,0x89,0xd6,0x48,0x83,
+	0xf8,0x09,0x77,0xd4,0x48,0x89,0xde,0xe8,
+	0xec,0xf8,0xff,0xff,0xe9,0x64,0xfd,0xff,
+	0xff,0x0f,0x1f,0x80,0x00,0x00,0x00,0x00,
+	0x41,0x8b,0x45,0x00,0x83,0xf8,0x2f,0x0f,
+	0x87,0xfb,0x00,0x00,0x00,0x89,0xc2,0x83,
+	0xc0,0x08,0x49,0x03,0x55,0x10,0x41,0x89,
+	0x45,0x00,0x8b,0x12,0x48,0x8d,0x7c,0x24,
+	0x10,0x48,0x8d,0x4c,0x24,0x08,0xbe,0x0c,
+	0x00,0x00,0x00,0xe8,0xc0,0xfb,0xff,0xff,
+	0x48,0x8b,0x7c,0x24,0x08,0x48,0x89,0xde,
+	0xe8,0xa3,0xf8,0xff,0xff,0xe9,0x1b,0xfd,
+	0xff,0xff,0x66,0x0f,0x1f,0x44,0x00,0x00,
+	0x41,0x8b,0x45,0x00,0x83,0xf8,0x2f,0x0f,
+	0x87,0x83,0x00,0x00,0x00,0x89,0xc2,0x83,
+	0xc0,0x08,0x49,0x03,0x55,0x10,0x41,0x89,
+	0x45,0x00,0x48,0x8b,0x0a,0xc6,0x44,0x24,
+	0x25,0x00,0x48,0x85,0xc9,0x0f,0x88,0x82,
+	0x00,0x00,0x00,0x41,0xb8,0x00,0x00,0x00,
+	0x00,0x0f,0x84,0x51,0x01,0x00,0x00,0x48,
+	0xbf,0xcd,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,
+	0xcc,0x48,0x8d,0x74,0x24,0x24,0x66,0x90,
+	0x48,0x89,0xc8,0x48,0xf7,0xe7,0x48,0xc1,
+	0xea,0x03,0x48,0x8d,0x04,0x92,0x48,0x01,
+	0xc0,0x48,0x29,0xc1,0x48,0x89,0xf0,0x48,
+	0x8d,0x76,0xff,0x83,0xc1,0x30,0x88,0x4e,
+	0x01,0x48,0x89,0xd1,0x48,0x85,0xd2,0x75,
+	0xd7,0x45,0x85,0xc0,0x74,0x06,0xc6,0x06,
+	0x2d,0x48,0x89,0xf0,0x48,0x89,0xde,0x48,
+	0x89,0xc7,0xe8,0x11,0xf8,0xff,0xff,0xe9,
+	0x89,0xfc,0xff,0xff,0x0f,0x1f,0x40,0x00,
+	0x49,0x8b,0x55,0x08,0x48,0x8d,0x42,0x08,
+	0x49,0x89,0x45,0x08,0x48,0x8b,0x0a,0xc6,
+	0x44,0x24,0x25,0x00,0x48,0x85,0xc9,0x0f,
+	0x89,0x7e,0xff,0xff,0xff,0x48,0xf7,0xd9,
+	0x41,0xb8,0x01,0x00,0x00,0x00,0xe9,0x7c,
+	0xff,0xff,0xff,0x0f,0x1f,0x44,0x00,0x00,
+	0x49,0x8b,0x55,0x08,0x48,0x8d,0x42,0x08,
+	0x49,0x89,0x45,0x08,0xe9,0x01,0xff,0xff,
+	0xff,0x0f,0x1f,0x80,0x00,0x00,0x00,0x00,
+	0x49,0x8b,0x55,0x08,0x48,0x8d,0x42,0x08,
+	0x49,0x89,0x45,0x08,0xe9,0x71,0xfe,0xff,
+	0xff,0x0f,0x1f,0x80,0x00,0x00,0x00,0x00,
+	0x49,0x8b,0x55,0x08,0x48,0x8d,0x42,0x08,
+	0x49,0x89,0x45,0x08,0xe9,0x41,0xfd,0xff,
+	0xff,0x0f,0x1f,0x80,0x00,0x00,0x00,0x00,
+	0x41,0x8b,0x55,0x00,0x83,0xfa,0x2f,0x76,
+	0x60,0x49,0x8b,0x45,0x08,0x48,0x8d,0x50,
+	0x08,0x49,0x89,0x55,0x08,0x48,0x8b,0x30,
+	0xc6,0x44,0x24,0x25,0x00,0x48,0x8d,0x7c,
+	0x24,0x25,0x49,0xb8,0xcd,0xcc,0xcc,0xcc,
+	0xcc,0xcc,0xcc,0xcc,0x0f,0x1f,0x40,0x00,
+	0x48,0x89,0xf0,0x48,0x83,0xef,0x01,0x49,
+	0xf7,0xe0,0x48,0x89,0xf0,0x48,0xc1,0xea,
+	0x03,0x48,0x8d,0x0c,0x92,0x48,0x01,0xc9,
+	0x48,0x29,0xc8,0x83,0xc0,0x30,0x88,0x07,
+	0x48,0x89,0xf0,0x48,0x89,0xd6,0x48,0x83,
+	0xf8,0x09,0x77,0xd4,0x48,0x89,0xde,0xe8,
+	0x2c,0xf7,0xff,0xff,0xe9,0xa4,0xfb,0xff,
+	0xff,0x89,0xd0,0x83,0xc2,0x08,0x49,0x03,
+	0x45,0x10,0x41,0x89,0x55,0x00,0xeb,0x9d,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0xc6,0x44,0x24,0x24,0x30,0x48,0x8d,0x44,
+	0x24,0x24,0xe9,0xe5,0xfe,0xff,0xff,0xc3,
+	0x41,0x57,0x41,0x56,0x41,0x55,0x41,0x54,
+	0x55,0x53,0x48,0x89,0xf3,0x48,0x81,0xec,
+	0x28,0x02,0x00,0x00,0x48,0x89,0x94,0x24,
+	0x80,0x01,0x00,0x00,0x48,0x89,0x8c,0x24,
+	0x88,0x01,0x00,0x00,0x4c,0x89,0x84,0x24,
+	0x90,0x01,0x00,0x00,0x4c,0x89,0x8c,0x24,
+	0x98,0x01,0x00,0x00,0x84,0xc0,0x74,0x40,
+	0x0f,0x29,0x84,0x24,0xa0,0x01,0x00,0x00,
+	0x0f,0x29,0x8c,0x24,0xb0,0x01,0x00,0x00,
+	0x0f,0x29,0x94,0x24,0xc0,0x01,0x00,0x00,
+	0x0f,0x29,0x9c,0x24,0xd0,0x01,0x00,0x00,
+	0x0f,0x29,0xa4,0x24,0xe0,0x01,0x00,0x00,
+	0x0f,0x29,0xac,0x24,0xf0,0x01,0x00,0x00,
+	0x0f,0x29,0xb4,0x24,0x00,0x02,0x00,0x00,
+	0x0f,0x29,0xbc,0x24,0x10,0x02,0x00,0x00,
+	0x39,0x3d,0xc2,0x1f,0x00,0x00,0x73,0x18,
+	0x48,0x81,0xc4,0x28,0x02,0x00,0x00,0x5b,
+	0x5d,0x41,0x5c,0x41,0x5d,0x41,0x5e,0x41,
+	0x5f,0xc3,0x66,0x0f,0x1f,0x44,0x00,0x00,
+	0x4c,0x8d,0x64,0x24,0x50,0x48,0x83,0x3d,
+	0x3b,0x20,0x00,0x00,0x00,0x4c,0x89,0xa4,
+	0x24,0x50,0x01,0x00,0x00,0x0f,0x85,0x35,
+	0x01,0x00,0x00,0x4c,0x8d,0x6c,0x24,0x30,
+	0x4c,0x8d,0x7c,0x24,0x18,0x4c,0x8d,0x74,
+	0x24,0x24,0xe8,0xe1,0x0d,0x00,0x00,0x4c,
+	0x89,0xf9,0xbe,0x0c,0x00,0x00,0x00,0x4c,
+	0x89,0xf7,0x89,0xc2,0xe8,0x37,0xf9,0xff,
+	0xff,0x48,0x8b,0x94,0x24,0x50,0x01,0x00,
+	0x00,0x48,0x8b,0x74,0x24,0x18,0x48,0x63,
+	0xe8,0xc6,0x02,0x70,0x48,0x8b,0x94,0x24,
+	0x50,0x01,0x00,0x00,0xc6,0x42,0x01,0x69,
+	0x48,0x8b,0x94,0x24,0x50,0x01,0x00,0x00,
+	0xc6,0x42,0x02,0x65,0x48,0x8b,0x94,0x24,
+	0x50,0x01,0x00,0x00,0xc6,0x42,0x03,0x3a,
+	0x48,0x8b,0x94,0x24,0x50,0x01,0x00,0x00,
+	0xc6,0x42,0x04,0x20,0x48,0x8b,0x84,0x24,
+	0x50,0x01,0x00,0x00,0x48,0x89,0xea,0x48,
+	0x8d,0x78,0x05,0xe8,0x5c,0x0a,0x00,0x00,
+	0x4c,0x89,0xea,0x48,0x89,0xde,0x4c,0x89,
+	0xe7,0x48,0x8b,0x84,0x24,0x50,0x01,0x00,
+	0x00,0xc6,0x44,0x28,0x05,0x3a,0x48,0x8b,
+	0x84,0x24,0x50,0x01,0x00,0x00,0xc6,0x44,
+	0x28,0x06,0x20,0x48,0x8b,0x84,0x24,0x50,
+	0x01,0x00,0x00,0xc7,0x44,0x24,0x30,0x10,
+	0x00,0x00,0x00,0x48,0x8d,0x44,0x28,0x07,
+	0xc7,0x44,0x24,0x34,0x30,0x00,0x00,0x00,
+	0x48,0x89,0x84,0x24,0x50,0x01,0x00,0x00,
+	0x4c,0x29,0xe0,0x89,0x84,0x24,0x58,0x01,
+	0x00,0x00,0x48,0x8d,0x05,0x27,0xf5,0xff,
+	0xff,0x48,0x89,0x84,0x24,0x60,0x01,0x00,
+	0x00,0x48,0x8d,0x84,0x24,0x60,0x02,0x00,
+	0x00,0x48,0x89,0x44,0x24,0x38,0x48,0x8d,
+	0x84,0x24,0x70,0x01,0x00,0x00,0x48,0x89,
+	0x44,0x24,0x40,0xe8,0x10,0xf9,0xff,0xff,
+	0x48,0x63,0x84,0x24,0x58,0x01,0x00,0x00,
+	0x48,0x8b,0x94,0x24,0x50,0x01,0x00,0x00,
+	0x4c,0x01,0xe0,0x48,0x39,0xc2,0x0f,0x84,
+	0xb4,0xfe,0xff,0xff,0x8b,0x3d,0x72,0x1e,
+	0x00,0x00,0x4c,0x29,0xe2,0x4c,0x89,0xe6,
+	0xe8,0xe3,0x09,0x00,0x00,0xe9,0x9e,0xfe,
+	0xff,0xff,0x66,0x0f,0x1f,0x44,0x00,0x00,
+	0x48,0x8b,0x05,0xe1,0x1e,0x00,0x00,0x4c,
+	0x8d,0x6c,0x24,0x30,0x31,0xf6,0x4c,0x89,
+	0xef,0x48,0x85,0xc0,0x0f,0x84,0x7e,0x01,
+	0x00,0x00,0xff,0xd0,0x48,0x8b,0x44,0x24,
+	0x38,0x48,0x8b,0x0d,0xd8,0x1e,0x00,0x00,
+	0x48,0x8b,0x54,0x24,0x30,0x48,0x2b,0x15,
+	0xc4,0x1e,0x00,0x00,0x48,0x89,0x54,0x24,
+	0x30,0x48,0x39,0xc8,0x0f,0x8c,0x3e,0x01,
+	0x00,0x00,0x48,0x29,0xc8,0x4c,0x8d,0x7c,
+	0x24,0x18,0x4c,0x8d,0x74,0x24,0x24,0xbe,
+	0x0c,0x00,0x00,0x00,0x48,0x89,0x44,0x24,
+	0x38,0x4c,0x89,0xf9,0x4c,0x89,0xf7,0xe8,
+	0xc4,0xf7,0xff,0xff,0x48,0x8b,0x4c,0x24,
+	0x18,0x83,0xf8,0x01,0x7f,0x30,0xba,0x01,
+	0x00,0x00,0x00,0xbe,0x30,0x00,0x00,0x00,
+	0x29,0xc2,0x48,0x89,0xd1,0x48,0x83,0xc2,
+	0x01,0x48,0xf7,0xd1,0x48,0x03,0x4c,0x24,
+	0x18,0x48,0x89,0xcf,0xe8,0x87,0x08,0x00,
+	0x00,0x48,0x89,0x44,0x24,0x18,0x48,0x89,
+	0xc1,0xb8,0x02,0x00,0x00,0x00,0x48,0x8b,
+	0x94,0x24,0x50,0x01,0x00,0x00,0x48,0x63,
+	0xe8,0x48,0x89,0xce,0xc6,0x02,0x28,0x48,
+	0x8b,0x84,0x24,0x50,0x01,0x00,0x00,0x48,
+	0x89,0xea,0x48,0x8d,0x78,0x01,0xe8,0xe1,
+	0x08,0x00,0x00,0x4c,0x89,0xf9,0xbe,0x0c,
+	0x00,0x00,0x00,0x4c,0x89,0xf7,0x48,0x8b,
+	0x84,0x24,0x50,0x01,0x00,0x00,0xc6,0x44,
+	0x28,0x01,0x2e,0x8b,0x54,0x24,0x38,0x48,
+	0x8d,0x45,0x02,0x48,0x01,0x84,0x24,0x50,
+	0x01,0x00,0x00,0xe8,0x38,0xf7,0xff,0xff,
+	0x48,0x8b,0x4c,0x24,0x18,0x89,0xc5,0x83,
+	0xf8,0x05,0x7f,0x30,0xba,0x05,0x00,0x00,
+	0x00,0xbe,0x30,0x00,0x00,0x00,0xbd,0x06,
+	0x00,0x00,0x00,0x29,0xc2,0x48,0x89,0xd1,
+	0x48,0x83,0xc2,0x01,0x48,0xf7,0xd1,0x48,
+	0x03,0x4c,0x24,0x18,0x48,0x89,0xcf,0xe8,
+	0xf4,0x07,0x00,0x00,0x48,0x89,0x44,0x24,
+	0x18,0x48,0x89,0xc1,0x48,0x8b,0xbc,0x24,
+	0x50,0x01,0x00,0x00,0x48,0x63,0xd5,0x48,
+	0x89,0xce,0x48,0x89,0x54,0x24,0x08,0xe8,
+	0x60,0x08,0x00,0x00,0x48,0x8b,0x84,0x24,
+	0x50,0x01,0x00,0x00,0x48,0x8b,0x54,0x24,
+	0x08,0xc6,0x04,0x10,0x29,0x8d,0x45,0x01,
+	0x48,0x8b,0x94,0x24,0x50,0x01,0x00,0x00,
+	0x83,0xc5,0x02,0x48,0x98,0x48,0x63,0xed,
+	0xc6,0x04,0x02,0x20,0x48,0x01,0xac,0x24,
+	0x50,0x01,0x00,0x00,0xe9,0x61,0xfd,0xff,
+	0xff,0x0f,0x1f,0x80,0x00,0x00,0x00,0x00,
+	0x48,0x83,0xea,0x01,0x48,0x29,0xc8,0x48,
+	0x89,0x54,0x24,0x30,0x48,0x05,0x40,0x42,
+	0x0f,0x00,0xe9,0xae,0xfe,0xff,0xff,0x90,
+	0xe8,0x03,0x0a,0x00,0x00,0xe9,0x7a,0xfe,
+	0xff,0xff,0x66,0x0f,0x1f,0x44,0x00,0x00,
+	0x55,0x48,0x89,0xfd,0x53,0x48,0x81,0xec,
+	0xf8,0x01,0x00,0x00,0x48,0x89,0x94,0x24,
+	0x50,0x01,0x00,0x00,0x48,0x89,0x8c,0x24,
+	0x58,0x01,0x00,0x00,0x4c,0x89,0x84,0x24,
+	0x60,0x01,0x00,0x00,0x4c,0x89,0x8c,0x24,
+	0x68,0x01,0x00,0x00,0x84,0xc0,0x74,0x40,
+	0x0f,0x29,0x84,0x24,0x70,0x01,0x00,0x00,
+	0x0f,0x29,0x8c,0x24,0x80,0x01,0x00,0x00,
+	0x0f,0x29,0x94,0x24,0x90,0x01,0x00,0x00,
+	0x0f,0x29,0x9c,0x24,0xa0,0x01,0x00,0x00,
+	0x0f,0x29,0xa4,0x24,0xb0,0x01,0x00,0x00,
+	0x0f,0x29,0xac,0x24,0xc0,0x01,0x00,0x00,
+	0x0f,0x29,0xb4,0x24,0xd0,0x01,0x00,0x00,
+	0x0f,0x29,0xbc,0x24,0xe0,0x01,0x00,0x00,
+	0x48,0x8d,0x5c,0x24,0x20,0x48,0x8d,0x84,
+	0x24,0x10,0x02,0x00,0x00,0x48,0xc7,0x84,
+	0x24,0x30,0x01,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x48,0x89,0x44,0x24,0x10,0x48,0x8d,
+	0x54,0x24,0x08,0x48,0x8d,0x84,0x24,0x40,
+	0x01,0x00,0x00,0x48,0x89,0xdf,0x48,0x89,
+	0x44,0x24,0x18,0x48,0x89,0x9c,0x24,0x20,
+	0x01,0x00,0x00,0xc7,0x44,0x24,0x08,0x10,
+	0x00,0x00,0x00,0xc7,0x44,0x24,0x0c,0x30,
+	0x00,0x00,0x00,0xe8,0x70,0xf6,0xff,0xff,
+	0x48,0x8b,0x84,0x24,0x20,0x01,0x00,0x00,
+	0xc6,0x00,0x00,0x48,0x8b,0xb4,0x24,0x20,
+	0x01,0x00,0x00,0x48,0x39,0xde,0x72,0x1e,
+	0x48,0x83,0xc6,0x01,0x48,0x89,0xd8,0x90,
+	0x0f,0xb6,0x08,0x48,0x89,0xc2,0x48,0x83,
+	0xc0,0x01,0x48,0x29,0xda,0x88,0x4c,0x15,
+	0x00,0x48,0x39,0xf0,0x75,0xea,0x48,0x81,
+	0xc4,0xf8,0x01,0x00,0x00,0x5b,0x5d,0xc3,
+	0x48,0x83,0xec,0x18,0xba,0x01,0x00,0x00,
+	0x00,0x40,0x88,0x74,0x24,0x0c,0x48,0x8d,
+	0x74,0x24,0x0c,0xe8,0x18,0x07,0x00,0x00,
+	0x48,0x83,0xc4,0x18,0xc3,0x0f,0x1f,0x00,
+	0x0f,0xb6,0x06,0x84,0xc0,0x74,0x49,0x41,
+	0x54,0x55,0x89,0xfd,0x53,0x48,0x89,0xf3,
+	0x48,0x83,0xec,0x10,0x4c,0x8d,0x64,0x24,
+	0x0f,0x0f,0x1f,0x80,0x00,0x00,0x00,0x00,
+	0xba,0x01,0x00,0x00,0x00,0x4c,0x89,0xe6,
+	0x89,0xef,0x48,0x83,0xc3,0x01,0x88,0x44,
+	0x24,0x0f,0xe8,0xd9,0x06,0x00,0x00,0x0f,
+	0xb6,0x03,0x84,0xc0,0x75,0xe2,0x48,0x83,
+	0xc4,0x10,0x5b,0x5d,0x41,0x5c,0xc3,0x66,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0xc3,0x66,0x66,0x2e,0x0f,0x1f,0x84,0x00,
+	0x00,0x00,0x00,0x00,0x0f,0x1f,0x40,0x00,
+	0x0f,0xb6,0x06,0x84,0xc0,0x0f,0x84,0x41,
+	0x03,0x00,0x00,0x41,0x57,0x48,0x89,0xf1,
+	0x41,0x56,0x41,0x55,0x49,0x89,0xd5,0x41,
+	0x54,0x55,0x53,0x89,0xfb,0x48,0x83,0xec,
+	0x48,0x4c,0x8d,0x64,0x24,0x1f,0x4c,0x8d,
+	0x74,0x24,0x20,0xeb,0x33,0x0f,0x1f,0x00,
+	0x0f,0xb6,0x41,0x01,0x3c,0x6c,0x74,0x68,
+	0x48,0x8d,0x69,0x01,0x3c,0x73,0x0f,0x84,
+	0xbc,0x00,0x00,0x00,0x3c,0x78,0x0f,0x84,
+	0xbc,0x01,0x00,0x00,0x3c,0x64,0x0f,0x84,
+	0x04,0x01,0x00,0x00,0x0f,0xb6,0x45,0x01,
+	0x48,0x8d,0x4d,0x01,0x84,0xc0,0x74,0x2d,
+	0x3c,0x25,0x74,0xcc,0xba,0x01,0x00,0x00,
+	0x00,0x4c,0x89,0xf6,0x89,0xdf,0x48,0x89,
+	0x4c,0x24,0x08,0x88,0x44,0x24,0x20,0xe8,
+	0x34,0x06,0x00,0x00,0x48,0x8b,0x6c,0x24,
+	0x08,0x0f,0xb6,0x45,0x01,0x48,0x8d,0x4d,
+	0x01,0x84,0xc0,0x75,0xd3,0x48,0x83,0xc4,
+	0x48,0x5b,0x5d,0x41,0x5c,0x41,0x5d,0x41,
+	0x5e,0x41,0x5f,0xc3,0x0f,0x1f,0x40,0x00,
+	0x0f,0xb6,0x41,0x02,0x48,0x8d,0x69,0x02,
+	0x3c,0x6c,0x75,0x08,0x0f,0xb6,0x41,0x03,
+	0x48,0x8d,0x69,0x03,0x3c,0x73,0x74,0x48,
+	0x3c,0x78,0x0f,0x84,0xb0,0x01,0x00,0x00,
+	0x3c,0x64,0x75,0x90,0x41,0x8b,0x45,0x00,
+	0x83,0xf8,0x2f,0x0f,0x87,0x4f,0x02,0x00,
+	0x00,0x89,0xc2,0x83,0xc0,0x08,0x49,0x03,
+	0x55,0x10,0x41,0x89,0x45,0x00,0x4c,0x8b,
+	0x0a,0xc6,0x44,0x24,0x3f,0x00,0x4d,0x85,
+	0xc9,0x0f,0x89,0x94,0x00,0x00,0x00,0x49,
+	0xf7,0xd9,0xbf,0x01,0x00,0x00,0x00,0xe9,
+	0x92,0x00,0x00,0x00,0x0f,0x1f,0x40,0x00,
+	0x41,0x8b,0x45,0x00,0x83,0xf8,0x2f,0x0f,
+	0x87,0xbb,0x01,0x00,0x00,0x89,0xc2,0x83,
+	0xc0,0x08,0x49,0x03,0x55,0x10,0x41,0x89,
+	0x45,0x00,0x4c,0x8b,0x3a,0x41,0x0f,0xb6,
+	0x07,0x84,0xc0,0x0f,0x84,0x2b,0xff,0xff,
+	0xff,0x0f,0x1f,0x80,0x00,0x00,0x00,0x00,
+	0xba,0x01,0x00,0x00,0x00,0x4c,0x89,0xf6,
+	0x89,0xdf,0x49,0x83,0xc7,0x01,0x88,0x44,
+	0x24,0x20,0xe8,0x69,0x05,0x00,0x00,0x41,
+	0x0f,0xb6,0x07,0x84,0xc0,0x75,0xe1,0xe9,
+	0x00,0xff,0xff,0xff,0x0f,0x1f,0x40,0x00,
+	0x41,0x8b,0x45,0x00,0x83,0xf8,0x2f,0x0f,
+	0x87,0xa3,0x01,0x00,0x00,0x89,0xc2,0x83,
+	0xc0,0x08,0x49,0x03,0x55,0x10,0x41,0x89,
+	0x45,0x00,0x4c,0x63,0x0a,0xc6,0x44,0x24,
+	0x3f,0x00,0x4d,0x85,0xc9,0x0f,0x88,0x6c,
+	0xff,0xff,0xff,0xbf,0x00,0x00,0x00,0x00,
+	0x0f,0x84,0xaa,0x01,0x00,0x00,0x48,0x8d,
+	0x74,0x24,0x3e,0x0f,0x1f,0x44,0x00,0x00,
+	0x48,0xb8,0xcd,0xcc,0xcc,0xcc,0xcc,0xcc,
+	0xcc,0xcc,0x4c,0x89,0xc9,0x49,0x89,0xf7,
+	0x49,0xf7,0xe1,0x48,0x8d,0x76,0xff,0x48,
+	0xc1,0xea,0x03,0x48,0x8d,0x04,0x92,0x49,
+	0x89,0xd1,0x48,0x01,0xc0,0x48,0x29,0xc1,
+	0x83,0xc1,0x30,0x88,0x4e,0x01,0x48,0x85,
+	0xd2,0x75,0xcd,0x85,0xff,0x74,0x11,0xc6,
+	0x06,0x2d,0x49,0x89,0xf7,0xb9,0x2d,0x00,
+	0x00,0x00,0x66,0x0f,0x1f,0x44,0x00,0x00,
+	0xba,0x01,0x00,0x00,0x00,0x4c,0x89,0xe6,
+	0x89,0xdf,0x49,0x83,0xc7,0x01,0x88,0x4c,
+	0x24,0x1f,0xe8,0xb9,0x04,0x00,0x00,0x41,
+	0x0f,0xb6,0x0f,0x84,0xc9,0x75,0xe1,0xe9,
+	0x50,0xfe,0xff,0xff,0x0f,0x1f,0x40,0x00,
+	0x41,0x8b,0x45,0x00,0x83,0xf8,0x2f,0x0f,
+	0x87,0xdb,0x00,0x00,0x00,0x89,0xc2,0x83,
+	0xc0,0x08,0x49,0x03,0x55,0x10,0x41,0x89,
+	0x45,0x00,0x48,0x63,0x12,0x48,0x8d,0x74,
+	0x24,0x3e,0xc6,0x44,0x24,0x3f,0x00,0x48,
+	0x85,0xd2,0x75,0x6c,0xc6,0x44,0x24,0x3e,
+	0x30,0xb8,0x30,0x00,0x00,0x00,0x49,0x89,
+	0xf7,0x0f,0x1f,0x80,0x00,0x00,0x00,0x00,
+	0xba,0x01,0x00,0x00,0x00,0x4c,0x89,0xe6,
+	0x89,0xdf,0x49,0x83,0xc7,0x01,0x88,0x44,
+	0x24,0x1f,0xe8,0x51,0x04,0x00,0x00,0x41,
+	0x0f,0xb6,0x07,0x84,0xc0,0x75,0xe1,0xe9,
+	0xe8,0xfd,0xff,0xff,0x0f,0x1f,0x40,0x00,
+	0x41,0x8b,0x45,0x00,0x83,0xf8,0x2f,0x77,
+	0x67,0x89,0xc2,0x83,0xc0,0x08,0x49,0x03,
+	0x55,0x10,0x41,0x89,0x45,0x00,0x48,0x8b,
+	0x12,0x48,0x8d,0x74,0x24,0x3e,0xc6,0x44,
+	0x24,0x3f,0x00,0x48,0x85,0xd2,0x74,0x9c,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0x48,0x89,0xd0,0x48,0x8d,0x3d,0xa6,0x3e,
+	0x00,0x00,0x49,0x89,0xf7,0x83,0xe0,0x0f,
+	0x48,0xc1,0xea,0x04,0x48,0x8d,0x76,0xff,
+	0x0f,0xb6,0x04,0x07,0x88,0x46,0x01,0x75,
+	0xdf,0xeb,0xa0,0x0f,0x1f,0x44,0x00,0x00,
+	0x49,0x8b,0x55,0x08,0x48,0x8d,0x42,0x08,
+	0x49,0x89,0x45,0x08,0xe9,0x41,0xfe,0xff,
+	0xff,0x0f,0x1f,0x80,0x00,0x00,0x00,0x00,
+	0x49,0x8b,0x55,0x08,0x48,0x8d,0x42,0x08,
+	0x49,0x89,0x45,0x08,0xeb,0x98,0x66,0x90,
+	0x49,0x8b,0x55,0x08,0x48,0x8d,0x42,0x08,
+	0x49,0x89,0x45,0x08,0xe9,0x21,0xff,0xff,
+	0xff,0x0f,0x1f,0x80,0x00,0x00,0x00,0x00,
+	0x49,0x8b,0x55,0x08,0x48,0x8d,0x42,0x08,
+	0x49,0x89,0x45,0x08,0xe9,0x59,0xfe,0xff,
+	0xff,0x0f,0x1f,0x80,0x00,0x00,0x00,0x00,
+	0x49,0x8b,0x55,0x08,0x48,0x8d,0x42,0x08,
+	0x49,0x89,0x45,0x08,0xe9,0xad,0xfd,0xff,
+	0xff,0x0f,0x1f,0x80,0x00,0x00,0x00,0x00,
+	0xc6,0x44,0x24,0x3e,0x30,0x4c,0x8d,0x7c,
+	0x24,0x3e,0xb9,0x30,0x00,0x00,0x00,0xe9,
+	0x94,0xfe,0xff,0xff,0xc3,0x0f,0x1f,0x00,
+	0x48,0x81,0xec,0xd8,0x00,0x00,0x00,0x48,
+	0x89,0x54,0x24,0x30,0x48,0x89,0x4c,0x24,
+	0x38,0x4c,0x89,0x44,0x24,0x40,0x4c,0x89,
+	0x4c,0x24,0x48,0x84,0xc0,0x74,0x37,0x0f,
+	0x29,0x44,0x24,0x50,0x0f,0x29,0x4c,0x24,
+	0x60,0x0f,0x29,0x54,0x24,0x70,0x0f,0x29,
+	0x9c,0x24,0x80,0x00,0x00,0x00,0x0f,0x29,
+	0xa4,0x24,0x90,0x00,0x00,0x00,0x0f,0x29,
+	0xac,0x24,0xa0,0x00,0x00,0x00,0x0f,0x29,
+	0xb4,0x24,0xb0,0x00,0x00,0x00,0x0f,0x29,
+	0xbc,0x24,0xc0,0x00,0x00,0x00,0x48,0x8d,
+	0x84,0x24,0xe0,0x00,0x00,0x00,0x48,0x8d,
+	0x54,0x24,0x08,0xc7,0x44,0x24,0x08,0x10,
+	0x00,0x00,0x00,0x48,0x89,0x44,0x24,0x10,
+	0x48,0x8d,0x44,0x24,0x20,0xc7,0x44,0x24,
+	0x0c,0x30,0x00,0x00,0x00,0x48,0x89,0x44,
+	0x24,0x18,0xe8,0x29,0xfc,0xff,0xff,0x48,
+	0x81,0xc4,0xd8,0x00,0x00,0x00,0xc3,0x90,
+	0x41,0x89,0xd0,0x83,0xfa,0x01,0x49,0x89,
+	0xf1,0x0f,0x94,0xc2,0x41,0x83,0xf8,0x24,
+	0x0f,0x97,0xc0,0x08,0xc2,0x41,0x89,0xd2,
+	0x0f,0x85,0x92,0x00,0x00,0x00,0x66,0x90,
+	0x0f,0xb6,0x17,0x8d,0x42,0xf7,0x3c,0x04,
+	0x0f,0x86,0x92,0x00,0x00,0x00,0x80,0xfa,
+	0x20,0x0f,0x84,0x89,0x00,0x00,0x00,0x84,
+	0xd2,0x74,0x75,0x80,0xfa,0x2d,0x0f,0x84,
+	0xcc,0x00,0x00,0x00,0x45,0x85,0xc0,0x0f,
+	0x84,0x83,0x00,0x00,0x00,0x41,0x83,0xf8,
+	0x10,0x0f,0x84,0x11,0x01,0x00,0x00,0x84,
+	0xd2,0x0f,0x84,0x5e,0x01,0x00,0x00,0x31,
+	0xc0,0x4d,0x63,0xd8,0x0f,0x1f,0x40,0x00,
+	0x8d,0x4a,0xf7,0x80,0xf9,0x04,0x0f,0x86,
+	0xd7,0x00,0x00,0x00,0x80,0xfa,0x20,0x0f,
+	0x84,0xce,0x00,0x00,0x00,0x89,0xd6,0x0f,
+	0xb6,0xca,0x83,0xe6,0xdf,0x83,0xee,0x41,
+	0x40,0x80,0xfe,0x19,0x0f,0x86,0x96,0x00,
+	0x00,0x00,0x83,0xea,0x30,0x80,0xfa,0x09,
+	0x0f,0x86,0xc2,0x00,0x00,0x00,0x4d,0x85,
+	0xc9,0x74,0x03,0x49,0x89,0x39,0x45,0x84,
+	0xd2,0x74,0x03,0x48,0xf7,0xd8,0xc3,0x90,
+	0x4d,0x85,0xc9,0x74,0x03,0x49,0x89,0x39,
+	0x31,0xc0,0xc3,0x0f,0x1f,0x44,0x00,0x00,
+	0x48,0x83,0xc7,0x01,0xe9,0x57,0xff,0xff,
+	0xff,0x0f,0x1f,0x80,0x00,0x00,0x00,0x00,
+	0x41,0xb8,0x0a,0x00,0x00,0x00,0x80,0xfa,
+	0x30,0x0f,0x85,0x78,0xff,0xff,0xff,0x0f,
+	0xb6,0x57,0x01,0x8d,0x4a,0xbf,0x8d,0x42,
+	0x20,0x80,0xf9,0x1a,0x0f,0x43,0xc2,0x3c,
+	0x62,0x0f,0x84,0xb3,0x00,0x00,0x00,0x3c,
+	0x78,0x0f,0x84,0x98,0x00,0x00,0x00,0x48,
+	0x83,0xc7,0x01,0x41,0xb8,0x08,0x00,0x00,
+	0x00,0xe9,0x49,0xff,0xff,0xff,0x66,0x90,
+	0x0f,0xb6,0x57,0x01,0x41,0xba,0x01,0x00,
+	0x00,0x00,0x48,0x83,0xc7,0x01,0xe9,0x21,
+	0xff,0xff,0xff,0x0f,0x1f,0x44,0x00,0x00,
+	0x8d,0x72,0xbf,0x83,0xc2,0x20,0x0f,0xb6,
+	0xd2,0x40,0x80,0xfe,0x1a,0x0f,0x42,0xca,
+	0x83,0xe9,0x57,0x41,0x39,0xc8,0x0f,0x82,
+	0x5a,0xff,0xff,0xff,0x49,0x0f,0xaf,0xc3,
+	0x48,0x01,0xc8,0x0f,0xb6,0x57,0x01,0x48,
+	0x83,0xc7,0x01,0x84,0xd2,0x0f,0x85,0x0d,
+	0xff,0xff,0xff,0xe9,0x3e,0xff,0xff,0xff,
+	0x83,0xe9,0x30,0xeb,0xd6,0x0f,0x1f,0x00,
+	0x80,0xfa,0x30,0x0f,0x85,0xe6,0xfe,0xff,
+	0xff,0x0f,0xb6,0x47,0x01,0x8d,0x70,0xbf,
+	0x8d,0x48,0x20,0x40,0x80,0xfe,0x1a,0x0f,
+	0x42,0xc1,0x3c,0x78,0x0f,0x85,0xd5,0xfe,
+	0xff,0xff,0x0f,0xb6,0x57,0x02,0x48,0x83,
+	0xc7,0x02,0xe9,0xc0,0xfe,0xff,0xff,0x0f,
+	0xb6,0x57,0x02,0x41,0xb8,0x10,0x00,0x00,
+	0x00,0x48,0x83,0xc7,0x02,0xe9,0xad,0xfe,
+	0xff,0xff,0x0f,0xb6,0x57,0x02,0x41,0xb8,
+	0x02,0x00,0x00,0x00,0x48,0x83,0xc7,0x02,
+	0xe9,0x9a,0xfe,0xff,0xff,0x31,0xc0,0xe9,
+	0xda,0xfe,0xff,0xff,0x66,0x66,0x2e,0x0f,
+	0x1f,0x84,0x00,0x00,0x00,0x00,0x00,0x90,
+	0x48,0x85,0xd2,0x74,0x2c,0x31,0xc9,0xeb,
+	0x10,0x0f,0x1f,0x80,0x00,0x00,0x00,0x00,
+	0x48,0x83,0xc1,0x01,0x48,0x39,0xca,0x74,
+	0x17,0x0f,0xb6,0x04,0x0f,0x44,0x0f,0xb6,
+	0x04,0x0e,0x44,0x29,0xc0,0x74,0xe9,0xc3,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0xc3,0x31,0xc0,0xc3,0x66,0x66,0x2e,0x0f,
+	0x1f,0x84,0x00,0x00,0x00,0x00,0x00,0x90,
+	0x48,0x89,0xf8,0x48,0x89,0xf9,0x4c,0x8d,
+	0x04,0x3a,0x48,0x85,0xd2,0x74,0x0d,0x90,
+	0x40,0x88,0x31,0x48,0x83,0xc1,0x01,0x4c,
+	0x39,0xc1,0x75,0xf4,0xc3,0x0f,0x1f,0x00,
+	0x31,0xc0,0xeb,0x0c,0x0f,0x1f,0x40,0x00,
+	0x48,0x83,0xc0,0x01,0x84,0xd2,0x74,0x10,
+	0x0f,0xb6,0x14,0x07,0x3a,0x14,0x06,0x74,
+	0xef,0x19,0xc0,0x83,0xc8,0x01,0xc3,0x90,
+	0x31,0xc0,0xc3,0x66,0x66,0x2e,0x0f,0x1f,
+	0x84,0x00,0x00,0x00,0x00,0x00,0x66,0x90,
+	0x48,0x85,0xd2,0x74,0x33,0x31,0xc0,0xeb,
+	0x14,0x0f,0x1f,0x80,0x00,0x00,0x00,0x00,
+	0x84,0xc9,0x74,0x24,0x48,0x83,0xc0,0x01,
+	0x48,0x39,0xc2,0x74,0x1b,0x0f,0xb6,0x0c,
+	0x07,0x3a,0x0c,0x06,0x74,0xea,0x0f,0x9d,
+	0xc0,0x0f,0xb6,0xc0,0x8d,0x44,0x00,0xff,
+	0xc3,0x0f,0x1f,0x80,0x00,0x00,0x00,0x00,
+	0x31,0xc0,0xc3,0x90,0x48,0x89,0xf8,0x48,
+	0x89,0xd1,0x48,0xc1,0xe9,0x03,0x83,0xe2,
+	0x07,0xf3,0x48,0xa5,0x89,0xd1,0xf3,0xa4,
+	0xc3,0x0f,0x1f,0x00,0x49,0x89,0xca,0x0f,
+	0x05,0xc3,0x66,0x90,0x48,0xc7,0xc0,0x0f,
+	0x00,0x00,0x00,0x0f,0x05,0x0f,0x1f,0x00,
+	0xb8,0x00,0x00,0x00,0x00,0xeb,0xe5,0x90,
+	0xb8,0x01,0x00,0x00,0x00,0xeb,0xdd,0x90,
+	0xb8,0x02,0x00,0x00,0x00,0xeb,0xd5,0x90,
+	0xb8,0x03,0x00,0x00,0x00,0xeb,0xcd,0x90,
+	0xb8,0x08,0x00,0x00,0x00,0xeb,0xc5,0x90,
+	0xb8,0x09,0x00,0x00,0x00,0xeb,0xbd,0x90,
+	0xb8,0x0a,0x00,0x00,0x00,0xeb,0xb5,0x90,
+	0xb8,0x0b,0x00,0x00,0x00,0xeb,0xad,0x90,
+	0xb8,0x0c,0x00,0x00,0x00,0xeb,0xa5,0x90,
+	0xb8,0x0d,0x00,0x00,0x00,0xeb,0x9d,0x90,
+	0xb8,0x0e,0x00,0x00,0x00,0xeb,0x95,0x90,
+	0xb8,0x0f,0x00,0x00,0x00,0xeb,0x8d,0x90,
+	0xb8,0x10,0x00,0x00,0x00,0xeb,0x85,0x90,
+	0xb8,0x11,0x00,0x00,0x00,0xe9,0x7a,0xff,
+	0xff,0xff,0x66,0x90,0xb8,0x19,0x00,0x00,
+	0x00,0xe9,0x6e,0xff,0xff,0xff,0x66,0x90,
+	0xb8,0x1b,0x00,0x00,0x00,0xe9,0x62,0xff,
+	0xff,0xff,0x66,0x90,0xb8,0x1c,0x00,0x00,
+	0x00,0xe9,0x56,0xff,0xff,0xff,0x66,0x90,
+	0xb8,0x1e,0x00,0x00,0x00,0xe9,0x4a,0xff,
+	0xff,0xff,0x66,0x90,0xb8,0x21,0x00,0x00,
+	0x00,0xe9,0x3e,0xff,0xff,0xff,0x66,0x90,
+	0xb8,0x23,0x00,0x00,0x00,0xe9,0x32,0xff,
+	0xff,0xff,0x66,0x90,0xb8,0x24,0x00,0x00,
+	0x00,0xe9,0x26,0xff,0xff,0xff,0x66,0x90,
+	0xb8,0x26,0x00,0x00,0x00,0xe9,0x1a,0xff,
+	0xff,0xff,0x66,0x90,0xb8,0x27,0x00,0x00,
+	0x00,0xe9,0x0e,0xff,0xff,0xff,0x66,0x90,
+	0xb8,0x29,0x00,0x00,0x00,0xe9,0x02,0xff,
+	0xff,0xff,0x66,0x90,0xb8,0x2a,0x00,0x00,
+	0x00,0xe9,0xf6,0xfe,0xff,0xff,0x66,0x90,
+	0xb8,0x2c,0x00,0x00,0x00,0xe9,0xea,0xfe,
+	0xff,0xff,0x66,0x90,0xb8,0x2d,0x00,0x00,
+	0x00,0xe9,0xde,0xfe,0xff,0xff,0x66,0x90,
+	0xb8,0x2e,0x00,0x00,0x00,0xe9,0xd2,0xfe,
+	0xff,0xff,0x66,0x90,0xb8,0x2f,0x00,0x00,
+	0x00,0xe9,0xc6,0xfe,0xff,0xff,0x66,0x90,
+	0xb8,0x30,0x00,0x00,0x00,0xe9,0xba,0xfe,
+	0xff,0xff,0x66,0x90,0xb8,0x31,0x00,0x00,
+	0x00,0xe9,0xae,0xfe,0xff,0xff,0x66,0x90,
+	0xb8,0x36,0x00,0x00,0x00,0xe9,0xa2,0xfe,
+	0xff,0xff,0x66,0x90,0xb8,0x37,0x00,0x00,
+	0x00,0xe9,0x96,0xfe,0xff,0xff,0x66,0x90,
+	0xb8,0x38,0x00,0x00,0x00,0xe9,0x8a,0xfe,
+	0xff,0xff,0x66,0x90,0xb8,0x3c,0x00,0x00,
+	0x00,0xe9,0x7e,0xfe,0xff,0xff,0x66,0x90,
+	0xb8,0x3d,0x00,0x00,0x00,0xe9,0x72,0xfe,
+	0xff,0xff,0x66,0x90,0xb8,0x3e,0x00,0x00,
+	0x00,0xe9,0x66,0xfe,0xff,0xff,0x66,0x90,
+	0xb8,0x48,0x00,0x00,0x00,0xe9,0x5a,0xfe,
+	0xff,0xff,0x66,0x90,0xb8,0x49,0x00,0x00,
+	0x00,0xe9,0x4e,0xfe,0xff,0xff,0x66,0x90,
+	0xb8,0x53,0x00,0x00,0x00,0xe9,0x42,0xfe,
+	0xff,0xff,0x66,0x90,0xb8,0x54,0x00,0x00,
+	0x00,0xe9,0x36,0xfe,0xff,0xff,0x66,0x90,
+	0xb8,0x57,0x00,0x00,0x00,0xe9,0x2a,0xfe,
+	0xff,0xff,0x66,0x90,0xb8,0x5f,0x00,0x00,
+	0x00,0xe9,0x1e,0xfe,0xff,0xff,0x66,0x90,
+	0xb8,0x60,0x00,0x00,0x00,0xe9,0x12,0xfe,
+	0xff,0xff,0x66,0x90,0xb8,0x65,0x00,0x00,
+	0x00,0xe9,0x06,0xfe,0xff,0xff,0x66,0x90,
+	0xb8,0x73,0x00,0x00,0x00,0xe9,0xfa,0xfd,
+	0xff,0xff,0x66,0x90,0xb8,0x74,0x00,0x00,
+	0x00,0xe9,0xee,0xfd,0xff,0xff,0x66,0x90,
+	0xb8,0x75,0x00,0x00,0x00,0xe9,0xe2,0xfd,
+	0xff,0xff,0x66,0x90,0xb8,0x76,0x00,0x00,
+	0x00,0xe9,0xd6,0xfd,0xff,0xff,0x66,0x90,
+	0xb8,0x77,0x00,0x00,0x00,0xe9,0xca,0xfd,
+	0xff,0xff,0x66,0x90,0xb8,0x78,0x00,0x00,
+	0x00,0xe9,0xbe,0xfd,0xff,0xff,0x66,0x90,
+	0xb8,0x79,0x00,0x00,0x00,0xe9,0xb2,0xfd,
+	0xff,0xff,0x66,0x90,0xb8,0x7a,0x00,0x00,
+	0x00,0xe9,0xa6,0xfd,0xff,0xff,0x66,0x90,
+	0xb8,0x7b,0x00,0x00,0x00,0xe9,0x9a,0xfd,
+	0xff,0xff,0x66,0x90,0xb8,0x7c,0x00,0x00,
+	0x00,0xe9,0x8e,0xfd,0xff,0xff,0x66,0x90,
+	0xb8,0x7d,0x00,0x00,0x00,0xe9,0x82,0xfd,
+	0xff,0xff,0x66,0x90,0xb8,0x7e,0x00,0x00,
+	0x00,0xe9,0x76,0xfd,0xff,0xff,0x66,0x90,
+	0xb8,0x81,0x00,0x00,0x00,0xe9,0x6a,0xfd,
+	0xff,0xff,0x66,0x90,0xb8,0x83,0x00,0x00,
+	0x00,0xe9,0x5e,0xfd,0xff,0xff,0x66,0x90,
+	0xb8,0x87,0x00,0x00,0x00,0xe9,0x52,0xfd,
+	0xff,0xff,0x66,0x90,0xb8,0x8d,0x00,0x00,
+	0x00,0xe9,0x46,0xfd,0xff,0xff,0x66,0x90,
+	0xb8,0x90,0x00,0x00,0x00,0xe9,0x3a,0xfd,
+	0xff,0xff,0x66,0x90,0xb8,0x9d,0x00,0x00,
+	0x00,0xe9,0x2e,0xfd,0xff,0xff,0x66,0x90,
+	0xb8,0x9e,0x00,0x00,0x00,0xe9,0x22,0xfd,
+	0xff,0xff,0x66,0x90,0xb8,0xa0,0x00,0x00,
+	0x00,0xe9,0x16,0xfd,0xff,0xff,0x66,0x90,
+	0xb8,0xa5,0x00,0x00,0x00,0xe9,0x0a,0xfd,
+	0xff,0xff,0x66,0x90,0xb8,0xa6,0x00,0x00,
+	0x00,0xe9,0xfe,0xfc,0xff,0xff,0x66,0x90,
+	0xb8,0xba,0x00,0x00,0x00,0xe9,0xf2,0xfc,
+	0xff,0xff,0x66,0x90,0xb8,0xca,0x00,0x00,
+	0x00,0xe9,0xe6,0xfc,0xff,0xff,0x66,0x90,
+	0xb8,0xcd,0x00,0x00,0x00,0xe9,0xda,0xfc,
+	0xff,0xff,0x66,0x90,0xb8,0xce,0x00,0x00,
+	0x00,0xe9,0xce,0xfc,0xff,0xff,0x66,0x90,
+	0xb8,0xd0,0x00,0x00,0x00,0xe9,0xc2,0xfc,
+	0xff,0xff,0x66,0x90,0xb8,0xd1,0x00,0x00,
+	0x00,0xe9,0xb6,0xfc,0xff,0xff,0x66,0x90,
+	0xb8,0xd3,0x00,0x00,0x00,0xe9,0xaa,0xfc,
+	0xff,0xff,0x66,0x90,0xb8,0xda,0x00,0x00,
+	0x00,0xe9,0x9e,0xfc,0xff,0xff,0x66,0x90,
+	0xb8,0xdb,0x00,0x00,0x00,0xe9,0x92,0xfc,
+	0xff,0xff,0x66,0x90,0xb8,0xde,0x00,0x00,
+	0x00,0xe9,0x86,0xfc,0xff,0xff,0x66,0x90,
+	0xb8,0xdf,0x00,0x00,0x00,0xe9,0x7a,0xfc,
+	0xff,0xff,0x66,0x90,0xb8,0xe0,0x00,0x00,
+	0x00,0xe9,0x6e,0xfc,0xff,0xff,0x66,0x90,
+	0xb8,0xe1,0x00,0x00,0x00,0xe9,0x62,0xfc,
+	0xff,0xff,0x66,0x90,0xb8,0xe2,0x00,0x00,
+	0x00,0xe9,0x56,0xfc,0xff,0xff,0x66,0x90,
+	0xb8,0xe4,0x00,0x00,0x00,0xe9,0x4a,0xfc,
+	0xff,0xff,0x66,0x90,0xb8,0xe7,0x00,0x00,
+	0x00,0xe9,0x3e,0xfc,0xff,0xff,0x66,0x90,
+	0xb8,0x01,0x01,0x00,0x00,0xe9,0x32,0xfc,
+	0xff,0xff,0x66,0x90,0xb8,0xf7,0x00,0x00,
+	0x00,0xe9,0x26,0xfc,0xff,0xff,0x66,0x90,
+	0xb8,0x0b,0x01,0x00,0x00,0xe9,0x1a,0xfc,
+	0xff,0xff,0x66,0x90,0xb8,0x11,0x01,0x00,
+	0x00,0xe9,0x0e,0xfc,0xff,0xff,0x66,0x90,
+	0xb8,0x12,0x01,0x00,0x00,0xe9,0x02,0xfc,
+	0xff,0xff,0x66,0x90,0xb8,0x3d,0x01,0x00,
+	0x00,0xe9,0xf6,0xfb,0xff,0xff,0x66,0x90,
+	0xb8,0x16,0x01,0x00,0x00,0xe9,0xea,0xfb,
+	0xff,0xff,0x66,0x90,0xb8,0x1d,0x01,0x00,
+	0x00,0xe9,0xde,0xfb,0xff,0xff,0x66,0x90,
+	0xb8,0x1e,0x01,0x00,0x00,0xe9,0xd2,0xfb,
+	0xff,0xff,0x66,0x90,0xb8,0x21,0x01,0x00,
+	0x00,0xe9,0xc6,0xfb,0xff,0xff,0x66,0x90,
+	0xb8,0x27,0x01,0x00,0x00,0xe9,0xba,0xfb,
+	0xff,0xff,0x66,0x90,0xb8,0x29,0x01,0x00,
+	0x00,0xe9,0xae,0xfb,0xff,0xff,0x66,0x90,
+	0xb8,0x2c,0x01,0x00,0x00,0xe9,0xa2,0xfb,
+	0xff,0xff,0x66,0x90,0xb8,0x2d,0x01,0x00,
+	0x00,0xe9,0x96,0xfb,0xff,0xff,0x66,0x90,
+	0xb8,0x30,0x01,0x00,0x00,0xe9,0x8a,0xfb,
+	0xff,0xff,0x66,0x90,0xb8,0x34,0x01,0x00,
+	0x00,0xe9,0x7e,0xfb,0xff,0xff,0x66,0x90,
+	0xb8,0x38,0x01,0x00,0x00,0xe9,0x72,0xfb,
+	0xff,0xff,0x66,0x90,0xb8,0x3f,0x01,0x00,
+	0x00,0xe9,0x66,0xfb,0xff,0xff,0x66,0x90,
+	0xb8,0x43,0x01,0x00,0x00,0xe9,0x5a,0xfb,
+	0xff,0xff,0x66,0x90,0xb8,0x0f,0x01,0x00,
+	0x00,0xe9,0x4e,0xfb,0xff,0xff,0x66,0x90,
+	0xb8,0xac,0x01,0x00,0x00,0xe9,0x42,0xfb,
+	0xff,0xff,0x66,0x90,0xb8,0xad,0x01,0x00,
+	0x00,0xe9,0x36,0xfb,0xff,0xff,0x66,0x90,
+	0xb8,0xae,0x01,0x00,0x00,0xe9,0x2a,0xfb,
+	0xff,0xff,0x66,0x90,0xb8,0xaf,0x01,0x00,
+	0x00,0xe9,0x1e,0xfb,0xff,0xff,0x66,0x90,
+	0xb8,0xb0,0x01,0x00,0x00,0xe9,0x12,0xfb,
+	0xff,0xff,0x66,0x90,0xb8,0xb3,0x01,0x00,
+	0x00,0xe9,0x06,0xfb,0xff,0xff,0x66,0x90,
+	0xb8,0xb2,0x01,0x00,0x00,0xe9,0xfa,0xfa,
+	0xff,0xff,0x66,0x90,0xb8,0xb5,0x01,0x00,
+	0x00,0xe9,0xee,0xfa,0xff,0xff,0x66,0x90,
+	0xb8,0xb6,0x01,0x00,0x00,0xe9,0xe2,0xfa,
+	0xff,0xff,0x66,0x90,0xb8,0x4e,0x01,0x00,
+	0x00,0xe9,0xd6,0xfa,0xff,0xff,0x66,0x90,
+	0x48,0x8b,0x05,0x29,0x10,0x00,0x00,0x80,
+	0xb8,0x40,0x37,0x00,0x00,0x00,0x74,0x10,
+	0x48,0x89,0xf8,0x48,0x89,0xc4,0xb8,0x0f,
+	0x00,0x00,0x00,0x0f,0x05,0xc3,0x66,0x90,
+	0x6a,0x23,0x48,0x31,0xc0,0xb8,0x00,0x00,
+	0x00,0x00,0x50,0x48,0xcb,0x89,0xfc,0xb8,
+	0xad,0x00,0x00,0x00,0xcd,0x80,0xc3,0x66,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0x48,0x83,0xec,0x18,0x66,0x0f,0x6e,0xcf,
+	0x8b,0x3d,0x2a,0x0f,0x00,0x00,0x31,0xc9,
+	0x89,0x74,0x24,0x08,0x66,0x0f,0x70,0xc1,
+	0xe0,0x45,0x31,0xc9,0x45,0x31,0xc0,0x48,
+	0x89,0xe6,0xba,0x0c,0x00,0x00,0x00,0x66,
+	0x0f,0xd6,0x04,0x24,0xe8,0x6f,0xfb,0xff,
+	0xff,0x83,0xf8,0x0c,0x75,0x2a,0x44,0x8b,
+	0x44,0x24,0x08,0x8b,0x4c,0x24,0x04,0x31,
+	0xc0,0xbf,0x04,0x00,0x00,0x00,0x8b,0x14,
+	0x24,0x48,0x8d,0x35,0xc2,0x35,0x00,0x00,
+	0xe8,0x9b,0xee,0xff,0xff,0x31,0xc0,0x48,
+	0x83,0xc4,0x18,0xc3,0x0f,0x1f,0x40,0x00,
+	0x89,0xc2,0xb9,0x0c,0x00,0x00,0x00,0x31,
+	0xc0,0xbf,0x01,0x00,0x00,0x00,0x48,0x8d,
+	0x35,0x03,0x35,0x00,0x00,0xe8,0x76,0xee,
+	0xff,0xff,0xb8,0xff,0xff,0xff,0xff,0xeb,
+	0xd6,0x66,0x66,0x2e,0x0f,0x1f,0x84,0x00,
+	0x00,0x00,0x00,0x00,0x0f,0x1f,0x40,0x00,
+	0x48,0x83,0xec,0x08,0x89,0x37,0x45,0x31,
+	0xc9,0x45,0x31,0xc0,0x31,0xc9,0xba,0xff,
+	0xff,0xff,0x7f,0xbe,0x01,0x00,0x00,0x00,
+	0xe8,0xf7,0xfc,0xff,0xff,0x48,0x85,0xc0,
+	0x78,0x05,0x48,0x83,0xc4,0x08,0xc3,0x31,
+	0xc0,0x48,0x89,0x04,0x25,0x00,0x00,0x00,
+	0x00,0x0f,0x0b,0x66,0x66,0x2e,0x0f,0x1f,
+	0x84,0x00,0x00,0x00,0x00,0x00,0x66,0x90,
+	0x55,0x53,0x48,0x83,0xec,0x08,0xe8,0xb5,
+	0xa8,0xff,0xff,0x48,0x8b,0x05,0x0e,0x0f,
+	0x00,0x00,0x80,0xb8,0x40,0x37,0x00,0x00,
+	0x00,0x74,0x76,0x48,0x8b,0xa8,0xb0,0x00,
+	0x00,0x00,0x48,0x8d,0x58,0x08,0xe8,0x9d,
+	0xfc,0xff,0xff,0x49,0x89,0xe8,0x48,0x89,
+	0xd9,0xbf,0x04,0x00,0x00,0x00,0x48,0x89,
+	0xc2,0x48,0x8d,0x35,0x1c,0x35,0x00,0x00,
+	0x31,0xc0,0xe8,0xd9,0xed,0xff,0xff,0x8b,
+	0x3d,0x1b,0x0e,0x00,0x00,0xe8,0x9e,0xf9,
+	0xff,0xff,0xbf,0xff,0xff,0xff,0xff,0xe8,
+	0x64,0xe7,0xff,0xff,0x48,0x89,0xdf,0xb9,
+	0x65,0x00,0x00,0x00,0x48,0x8d,0x15,0x09,
+	0x35,0x00,0x00,0xe8,0x80,0xfe,0xff,0xff,
+	0x48,0x8d,0x35,0x19,0x35,0x00,0x00,0xbf,
+	0x01,0x00,0x00,0x00,0x31,0xc0,0xe8,0x9d,
+	0xed,0xff,0xff,0x48,0xc7,0x04,0x25,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,
+	0x0b,0x8b,0xa8,0xdc,0x00,0x00,0x00,0x48,
+	0x8d,0x58,0x04,0xeb,0x89,0x0f,0x1f,0x00,
+	0x8b,0x05,0xc2,0x0d,0x00,0x00,0xc3,0x66,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0x41,0x57,0x48,0x8d,0x35,0xe5,0x34,0x00,
+	0x00,0x31,0xc0,0x41,0x56,0x41,0x55,0x41,
+	0x54,0x55,0x48,0x89,0xfd,0xbf,0x04,0x00,
+	0x00,0x00,0x53,0x48,0x83,0xec,0x18,0xe8,
+	0x4c,0xed,0xff,0xff,0x31,0xf6,0xbf,0x02,
+	0x00,0x00,0x00,0xe8,0x50,0xfe,0xff,0xff,
+	0x85,0xc0,0x0f,0x85,0x90,0x00,0x00,0x00,
+	0x89,0xc3,0x4c,0x8d,0x2d,0xcb,0x34,0x00,
+	0x00,0x4c,0x8d,0x64,0x24,0x04,0x4c,0x8d,
+	0x35,0xd9,0x34,0x00,0x00,0x4c,0x8d,0x3d,
+	0xf4,0x33,0x00,0x00,0x0f,0x1f,0x40,0x00,
+	0x4c,0x89,0xee,0xbf,0x04,0x00,0x00,0x00,
+	0x31,0xc0,0xe8,0x09,0xed,0xff,0xff,0xb9,
+	0x00,0x01,0x00,0x00,0x45,0x31,0xc9,0x45,
+	0x31,0xc0,0x8b,0x3d,0x40,0x0d,0x00,0x00,
+	0xba,0x0c,0x00,0x00,0x00,0x4c,0x89,0xe6,
+	0x48,0xc7,0x44,0x24,0x04,0x00,0x00,0x00,
+	0x00,0xc7,0x44,0x24,0x0c,0x00,0x00,0x00,
+	0x00,0xe8,0x96,0xf9,0xff,0xff,0x89,0xc1,
+	0x83,0xf8,0x0c,0x0f,0x85,0x97,0x00,0x00,
+	0x00,0x44,0x8b,0x44,0x24,0x0c,0x8b,0x4c,
+	0x24,0x08,0x31,0xc0,0x4c,0x89,0xf6,0x8b,
+	0x54,0x24,0x04,0xbf,0x04,0x00,0x00,0x00,
+	0xe8,0xb3,0xec,0xff,0xff,0x85,0xdb,0x74,
+	0x0f,0x83,0x7c,0x24,0x04,0x03,0x75,0x58,
+	0xe8,0x83,0xfe,0xff,0xff,0x0f,0x1f,0x00,
+	0x8b,0x7c,0x24,0x04,0x83,0xff,0x03,0x74,
+	0xef,0x48,0x89,0xee,0xe8,0x0f,0xa7,0xff,
+	0xff,0x8b,0x7c,0x24,0x04,0x89,0xc6,0x89,
+	0xc3,0xe8,0x92,0xfd,0xff,0xff,0x85,0xc0,
+	0x75,0xd6,0x85,0xdb,0x0f,0x84,0x5e,0xff,
+	0xff,0xff,0x4c,0x89,0xfe,0xbf,0x01,0x00,
+	0x00,0x00,0xe8,0x69,0xec,0xff,0xff,0x8b,
+	0x3d,0xab,0x0c,0x00,0x00,0xbe,0x01,0x00,
+	0x00,0x00,0xe8,0x39,0xf9,0xff,0xff,0xe9,
+	0x3c,0xff,0xff,0xff,0x0f,0x1f,0x40,0x00,
+	0x48,0x8d,0x35,0x18,0x34,0x00,0x00,0xbf,
+	0x01,0x00,0x00,0x00,0x31,0xc0,0xe8,0x3d,
+	0xec,0xff,0xff,0xe9,0x20,0xff,0xff,0xff,
+	0xba,0x0c,0x00,0x00,0x00,0x48,0x8d,0x35,
+	0xdc,0x32,0x00,0x00,0xbf,0x01,0x00,0x00,
+	0x00,0x31,0xc0,0xe8,0x20,0xec,0xff,0xff,
+	0xe9,0x73,0xff,0xff,0xff,0x66,0x66,0x2e,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0x41,0x54,0x48,0x8d,0x05,0xd7,0xfc,0xff,
+	0xff,0x31,0xd2,0xbe,0x05,0x00,0x00,0x00,
+	0x55,0x53,0x48,0x89,0xfb,0x4c,0x8d,0xa3,
+	0x88,0x00,0x00,0x00,0x48,0x83,0xec,0x10,
+	0x48,0x89,0x47,0x78,0x48,0x8b,0x87,0x80,
+	0x00,0x00,0x00,0xbf,0x01,0x00,0x00,0x00,
+	0x48,0x89,0x05,0xd9,0x0c,0x00,0x00,0xe8,
+	0x6c,0xf8,0xff,0xff,0x89,0x05,0x16,0x0c,
+	0x00,0x00,0x89,0xc5,0x85,0xc0,0x78,0x63,
+	0x8b,0x13,0x48,0x8d,0x73,0x04,0x89,0xc7,
+	0xe8,0x5f,0xf8,0xff,0xff,0x89,0xc5,0x85,
+	0xc0,0x78,0x74,0xbe,0x01,0x00,0x00,0x00,
+	0x4c,0x89,0xe7,0x83,0xcd,0xff,0xe8,0x45,
+	0xfd,0xff,0xff,0x8b,0x3d,0xe7,0x0b,0x00,
+	0x00,0x45,0x31,0xc9,0x31,0xc9,0x48,0x8d,
+	0x74,0x24,0x0c,0x45,0x31,0xc0,0xba,0x01,
+	0x00,0x00,0x00,0xe8,0xb8,0x02,0x00,0x00,
+	0x85,0xc0,0x75,0x34,0x8b,0x6c,0x24,0x0c,
+	0x85,0xed,0x78,0x2c,0x89,0xef,0xe8,0x15,
+	0xe5,0xff,0xff,0x8b,0x7b,0x74,0xe8,0x2d,
+	0xe5,0xff,0xff,0x48,0x89,0xdf,0xe8,0xf5,
+	0xfd,0xff,0xff,0x89,0xc2,0x48,0x8d,0x35,
+	0x3d,0x33,0x00,0x00,0xbf,0x01,0x00,0x00,
+	0x00,0x31,0xc0,0xe8,0x50,0xeb,0xff,0xff,
+	0x89,0xee,0x4c,0x89,0xe7,0xe8,0xe6,0xfc,
+	0xff,0xff,0xe8,0x21,0xfd,0xff,0xff,0x48,
+	0x8d,0x35,0x3a,0x32,0x00,0x00,0xbf,0x01,
+	0x00,0x00,0x00,0x31,0xc0,0xe8,0x2e,0xeb,
+	0xff,0xff,0xeb,0xdc,0x66,0x66,0x2e,0x0f,
+	0x1f,0x84,0x00,0x00,0x00,0x00,0x00,0x90,
+	0x55,0x31,0xc0,0x48,0x8d,0x35,0x10,0x33,
+	0x00,0x00,0xbf,0x03,0x00,0x00,0x00,0x53,
+	0x48,0x83,0xec,0x08,0x8b,0x1d,0xfe,0x0b,
+	0x00,0x00,0x48,0x8b,0x2d,0xef,0x0b,0x00,
+	0x00,0x89,0xd9,0x89,0xda,0xe8,0xf6,0xea,
+	0xff,0xff,0x83,0xfb,0x02,0x74,0x10,0x48,
+	0x83,0xc4,0x08,0x48,0x89,0xee,0x89,0xdf,
+	0x5b,0x5d,0xe9,0x71,0xa5,0xff,0xff,0x48,
+	0x89,0xef,0xe8,0xc9,0xfe,0xff,0xff,0x66,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0x41,0x57,0x31,0xc0,0x41,0x56,0x41,0x55,
+	0x41,0x54,0x55,0x53,0x48,0x81,0xec,0x78,
+	0x04,0x00,0x00,0x89,0x7c,0x24,0x14,0x48,
+	0x8d,0x7c,0x24,0x20,0x48,0x89,0x4c,0x24,
+	0x08,0xb9,0x89,0x00,0x00,0x00,0x48,0x89,
+	0x7c,0x24,0x18,0xf3,0x48,0xab,0x48,0x8d,
+	0x44,0x24,0x58,0x89,0x54,0x24,0x28,0x48,
+	0x8d,0x54,0x24,0x68,0x48,0x89,0x44,0x24,
+	0x30,0x48,0x8b,0x05,0xa0,0x32,0x00,0x00,
+	0x48,0xc7,0x44,0x24,0x38,0x01,0x00,0x00,
+	0x00,0x48,0x89,0x74,0x24,0x20,0x48,0x89,
+	0x54,0x24,0x40,0x48,0xc7,0x44,0x24,0x68,
+	0x00,0x04,0x00,0x00,0x48,0x89,0x44,0x24,
+	0x70,0x45,0x85,0xc0,0x0f,0x8e,0x46,0x01,
+	0x00,0x00,0x44,0x89,0xc3,0x4d,0x89,0xcd,
+	0x48,0x8d,0x6c,0x24,0x78,0x45,0x31,0xff,
+	0xeb,0x46,0x66,0x0f,0x1f,0x44,0x00,0x00,
+	0xa8,0x04,0x0f,0x85,0x40,0x01,0x00,0x00,
+	0x85,0xc0,0x74,0x06,0x0f,0xb6,0x06,0x88,
+	0x45,0x00,0x48,0x8b,0x74,0x24,0x18,0x8b,
+	0x7c,0x24,0x14,0x31,0xd2,0xe8,0xee,0xf6,
+	0xff,0xff,0x89,0xc2,0x85,0xc0,0x0f,0x8e,
+	0xd2,0x00,0x00,0x00,0x4d,0x01,0xf5,0x45,
+	0x01,0xe7,0x44,0x39,0xfb,0x0f,0x8e,0xf5,
+	0x00,0x00,0x00,0x48,0x8b,0x54,0x24,0x40,
+	0x41,0x89,0xdc,0xb8,0xfc,0x00,0x00,0x00,
+	0x48,0x8b,0x4c,0x24,0x08,0x45,0x29,0xfc,
+	0x41,0x39,0xc4,0x44,0x0f,0x4f,0xe0,0x41,
+	0x8d,0x44,0x24,0x04,0x48,0x98,0x48,0xc1,
+	0xe0,0x02,0x48,0x89,0x44,0x24,0x48,0x48,
+	0x89,0x02,0x49,0x63,0xd7,0x48,0x83,0xe8,
+	0x10,0x48,0x8d,0x34,0x91,0x4d,0x85,0xed,
+	0x74,0x3e,0x45,0x89,0xe6,0x4c,0x89,0x6c,
+	0x24,0x58,0x44,0x0f,0xaf,0xb4,0x24,0xb0,
+	0x04,0x00,0x00,0x4c,0x89,0x74,0x24,0x60,
+	0x83,0xf8,0x08,0x0f,0x82,0x67,0xff,0xff,
+	0xff,0x89,0xc2,0x83,0xe8,0x01,0x48,0x89,
+	0xef,0x48,0x8b,0x4c,0x16,0xf8,0xc1,0xe8,
+	0x03,0x48,0x89,0x4c,0x15,0xf8,0x89,0xc1,
+	0xf3,0x48,0xa5,0xe9,0x5a,0xff,0xff,0xff,
+	0x48,0xc7,0x44,0x24,0x60,0x01,0x00,0x00,
+	0x00,0x48,0x8d,0x3d,0x88,0x0a,0x00,0x00,
+	0x48,0x89,0x7c,0x24,0x58,0x83,0xf8,0x08,
+	0x73,0x3e,0xa8,0x04,0x0f,0x85,0x86,0x00,
+	0x00,0x00,0x85,0xc0,0x74,0x06,0x0f,0xb6,
+	0x06,0x88,0x45,0x00,0x48,0x8b,0x74,0x24,
+	0x18,0x8b,0x7c,0x24,0x14,0x31,0xd2,0xe8,
+	0x1c,0xf6,0xff,0xff,0x89,0xc2,0x85,0xc0,
+	0x0f,0x8f,0x31,0xff,0xff,0xff,0x85,0xd2,
+	0xb8,0xff,0xff,0xff,0xff,0x0f,0x44,0xd0,
+	0xeb,0x28,0x66,0x0f,0x1f,0x44,0x00,0x00,
+	0x89,0xc2,0x83,0xe8,0x01,0x48,0x89,0xef,
+	0x48,0x8b,0x4c,0x16,0xf8,0xc1,0xe8,0x03,
+	0x48,0x89,0x4c,0x15,0xf8,0x89,0xc1,0xf3,
+	0x48,0xa5,0xeb,0xb8,0x0f,0x1f,0x40,0x00,
+	0x31,0xd2,0x48,0x81,0xc4,0x78,0x04,0x00,
+	0x00,0x89,0xd0,0x5b,0x5d,0x41,0x5c,0x41,
+	0x5d,0x41,0x5e,0x41,0x5f,0xc3,0x66,0x90,
+	0x8b,0x16,0x89,0xc0,0x89,0x55,0x00,0x8b,
+	0x54,0x06,0xfc,0x89,0x54,0x05,0xfc,0xe9,
+	0xb6,0xfe,0xff,0xff,0x0f,0x1f,0x40,0x00,
+	0x8b,0x16,0x89,0xc0,0x89,0x55,0x00,0x8b,
+	0x54,0x06,0xfc,0x89,0x54,0x05,0xfc,0xe9,
+	0x70,0xff,0xff,0xff,0x0f,0x1f,0x40,0x00,
+	0x41,0x57,0x45,0x89,0xc7,0x31,0xc0,0x41,
+	0x56,0x41,0x89,0xfe,0x41,0x55,0x41,0x89,
+	0xd5,0x41,0x54,0x55,0x48,0x89,0xcd,0xb9,
+	0x89,0x00,0x00,0x00,0x53,0x48,0x81,0xec,
+	0x68,0x04,0x00,0x00,0x4c,0x8d,0x44,0x24,
+	0x10,0x48,0x8d,0x54,0x24,0x58,0x4c,0x89,
+	0xc7,0xf3,0x48,0xab,0x48,0x8d,0x44,0x24,
+	0x48,0x48,0x89,0x54,0x24,0x30,0x48,0x89,
+	0x44,0x24,0x20,0x48,0x8b,0x05,0x9e,0x30,
+	0x00,0x00,0x48,0xc7,0x44,0x24,0x28,0x01,
+	0x00,0x00,0x00,0x48,0xc7,0x44,0x24,0x58,
+	0x00,0x04,0x00,0x00,0x48,0x89,0x44,0x24,
+	0x60,0x45,0x85,0xed,0x0f,0x8e,0x01,0x01,
+	0x00,0x00,0x44,0x89,0x4c,0x24,0x04,0x49,
+	0x89,0xec,0x31,0xdb,0x48,0x89,0xf5,0x4c,
+	0x89,0x44,0x24,0x08,0x44,0x89,0xe9,0xb8,
+	0xfc,0x00,0x00,0x00,0x29,0xd9,0x39,0xc1,
+	0x0f,0x4f,0xc8,0x8d,0x41,0x04,0x48,0x98,
+	0x48,0xc1,0xe0,0x02,0x48,0x89,0x44,0x24,
+	0x38,0x48,0x89,0x02,0xba,0x01,0x00,0x00,
+	0x00,0x48,0x8d,0x05,0x30,0x09,0x00,0x00,
+	0x4d,0x85,0xe4,0x74,0x09,0x89,0xca,0x4c,
+	0x89,0xe0,0x41,0x0f,0xaf,0xd7,0x48,0x89,
+	0x54,0x24,0x50,0x48,0x8b,0x74,0x24,0x08,
+	0x44,0x89,0xf7,0x8b,0x54,0x24,0x04,0x48,
+	0x89,0x44,0x24,0x48,0xe8,0xd3,0xf4,0xff,
+	0xff,0x89,0xc2,0x85,0xc0,0x0f,0x8e,0x15,
+	0x01,0x00,0x00,0x48,0x83,0x7c,0x24,0x38,
+	0x0f,0x0f,0x86,0xd9,0x00,0x00,0x00,0x48,
+	0x8b,0x54,0x24,0x30,0x48,0x85,0xd2,0x0f,
+	0x84,0xcb,0x00,0x00,0x00,0x83,0x7a,0x0c,
+	0x01,0x0f,0x85,0xc1,0x00,0x00,0x00,0xf6,
+	0x44,0x24,0x40,0x08,0x0f,0x85,0xf6,0x00,
+	0x00,0x00,0x48,0x8b,0x02,0x48,0x83,0xe8,
+	0x10,0x48,0xc1,0xe8,0x02,0x3d,0xfc,0x00,
+	0x00,0x00,0x0f,0x8f,0xe7,0x00,0x00,0x00,
+	0x85,0xc0,0x7e,0x7c,0x48,0x63,0xcb,0x48,
+	0x8d,0x74,0x24,0x68,0x4c,0x8d,0x54,0x8d,
+	0x00,0x48,0x63,0xc8,0x48,0xc1,0xe1,0x02,
+	0x83,0xf9,0x08,0x73,0x33,0xf6,0xc1,0x04,
+	0x0f,0x85,0x8a,0x00,0x00,0x00,0x85,0xc9,
+	0x74,0x08,0x0f,0xb6,0x4c,0x24,0x68,0x41,
+	0x88,0x0a,0x4d,0x85,0xe4,0x74,0x09,0x44,
+	0x89,0xf9,0x0f,0xaf,0xc8,0x49,0x01,0xcc,
+	0x01,0xc3,0x41,0x39,0xdd,0x0f,0x8f,0x11,
+	0xff,0xff,0xff,0x31,0xd2,0xeb,0x36,0x90,
+	0x48,0x8b,0x7c,0x24,0x68,0x49,0x89,0x3a,
+	0x89,0xcf,0x4c,0x8b,0x5c,0x3e,0xf8,0x4d,
+	0x89,0x5c,0x3a,0xf8,0x49,0x8d,0x7a,0x08,
+	0x48,0x83,0xe7,0xf8,0x49,0x29,0xfa,0x44,
+	0x01,0xd1,0x4c,0x29,0xd6,0xc1,0xe9,0x03,
+	0xf3,0x48,0xa5,0xeb,0xb5,0x0f,0x1f,0x00,
+	0xba,0xb3,0xff,0xff,0xff,0x48,0x81,0xc4,
+	0x68,0x04,0x00,0x00,0x89,0xd0,0x5b,0x5d,
+	0x41,0x5c,0x41,0x5d,0x41,0x5e,0x41,0x5f,
+	0xc3,0x0f,0x1f,0x80,0x00,0x00,0x00,0x00,
+	0xba,0xea,0xff,0xff,0xff,0xeb,0xde,0x66,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0x8b,0x7c,0x24,0x68,0x89,0xc9,0x41,0x89,
+	0x3a,0x8b,0x74,0x0e,0xfc,0x41,0x89,0x74,
+	0x0a,0xfc,0xe9,0x6b,0xff,0xff,0xff,0x66,
+	0x0f,0x1f,0x84,0x00,0x00,0x00,0x00,0x00,
+	0xb8,0xd6,0xff,0xff,0xff,0x0f,0x44,0xd0,
+	0xeb,0xab,0x66,0x0f,0x1f,0x44,0x00,0x00,
+	0xba,0xe9,0xff,0xff,0xff,0xeb,0x9e,0x31,
+	0xc0,0x48,0x89,0x04,0x25,0x00,0x00,0x00,
+	0x00,0x0f,0x0b,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x02,0x00,0x00,0x00,0xff,0xff,0xff,0xff,
+	0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x76,0x64,0x73,0x6f,0x3a,0x20,0x52,0x65,
+	0x6d,0x61,0x70,0x20,0x25,0x73,0x20,0x25,
+	0x6c,0x78,0x20,0x2d,0x3e,0x20,0x25,0x6c,
+	0x78,0x0a,0x00,0x63,0x72,0x69,0x75,0x2f,
+	0x70,0x69,0x65,0x2f,0x70,0x61,0x72,0x61,
+	0x73,0x69,0x74,0x65,0x2d,0x76,0x64,0x73,
+	0x6f,0x2e,0x63,0x00,0x72,0x74,0x2d,0x76,
+	0x64,0x73,0x6f,0x00,0x72,0x74,0x2d,0x76,
+	0x76,0x61,0x72,0x00,0x76,0x64,0x73,0x6f,
+	0x2f,0x76,0x76,0x61,0x72,0x00,0x76,0x76,
+	0x61,0x72,0x2f,0x76,0x64,0x73,0x6f,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x76,
+	0x64,0x73,0x6f,0x3a,0x20,0x55,0x6e,0x61,
+	0x62,0x6c,0x65,0x20,0x74,0x6f,0x20,0x72,
+	0x65,0x6d,0x61,0x70,0x20,0x25,0x6c,0x78,
+	0x20,0x2d,0x3e,0x20,0x25,0x6c,0x78,0x20,
+	0x25,0x6c,0x78,0x0a,0x00,0x00,0x00,0x00,
+	0x76,0x64,0x73,0x6f,0x3a,0x20,0x4e,0x6f,
+	0x20,0x72,0x74,0x2d,0x76,0x64,0x73,0x6f,
+	0x20,0x2d,0x20,0x6e,0x6f,0x20,0x66,0x61,
+	0x73,0x74,0x20,0x67,0x65,0x74,0x74,0x69,
+	0x6d,0x65,0x6f,0x66,0x64,0x61,0x79,0x28,
+	0x29,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x76,0x64,0x73,0x6f,0x3a,0x20,0x63,0x6f,
+	0x6d,0x70,0x61,0x74,0x20,0x6d,0x6f,0x64,
+	0x65,0x3a,0x20,0x75,0x73,0x69,0x6e,0x67,
+	0x20,0x73,0x79,0x73,0x63,0x61,0x6c,0x6c,
+	0x20,0x66,0x6f,0x72,0x20,0x67,0x65,0x74,
+	0x74,0x69,0x6d,0x65,0x6f,0x66,0x64,0x61,
+	0x79,0x28,0x29,0x0a,0x00,0x00,0x00,0x00,
+	0x76,0x64,0x73,0x6f,0x3a,0x20,0x4e,0x6f,
+	0x20,0x67,0x65,0x74,0x74,0x69,0x6d,0x65,
+	0x6f,0x66,0x64,0x61,0x79,0x28,0x29,0x20,
+	0x6f,0x6e,0x20,0x72,0x74,0x2d,0x76,0x64,
+	0x73,0x6f,0x0a,0x00,0x00,0x00,0x00,0x00,
+	0x76,0x64,0x73,0x6f,0x3a,0x20,0x55,0x73,
+	0x69,0x6e,0x67,0x20,0x67,0x65,0x74,0x74,
+	0x69,0x6d,0x65,0x6f,0x66,0x64,0x61,0x79,
+	0x28,0x29,0x20,0x6f,0x6e,0x20,0x76,0x64,
+	0x73,0x6f,0x20,0x61,0x74,0x20,0x25,0x70,
+	0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x76,
+	0x64,0x73,0x6f,0x3a,0x20,0x42,0x55,0x47,
+	0x20,0x61,0x74,0x20,0x25,0x73,0x3a,0x25,
+	0x64,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x76,0x64,0x73,0x6f,0x3a,0x20,0x4e,0x6f,
+	0x20,0x56,0x56,0x41,0x52,0x2c,0x20,0x6e,
+	0x6f,0x20,0x76,0x44,0x53,0x4f,0x20,0x69,
+	0x6e,0x20,0x69,0x6d,0x61,0x67,0x65,0x0a,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x76,
+	0x64,0x73,0x6f,0x3a,0x20,0x43,0x61,0x6e,
+	0x27,0x74,0x20,0x66,0x69,0x6e,0x64,0x20,
+	0x76,0x44,0x53,0x4f,0x20,0x61,0x72,0x65,
+	0x61,0x20,0x69,0x6e,0x20,0x69,0x6d,0x61,
+	0x67,0x65,0x0a,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x76,
+	0x64,0x73,0x6f,0x3a,0x20,0x76,0x44,0x53,
+	0x4f,0x20,0x69,0x73,0x6e,0x27,0x74,0x20,
+	0x70,0x72,0x6f,0x76,0x69,0x64,0x65,0x64,
+	0x20,0x62,0x79,0x20,0x6b,0x65,0x72,0x6e,
+	0x65,0x6c,0x2c,0x20,0x62,0x75,0x74,0x20,
+	0x65,0x78,0x69,0x73,0x74,0x73,0x20,0x69,
+	0x6e,0x20,0x69,0x6d,0x61,0x67,0x65,0x73,
+	0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x76,0x64,0x73,0x6f,0x3a,0x20,0x69,0x6d,
+	0x61,0x67,0x65,0x20,0x5b,0x76,0x64,0x73,
+	0x6f,0x5d,0x20,0x25,0x6c,0x78,0x2d,0x25,
+	0x6c,0x78,0x20,0x5b,0x76,0x76,0x61,0x72,
+	0x5d,0x20,0x25,0x6c,0x78,0x2d,0x25,0x6c,
+	0x78,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x76,0x64,0x73,0x6f,0x3a,0x20,0x73,0x69,
+	0x7a,0x65,0x20,0x64,0x69,0x66,0x66,0x65,
+	0x72,0x73,0x3a,0x20,0x25,0x6c,0x78,0x20,
+	0x21,0x3d,0x20,0x25,0x6c,0x78,0x20,0x28,
+	0x72,0x74,0x29,0x0a,0x00,0x00,0x00,0x00,
+	0x76,0x64,0x73,0x6f,0x3a,0x20,0x5b,0x25,
+	0x7a,0x75,0x5d,0x60,0x25,0x73,0x60,0x20,
+	0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x64,
+	0x69,0x66,0x66,0x65,0x72,0x73,0x3a,0x20,
+	0x25,0x6c,0x78,0x20,0x21,0x3d,0x20,0x25,
+	0x6c,0x78,0x20,0x28,0x72,0x74,0x29,0x0a,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x76,0x64,0x73,0x6f,0x3a,0x20,0x76,0x76,
+	0x61,0x72,0x20,0x73,0x69,0x7a,0x65,0x20,
+	0x64,0x69,0x66,0x66,0x65,0x72,0x73,0x3a,
+	0x20,0x25,0x6c,0x78,0x20,0x21,0x3d,0x20,
+	0x25,0x6c,0x78,0x20,0x28,0x72,0x74,0x29,
+	0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x76,0x64,0x73,0x6f,0x3a,0x20,0x5b,0x25,
+	0x73,0x5d,0x20,0x70,0x61,0x69,0x72,0x20,
+	0x68,0x61,0x73,0x20,0x64,0x69,0x66,0x66,
+	0x65,0x72,0x65,0x6e,0x74,0x20,0x6f,0x72,
+	0x64,0x65,0x72,0x0a,0x00,0x00,0x00,0x00,
+	0x76,0x64,0x73,0x6f,0x3a,0x20,0x52,0x75,
+	0x6e,0x74,0x69,0x6d,0x65,0x20,0x76,0x64,
+	0x73,0x6f,0x2f,0x76,0x76,0x61,0x72,0x20,
+	0x6d,0x61,0x74,0x63,0x68,0x65,0x73,0x20,
+	0x64,0x75,0x6d,0x70,0x65,0x65,0x2c,0x20,
+	0x72,0x65,0x6d,0x61,0x70,0x20,0x69,0x6e,
+	0x70,0x6c,0x61,0x63,0x65,0x0a,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x76,
+	0x64,0x73,0x6f,0x3a,0x20,0x46,0x61,0x69,
+	0x6c,0x65,0x64,0x20,0x74,0x6f,0x20,0x75,
+	0x6e,0x6d,0x61,0x70,0x20,0x64,0x75,0x6d,
+	0x70,0x65,0x65,0x20,0x76,0x64,0x73,0x6f,
+	0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x76,
+	0x64,0x73,0x6f,0x3a,0x20,0x46,0x61,0x69,
+	0x6c,0x65,0x64,0x20,0x74,0x6f,0x20,0x75,
+	0x6e,0x6d,0x61,0x70,0x20,0x64,0x75,0x6d,
+	0x70,0x65,0x65,0x20,0x76,0x76,0x61,0x72,
+	0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x76,0x64,0x73,0x6f,0x3a,0x20,0x52,0x75,
+	0x6e,0x74,0x69,0x6d,0x65,0x20,0x76,0x64,
+	0x73,0x6f,0x20,0x6d,0x69,0x73,0x6d,0x61,
+	0x74,0x63,0x68,0x65,0x73,0x20,0x64,0x75,
+	0x6d,0x70,0x65,0x65,0x2c,0x20,0x67,0x65,
+	0x6e,0x65,0x72,0x61,0x74,0x65,0x20,0x70,
+	0x72,0x6f,0x78,0x79,0x0a,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x76,
+	0x64,0x73,0x6f,0x3a,0x20,0x46,0x61,0x69,
+	0x6c,0x65,0x64,0x20,0x74,0x6f,0x20,0x70,
+	0x72,0x6f,0x78,0x69,0x66,0x79,0x20,0x64,
+	0x75,0x6d,0x70,0x65,0x65,0x20,0x63,0x6f,
+	0x6e,0x74,0x65,0x6e,0x74,0x73,0x0a,0x00,
+	0x76,0x64,0x73,0x6f,0x3a,0x20,0x6a,0x6d,
+	0x70,0x3a,0x20,0x25,0x6c,0x78,0x2f,0x25,
+	0x6c,0x78,0x20,0x2d,0x3e,0x20,0x25,0x6c,
+	0x78,0x2f,0x25,0x6c,0x78,0x20,0x28,0x69,
+	0x6e,0x64,0x65,0x78,0x20,0x25,0x64,0x29,
+	0x0a,0x00,0x63,0x6f,0x6d,0x70,0x61,0x74,
+	0x69,0x62,0x6c,0x65,0x00,0x6e,0x61,0x74,
+	0x69,0x76,0x65,0x00,0x4d,0x61,0x70,0x70,
+	0x69,0x6e,0x67,0x20,0x25,0x73,0x20,0x76,
+	0x44,0x53,0x4f,0x20,0x61,0x74,0x20,0x25,
+	0x6c,0x78,0x0a,0x00,0x53,0x45,0x54,0x5f,
+	0x46,0x53,0x20,0x66,0x61,0x69,0x6c,0x20,
+	0x25,0x6c,0x64,0x0a,0x00,0x53,0x45,0x54,
+	0x5f,0x47,0x53,0x20,0x66,0x61,0x69,0x6c,
+	0x20,0x25,0x6c,0x64,0x0a,0x00,0x63,0x72,
+	0x69,0x75,0x2f,0x61,0x72,0x63,0x68,0x2f,
+	0x78,0x38,0x36,0x2f,0x72,0x65,0x73,0x74,
+	0x6f,0x72,0x65,0x72,0x2e,0x63,0x00,0x00,
+	0x63,0x72,0x69,0x75,0x2f,0x61,0x72,0x63,
+	0x68,0x2f,0x78,0x38,0x36,0x2f,0x69,0x6e,
+	0x63,0x6c,0x75,0x64,0x65,0x2f,0x61,0x73,
+	0x6d,0x2f,0x63,0x6f,0x6d,0x70,0x61,0x74,
+	0x2e,0x68,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x6d,
+	0x6d,0x61,0x70,0x28,0x29,0x20,0x6f,0x66,
+	0x20,0x63,0x6f,0x6d,0x70,0x61,0x74,0x20,
+	0x73,0x79,0x73,0x63,0x61,0x6c,0x6c,0x20,
+	0x73,0x74,0x61,0x63,0x6b,0x20,0x66,0x61,
+	0x69,0x6c,0x65,0x64,0x20,0x77,0x69,0x74,
+	0x68,0x20,0x25,0x64,0x0a,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x46,
+	0x61,0x69,0x6c,0x65,0x64,0x20,0x74,0x6f,
+	0x20,0x61,0x6c,0x6c,0x6f,0x63,0x61,0x74,
+	0x65,0x20,0x73,0x74,0x61,0x63,0x6b,0x20,
+	0x66,0x6f,0x72,0x20,0x33,0x32,0x2d,0x62,
+	0x69,0x74,0x20,0x54,0x4c,0x53,0x20,0x72,
+	0x65,0x73,0x74,0x6f,0x72,0x65,0x0a,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x46,
+	0x61,0x69,0x6c,0x65,0x64,0x20,0x74,0x6f,
+	0x20,0x72,0x65,0x73,0x74,0x6f,0x72,0x65,
+	0x20,0x54,0x4c,0x53,0x20,0x64,0x65,0x73,
+	0x63,0x72,0x69,0x70,0x74,0x6f,0x72,0x20,
+	0x25,0x75,0x20,0x69,0x6e,0x20,0x47,0x44,
+	0x54,0x3a,0x20,0x25,0x64,0x0a,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x6d,
+	0x75,0x6e,0x6d,0x61,0x70,0x28,0x29,0x20,
+	0x6f,0x66,0x20,0x63,0x6f,0x6d,0x70,0x61,
+	0x74,0x20,0x61,0x64,0x64,0x72,0x20,0x25,
+	0x70,0x20,0x66,0x61,0x69,0x6c,0x65,0x64,
+	0x20,0x77,0x69,0x74,0x68,0x20,0x25,0x6c,
+	0x64,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x63,0x72,0x69,0x75,0x2f,0x61,0x72,0x63,
+	0x68,0x2f,0x78,0x38,0x36,0x2f,0x73,0x69,
+	0x67,0x61,0x63,0x74,0x69,0x6f,0x6e,0x5f,
+	0x63,0x6f,0x6d,0x70,0x61,0x74,0x5f,0x70,
+	0x69,0x65,0x2e,0x63,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x63,
+	0x6f,0x6d,0x70,0x61,0x74,0x20,0x72,0x74,
+	0x5f,0x73,0x69,0x67,0x61,0x63,0x74,0x69,
+	0x6f,0x6e,0x20,0x77,0x69,0x74,0x68,0x6f,
+	0x75,0x74,0x20,0x33,0x32,0x2d,0x62,0x69,
+	0x74,0x20,0x73,0x74,0x61,0x63,0x6b,0x0a,
+	0x00,0x63,0x72,0x69,0x75,0x2f,0x70,0x69,
+	0x65,0x2f,0x72,0x65,0x73,0x74,0x6f,0x72,
+	0x65,0x72,0x2e,0x63,0x00,0x72,0x73,0x65,
+	0x71,0x3a,0x20,0x6e,0x6f,0x74,0x68,0x69,
+	0x6e,0x67,0x20,0x74,0x6f,0x20,0x72,0x65,
+	0x73,0x74,0x6f,0x72,0x65,0x0a,0x00,0x52,
+	0x65,0x73,0x74,0x6f,0x72,0x65,0x20,0x73,
+	0x69,0x67,0x6e,0x61,0x6c,0x20,0x25,0x64,
+	0x20,0x67,0x72,0x6f,0x75,0x70,0x20,0x25,
+	0x64,0x0a,0x00,0x73,0x65,0x63,0x63,0x6f,
+	0x6d,0x70,0x3a,0x20,0x6d,0x6f,0x64,0x65,
+	0x20,0x25,0x64,0x20,0x6f,0x6e,0x20,0x74,
+	0x69,0x64,0x20,0x25,0x64,0x0a,0x00,0x73,
+	0x65,0x6c,0x66,0x2f,0x74,0x61,0x73,0x6b,
+	0x2f,0x25,0x6c,0x64,0x2f,0x61,0x74,0x74,
+	0x72,0x2f,0x25,0x73,0x00,0x73,0x6f,0x63,
+	0x6b,0x63,0x72,0x65,0x61,0x74,0x65,0x00,
+	0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x00,
+	0x65,0x78,0x69,0x74,0x65,0x64,0x2c,0x20,
+	0x73,0x74,0x61,0x74,0x75,0x73,0x3d,0x00,
+	0x64,0x69,0x73,0x61,0x70,0x70,0x65,0x61,
+	0x72,0x65,0x64,0x20,0x77,0x69,0x74,0x68,
+	0x00,0x6b,0x69,0x6c,0x6c,0x65,0x64,0x20,
+	0x62,0x79,0x20,0x73,0x69,0x67,0x6e,0x61,
+	0x6c,0x00,0x74,0x65,0x72,0x6d,0x69,0x6e,
+	0x61,0x74,0x65,0x64,0x20,0x61,0x62,0x6e,
+	0x6f,0x72,0x6d,0x61,0x6c,0x6c,0x79,0x20,
+	0x77,0x69,0x74,0x68,0x00,0x74,0x72,0x61,
+	0x70,0x70,0x65,0x64,0x20,0x77,0x69,0x74,
+	0x68,0x00,0x73,0x74,0x6f,0x70,0x70,0x65,
+	0x64,0x20,0x77,0x69,0x74,0x68,0x00,0x54,
+	0x61,0x73,0x6b,0x20,0x25,0x64,0x20,0x25,
+	0x73,0x20,0x25,0x64,0x0a,0x00,0x25,0x6c,
+	0x64,0x3a,0x20,0x52,0x65,0x73,0x74,0x6f,
+	0x72,0x65,0x64,0x0a,0x00,0x45,0x72,0x72,
+	0x6f,0x72,0x20,0x28,0x25,0x73,0x3a,0x25,
+	0x64,0x29,0x3a,0x20,0x42,0x55,0x47,0x20,
+	0x61,0x74,0x20,0x25,0x73,0x3a,0x25,0x64,
+	0x0a,0x00,0x53,0x77,0x69,0x74,0x63,0x68,
+	0x65,0x64,0x20,0x74,0x6f,0x20,0x74,0x68,
+	0x65,0x20,0x72,0x65,0x73,0x74,0x6f,0x72,
+	0x65,0x72,0x20,0x25,0x64,0x0a,0x00,0x6c,
+	0x61,0x7a,0x79,0x2d,0x70,0x61,0x67,0x65,
+	0x73,0x3a,0x20,0x75,0x66,0x66,0x64,0x20,
+	0x25,0x64,0x0a,0x00,0x6c,0x61,0x7a,0x79,
+	0x2d,0x70,0x61,0x67,0x65,0x73,0x3a,0x20,
+	0x63,0x6c,0x6f,0x73,0x69,0x6e,0x67,0x20,
+	0x75,0x66,0x66,0x64,0x20,0x25,0x64,0x0a,
+	0x00,0x41,0x74,0x74,0x61,0x63,0x68,0x20,
+	0x53,0x59,0x53,0x56,0x20,0x73,0x68,0x6d,
+	0x65,0x6d,0x20,0x25,0x64,0x20,0x61,0x74,
+	0x20,0x25,0x6c,0x78,0x0a,0x00,0x09,0x6d,
+	0x6d,0x61,0x70,0x28,0x25,0x6c,0x78,0x20,
+	0x2d,0x3e,0x20,0x25,0x6c,0x78,0x2c,0x20,
+	0x25,0x78,0x20,0x25,0x78,0x20,0x25,0x64,
+	0x29,0x0a,0x00,0x2f,0x64,0x65,0x76,0x2f,
+	0x6e,0x75,0x6c,0x6c,0x00,0x20,0x20,0x2e,
+	0x73,0x74,0x61,0x72,0x74,0x5f,0x63,0x6f,
+	0x64,0x65,0x20,0x3d,0x20,0x25,0x6c,0x78,
+	0x0a,0x00,0x20,0x20,0x2e,0x65,0x6e,0x64,
+	0x5f,0x63,0x6f,0x64,0x65,0x20,0x3d,0x20,
+	0x25,0x6c,0x78,0x0a,0x00,0x20,0x20,0x2e,
+	0x73,0x74,0x61,0x72,0x74,0x5f,0x64,0x61,
+	0x74,0x61,0x20,0x3d,0x20,0x25,0x6c,0x78,
+	0x0a,0x00,0x20,0x20,0x2e,0x65,0x6e,0x64,
+	0x5f,0x64,0x61,0x74,0x61,0x20,0x3d,0x20,
+	0x25,0x6c,0x78,0x0a,0x00,0x20,0x20,0x2e,
+	0x73,0x74,0x61,0x72,0x74,0x5f,0x73,0x74,
+	0x61,0x63,0x6b,0x20,0x3d,0x20,0x25,0x6c,
+	0x78,0x0a,0x00,0x20,0x20,0x2e,0x73,0x74,
+	0x61,0x72,0x74,0x5f,0x62,0x72,0x6b,0x20,
+	0x3d,0x20,0x25,0x6c,0x78,0x0a,0x00,0x20,
+	0x20,0x2e,0x62,0x72,0x6b,0x20,0x3d,0x20,
+	0x25,0x6c,0x78,0x0a,0x00,0x20,0x20,0x2e,
+	0x61,0x72,0x67,0x5f,0x73,0x74,0x61,0x72,
+	0x74,0x20,0x3d,0x20,0x25,0x6c,0x78,0x0a,
+	0x00,0x20,0x20,0x2e,0x61,0x72,0x67,0x5f,
+	0x65,0x6e,0x64,0x20,0x3d,0x20,0x25,0x6c,
+	0x78,0x0a,0x00,0x20,0x20,0x2e,0x65,0x6e,
+	0x76,0x5f,0x73,0x74,0x61,0x72,0x74,0x20,
+	0x3d,0x20,0x25,0x6c,0x78,0x0a,0x00,0x20,
+	0x20,0x2e,0x65,0x6e,0x76,0x5f,0x65,0x6e,
+	0x64,0x20,0x3d,0x20,0x25,0x6c,0x78,0x0a,
+	0x00,0x20,0x20,0x2e,0x61,0x75,0x78,0x76,
+	0x5f,0x73,0x69,0x7a,0x65,0x20,0x3d,0x20,
+	0x25,0x75,0x0a,0x00,0x20,0x20,0x2e,0x65,
+	0x78,0x65,0x5f,0x66,0x64,0x20,0x3d,0x20,
+	0x25,0x75,0x0a,0x00,0x20,0x20,0x2e,0x61,
+	0x75,0x78,0x76,0x5b,0x25,0x64,0x5d,0x20,
+	0x3d,0x20,0x25,0x6c,0x78,0x0a,0x00,0x52,
+	0x65,0x73,0x74,0x6f,0x72,0x69,0x6e,0x67,
+	0x20,0x45,0x58,0x45,0x20,0x6c,0x69,0x6e,
+	0x6b,0x0a,0x00,0x73,0x79,0x73,0x2f,0x6b,
+	0x65,0x72,0x6e,0x65,0x6c,0x2f,0x6e,0x73,
+	0x5f,0x6c,0x61,0x73,0x74,0x5f,0x70,0x69,
+	0x64,0x00,0x74,0x69,0x6d,0x65,0x72,0x66,
+	0x64,0x3a,0x20,0x61,0x72,0x6d,0x20,0x66,
+	0x6f,0x72,0x20,0x66,0x64,0x20,0x25,0x64,
+	0x20,0x28,0x25,0x64,0x29,0x0a,0x00,0x63,
+	0x72,0x69,0x75,0x2f,0x69,0x6e,0x63,0x6c,
+	0x75,0x64,0x65,0x2f,0x73,0x6b,0x2d,0x69,
+	0x6e,0x65,0x74,0x2e,0x68,0x00,0x00,0x00,
+	0x57,0x61,0x72,0x6e,0x20,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x44,
+	0x75,0x6d,0x70,0x61,0x62,0x6c,0x65,0x20,
+	0x66,0x6c,0x61,0x67,0x20,0x6e,0x6f,0x74,
+	0x20,0x70,0x72,0x65,0x73,0x65,0x6e,0x74,
+	0x20,0x69,0x6e,0x20,0x63,0x72,0x69,0x75,
+	0x20,0x64,0x75,0x6d,0x70,0x2e,0x0a,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x55,
+	0x6e,0x61,0x62,0x6c,0x65,0x20,0x74,0x6f,
+	0x20,0x73,0x65,0x74,0x20,0x50,0x52,0x5f,
+	0x53,0x45,0x54,0x5f,0x44,0x55,0x4d,0x50,
+	0x41,0x42,0x4c,0x45,0x3a,0x20,0x25,0x64,
+	0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x57,0x61,0x72,0x6e,0x20,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x44,
+	0x75,0x6d,0x70,0x61,0x62,0x6c,0x65,0x20,
+	0x66,0x6c,0x61,0x67,0x20,0x5b,0x25,0x64,
+	0x5d,0x20,0x64,0x6f,0x65,0x73,0x20,0x6e,
+	0x6f,0x74,0x20,0x6d,0x61,0x74,0x63,0x68,
+	0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,
+	0x20,0x5b,0x25,0x64,0x5d,0x2e,0x20,0x57,
+	0x69,0x6c,0x6c,0x20,0x66,0x61,0x6c,0x6c,
+	0x62,0x61,0x63,0x6b,0x20,0x74,0x6f,0x20,
+	0x73,0x65,0x74,0x74,0x69,0x6e,0x67,0x20,
+	0x69,0x74,0x20,0x74,0x6f,0x20,0x30,0x20,
+	0x74,0x6f,0x20,0x64,0x69,0x73,0x61,0x62,
+	0x6c,0x65,0x20,0x69,0x74,0x2e,0x0a,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x46,
+	0x61,0x69,0x6c,0x65,0x64,0x20,0x74,0x6f,
+	0x20,0x72,0x65,0x63,0x6f,0x76,0x65,0x72,
+	0x20,0x66,0x75,0x74,0x65,0x78,0x20,0x72,
+	0x6f,0x62,0x75,0x73,0x74,0x20,0x6c,0x69,
+	0x73,0x74,0x3a,0x20,0x25,0x64,0x0a,0x00,
+	0x52,0x65,0x73,0x74,0x6f,0x72,0x69,0x6e,
+	0x67,0x20,0x73,0x63,0x68,0x65,0x64,0x75,
+	0x6c,0x65,0x72,0x20,0x70,0x61,0x72,0x61,
+	0x6d,0x73,0x20,0x25,0x64,0x2e,0x25,0x64,
+	0x2e,0x25,0x64,0x0a,0x00,0x00,0x00,0x00,
+	0x72,0x73,0x65,0x71,0x3a,0x20,0x72,0x73,
+	0x65,0x71,0x5f,0x61,0x62,0x69,0x5f,0x70,
+	0x6f,0x69,0x6e,0x74,0x65,0x72,0x20,0x3d,
+	0x20,0x25,0x6c,0x78,0x20,0x73,0x69,0x67,
+	0x6e,0x61,0x74,0x75,0x72,0x65,0x20,0x3d,
+	0x20,0x25,0x78,0x0a,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x66,
+	0x61,0x69,0x6c,0x65,0x64,0x20,0x73,0x79,
+	0x73,0x5f,0x72,0x73,0x65,0x71,0x28,0x25,
+	0x6c,0x78,0x2c,0x20,0x25,0x6c,0x78,0x2c,
+	0x20,0x25,0x78,0x2c,0x20,0x25,0x78,0x29,
+	0x20,0x3d,0x20,0x25,0x64,0x0a,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x55,
+	0x6e,0x61,0x62,0x6c,0x65,0x20,0x74,0x6f,
+	0x20,0x73,0x65,0x6e,0x64,0x20,0x73,0x69,
+	0x67,0x69,0x6e,0x66,0x6f,0x20,0x25,0x64,
+	0x20,0x25,0x78,0x20,0x77,0x69,0x74,0x68,
+	0x20,0x63,0x6f,0x64,0x65,0x20,0x25,0x64,
+	0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x73,
+	0x65,0x63,0x63,0x6f,0x6d,0x70,0x3a,0x20,
+	0x53,0x45,0x43,0x43,0x4f,0x4d,0x50,0x5f,
+	0x4d,0x4f,0x44,0x45,0x5f,0x53,0x54,0x52,
+	0x49,0x43,0x54,0x20,0x72,0x65,0x74,0x75,
+	0x72,0x6e,0x65,0x64,0x20,0x25,0x64,0x20,
+	0x6f,0x6e,0x20,0x74,0x69,0x64,0x20,0x25,
+	0x64,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x73,0x65,0x63,0x63,0x6f,0x6d,0x70,0x3a,
+	0x20,0x52,0x65,0x73,0x74,0x6f,0x72,0x69,
+	0x6e,0x67,0x20,0x6d,0x6f,0x64,0x65,0x20,
+	0x25,0x64,0x20,0x66,0x6c,0x61,0x67,0x73,
+	0x20,0x25,0x78,0x20,0x6f,0x6e,0x20,0x74,
+	0x69,0x64,0x20,0x25,0x64,0x20,0x66,0x69,
+	0x6c,0x74,0x65,0x72,0x20,0x25,0x64,0x0a,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x73,0x65,0x63,0x63,0x6f,0x6d,0x70,0x3a,
+	0x20,0x73,0x79,0x73,0x5f,0x73,0x65,0x63,
+	0x63,0x6f,0x6d,0x70,0x20,0x69,0x73,0x20,
+	0x6e,0x6f,0x74,0x20,0x73,0x75,0x70,0x70,
+	0x6f,0x72,0x74,0x65,0x64,0x20,0x69,0x6e,
+	0x20,0x6b,0x65,0x72,0x6e,0x65,0x6c,0x2c,
+	0x20,0x73,0x77,0x69,0x74,0x63,0x68,0x69,
+	0x6e,0x67,0x20,0x74,0x6f,0x20,0x70,0x72,
+	0x63,0x74,0x6c,0x20,0x69,0x6e,0x74,0x65,
+	0x72,0x66,0x61,0x63,0x65,0x0a,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x73,
+	0x65,0x63,0x63,0x6f,0x6d,0x70,0x3a,0x20,
+	0x50,0x52,0x5f,0x53,0x45,0x54,0x5f,0x53,
+	0x45,0x43,0x43,0x4f,0x4d,0x50,0x20,0x72,
+	0x65,0x74,0x75,0x72,0x6e,0x65,0x64,0x20,
+	0x25,0x64,0x20,0x6f,0x6e,0x20,0x74,0x69,
+	0x64,0x20,0x25,0x64,0x0a,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x73,
+	0x65,0x63,0x63,0x6f,0x6d,0x70,0x3a,0x20,
+	0x53,0x45,0x43,0x43,0x4f,0x4d,0x50,0x5f,
+	0x53,0x45,0x54,0x5f,0x4d,0x4f,0x44,0x45,
+	0x5f,0x46,0x49,0x4c,0x54,0x45,0x52,0x20,
+	0x72,0x65,0x74,0x75,0x72,0x6e,0x65,0x64,
+	0x20,0x25,0x64,0x20,0x6f,0x6e,0x20,0x74,
+	0x69,0x64,0x20,0x25,0x64,0x0a,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x73,
+	0x65,0x63,0x63,0x6f,0x6d,0x70,0x3a,0x20,
+	0x55,0x6e,0x6b,0x6e,0x6f,0x77,0x6e,0x20,
+	0x73,0x65,0x63,0x63,0x6f,0x6d,0x70,0x20,
+	0x6d,0x6f,0x64,0x65,0x20,0x25,0x64,0x20,
+	0x6f,0x6e,0x20,0x74,0x69,0x64,0x20,0x25,
+	0x64,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x73,0x65,0x63,0x63,0x6f,0x6d,0x70,0x3a,
+	0x20,0x52,0x65,0x73,0x74,0x6f,0x72,0x65,
+	0x64,0x20,0x6d,0x6f,0x64,0x65,0x20,0x25,
+	0x64,0x20,0x6f,0x6e,0x20,0x74,0x69,0x64,
+	0x20,0x25,0x64,0x0a,0x00,0x00,0x00,0x00,
+	0x72,0x65,0x73,0x74,0x6f,0x72,0x69,0x6e,
+	0x67,0x20,0x6c,0x73,0x6d,0x20,0x70,0x72,
+	0x6f,0x66,0x69,0x6c,0x65,0x20,0x28,0x25,
+	0x73,0x29,0x20,0x25,0x73,0x0a,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x66,
+	0x61,0x69,0x6c,0x65,0x64,0x20,0x6f,0x70,
+	0x65,0x6e,0x61,0x74,0x20,0x25,0x64,0x0a,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x63,
+	0x61,0x6e,0x27,0x74,0x20,0x77,0x72,0x69,
+	0x74,0x65,0x20,0x6c,0x73,0x6d,0x20,0x70,
+	0x72,0x6f,0x66,0x69,0x6c,0x65,0x20,0x25,
+	0x64,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x43,
+	0x61,0x6e,0x27,0x74,0x20,0x73,0x65,0x74,
+	0x75,0x70,0x20,0x73,0x75,0x70,0x70,0x6c,
+	0x65,0x6d,0x65,0x6e,0x74,0x61,0x72,0x79,
+	0x20,0x67,0x72,0x6f,0x75,0x70,0x20,0x49,
+	0x44,0x73,0x3a,0x20,0x25,0x64,0x0a,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x55,
+	0x6e,0x61,0x62,0x6c,0x65,0x20,0x74,0x6f,
+	0x20,0x73,0x65,0x74,0x20,0x53,0x45,0x43,
+	0x55,0x52,0x45,0x5f,0x4e,0x4f,0x5f,0x53,
+	0x45,0x54,0x55,0x49,0x44,0x5f,0x46,0x49,
+	0x58,0x55,0x50,0x3a,0x20,0x25,0x64,0x0a,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x55,
+	0x6e,0x61,0x62,0x6c,0x65,0x20,0x74,0x6f,
+	0x20,0x73,0x65,0x74,0x20,0x72,0x65,0x61,
+	0x6c,0x2c,0x20,0x65,0x66,0x66,0x65,0x63,
+	0x74,0x69,0x76,0x65,0x20,0x61,0x6e,0x64,
+	0x20,0x73,0x61,0x76,0x65,0x64,0x20,0x75,
+	0x73,0x65,0x72,0x20,0x49,0x44,0x3a,0x20,
+	0x25,0x64,0x0a,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x55,
+	0x6e,0x61,0x62,0x6c,0x65,0x20,0x74,0x6f,
+	0x20,0x73,0x65,0x74,0x20,0x66,0x73,0x75,
+	0x69,0x64,0x0a,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x55,
+	0x6e,0x61,0x62,0x6c,0x65,0x20,0x74,0x6f,
+	0x20,0x73,0x65,0x74,0x20,0x72,0x65,0x61,
+	0x6c,0x2c,0x20,0x65,0x66,0x66,0x65,0x63,
+	0x74,0x69,0x76,0x65,0x20,0x61,0x6e,0x64,
+	0x20,0x73,0x61,0x76,0x65,0x64,0x20,0x67,
+	0x72,0x6f,0x75,0x70,0x20,0x49,0x44,0x3a,
+	0x20,0x25,0x64,0x0a,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x55,
+	0x6e,0x61,0x62,0x6c,0x65,0x20,0x74,0x6f,
+	0x20,0x73,0x65,0x74,0x20,0x66,0x73,0x67,
+	0x69,0x64,0x0a,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x55,
+	0x6e,0x61,0x62,0x6c,0x65,0x20,0x74,0x6f,
+	0x20,0x73,0x65,0x74,0x20,0x50,0x52,0x5f,
+	0x53,0x45,0x54,0x5f,0x53,0x45,0x43,0x55,
+	0x52,0x45,0x42,0x49,0x54,0x53,0x3a,0x20,
+	0x25,0x64,0x0a,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x55,
+	0x6e,0x61,0x62,0x6c,0x65,0x20,0x74,0x6f,
+	0x20,0x64,0x72,0x6f,0x70,0x20,0x63,0x61,
+	0x70,0x61,0x62,0x69,0x6c,0x69,0x74,0x79,
+	0x20,0x25,0x64,0x3a,0x20,0x25,0x64,0x0a,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x55,
+	0x6e,0x61,0x62,0x6c,0x65,0x20,0x74,0x6f,
+	0x20,0x72,0x65,0x73,0x74,0x6f,0x72,0x65,
+	0x20,0x63,0x61,0x70,0x61,0x62,0x69,0x6c,
+	0x69,0x74,0x69,0x65,0x73,0x3a,0x20,0x25,
+	0x64,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x46,
+	0x61,0x69,0x6c,0x65,0x64,0x20,0x74,0x6f,
+	0x20,0x70,0x6f,0x6c,0x6c,0x20,0x66,0x72,
+	0x6f,0x6d,0x20,0x69,0x6e,0x6f,0x74,0x69,
+	0x66,0x79,0x20,0x66,0x64,0x3a,0x20,0x25,
+	0x64,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x46,
+	0x61,0x69,0x6c,0x65,0x64,0x20,0x74,0x6f,
+	0x20,0x72,0x65,0x61,0x64,0x20,0x69,0x6e,
+	0x6f,0x74,0x69,0x66,0x79,0x20,0x65,0x76,
+	0x65,0x6e,0x74,0x73,0x0a,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x54,
+	0x68,0x72,0x65,0x61,0x64,0x20,0x70,0x69,
+	0x64,0x20,0x6d,0x69,0x73,0x6d,0x61,0x74,
+	0x63,0x68,0x20,0x25,0x64,0x2f,0x25,0x64,
+	0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x55,
+	0x6e,0x61,0x62,0x6c,0x65,0x20,0x74,0x6f,
+	0x20,0x62,0x6c,0x6f,0x63,0x6b,0x20,0x73,
+	0x69,0x67,0x6e,0x61,0x6c,0x73,0x20,0x25,
+	0x64,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x64,
+	0x6f,0x20,0x6e,0x6f,0x74,0x20,0x73,0x75,
+	0x70,0x70,0x6f,0x72,0x74,0x20,0x63,0x67,
+	0x72,0x6f,0x75,0x70,0x64,0x20,0x66,0x6f,
+	0x72,0x20,0x6e,0x6f,0x77,0x21,0x0a,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x55,
+	0x6e,0x61,0x62,0x6c,0x65,0x20,0x74,0x6f,
+	0x20,0x73,0x65,0x74,0x20,0x61,0x20,0x74,
+	0x68,0x72,0x65,0x61,0x64,0x20,0x6e,0x61,
+	0x6d,0x65,0x3a,0x20,0x25,0x64,0x0a,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x55,
+	0x6e,0x61,0x62,0x6c,0x65,0x20,0x74,0x6f,
+	0x20,0x73,0x65,0x74,0x20,0x50,0x52,0x5f,
+	0x53,0x45,0x54,0x5f,0x50,0x44,0x45,0x41,
+	0x54,0x48,0x53,0x49,0x47,0x28,0x25,0x64,
+	0x29,0x3a,0x20,0x25,0x64,0x0a,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x52,
+	0x65,0x73,0x74,0x6f,0x72,0x65,0x72,0x20,
+	0x61,0x62,0x6e,0x6f,0x72,0x6d,0x61,0x6c,
+	0x20,0x74,0x65,0x72,0x6d,0x69,0x6e,0x61,
+	0x74,0x69,0x6f,0x6e,0x20,0x66,0x6f,0x72,
+	0x20,0x25,0x6c,0x64,0x0a,0x00,0x00,0x00,
+	0x43,0x6c,0x65,0x61,0x6e,0x69,0x6e,0x67,
+	0x20,0x69,0x6e,0x6f,0x74,0x69,0x66,0x79,
+	0x20,0x65,0x76,0x65,0x6e,0x74,0x73,0x20,
+	0x66,0x72,0x6f,0x6d,0x20,0x25,0x64,0x0a,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x46,
+	0x61,0x69,0x6c,0x65,0x64,0x20,0x74,0x6f,
+	0x20,0x73,0x65,0x74,0x20,0x53,0x49,0x47,
+	0x43,0x48,0x4c,0x44,0x20,0x25,0x6c,0x64,
+	0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x46,
+	0x61,0x69,0x6c,0x65,0x64,0x20,0x74,0x6f,
+	0x20,0x75,0x6e,0x62,0x6c,0x6f,0x63,0x6b,
+	0x20,0x53,0x49,0x47,0x43,0x48,0x4c,0x44,
+	0x20,0x25,0x6c,0x64,0x0a,0x00,0x00,0x00,
+	0x62,0x6f,0x6f,0x74,0x73,0x74,0x72,0x61,
+	0x70,0x20,0x73,0x74,0x61,0x72,0x74,0x20,
+	0x25,0x70,0x20,0x6c,0x65,0x6e,0x20,0x25,
+	0x64,0x20,0x76,0x64,0x73,0x6f,0x20,0x6c,
+	0x65,0x6e,0x20,0x25,0x6c,0x64,0x0a,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x43,
+	0x6f,0x6d,0x70,0x61,0x74,0x69,0x62,0x6c,
+	0x65,0x20,0x6d,0x6f,0x64,0x65,0x20,0x77,
+	0x69,0x74,0x68,0x6f,0x75,0x74,0x20,0x76,
+	0x64,0x73,0x6f,0x20,0x6d,0x61,0x70,0x20,
+	0x73,0x75,0x70,0x70,0x6f,0x72,0x74,0x0a,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x57,0x61,0x72,0x6e,0x20,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x43,
+	0x61,0x6e,0x27,0x74,0x20,0x72,0x65,0x73,
+	0x74,0x6f,0x72,0x65,0x20,0x76,0x76,0x61,
+	0x72,0x20,0x2d,0x20,0x63,0x6f,0x6e,0x74,
+	0x69,0x6e,0x75,0x69,0x6e,0x67,0x20,0x72,
+	0x65,0x67,0x61,0x72,0x64,0x6c,0x65,0x73,
+	0x73,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x70,
+	0x72,0x65,0x6d,0x61,0x70,0x70,0x65,0x64,
+	0x20,0x61,0x64,0x64,0x72,0x20,0x6e,0x6f,
+	0x6e,0x20,0x6e,0x75,0x6c,0x6c,0x3a,0x20,
+	0x25,0x23,0x6c,0x78,0x2c,0x20,0x6c,0x65,
+	0x6e,0x20,0x3d,0x20,0x25,0x23,0x6c,0x78,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x55,
+	0x6e,0x61,0x62,0x6c,0x65,0x20,0x74,0x6f,
+	0x20,0x75,0x6e,0x6d,0x61,0x70,0x20,0x28,
+	0x25,0x70,0x2d,0x25,0x70,0x29,0x3a,0x20,
+	0x25,0x64,0x0a,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x46,
+	0x61,0x69,0x6c,0x65,0x64,0x20,0x74,0x6f,
+	0x20,0x6d,0x61,0x70,0x20,0x76,0x64,0x73,
+	0x6f,0x20,0x25,0x64,0x0a,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x66,
+	0x6f,0x75,0x6e,0x64,0x20,0x75,0x6e,0x65,
+	0x78,0x70,0x65,0x63,0x74,0x65,0x64,0x20,
+	0x56,0x4d,0x41,0x5f,0x50,0x52,0x45,0x4d,
+	0x4d,0x41,0x50,0x45,0x44,0x20,0x61,0x72,
+	0x65,0x61,0x21,0x0a,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x43,
+	0x61,0x6e,0x6e,0x6f,0x74,0x20,0x72,0x65,
+	0x2d,0x65,0x6e,0x61,0x62,0x6c,0x65,0x20,
+	0x54,0x48,0x50,0x3a,0x20,0x25,0x64,0x0a,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x43,
+	0x61,0x6e,0x27,0x74,0x20,0x72,0x65,0x73,
+	0x74,0x6f,0x72,0x65,0x20,0x25,0x6c,0x78,
+	0x20,0x6d,0x61,0x70,0x70,0x69,0x6e,0x67,
+	0x20,0x77,0x69,0x74,0x68,0x20,0x25,0x6c,
+	0x78,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x63,
+	0x61,0x6e,0x6e,0x6f,0x74,0x20,0x61,0x74,
+	0x74,0x61,0x63,0x68,0x20,0x70,0x73,0x65,
+	0x75,0x64,0x6f,0x5f,0x6d,0x6d,0x20,0x25,
+	0x64,0x20,0x74,0x6f,0x20,0x70,0x72,0x6f,
+	0x63,0x65,0x73,0x73,0x20,0x25,0x64,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x52,
+	0x69,0x6e,0x67,0x20,0x73,0x65,0x74,0x75,
+	0x70,0x20,0x66,0x61,0x69,0x6c,0x65,0x64,
+	0x20,0x77,0x69,0x74,0x68,0x20,0x25,0x64,
+	0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x77,
+	0x72,0x6f,0x6e,0x67,0x20,0x61,0x69,0x6f,
+	0x3a,0x20,0x74,0x61,0x69,0x6c,0x3d,0x25,
+	0x78,0x20,0x68,0x65,0x61,0x64,0x3d,0x25,
+	0x78,0x20,0x72,0x65,0x71,0x3d,0x25,0x78,
+	0x20,0x6f,0x6c,0x64,0x5f,0x6e,0x72,0x3d,
+	0x25,0x78,0x20,0x6e,0x65,0x77,0x5f,0x6e,
+	0x72,0x3d,0x25,0x78,0x20,0x65,0x78,0x70,
+	0x65,0x63,0x74,0x3d,0x25,0x78,0x0a,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x43,
+	0x61,0x6e,0x27,0x74,0x20,0x6f,0x70,0x65,
+	0x6e,0x20,0x2f,0x64,0x65,0x76,0x2f,0x6e,
+	0x75,0x6c,0x6c,0x20,0x66,0x6f,0x72,0x20,
+	0x61,0x69,0x6f,0x0a,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x43,
+	0x61,0x6e,0x27,0x74,0x20,0x6d,0x6d,0x61,
+	0x70,0x20,0x61,0x69,0x6f,0x20,0x74,0x6d,
+	0x70,0x20,0x62,0x75,0x66,0x66,0x65,0x72,
+	0x3a,0x20,0x25,0x6c,0x64,0x0a,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x43,
+	0x61,0x6e,0x27,0x74,0x20,0x73,0x75,0x62,
+	0x6d,0x69,0x74,0x20,0x61,0x69,0x6f,0x20,
+	0x69,0x6f,0x63,0x62,0x73,0x3a,0x20,0x72,
+	0x65,0x74,0x3d,0x25,0x64,0x0a,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x52,
+	0x69,0x6e,0x67,0x20,0x72,0x65,0x6d,0x61,
+	0x70,0x20,0x66,0x61,0x69,0x6c,0x65,0x64,
+	0x20,0x77,0x69,0x74,0x68,0x20,0x25,0x6c,
+	0x64,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x6d,
+	0x61,0x64,0x76,0x69,0x73,0x65,0x28,0x25,
+	0x6c,0x78,0x2c,0x20,0x25,0x6c,0x75,0x2c,
+	0x20,0x25,0x6c,0x64,0x29,0x20,0x66,0x61,
+	0x69,0x6c,0x65,0x64,0x20,0x77,0x69,0x74,
+	0x68,0x20,0x25,0x6c,0x64,0x0a,0x00,0x00,
+	0x4d,0x45,0x54,0x52,0x49,0x43,0x20,0x5b,
+	0x70,0x69,0x64,0x3a,0x25,0x64,0x5d,0x20,
+	0x69,0x6e,0x20,0x72,0x65,0x73,0x74,0x6f,
+	0x72,0x65,0x72,0x20,0x74,0x6f,0x20,0x72,
+	0x65,0x73,0x74,0x6f,0x72,0x65,0x20,0x6d,
+	0x65,0x6d,0x6f,0x72,0x79,0x2c,0x20,0x73,
+	0x70,0x65,0x6e,0x74,0x20,0x25,0x6c,0x64,
+	0x20,0x75,0x73,0x0a,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x70,
+	0x72,0x63,0x74,0x6c,0x20,0x66,0x61,0x69,
+	0x6c,0x65,0x64,0x20,0x40,0x25,0x64,0x20,
+	0x77,0x69,0x74,0x68,0x20,0x25,0x6c,0x64,
+	0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x70,0x72,0x63,0x74,0x6c,0x20,0x50,0x52,
+	0x5f,0x53,0x45,0x54,0x5f,0x4d,0x4d,0x5f,
+	0x4d,0x41,0x50,0x20,0x66,0x61,0x69,0x6c,
+	0x65,0x64,0x20,0x77,0x69,0x74,0x68,0x20,
+	0x25,0x64,0x0a,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x43,
+	0x61,0x6e,0x27,0x74,0x20,0x72,0x65,0x73,
+	0x74,0x6f,0x72,0x65,0x20,0x45,0x58,0x45,
+	0x20,0x6c,0x69,0x6e,0x6b,0x20,0x28,0x25,
+	0x64,0x29,0x0a,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x73,
+	0x79,0x73,0x5f,0x70,0x72,0x63,0x74,0x6c,
+	0x28,0x50,0x52,0x5f,0x53,0x45,0x54,0x5f,
+	0x4d,0x4d,0x2c,0x20,0x50,0x52,0x5f,0x53,
+	0x45,0x54,0x5f,0x4d,0x4d,0x5f,0x4d,0x41,
+	0x50,0x29,0x20,0x66,0x61,0x69,0x6c,0x65,
+	0x64,0x20,0x77,0x69,0x74,0x68,0x20,0x25,
+	0x64,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x63,
+	0x61,0x6e,0x27,0x74,0x20,0x6f,0x70,0x65,
+	0x6e,0x20,0x6c,0x61,0x73,0x74,0x20,0x70,
+	0x69,0x64,0x20,0x66,0x64,0x20,0x25,0x64,
+	0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x55,0x73,0x69,0x6e,0x67,0x20,0x63,0x6c,
+	0x6f,0x6e,0x65,0x33,0x20,0x74,0x6f,0x20,
+	0x72,0x65,0x73,0x74,0x6f,0x72,0x65,0x20,
+	0x74,0x68,0x65,0x20,0x70,0x72,0x6f,0x63,
+	0x65,0x73,0x73,0x0a,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x43,
+	0x61,0x6e,0x27,0x74,0x20,0x73,0x65,0x74,
+	0x20,0x6c,0x61,0x73,0x74,0x5f,0x70,0x69,
+	0x64,0x20,0x25,0x6c,0x64,0x2f,0x25,0x73,
+	0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x55,
+	0x6e,0x61,0x62,0x6c,0x65,0x20,0x74,0x6f,
+	0x20,0x63,0x72,0x65,0x61,0x74,0x65,0x20,
+	0x61,0x20,0x74,0x68,0x72,0x65,0x61,0x64,
+	0x3a,0x20,0x25,0x6c,0x64,0x0a,0x00,0x00,
+	0x4d,0x45,0x54,0x52,0x49,0x43,0x20,0x5b,
+	0x70,0x69,0x64,0x3a,0x25,0x64,0x5d,0x20,
+	0x69,0x6e,0x20,0x72,0x65,0x73,0x74,0x6f,
+	0x72,0x65,0x72,0x20,0x74,0x6f,0x20,0x72,
+	0x65,0x73,0x74,0x6f,0x72,0x65,0x20,0x74,
+	0x68,0x72,0x65,0x61,0x64,0x73,0x20,0x73,
+	0x70,0x65,0x6e,0x74,0x20,0x25,0x6c,0x64,
+	0x20,0x75,0x73,0x0a,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x43,
+	0x61,0x6e,0x27,0x74,0x20,0x63,0x72,0x65,
+	0x61,0x74,0x65,0x20,0x70,0x6f,0x73,0x69,
+	0x78,0x20,0x74,0x69,0x6d,0x65,0x72,0x20,
+	0x2d,0x20,0x25,0x64,0x0a,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x43,
+	0x61,0x6e,0x27,0x74,0x20,0x72,0x65,0x6d,
+	0x6f,0x76,0x65,0x20,0x74,0x65,0x6d,0x70,
+	0x6f,0x72,0x61,0x74,0x79,0x20,0x70,0x6f,
+	0x73,0x69,0x78,0x20,0x74,0x69,0x6d,0x65,
+	0x72,0x20,0x30,0x78,0x25,0x78,0x0a,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x43,
+	0x61,0x6e,0x27,0x74,0x20,0x63,0x72,0x65,
+	0x61,0x74,0x65,0x20,0x74,0x69,0x6d,0x65,
+	0x72,0x73,0x2c,0x20,0x6b,0x65,0x72,0x6e,
+	0x65,0x6c,0x20,0x64,0x6f,0x6e,0x27,0x74,
+	0x20,0x67,0x69,0x76,0x65,0x20,0x74,0x68,
+	0x65,0x6d,0x20,0x63,0x6f,0x6e,0x73,0x65,
+	0x71,0x75,0x65,0x6e,0x74,0x6c,0x79,0x0a,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x43,
+	0x61,0x6e,0x27,0x74,0x20,0x72,0x65,0x73,
+	0x74,0x6f,0x72,0x65,0x20,0x70,0x6f,0x73,
+	0x69,0x78,0x20,0x74,0x69,0x6d,0x65,0x72,
+	0x73,0x20,0x25,0x6c,0x64,0x0a,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x43,
+	0x61,0x6e,0x27,0x74,0x20,0x67,0x65,0x74,
+	0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,
+	0x20,0x74,0x69,0x6d,0x65,0x0a,0x00,0x00,
+	0x41,0x64,0x6a,0x75,0x73,0x74,0x20,0x69,
+	0x64,0x20,0x25,0x78,0x20,0x69,0x74,0x5f,
+	0x76,0x61,0x6c,0x75,0x65,0x28,0x25,0x6c,
+	0x6c,0x75,0x2c,0x20,0x25,0x6c,0x6c,0x75,
+	0x29,0x20,0x2d,0x3e,0x20,0x69,0x74,0x5f,
+	0x76,0x61,0x6c,0x75,0x65,0x28,0x25,0x6c,
+	0x6c,0x75,0x2c,0x20,0x25,0x6c,0x6c,0x75,
+	0x29,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x43,
+	0x61,0x6e,0x27,0x74,0x20,0x72,0x65,0x73,
+	0x74,0x6f,0x72,0x65,0x20,0x74,0x69,0x63,
+	0x6b,0x73,0x2f,0x74,0x69,0x6d,0x65,0x20,
+	0x66,0x6f,0x72,0x20,0x74,0x69,0x6d,0x65,
+	0x72,0x66,0x64,0x20,0x2d,0x20,0x25,0x64,
+	0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x43,
+	0x61,0x6e,0x27,0x74,0x20,0x72,0x65,0x73,
+	0x74,0x6f,0x72,0x65,0x20,0x74,0x69,0x6d,
+	0x65,0x72,0x66,0x64,0x20,0x25,0x6c,0x64,
+	0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x25,
+	0x64,0x20,0x65,0x78,0x69,0x74,0x65,0x64,
+	0x20,0x77,0x69,0x74,0x68,0x20,0x6e,0x6f,
+	0x6e,0x2d,0x7a,0x65,0x72,0x6f,0x20,0x63,
+	0x6f,0x64,0x65,0x20,0x28,0x25,0x64,0x2c,
+	0x25,0x64,0x29,0x0a,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x57,
+	0x61,0x69,0x74,0x20,0x6f,0x6e,0x20,0x25,
+	0x64,0x20,0x7a,0x6f,0x6d,0x62,0x69,0x65,
+	0x20,0x66,0x61,0x69,0x6c,0x65,0x64,0x3a,
+	0x20,0x25,0x64,0x0a,0x00,0x00,0x00,0x00,
+	0x25,0x6c,0x64,0x3a,0x20,0x43,0x6f,0x6c,
+	0x6c,0x65,0x63,0x74,0x20,0x61,0x20,0x7a,
+	0x6f,0x6d,0x62,0x69,0x65,0x20,0x77,0x69,
+	0x74,0x68,0x20,0x70,0x69,0x64,0x20,0x25,
+	0x64,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x55,
+	0x6e,0x61,0x62,0x6c,0x65,0x20,0x74,0x6f,
+	0x20,0x62,0x6c,0x6f,0x63,0x6b,0x20,0x73,
+	0x69,0x67,0x6e,0x61,0x6c,0x73,0x20,0x25,
+	0x6c,0x64,0x0a,0x00,0x00,0x00,0x00,0x00,
+	0x63,0x72,0x69,0x75,0x2f,0x61,0x72,0x63,
+	0x68,0x2f,0x78,0x38,0x36,0x2f,0x69,0x6e,
+	0x63,0x6c,0x75,0x64,0x65,0x2f,0x61,0x73,
+	0x6d,0x2f,0x63,0x6f,0x6d,0x70,0x61,0x74,
+	0x2e,0x68,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x6d,
+	0x6d,0x61,0x70,0x28,0x29,0x20,0x6f,0x66,
+	0x20,0x63,0x6f,0x6d,0x70,0x61,0x74,0x20,
+	0x73,0x79,0x73,0x63,0x61,0x6c,0x6c,0x20,
+	0x73,0x74,0x61,0x63,0x6b,0x20,0x66,0x61,
+	0x69,0x6c,0x65,0x64,0x20,0x77,0x69,0x74,
+	0x68,0x20,0x25,0x64,0x0a,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x46,
+	0x61,0x69,0x6c,0x65,0x64,0x20,0x74,0x6f,
+	0x20,0x61,0x6c,0x6c,0x6f,0x63,0x61,0x74,
+	0x65,0x20,0x33,0x32,0x2d,0x62,0x69,0x74,
+	0x20,0x73,0x74,0x61,0x63,0x6b,0x20,0x66,
+	0x6f,0x72,0x20,0x73,0x69,0x67,0x61,0x63,
+	0x74,0x69,0x6f,0x6e,0x0a,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x6d,
+	0x75,0x6e,0x6d,0x61,0x70,0x28,0x29,0x20,
+	0x6f,0x66,0x20,0x63,0x6f,0x6d,0x70,0x61,
+	0x74,0x20,0x61,0x64,0x64,0x72,0x20,0x25,
+	0x70,0x20,0x66,0x61,0x69,0x6c,0x65,0x64,
+	0x20,0x77,0x69,0x74,0x68,0x20,0x25,0x6c,
+	0x64,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x46,
+	0x61,0x69,0x6c,0x65,0x64,0x20,0x74,0x6f,
+	0x20,0x72,0x65,0x73,0x74,0x6f,0x72,0x65,
+	0x20,0x53,0x49,0x47,0x43,0x48,0x4c,0x44,
+	0x3a,0x20,0x25,0x6c,0x64,0x0a,0x00,0x00,
+	0x70,0x69,0x65,0x3a,0x20,0x54,0x75,0x72,
+	0x6e,0x69,0x6e,0x67,0x20,0x72,0x65,0x70,
+	0x61,0x69,0x72,0x20,0x6f,0x66,0x66,0x20,
+	0x66,0x6f,0x72,0x20,0x25,0x64,0x20,0x28,
+	0x72,0x65,0x75,0x73,0x65,0x20,0x25,0x64,
+	0x29,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x46,
+	0x61,0x69,0x6c,0x65,0x64,0x20,0x74,0x6f,
+	0x20,0x74,0x75,0x72,0x6e,0x20,0x6f,0x66,
+	0x66,0x20,0x72,0x65,0x70,0x61,0x69,0x72,
+	0x20,0x6d,0x6f,0x64,0x65,0x20,0x6f,0x6e,
+	0x20,0x73,0x6f,0x63,0x6b,0x65,0x74,0x0a,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x46,
+	0x61,0x69,0x6c,0x65,0x64,0x20,0x74,0x6f,
+	0x20,0x72,0x65,0x73,0x74,0x6f,0x72,0x65,
+	0x20,0x6f,0x66,0x20,0x53,0x4f,0x5f,0x52,
+	0x45,0x55,0x53,0x45,0x41,0x44,0x44,0x52,
+	0x20,0x6f,0x6e,0x20,0x73,0x6f,0x63,0x6b,
+	0x65,0x74,0x20,0x28,0x25,0x64,0x29,0x0a,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x55,
+	0x6e,0x61,0x62,0x6c,0x65,0x20,0x74,0x6f,
+	0x20,0x73,0x65,0x74,0x20,0x50,0x52,0x5f,
+	0x53,0x45,0x54,0x5f,0x43,0x48,0x49,0x4c,
+	0x44,0x5f,0x53,0x55,0x42,0x52,0x45,0x41,
+	0x50,0x45,0x52,0x28,0x25,0x64,0x29,0x3a,
+	0x20,0x25,0x64,0x0a,0x00,0x00,0x00,0x00,
+	0x4d,0x45,0x54,0x52,0x49,0x43,0x20,0x5b,
+	0x70,0x69,0x64,0x3a,0x25,0x64,0x5d,0x20,
+	0x69,0x6e,0x20,0x72,0x65,0x73,0x74,0x6f,
+	0x72,0x65,0x72,0x20,0x74,0x6f,0x20,0x61,
+	0x66,0x74,0x65,0x72,0x20,0x72,0x65,0x73,
+	0x74,0x6f,0x72,0x65,0x20,0x74,0x68,0x72,
+	0x65,0x61,0x64,0x73,0x20,0x73,0x70,0x65,
+	0x6e,0x74,0x20,0x25,0x6c,0x64,0x20,0x75,
+	0x73,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x52,
+	0x65,0x73,0x74,0x6f,0x72,0x65,0x72,0x20,
+	0x66,0x61,0x69,0x6c,0x20,0x25,0x6c,0x64,
+	0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x52,
+	0x65,0x73,0x74,0x6f,0x72,0x65,0x72,0x20,
+	0x73,0x74,0x61,0x63,0x6b,0x20,0x73,0x6d,
+	0x61,0x73,0x68,0x20,0x64,0x65,0x74,0x65,
+	0x63,0x74,0x65,0x64,0x20,0x25,0x6c,0x64,
+	0x0a,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+	0x63,0x72,0x69,0x75,0x2f,0x70,0x69,0x65,
+	0x2f,0x75,0x74,0x69,0x6c,0x2e,0x63,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x43,
+	0x61,0x6e,0x27,0x74,0x20,0x6f,0x70,0x65,
+	0x6e,0x20,0x64,0x69,0x72,0x65,0x63,0x74,
+	0x6f,0x72,0x79,0x20,0x25,0x73,0x3a,0x20,
+	0x25,0x64,0x0a,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x43,
+	0x61,0x6e,0x27,0x74,0x20,0x64,0x65,0x74,
+	0x61,0x63,0x68,0x20,0x6d,0x6f,0x75,0x6e,
+	0x74,0x20,0x25,0x73,0x3a,0x20,0x25,0x64,
+	0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x43,
+	0x61,0x6e,0x27,0x74,0x20,0x72,0x65,0x6d,
+	0x6f,0x76,0x65,0x20,0x74,0x6d,0x70,0x20,
+	0x64,0x69,0x72,0x20,0x25,0x73,0x3a,0x20,
+	0x25,0x64,0x0a,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x43,
+	0x61,0x6e,0x27,0x74,0x20,0x73,0x79,0x73,
+	0x5f,0x67,0x65,0x74,0x74,0x69,0x6d,0x65,
+	0x6f,0x66,0x64,0x61,0x79,0x0a,0x00,0x76,
+	0x64,0x73,0x6f,0x3a,0x20,0x50,0x61,0x72,
+	0x73,0x69,0x6e,0x67,0x20,0x61,0x74,0x20,
+	0x25,0x6c,0x78,0x20,0x25,0x6c,0x78,0x0a,
+	0x00,0x63,0x72,0x69,0x75,0x2f,0x70,0x69,
+	0x65,0x2f,0x75,0x74,0x69,0x6c,0x2d,0x76,
+	0x64,0x73,0x6f,0x2e,0x63,0x00,0x76,0x64,
+	0x73,0x6f,0x3a,0x20,0x50,0x54,0x5f,0x4c,
+	0x4f,0x41,0x44,0x20,0x70,0x5f,0x76,0x61,
+	0x64,0x64,0x72,0x3a,0x20,0x25,0x6c,0x78,
+	0x0a,0x00,0x76,0x64,0x73,0x6f,0x3a,0x20,
+	0x44,0x54,0x5f,0x53,0x54,0x52,0x54,0x41,
+	0x42,0x3a,0x20,0x25,0x6c,0x78,0x0a,0x00,
+	0x76,0x64,0x73,0x6f,0x3a,0x20,0x44,0x54,
+	0x5f,0x53,0x59,0x4d,0x54,0x41,0x42,0x3a,
+	0x20,0x25,0x6c,0x78,0x0a,0x00,0x76,0x64,
+	0x73,0x6f,0x3a,0x20,0x44,0x54,0x5f,0x53,
+	0x54,0x52,0x53,0x5a,0x3a,0x20,0x25,0x6c,
+	0x78,0x0a,0x00,0x76,0x64,0x73,0x6f,0x3a,
+	0x20,0x44,0x54,0x5f,0x53,0x59,0x4d,0x45,
+	0x4e,0x54,0x3a,0x20,0x25,0x6c,0x78,0x0a,
+	0x00,0x76,0x64,0x73,0x6f,0x3a,0x20,0x44,
+	0x54,0x5f,0x48,0x41,0x53,0x48,0x3a,0x20,
+	0x25,0x6c,0x78,0x0a,0x00,0x5f,0x5f,0x76,
+	0x64,0x73,0x6f,0x5f,0x63,0x6c,0x6f,0x63,
+	0x6b,0x5f,0x67,0x65,0x74,0x74,0x69,0x6d,
+	0x65,0x00,0x5f,0x5f,0x76,0x64,0x73,0x6f,
+	0x5f,0x67,0x65,0x74,0x63,0x70,0x75,0x00,
+	0x5f,0x5f,0x76,0x64,0x73,0x6f,0x5f,0x67,
+	0x65,0x74,0x74,0x69,0x6d,0x65,0x6f,0x66,
+	0x64,0x61,0x79,0x00,0x5f,0x5f,0x76,0x64,
+	0x73,0x6f,0x5f,0x74,0x69,0x6d,0x65,0x00,
+	0x5f,0x5f,0x6b,0x65,0x72,0x6e,0x65,0x6c,
+	0x5f,0x73,0x69,0x67,0x72,0x65,0x74,0x75,
+	0x72,0x6e,0x00,0x5f,0x5f,0x6b,0x65,0x72,
+	0x6e,0x65,0x6c,0x5f,0x72,0x74,0x5f,0x73,
+	0x69,0x67,0x72,0x65,0x74,0x75,0x72,0x6e,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x76,
+	0x64,0x73,0x6f,0x3a,0x20,0x45,0x4c,0x46,
+	0x20,0x68,0x65,0x61,0x64,0x65,0x72,0x20,
+	0x6d,0x61,0x67,0x69,0x63,0x20,0x6d,0x69,
+	0x73,0x6d,0x61,0x74,0x63,0x68,0x0a,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x76,
+	0x64,0x73,0x6f,0x3a,0x20,0x53,0x65,0x63,
+	0x6f,0x6e,0x64,0x20,0x50,0x54,0x5f,0x44,
+	0x59,0x4e,0x41,0x4d,0x49,0x43,0x20,0x68,
+	0x65,0x61,0x64,0x65,0x72,0x0a,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x76,
+	0x64,0x73,0x6f,0x3a,0x20,0x53,0x65,0x63,
+	0x6f,0x6e,0x64,0x20,0x50,0x54,0x5f,0x4c,
+	0x4f,0x41,0x44,0x20,0x68,0x65,0x61,0x64,
+	0x65,0x72,0x0a,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x76,
+	0x64,0x73,0x6f,0x3a,0x20,0x43,0x6f,0x72,
+	0x72,0x75,0x70,0x74,0x65,0x64,0x20,0x45,
+	0x6c,0x66,0x20,0x70,0x68,0x64,0x72,0x0a,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x76,
+	0x64,0x73,0x6f,0x3a,0x20,0x4f,0x6e,0x65,
+	0x20,0x6f,0x66,0x20,0x6f,0x62,0x6c,0x69,
+	0x67,0x61,0x74,0x65,0x64,0x20,0x70,0x72,
+	0x6f,0x67,0x72,0x61,0x6d,0x20,0x68,0x65,
+	0x61,0x64,0x65,0x72,0x73,0x20,0x69,0x73,
+	0x20,0x6d,0x69,0x73,0x73,0x65,0x64,0x0a,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x76,
+	0x64,0x73,0x6f,0x3a,0x20,0x4e,0x6f,0x74,
+	0x20,0x61,0x6c,0x6c,0x20,0x64,0x79,0x6e,
+	0x61,0x6d,0x69,0x63,0x20,0x65,0x6e,0x74,
+	0x72,0x69,0x65,0x73,0x20,0x61,0x72,0x65,
+	0x20,0x70,0x72,0x65,0x73,0x65,0x6e,0x74,
+	0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x76,
+	0x64,0x73,0x6f,0x3a,0x20,0x43,0x6f,0x72,
+	0x72,0x75,0x70,0x74,0x65,0x64,0x20,0x45,
+	0x6c,0x66,0x20,0x64,0x79,0x6e,0x61,0x6d,
+	0x69,0x63,0x20,0x73,0x65,0x63,0x74,0x69,
+	0x6f,0x6e,0x0a,0x00,0x00,0x00,0x00,0x00,
+	0x76,0x64,0x73,0x6f,0x3a,0x20,0x6e,0x62,
+	0x75,0x63,0x6b,0x65,0x74,0x20,0x25,0x6c,
+	0x78,0x20,0x6e,0x63,0x68,0x61,0x69,0x6e,
+	0x20,0x25,0x6c,0x78,0x20,0x62,0x75,0x63,
+	0x6b,0x65,0x74,0x20,0x25,0x6c,0x78,0x20,
+	0x63,0x68,0x61,0x69,0x6e,0x20,0x25,0x6c,
+	0x78,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x76,
+	0x64,0x73,0x6f,0x3a,0x20,0x43,0x6f,0x72,
+	0x72,0x75,0x70,0x74,0x65,0x64,0x20,0x45,
+	0x6c,0x66,0x20,0x73,0x79,0x6d,0x62,0x6f,
+	0x6c,0x73,0x2f,0x68,0x61,0x73,0x68,0x0a,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x60,0xab,0xff,0xff,0xf0,0xa6,0xff,0xff,
+	0x30,0xab,0xff,0xff,0x20,0xa7,0xff,0xff,
+	0x20,0xa7,0xff,0xff,0x20,0xa7,0xff,0xff,
+	0x00,0xab,0xff,0xff,0x90,0xa7,0xff,0xff,
+	0x7f,0x45,0x4c,0x46,0x02,0x01,0x01,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x76,0x64,0x73,0x6f,0x3a,0x20,0x50,0x61,
+	0x72,0x73,0x69,0x6e,0x67,0x20,0x61,0x74,
+	0x20,0x25,0x6c,0x78,0x20,0x25,0x6c,0x78,
+	0x0a,0x00,0x63,0x72,0x69,0x75,0x2f,0x70,
+	0x69,0x65,0x2f,0x75,0x74,0x69,0x6c,0x2d,
+	0x76,0x64,0x73,0x6f,0x2d,0x65,0x6c,0x66,
+	0x33,0x32,0x2e,0x63,0x00,0x76,0x64,0x73,
+	0x6f,0x3a,0x20,0x50,0x54,0x5f,0x4c,0x4f,
+	0x41,0x44,0x20,0x70,0x5f,0x76,0x61,0x64,
+	0x64,0x72,0x3a,0x20,0x25,0x6c,0x78,0x0a,
+	0x00,0x76,0x64,0x73,0x6f,0x3a,0x20,0x44,
+	0x54,0x5f,0x53,0x54,0x52,0x54,0x41,0x42,
+	0x3a,0x20,0x25,0x6c,0x78,0x0a,0x00,0x76,
+	0x64,0x73,0x6f,0x3a,0x20,0x44,0x54,0x5f,
+	0x53,0x59,0x4d,0x54,0x41,0x42,0x3a,0x20,
+	0x25,0x6c,0x78,0x0a,0x00,0x76,0x64,0x73,
+	0x6f,0x3a,0x20,0x44,0x54,0x5f,0x53,0x54,
+	0x52,0x53,0x5a,0x3a,0x20,0x25,0x6c,0x78,
+	0x0a,0x00,0x76,0x64,0x73,0x6f,0x3a,0x20,
+	0x44,0x54,0x5f,0x53,0x59,0x4d,0x45,0x4e,
+	0x54,0x3a,0x20,0x25,0x6c,0x78,0x0a,0x00,
+	0x76,0x64,0x73,0x6f,0x3a,0x20,0x44,0x54,
+	0x5f,0x48,0x41,0x53,0x48,0x3a,0x20,0x25,
+	0x6c,0x78,0x0a,0x00,0x5f,0x5f,0x76,0x64,
+	0x73,0x6f,0x5f,0x63,0x6c,0x6f,0x63,0x6b,
+	0x5f,0x67,0x65,0x74,0x74,0x69,0x6d,0x65,
+	0x00,0x5f,0x5f,0x76,0x64,0x73,0x6f,0x5f,
+	0x67,0x65,0x74,0x63,0x70,0x75,0x00,0x5f,
+	0x5f,0x76,0x64,0x73,0x6f,0x5f,0x67,0x65,
+	0x74,0x74,0x69,0x6d,0x65,0x6f,0x66,0x64,
+	0x61,0x79,0x00,0x5f,0x5f,0x76,0x64,0x73,
+	0x6f,0x5f,0x74,0x69,0x6d,0x65,0x00,0x5f,
+	0x5f,0x6b,0x65,0x72,0x6e,0x65,0x6c,0x5f,
+	0x73,0x69,0x67,0x72,0x65,0x74,0x75,0x72,
+	0x6e,0x00,0x5f,0x5f,0x6b,0x65,0x72,0x6e,
+	0x65,0x6c,0x5f,0x72,0x74,0x5f,0x73,0x69,
+	0x67,0x72,0x65,0x74,0x75,0x72,0x6e,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x76,
+	0x64,0x73,0x6f,0x3a,0x20,0x45,0x4c,0x46,
+	0x20,0x68,0x65,0x61,0x64,0x65,0x72,0x20,
+	0x6d,0x61,0x67,0x69,0x63,0x20,0x6d,0x69,
+	0x73,0x6d,0x61,0x74,0x63,0x68,0x0a,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x76,
+	0x64,0x73,0x6f,0x3a,0x20,0x53,0x65,0x63,
+	0x6f,0x6e,0x64,0x20,0x50,0x54,0x5f,0x44,
+	0x59,0x4e,0x41,0x4d,0x49,0x43,0x20,0x68,
+	0x65,0x61,0x64,0x65,0x72,0x0a,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x76,
+	0x64,0x73,0x6f,0x3a,0x20,0x53,0x65,0x63,
+	0x6f,0x6e,0x64,0x20,0x50,0x54,0x5f,0x4c,
+	0x4f,0x41,0x44,0x20,0x68,0x65,0x61,0x64,
+	0x65,0x72,0x0a,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x76,
+	0x64,0x73,0x6f,0x3a,0x20,0x43,0x6f,0x72,
+	0x72,0x75,0x70,0x74,0x65,0x64,0x20,0x45,
+	0x6c,0x66,0x20,0x70,0x68,0x64,0x72,0x0a,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x76,
+	0x64,0x73,0x6f,0x3a,0x20,0x4f,0x6e,0x65,
+	0x20,0x6f,0x66,0x20,0x6f,0x62,0x6c,0x69,
+	0x67,0x61,0x74,0x65,0x64,0x20,0x70,0x72,
+	0x6f,0x67,0x72,0x61,0x6d,0x20,0x68,0x65,
+	0x61,0x64,0x65,0x72,0x73,0x20,0x69,0x73,
+	0x20,0x6d,0x69,0x73,0x73,0x65,0x64,0x0a,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x76,
+	0x64,0x73,0x6f,0x3a,0x20,0x4e,0x6f,0x74,
+	0x20,0x61,0x6c,0x6c,0x20,0x64,0x79,0x6e,
+	0x61,0x6d,0x69,0x63,0x20,0x65,0x6e,0x74,
+	0x72,0x69,0x65,0x73,0x20,0x61,0x72,0x65,
+	0x20,0x70,0x72,0x65,0x73,0x65,0x6e,0x74,
+	0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x76,
+	0x64,0x73,0x6f,0x3a,0x20,0x43,0x6f,0x72,
+	0x72,0x75,0x70,0x74,0x65,0x64,0x20,0x45,
+	0x6c,0x66,0x20,0x64,0x79,0x6e,0x61,0x6d,
+	0x69,0x63,0x20,0x73,0x65,0x63,0x74,0x69,
+	0x6f,0x6e,0x0a,0x00,0x00,0x00,0x00,0x00,
+	0x76,0x64,0x73,0x6f,0x3a,0x20,0x6e,0x62,
+	0x75,0x63,0x6b,0x65,0x74,0x20,0x25,0x6c,
+	0x78,0x20,0x6e,0x63,0x68,0x61,0x69,0x6e,
+	0x20,0x25,0x6c,0x78,0x20,0x62,0x75,0x63,
+	0x6b,0x65,0x74,0x20,0x25,0x6c,0x78,0x20,
+	0x63,0x68,0x61,0x69,0x6e,0x20,0x25,0x6c,
+	0x78,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x45,0x72,0x72,0x6f,0x72,0x20,0x28,0x25,
+	0x73,0x3a,0x25,0x64,0x29,0x3a,0x20,0x76,
+	0x64,0x73,0x6f,0x3a,0x20,0x43,0x6f,0x72,
+	0x72,0x75,0x70,0x74,0x65,0x64,0x20,0x45,
+	0x6c,0x66,0x20,0x73,0x79,0x6d,0x62,0x6f,
+	0x6c,0x73,0x2f,0x68,0x61,0x73,0x68,0x0a,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0xf8,0xaf,0xff,0xff,0x78,0xab,0xff,0xff,
+	0xc8,0xaf,0xff,0xff,0xa0,0xab,0xff,0xff,
+	0xa0,0xab,0xff,0xff,0xa0,0xab,0xff,0xff,
+	0x98,0xaf,0xff,0xff,0x08,0xac,0xff,0xff,
+	0x7f,0x45,0x4c,0x46,0x01,0x01,0x01,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x30,0x31,0x32,0x33,0x34,0x35,0x36,0x37,
+	0x38,0x39,0x61,0x62,0x63,0x64,0x65,0x66,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x0a,0x45,0x72,0x72,0x6f,0x72,0x3a,0x20,
+	0x55,0x6e,0x6b,0x6e,0x6f,0x77,0x6e,0x20,
+	0x70,0x72,0x69,0x6e,0x74,0x66,0x20,0x66,
+	0x6f,0x72,0x6d,0x61,0x74,0x20,0x25,0x00,
+	0xd8,0xb8,0xff,0xff,0xd8,0xb5,0xff,0xff,
+	0xd8,0xb5,0xff,0xff,0xd8,0xb5,0xff,0xff,
+	0xd8,0xb5,0xff,0xff,0xd8,0xb5,0xff,0xff,
+	0xd8,0xb5,0xff,0xff,0xd8,0xb5,0xff,0xff,
+	0xd8,0xb5,0xff,0xff,0xd8,0xb5,0xff,0xff,
+	0xd8,0xb5,0xff,0xff,0xd8,0xb5,0xff,0xff,
+	0x10,0xb6,0xff,0xff,0xd8,0xb5,0xff,0xff,
+	0xd8,0xb5,0xff,0xff,0x58,0xb6,0xff,0xff,
+	0xd8,0xb5,0xff,0xff,0x60,0xb8,0xff,0xff,
+	0xd8,0xb5,0xff,0xff,0xd8,0xb5,0xff,0xff,
+	0x48,0xb7,0xff,0xff,0xcc,0xb8,0xff,0xff,
+	0x84,0xb5,0xff,0xff,0x84,0xb5,0xff,0xff,
+	0x84,0xb5,0xff,0xff,0x84,0xb5,0xff,0xff,
+	0x84,0xb5,0xff,0xff,0x84,0xb5,0xff,0xff,
+	0x84,0xb5,0xff,0xff,0x84,0xb5,0xff,0xff,
+	0x84,0xb5,0xff,0xff,0x84,0xb5,0xff,0xff,
+	0x84,0xb5,0xff,0xff,0xbc,0xb5,0xff,0xff,
+	0x84,0xb5,0xff,0xff,0x84,0xb5,0xff,0xff,
+	0x04,0xb6,0xff,0xff,0x84,0xb5,0xff,0xff,
+	0xd4,0xb9,0xff,0xff,0x84,0xb5,0xff,0xff,
+	0x84,0xb5,0xff,0xff,0xbc,0xb5,0xff,0xff,
+	0x78,0xb8,0xff,0xff,0x30,0xb5,0xff,0xff,
+	0x30,0xb5,0xff,0xff,0x30,0xb5,0xff,0xff,
+	0x30,0xb5,0xff,0xff,0x30,0xb5,0xff,0xff,
+	0x30,0xb5,0xff,0xff,0x30,0xb5,0xff,0xff,
+	0x30,0xb5,0xff,0xff,0x30,0xb5,0xff,0xff,
+	0x30,0xb5,0xff,0xff,0x30,0xb5,0xff,0xff,
+	0x68,0xb5,0xff,0xff,0x30,0xb5,0xff,0xff,
+	0x30,0xb5,0xff,0xff,0xb0,0xb5,0xff,0xff,
+	0x30,0xb5,0xff,0xff,0x80,0xb9,0xff,0xff,
+	0x30,0xb5,0xff,0xff,0x30,0xb5,0xff,0xff,
+	0x68,0xb5,0xff,0xff,0x30,0x78,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x30,0x31,0x32,0x33,0x34,0x35,0x36,0x37,
+	0x38,0x39,0x61,0x62,0x63,0x64,0x65,0x66,
+	0x67,0x68,0x69,0x6a,0x6b,0x6c,0x6d,0x6e,
+	0x6f,0x70,0x71,0x72,0x73,0x74,0x75,0x76,
+	0x77,0x78,0x79,0x7a,0x00,0x00,0x00,0x00,
+	0x53,0x65,0x6e,0x74,0x20,0x6f,0x6e,0x6c,
+	0x79,0x20,0x25,0x64,0x20,0x62,0x79,0x74,
+	0x65,0x73,0x20,0x77,0x68,0x69,0x6c,0x65,
+	0x20,0x25,0x7a,0x75,0x20,0x65,0x78,0x70,
+	0x65,0x63,0x74,0x65,0x64,0x0a,0x00,0x00,
+	0x54,0x72,0x69,0x6d,0x6d,0x65,0x64,0x20,
+	0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x20,
+	0x72,0x65,0x63,0x65,0x69,0x76,0x65,0x64,
+	0x20,0x28,0x25,0x64,0x2f,0x25,0x64,0x29,
+	0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x43,0x6c,0x6f,0x73,0x65,0x20,0x74,0x68,
+	0x65,0x20,0x63,0x6f,0x6e,0x74,0x72,0x6f,
+	0x6c,0x20,0x73,0x6f,0x63,0x6b,0x65,0x74,
+	0x20,0x66,0x6f,0x72,0x20,0x77,0x72,0x69,
+	0x74,0x69,0x6e,0x67,0x0a,0x00,0x00,0x00,
+	0x43,0x61,0x6e,0x27,0x74,0x20,0x63,0x6f,
+	0x6e,0x6e,0x65,0x63,0x74,0x20,0x74,0x68,
+	0x65,0x20,0x63,0x6f,0x6e,0x74,0x72,0x6f,
+	0x6c,0x20,0x73,0x6f,0x63,0x6b,0x65,0x74,
+	0x0a,0x00,0x5f,0x5f,0x73,0x65,0x6e,0x74,
+	0x20,0x61,0x63,0x6b,0x20,0x6d,0x73,0x67,
+	0x3a,0x20,0x25,0x64,0x20,0x25,0x64,0x20,
+	0x25,0x64,0x0a,0x00,0x25,0x6c,0x64,0x3a,
+	0x20,0x6e,0x65,0x77,0x5f,0x73,0x70,0x3d,
+	0x25,0x6c,0x78,0x20,0x69,0x70,0x20,0x25,
+	0x6c,0x78,0x0a,0x00,0x63,0x6f,0x6d,0x70,
+	0x65,0x6c,0x2f,0x70,0x6c,0x75,0x67,0x69,
+	0x6e,0x73,0x2f,0x73,0x74,0x64,0x2f,0x69,
+	0x6e,0x66,0x65,0x63,0x74,0x2e,0x63,0x00,
+	0x42,0x55,0x47,0x20,0x61,0x74,0x20,0x25,
+	0x73,0x3a,0x25,0x64,0x0a,0x00,0x52,0x75,
+	0x6e,0x6e,0x69,0x6e,0x67,0x20,0x64,0x61,
+	0x65,0x6d,0x6f,0x6e,0x20,0x74,0x68,0x72,
+	0x65,0x61,0x64,0x20,0x6c,0x65,0x61,0x64,
+	0x65,0x72,0x0a,0x00,0x44,0x61,0x65,0x6d,
+	0x6f,0x6e,0x20,0x77,0x61,0x69,0x74,0x73,
+	0x20,0x66,0x6f,0x72,0x20,0x63,0x6f,0x6d,
+	0x6d,0x61,0x6e,0x64,0x0a,0x00,0x5f,0x5f,
+	0x66,0x65,0x74,0x63,0x68,0x65,0x64,0x20,
+	0x6d,0x73,0x67,0x3a,0x20,0x25,0x64,0x20,
+	0x25,0x64,0x20,0x25,0x64,0x0a,0x00,0x43,
+	0x6f,0x6d,0x6d,0x61,0x6e,0x64,0x20,0x72,
+	0x65,0x6a,0x65,0x63,0x74,0x65,0x64,0x0a,
+	0x00,0x43,0x61,0x6e,0x27,0x74,0x20,0x63,
+	0x72,0x65,0x61,0x74,0x65,0x20,0x73,0x6f,
+	0x63,0x6b,0x65,0x74,0x3a,0x20,0x25,0x64,
+	0x0a,0x00,0x50,0x61,0x72,0x61,0x73,0x69,
+	0x74,0x65,0x20,0x63,0x6d,0x64,0x20,0x25,
+	0x64,0x2f,0x25,0x78,0x20,0x70,0x72,0x6f,
+	0x63,0x65,0x73,0x73,0x0a,0x00,0x00,0x00,
+	0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,};
+
+static void __maybe_unused restorer_setup_c_header_desc(struct parasite_blob_desc *pbd, bool native)
+{
+	pbd->parasite_type	= COMPEL_BLOB_CHEADER;
+	pbd->hdr.mem		= restorer_blob;
+	pbd->hdr.bsize		= sizeof(restorer_blob);
+	if (native)
+		pbd->hdr.parasite_ip_off	= restorer_sym__export_parasite_head_start;
+#ifdef CONFIG_COMPAT
+	else
+		pbd->hdr.parasite_ip_off	= restorer_sym__export_parasite_head_start_compat;
+#endif /* CONFIG_COMPAT */
+	pbd->hdr.cmd_off	= restorer_sym__export_parasite_service_cmd;
+	pbd->hdr.args_ptr_off	= restorer_sym__export_parasite_service_args_ptr;
+	pbd->hdr.got_off	= round_up(pbd->hdr.bsize, sizeof(long));
+	pbd->hdr.args_off	= pbd->hdr.got_off + 0*sizeof(long);
+	pbd->hdr.data_off	= 0x8000;
+	pbd->hdr.relocs		= restorer_relocs;
+	pbd->hdr.nr_relocs	= sizeof(restorer_relocs) / sizeof(restorer_relocs[0]);
+}
+
+static void __maybe_unused restorer_setup_c_header(struct parasite_ctl *ctl)
+{
+	restorer_setup_c_header_desc(compel_parasite_blob_desc(ctl), compel_mode_native(ctl));
+}
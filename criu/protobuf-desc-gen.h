@@ -0,0 +1,66 @@
+CR_PB_DESC(INVENTORY, Inventory, inventory);
+CR_PB_DESC(STATS, Stats, stats);
+CR_PB_DESC(FDINFO, Fdinfo, fdinfo);
+CR_PB_DESC(CORE, Core, core);
+CR_PB_DESC(MM, Mm, mm);
+CR_PB_DESC(VMA, Vma, vma);
+CR_PB_DESC(ITIMER, Itimer, itimer);
+CR_PB_DESC(POSIX_TIMER, PosixTimer, posix_timer);
+CR_PB_DESC(CREDS, Creds, creds);
+CR_PB_DESC(FS, Fs, fs);
+CR_PB_DESC(UTSNS, Utsns, utsns);
+CR_PB_DESC(IPC_VAR, IpcVar, ipc_var);
+CR_PB_DESC(IPC_SHM, IpcShm, ipc_shm);
+CR_PB_DESC(IPC_SEM, IpcSem, ipc_sem);
+CR_PB_DESC(MNT, Mnt, mnt);
+CR_PB_DESC(PSTREE, Pstree, pstree);
+CR_PB_DESC(GHOST_FILE, GhostFile, ghost_file);
+CR_PB_DESC(TCP_STREAM, TcpStream, tcp_stream);
+CR_PB_DESC(REG_FILE, RegFile, reg_file);
+CR_PB_DESC(EXT_FILE, ExtFile, ext_file);
+CR_PB_DESC(NS_FILE, NsFile, ns_file);
+CR_PB_DESC(INET_SK, InetSk, inet_sk);
+CR_PB_DESC(UNIX_SK, UnixSk, unix_sk);
+CR_PB_DESC(PACKET_SOCK, PacketSock, packet_sock);
+CR_PB_DESC(NETLINK_SK, NetlinkSk, netlink_sk);
+CR_PB_DESC(PIPE, Pipe, pipe);
+CR_PB_DESC(FIFO, Fifo, fifo);
+CR_PB_DESC(PIPE_DATA, PipeData, pipe_data);
+CR_PB_DESC(EVENTFD_FILE, EventfdFile, eventfd_file);
+CR_PB_DESC(EVENTPOLL_FILE, EventpollFile, eventpoll_file);
+CR_PB_DESC(EVENTPOLL_TFD, EventpollTfd, eventpoll_tfd);
+CR_PB_DESC(SIGNALFD, Signalfd, signalfd);
+CR_PB_DESC(INOTIFY_FILE, InotifyFile, inotify_file);
+CR_PB_DESC(INOTIFY_WD, InotifyWd, inotify_wd);
+CR_PB_DESC(FANOTIFY_FILE, FanotifyFile, fanotify_file);
+CR_PB_DESC(FANOTIFY_MARK, FanotifyMark, fanotify_mark);
+CR_PB_DESC(TTY_FILE, TtyFile, tty_file);
+CR_PB_DESC(TTY_INFO, TtyInfo, tty_info);
+CR_PB_DESC(FILE_LOCK, FileLock, file_lock);
+CR_PB_DESC(RLIMIT, Rlimit, rlimit);
+CR_PB_DESC(PAGEMAP, Pagemap, pagemap);
+CR_PB_DESC(SIGINFO, Siginfo, siginfo);
+CR_PB_DESC(TUNFILE, Tunfile, tunfile);
+CR_PB_DESC(IRMAP_CACHE, IrmapCache, irmap_cache);
+CR_PB_DESC(CGROUP, Cgroup, cgroup);
+CR_PB_DESC(SECCOMP, Seccomp, seccomp);
+CR_PB_DESC(TIMERFD, Timerfd, timerfd);
+CR_PB_DESC(CPUINFO, Cpuinfo, cpuinfo);
+CR_PB_DESC(USERNS, Userns, userns);
+CR_PB_DESC(NETNS, Netns, netns);
+CR_PB_DESC(BINFMT_MISC, BinfmtMisc, binfmt_misc);
+CR_PB_DESC(TTY_DATA, TtyData, tty_data);
+CR_PB_DESC(AUTOFS, Autofs, autofs);
+CR_PB_DESC(GHOST_CHUNK, GhostChunk, ghost_chunk);
+CR_PB_DESC(FILE, File, file);
+CR_PB_DESC(MEMFD_FILE, MemfdFile, memfd_file);
+CR_PB_DESC(MEMFD_INODE, MemfdInode, memfd_inode);
+CR_PB_DESC(TIMENS, Timens, timens);
+CR_PB_DESC(IMG_STREAMER_REQUEST, ImgStreamerRequest, img_streamer_request);
+CR_PB_DESC(IMG_STREAMER_REPLY, ImgStreamerReply, img_streamer_reply);
+CR_PB_DESC(PIDNS, Pidns, pidns);
+CR_PB_DESC(BPFMAP_FILE, BpfmapFile, bpfmap_file);
+CR_PB_DESC(BPFMAP_DATA, BpfmapData, bpfmap_data);
+CR_PB_DESC(APPARMOR, Apparmor, apparmor);
+CR_PB_DESC(PAGES_BLOCK, PagesBlock, pages_block);
+CR_PB_DESC(FAULT_PROFILE, FaultProfile, fault_profile);
@@ -35,6 +35,79 @@ static char *__image_name(struct cr_img *img, char *image_path, size_t image_pat
 	return NULL;
 }
 
+/*
+ * Entries collected with COLLECT_ARENA live till the end of restore, so
+ * they are unpacked into chunks that are never freed, rather than with
+ * a malloc per field of every entry. So are the private objects of the
+ * collectors, unless they are in shared memory.
+ */
+#define PB_ARENA_CHUNK (64 << 10)
+
+static void *pb_arena_cur;
+static size_t pb_arena_left;
+
+static void *pb_arena_alloc(void *data, size_t size)
+{
+	void *ret;
+
+	size = round_up(size, sizeof(u64));
+	if (size > PB_ARENA_CHUNK / 4)
+		return xmalloc(size);
+
+	if (size > pb_arena_left) {
+		pb_arena_cur = xmalloc(PB_ARENA_CHUNK);
+		if (!pb_arena_cur) {
+			pb_arena_left = 0;
+			return NULL;
+		}
+		pb_arena_left = PB_ARENA_CHUNK;
+	}
+
+	ret = pb_arena_cur;
+	pb_arena_cur += size;
+	pb_arena_left -= size;
+	return ret;
+}
+
+static void pb_arena_free(void *data, void *ptr)
+{
+}
+
+static ProtobufCAllocator pb_arena = {
+	.alloc = pb_arena_alloc,
+	.free = pb_arena_free,
+};
+
+static void *arena_alloc(size_t size)
+{
+	return pb_arena_alloc(NULL, size);
+}
+
+static void arena_free(void *ptr)
+{
+}
+
+/*
+ * Sub-messages collected by collect_entry() are parts of the entry being
+ * collected by collect_image(), thus come from the same allocator.
+ */
+static ProtobufCAllocator *collect_pb_alloc;
+
+static void collect_obj_alloc(struct collect_image_info *cinfo, void *(**o_alloc)(size_t size),
+			      void (**o_free)(void *ptr))
+{
+	*o_alloc = malloc;
+	*o_free = free;
+
+	if (cinfo->flags & COLLECT_SHARED) {
+		*o_alloc = shmalloc;
+		*o_free = shfree_last;
+	} else if (cinfo->flags & COLLECT_ARENA) {
+		*o_alloc = arena_alloc;
+		*o_free = arena_free;
+	}
+}
+
 /*
  * Reads PB record (header + packed object) from file @fd and unpack
  * it with @unpack procedure to the pointer @pobj
@@ -46,11 +119,12 @@ static char *__image_name(struct cr_img *img, char *image_path, size_t image_pat
  * Don't forget to free memory granted to unpacked object in calling code if needed
  */
 
-int do_pb_read_one(struct cr_img *img, void **pobj, int type, bool eof)
+static int __pb_read_one(struct cr_img *img, void **pobj, int type, bool eof, ProtobufCAllocator *alloc)
 {
 	char img_name_buf[PATH_MAX];
 	u8 local[PB_PKOBJ_LOCAL_SIZE];
 	void *buf = (void *)&local;
+	void *data;
 	u32 size;
 	int ret;
 
@@ -78,6 +152,11 @@ int do_pb_read_one(struct cr_img *img, void **pobj, int type, bool eof)
 		return -1;
 	}
 
+	/* Unpack right from the bfd buffer or the packed images mapping */
+	data = bpeek(&img->_x, size);
+	if (data)
+		goto unpack;
+
 	if (size > sizeof(local)) {
 		ret = -1;
 		buf = xmalloc(size);
@@ -94,8 +173,10 @@ int do_pb_read_one(struct cr_img *img, void **pobj, int type, bool eof)
 		ret = -1;
 		goto err;
 	}
+	data = buf;
 
-	*pobj = cr_pb_descs[type].unpack(NULL, size, buf);
+unpack:
+	*pobj = cr_pb_descs[type].unpack(alloc, size, data);
 	if (!*pobj) {
 		ret = -1;
 		pr_err("Failed unpacking object %p from %s\n", pobj, image_name(img, img_name_buf));
@@ -110,6 +191,11 @@ err:
 	return ret;
 }
 
+int do_pb_read_one(struct cr_img *img, void **pobj, int type, bool eof)
+{
+	return __pb_read_one(img, pobj, type, eof, NULL);
+}
+
 /*
  * Writes PB record (header + packed object pointed by @obj)
  * to file @fd, using @getpksize to get packed size and @pack
@@ -168,13 +254,10 @@ err:
 int collect_entry(ProtobufCMessage *msg, struct collect_image_info *cinfo)
 {
 	void *obj;
-	void *(*o_alloc)(size_t size) = malloc;
-	void (*o_free)(void *ptr) = free;
+	void *(*o_alloc)(size_t size);
+	void (*o_free)(void *ptr);
 
-	if (cinfo->flags & COLLECT_SHARED) {
-		o_alloc = shmalloc;
-		o_free = shfree_last;
-	}
+	collect_obj_alloc(cinfo, &o_alloc, &o_free);
 
 	if (cinfo->priv_size) {
 		obj = o_alloc(cinfo->priv_size);
@@ -186,12 +269,12 @@ int collect_entry(ProtobufCMessage *msg, struct collect_image_info *cinfo)
 	cinfo->flags |= COLLECT_HAPPENED;
 	if (cinfo->collect(obj, msg, NULL) < 0) {
 		o_free(obj);
-		cr_pb_descs[cinfo->pb_type].free(msg, NULL);
+		cr_pb_descs[cinfo->pb_type].free(msg, collect_pb_alloc);
 		return -1;
 	}
 
 	if (!cinfo->priv_size && !(cinfo->flags & COLLECT_NOFREE))
-		cr_pb_descs[cinfo->pb_type].free(msg, NULL);
+		cr_pb_descs[cinfo->pb_type].free(msg, collect_pb_alloc);
 
 	return 0;
 }
@@ -200,8 +283,9 @@ int collect_image(struct collect_image_info *cinfo)
 {
 	int ret;
 	struct cr_img *img;
-	void *(*o_alloc)(size_t size) = malloc;
-	void (*o_free)(void *ptr) = free;
+	void *(*o_alloc)(size_t size);
+	void (*o_free)(void *ptr);
+	ProtobufCAllocator *pb_alloc = NULL, *outer_pb_alloc;
 
 	pr_info("Collecting %d/%d (flags %x)\n", cinfo->fd_type, cinfo->pb_type, cinfo->flags);
 
@@ -209,10 +293,9 @@ int collect_image(struct collect_image_info *cinfo)
 	if (!img)
 		return -1;
 
-	if (cinfo->flags & COLLECT_SHARED) {
-		o_alloc = shmalloc;
-		o_free = shfree_last;
-	}
+	collect_obj_alloc(cinfo, &o_alloc, &o_free);
+	if (cinfo->flags & COLLECT_ARENA)
+		pb_alloc = &pb_arena;
 
 	while (1) {
 		void *obj;
@@ -226,22 +309,25 @@ int collect_image(struct collect_image_info *cinfo)
 		} else
 			obj = NULL;
 
-		ret = pb_read_one_eof(img, &msg, cinfo->pb_type);
+		ret = __pb_read_one(img, (void **)&msg, cinfo->pb_type, true, pb_alloc);
 		if (ret <= 0) {
 			o_free(obj);
 			break;
 		}
 
 		cinfo->flags |= COLLECT_HAPPENED;
+		outer_pb_alloc = collect_pb_alloc;
+		collect_pb_alloc = pb_alloc;
 		ret = cinfo->collect(obj, msg, img);
+		collect_pb_alloc = outer_pb_alloc;
 		if (ret < 0) {
 			o_free(obj);
-			cr_pb_descs[cinfo->pb_type].free(msg, NULL);
+			cr_pb_descs[cinfo->pb_type].free(msg, pb_alloc);
 			break;
 		}
 
 		if (!cinfo->priv_size && !(cinfo->flags & COLLECT_NOFREE))
-			cr_pb_descs[cinfo->pb_type].free(msg, NULL);
+			cr_pb_descs[cinfo->pb_type].free(msg, pb_alloc);
 	}
 
 	close_image(img);
@@ -797,7 +797,8 @@ static int do_dump_one_shmem(int fd, void *addr, struct shmem_info *si)
 	ret = dump_pages(pp, &xfer);
 
 err_xfer:
-	xfer.close(&xfer);
+	if (xfer.close(&xfer))
+		ret = -1;
 err_pp:
 	destroy_page_pipe(pp);
 err:
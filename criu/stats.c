@@ -19,6 +19,7 @@ struct timing {
 
 struct dump_stats {
 	struct timing timings[DUMP_TIME_NR_STATS];
+	/* Pages writer thread updates them too (--overlap-dump) */
 	unsigned long counts[DUMP_CNT_NR_STATS];
 };
 
@@ -43,7 +44,7 @@ void cnt_add(int c, unsigned long val)
 {
 	if (dstats != NULL) {
 		BUG_ON(c >= DUMP_CNT_NR_STATS);
-		dstats->counts[c] += val;
+		__atomic_add_fetch(&dstats->counts[c], val, __ATOMIC_RELAXED);
 	} else if (rstats != NULL) {
 		BUG_ON(c >= RESTORE_CNT_NR_STATS);
 		atomic_add(val, &rstats->counts[c]);
@@ -55,7 +56,7 @@ void cnt_sub(int c, unsigned long val)
 {
 	if (dstats != NULL) {
 		BUG_ON(c >= DUMP_CNT_NR_STATS);
-		dstats->counts[c] -= val;
+		__atomic_sub_fetch(&dstats->counts[c], val, __ATOMIC_RELAXED);
 	} else if (rstats != NULL) {
 		BUG_ON(c >= RESTORE_CNT_NR_STATS);
 		atomic_add(-val, &rstats->counts[c]);
@@ -103,6 +104,18 @@ long timeval_to_us(const struct timeval *tv)
 	return tv->tv_sec * USEC_PER_SEC + tv->tv_usec;
 }
 
+unsigned long dump_cnt(int c)
+{
+	BUG_ON(dstats == NULL || c >= DUMP_CNT_NR_STATS);
+	return __atomic_load_n(&dstats->counts[c], __ATOMIC_RELAXED);
+}
+
+long dump_time_us(int t)
+{
+	BUG_ON(dstats == NULL || t >= DUMP_TIME_NR_STATS);
+	return timeval_to_us(&dstats->timings[t].total);
+}
+
 void print_restore_timing(void)
 {
 	struct timing *tm;
@@ -144,6 +157,22 @@ void timing_stop(int t)
 	timeval_accumulate(&tm->start, &now, &tm->total);
 }
 
+/*
+ * Accounts time measured by another thread, which mustn't
+ * touch the timings itself.
+ */
+void timing_add_us(int t, long us)
+{
+	struct timeval tv = {}, delta = { .tv_sec = us / USEC_PER_SEC, .tv_usec = us % USEC_PER_SEC };
+	struct timing *tm;
+
+	if (!dstats && !rstats)
+		return;
+
+	tm = get_timing(t);
+	timeval_accumulate(&tv, &delta, &tm->total);
+}
+
 static void encode_time(int t, u_int32_t *to)
 {
 	struct timing *tm;
@@ -1,7 +1,11 @@
 #include <unistd.h>
+#include <string.h>
 #include <sys/types.h>
 #include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
 #include <linux/limits.h>
+#include <linux/tls.h>
 
 #include <gnutls/gnutls.h>
 
@@ -13,6 +17,18 @@
 #define GNUTLS_E_CERTIFICATE_VERIFICATION_ERROR GNUTLS_E_CERTIFICATE_ERROR
 #endif
 
+#ifndef GNUTLS_NO_TICKETS
+#define GNUTLS_NO_TICKETS 0
+#endif
+
+#ifndef SOL_TLS
+#define SOL_TLS 282
+#endif
+
+#ifndef TCP_ULP
+#define TCP_ULP 31
+#endif
+
 #undef LOG_PREFIX
 #define LOG_PREFIX "tls: "
 
@@ -31,6 +47,77 @@ static gnutls_certificate_credentials_t x509_cred;
 static int tls_sk = -1;
 static int tls_sk_flags = 0;
 
+/* Set when the records in that direction are handled by kernel TLS */
+static bool ktls_tx, ktls_rx;
+
+#define TLS_RECORD_ALERT 21
+
+bool tls_user_tx(void)
+{
+	return opts.tls && !ktls_tx;
+}
+
+bool tls_user_rx(void)
+{
+	return opts.tls && !ktls_rx;
+}
+
+/*
+ * With kernel TLS the alerts are sent and received as records of
+ * their own type, gnutls_bye() can't be used as gnutls doesn't know
+ * the sequence numbers any longer.
+ */
+static void ktls_bye(bool async)
+{
+	unsigned char alert[2] = { 1 /* warning */, 0 /* close_notify */ };
+	char cbuf[CMSG_SPACE(sizeof(unsigned char))] = {};
+	struct iovec iov = { .iov_base = alert, .iov_len = sizeof(alert) };
+	struct msghdr msg = {
+		.msg_iov = &iov,
+		.msg_iovlen = 1,
+		.msg_control = cbuf,
+		.msg_controllen = sizeof(cbuf),
+	};
+	struct cmsghdr *cmsg;
+
+	if (ktls_tx) {
+		cmsg = CMSG_FIRSTHDR(&msg);
+		cmsg->cmsg_level = SOL_TLS;
+		cmsg->cmsg_type = TLS_SET_RECORD_TYPE;
+		cmsg->cmsg_len = CMSG_LEN(sizeof(unsigned char));
+		*CMSG_DATA(cmsg) = TLS_RECORD_ALERT;
+
+		if (sendmsg(tls_sk, &msg, 0) < 0)
+			pr_perror("Can't send close_notify");
+	} else
+		gnutls_alert_send(session, GNUTLS_AL_WARNING, GNUTLS_A_CLOSE_NOTIFY);
+
+	if (async)
+		return;
+
+	/* Wait for the peer's close_notify or for it to go away */
+	if (ktls_rx) {
+		while (1) {
+			ssize_t ret;
+
+			msg.msg_controllen = sizeof(cbuf);
+			ret = recvmsg(tls_sk, &msg, 0);
+			if (ret <= 0)
+				break;
+
+			cmsg = CMSG_FIRSTHDR(&msg);
+			if (cmsg && cmsg->cmsg_level == SOL_TLS && cmsg->cmsg_type == TLS_GET_RECORD_TYPE &&
+			    *CMSG_DATA(cmsg) == TLS_RECORD_ALERT)
+				break;
+		}
+	} else {
+		char c;
+
+		while (gnutls_record_recv(session, &c, sizeof(c)) > 0)
+			;
+	}
+}
+
 void tls_terminate_session(bool async)
 {
 	int ret;
@@ -39,18 +126,24 @@ void tls_terminate_session(bool async)
 		return;
 
 	if (session) {
-		do {
-			/*
-			 * Initiate a connection shutdown but don't
-			 * wait for peer to close connection.
-			 */
-			ret = gnutls_bye(session, async ? GNUTLS_SHUT_WR : GNUTLS_SHUT_RDWR);
-		} while (ret == GNUTLS_E_AGAIN || ret == GNUTLS_E_INTERRUPTED);
+		if (ktls_tx || ktls_rx)
+			ktls_bye(async);
+		else {
+			do {
+				/*
+				 * Initiate a connection shutdown but don't
+				 * wait for peer to close connection.
+				 */
+				ret = gnutls_bye(session, async ? GNUTLS_SHUT_WR : GNUTLS_SHUT_RDWR);
+			} while (ret == GNUTLS_E_AGAIN || ret == GNUTLS_E_INTERRUPTED);
+		}
 		/* Free the session object */
 		gnutls_deinit(session);
+		session = NULL;
 	}
 
 	tls_sk = -1;
+	ktls_tx = ktls_rx = false;
 
 	/* Free the credentials object */
 	if (x509_cred)
@@ -246,6 +339,133 @@ static int tls_handshake(void)
 	return 0;
 }
 
+union ktls_crypto_info {
+	struct tls_crypto_info info;
+	struct tls12_crypto_info_aes_gcm_128 aes_gcm_128;
+	struct tls12_crypto_info_aes_gcm_256 aes_gcm_256;
+};
+
+/*
+ * gnutls reports the implicit part of the nonce in the IV. For TLS 1.2
+ * that's the salt and the explicit part is the record sequence number,
+ * for TLS 1.3 the IV is salt + iv.
+ *
+ * Both AES-GCM key sizes have the same salt, iv and rec_seq sizes, so
+ * the callers only pass the key in.
+ */
+static int ktls_fill_aes_gcm(unsigned char *c_key, size_t key_size, unsigned char *salt, unsigned char *c_iv,
+			     unsigned char *rec_seq, gnutls_datum_t *key, gnutls_datum_t *iv, unsigned char *seq,
+			     bool tls13)
+{
+	if (key->size != key_size)
+		return -1;
+	if (iv->size < TLS_CIPHER_AES_GCM_128_SALT_SIZE + (tls13 ? TLS_CIPHER_AES_GCM_128_IV_SIZE : 0))
+		return -1;
+
+	memcpy(c_key, key->data, key_size);
+	memcpy(salt, iv->data, TLS_CIPHER_AES_GCM_128_SALT_SIZE);
+	if (tls13)
+		memcpy(c_iv, iv->data + TLS_CIPHER_AES_GCM_128_SALT_SIZE, TLS_CIPHER_AES_GCM_128_IV_SIZE);
+	else
+		memcpy(c_iv, seq, TLS_CIPHER_AES_GCM_128_IV_SIZE);
+	memcpy(rec_seq, seq, TLS_CIPHER_AES_GCM_128_REC_SEQ_SIZE);
+
+	return 0;
+}
+
+static int ktls_fill_aes_gcm_128(struct tls12_crypto_info_aes_gcm_128 *c, gnutls_datum_t *key, gnutls_datum_t *iv,
+				 unsigned char *seq, bool tls13)
+{
+	return ktls_fill_aes_gcm(c->key, sizeof(c->key), c->salt, c->iv, c->rec_seq, key, iv, seq, tls13);
+}
+
+static int ktls_fill_aes_gcm_256(struct tls12_crypto_info_aes_gcm_256 *c, gnutls_datum_t *key, gnutls_datum_t *iv,
+				 unsigned char *seq, bool tls13)
+{
+	return ktls_fill_aes_gcm(c->key, sizeof(c->key), c->salt, c->iv, c->rec_seq, key, iv, seq, tls13);
+}
+
+static int ktls_setup(int dir)
+{
+	union ktls_crypto_info ci = {};
+	gnutls_datum_t mac_key, iv, key;
+	unsigned char seq[8];
+	bool tls13;
+	size_t len;
+	int ret;
+
+	switch (gnutls_protocol_get_version(session)) {
+	case GNUTLS_TLS1_2:
+		ci.info.version = TLS_1_2_VERSION;
+		tls13 = false;
+		break;
+	case GNUTLS_TLS1_3:
+		ci.info.version = TLS_1_3_VERSION;
+		tls13 = true;
+		break;
+	default:
+		return -1;
+	}
+
+	ret = gnutls_record_get_state(session, dir == TLS_RX, &mac_key, &iv, &key, seq);
+	if (ret < 0) {
+		tls_perror("Can't get the TLS session state", ret);
+		return -1;
+	}
+
+	switch (gnutls_cipher_get(session)) {
+	case GNUTLS_CIPHER_AES_128_GCM:
+		ci.info.cipher_type = TLS_CIPHER_AES_GCM_128;
+		ret = ktls_fill_aes_gcm_128(&ci.aes_gcm_128, &key, &iv, seq, tls13);
+		len = sizeof(ci.aes_gcm_128);
+		break;
+	case GNUTLS_CIPHER_AES_256_GCM:
+		ci.info.cipher_type = TLS_CIPHER_AES_GCM_256;
+		ret = ktls_fill_aes_gcm_256(&ci.aes_gcm_256, &key, &iv, seq, tls13);
+		len = sizeof(ci.aes_gcm_256);
+		break;
+	default:
+		return -1;
+	}
+
+	if (ret)
+		return -1;
+
+	ret = setsockopt(tls_sk, SOL_TLS, dir, &ci, len);
+	memset(&ci, 0, sizeof(ci));
+	if (ret) {
+		pr_debug("Can't set up kernel TLS %s: %m\n", dir == TLS_TX ? "TX" : "RX");
+		return -1;
+	}
+
+	return 0;
+}
+
+/*
+ * Hand the records over to the kernel once the handshake is done, so
+ * that pages can be spliced to and from the socket and encrypted in
+ * the kernel (or by the NIC). Each direction is set up on its own and
+ * stays in gnutls if the kernel can't do it for the negotiated cipher.
+ */
+static void ktls_init(void)
+{
+	/* What gnutls has already read can't be given to the kernel */
+	if (gnutls_record_check_pending(session)) {
+		pr_info("Data pending in the TLS session, not using kernel TLS\n");
+		return;
+	}
+
+	if (setsockopt(tls_sk, SOL_TCP, TCP_ULP, "tls", sizeof("tls"))) {
+		pr_info("Kernel TLS is not available: %m\n");
+		return;
+	}
+
+	ktls_tx = !ktls_setup(TLS_TX);
+	ktls_rx = !ktls_setup(TLS_RX);
+
+	pr_info("Kernel TLS: TX %s, RX %s\n", ktls_tx ? "on" : "off", ktls_rx ? "on" : "off");
+}
+
 static int tls_x509_setup_creds(void)
 {
 	int ret;
@@ -343,8 +563,12 @@ static int tls_x509_setup_session(unsigned int flags)
 {
 	int ret;
 
-	/* Create the session object */
-	ret = gnutls_init(&session, flags);
+	/*
+	 * Create the session object. TLS 1.3 session tickets would come
+	 * after the handshake and break kernel TLS on receive, and we
+	 * never resume sessions anyway.
+	 */
+	ret = gnutls_init(&session, flags | GNUTLS_NO_TICKETS);
 	if (ret != GNUTLS_E_SUCCESS) {
 		tls_perror("Failed to initialize session", ret);
 		return -1;
@@ -397,6 +621,8 @@ int tls_x509_init(int sockfd, bool is_server)
 	if (tls_x509_verify_peer_cert())
 		goto err;
 
+	ktls_init();
+
 	return 0;
 err:
 	tls_terminate_session(true);
@@ -1672,7 +1672,7 @@ struct collect_image_info tty_info_cinfo = {
 	.fd_type = CR_FD_TTY_INFO,
 	.pb_type = PB_TTY_INFO,
 	.collect = collect_one_tty_info_entry,
-	.flags = COLLECT_NOFREE,
+	.flags = COLLECT_NOFREE | COLLECT_ARENA,
 };
 
 static int prep_tty_restore_cb(struct pprep_head *ph)
@@ -1750,6 +1750,7 @@ struct collect_image_info tty_cinfo = {
 	.pb_type = PB_TTY_FILE,
 	.priv_size = sizeof(struct tty_info),
 	.collect = collect_one_tty,
+	.flags = COLLECT_ARENA,
 };
 
 static int collect_one_tty_data(void *obj, ProtobufCMessage *msg, struct cr_img *i)
@@ -448,6 +448,7 @@ struct collect_image_info tunfile_cinfo = {
 	.pb_type = PB_TUNFILE,
 	.priv_size = sizeof(struct tunfile_info),
 	.collect = collect_one_tunfile,
+	.flags = COLLECT_ARENA,
 };
 
 int dump_tun_link(NetDeviceEntry *nde, struct cr_imgset *fds, struct nlattr **info)
@@ -7,6 +7,7 @@
 #include <poll.h>
 #include <string.h>
 #include <time.h>
+#include <pthread.h>
 #include <sys/stat.h>
 #include <sys/mman.h>
 #include <sys/syscall.h>
@@ -14,6 +15,7 @@
 #include <sys/un.h>
 #include <sys/socket.h>
 #include <sys/wait.h>
+#include <sys/eventfd.h>
 
 #include "linux/userfaultfd.h"
 
@@ -41,6 +43,9 @@
 #include "fdstore.h"
 #include "util.h"
 #include "namespaces.h"
+#include "image.h"
+
+#include "images/pagemap.pb-c.h"
 
 #undef LOG_PREFIX
 #define LOG_PREFIX "uffd: "
@@ -67,6 +72,88 @@
 #define DEFAULT_XFER_LEN (64 << 10)
 #define MAX_XFER_LEN	 (4 << 20)
 
+/*
+ * Up to that many requests of a process may be in flight, so that with
+ * a remote page server the background transfer isn't throttled to one
+ * chunk per round trip. Faults are sent right away in any case.
+ */
+#define XFER_WINDOW 4
+
+/*
+ * Fault-around. A fault brings in the aligned window of lazy pages
+ * around the faulting one. The window doubles while the faults stay
+ * close to each other and shrinks back when they jump around, so
+ * sequential access gets up to 2M per fault and random one doesn't
+ * pay for copying pages it won't touch. Faults on pages that are not
+ * in the image are resolved with zero pages in 2M units.
+ */
+#define FAULT_AROUND_MIN (DEFAULT_XFER_LEN / PAGE_SIZE)
+#define FAULT_AROUND_MAX ((2 << 20) / PAGE_SIZE)
+#define ZERO_AROUND_LEN	 (2 << 20)
+
+/*
+ * Fault profile. With --fault-profile and no profile in the images the
+ * daemon records the faults of the first opts.fault_profile_ms after the
+ * restore, in dump-time addresses. Pages faulted one right after another
+ * are merged into one entry. With the profile in the images each process
+ * gets its part of it and the background transfer serves these ranges
+ * first, in the recorded order.
+ */
+#define FAULT_PROFILE_MAX_FAULTS (64 << 10)
+
+struct fault_rec {
+	int pid;
+	unsigned long vaddr; /* dump-time address */
+	unsigned int nr_pages;
+	unsigned int time_ms;
+};
+
+static struct fault_rec *fp_recs;
+static unsigned long fp_nr, fp_size;
+static unsigned long fp_nr_faults;
+static bool fp_recording;
+static struct timespec fp_start;
+static pthread_mutex_t fp_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/*
+ * The processes are sharded between workers, each running its own epoll
+ * loop over the uffds of its processes, so that faults and copies for
+ * different processes are served in parallel. An lpi, its forked
+ * children and their IOV lists are only touched by the worker owning
+ * them. The first worker runs in the main thread and also serves the
+ * restore socket and the page server connection.
+ */
+#define LAZY_PAGES_MAX_WORKERS 8
+
+struct lazy_pages_worker {
+	int epollfd;
+	struct epoll_event *events;
+	int nr_fds;
+
+	struct list_head lpis;
+	struct list_head pending_lpis;
+
+	struct epoll_rfd wake_rfd;
+	pthread_t thread;
+	bool threaded;
+	int ret;
+};
+
+static struct lazy_pages_worker *workers;
+static int nr_workers;
+static bool lazy_pages_abort;
+
+/* For the flags set by one thread and polled by the workers */
+static inline bool lazy_flag(bool *flag)
+{
+	return __atomic_load_n(flag, __ATOMIC_ACQUIRE);
+}
+
+static inline void lazy_flag_set(bool *flag)
+{
+	__atomic_store_n(flag, true, __ATOMIC_RELEASE);
+}
+
 static mutex_t *lazy_sock_mutex;
 
 struct lazy_iov {
@@ -80,6 +167,8 @@ struct lazy_pages_info {
 	int pid;
 	bool exited;
 
+	struct lazy_pages_worker *w;
+
 	struct list_head iovs;
 	struct list_head reqs;
 
@@ -89,6 +178,8 @@ struct lazy_pages_info {
 	struct page_read pr;
 
 	unsigned long xfer_len; /* in pages */
+	unsigned long last_fault;
+	unsigned long fault_around; /* in pages */
 	unsigned long total_pages;
 	unsigned long copied_pages;
 
@@ -98,13 +189,14 @@ struct lazy_pages_info {
 
 	unsigned long buf_size;
 	void *buf;
+
+	struct fault_rec *profile;
+	unsigned long nr_profile;
+	unsigned long profile_pos;
 };
 
 /* global lazy-pages daemon state */
-static LIST_HEAD(lpis);
 static LIST_HEAD(exiting_lpis);
-static LIST_HEAD(pending_lpis);
-static int epollfd;
 static bool restore_finished;
 static struct epoll_rfd lazy_sk_rfd;
 /* socket for communication with lazy-pages daemon */
@@ -126,6 +218,7 @@ static struct lazy_pages_info *lpi_init(void)
 	INIT_LIST_HEAD(&lpi->l);
 	lpi->lpfd.read_event = handle_uffd_event;
 	lpi->xfer_len = DEFAULT_XFER_LEN;
+	lpi->fault_around = FAULT_AROUND_MIN;
 	lpi->ref_cnt = 1;
 
 	return lpi;
@@ -165,6 +258,7 @@ static void lpi_fini(struct lazy_pages_info *lpi)
 	if (!lpi)
 		return;
 	xfree(lpi->buf);
+	xfree(lpi->profile);
 	free_iovs(lpi);
 	if (lpi->lpfd.fd > 0)
 		close(lpi->lpfd.fd);
@@ -728,9 +822,222 @@ free_mm:
 	return ret;
 }
 
+static struct fault_rec *fault_profile_add(void)
+{
+	struct fault_rec *recs;
+
+	if (fp_nr == fp_size) {
+		fp_size = fp_size ? fp_size * 2 : 1024;
+		recs = xrealloc(fp_recs, fp_size * sizeof(*recs));
+		if (!recs)
+			return NULL;
+		fp_recs = recs;
+	}
+
+	return &fp_recs[fp_nr++];
+}
+
+static int fault_profile_load(void)
+{
+	struct cr_img *img;
+	int ret = -1;
+
+	img = open_image(CR_FD_FAULT_PROFILE, O_RSTR);
+	if (!img)
+		return -1;
+
+	if (empty_image(img)) {
+		pr_info("Recording fault profile for %d ms\n", opts.fault_profile_ms);
+		fp_recording = true;
+		close_image(img);
+		return 0;
+	}
+
+	while (1) {
+		FaultProfileEntry *fpe;
+		struct fault_rec *fr;
+
+		ret = pb_read_one_eof(img, &fpe, PB_FAULT_PROFILE);
+		if (ret <= 0)
+			break;
+
+		fr = fault_profile_add();
+		if (fr) {
+			fr->pid = fpe->pid;
+			fr->vaddr = fpe->vaddr;
+			fr->nr_pages = fpe->nr_pages;
+			fr->time_ms = fpe->time_ms;
+		}
+		fault_profile_entry__free_unpacked(fpe, NULL);
+		if (!fr) {
+			ret = -1;
+			break;
+		}
+	}
+	close_image(img);
+
+	if (!ret)
+		pr_info("Loaded %lu fault profile entries\n", fp_nr);
+	return ret;
+}
+
+static int fault_profile_attach(struct lazy_pages_info *lpi)
+{
+	unsigned long i, nr = 0;
+
+	for (i = 0; i < fp_nr; i++)
+		if (fp_recs[i].pid == lpi->pid)
+			nr++;
+	if (!nr)
+		return 0;
+
+	lpi->profile = xmalloc(nr * sizeof(*lpi->profile));
+	if (!lpi->profile)
+		return -1;
+
+	for (i = 0; i < fp_nr; i++)
+		if (fp_recs[i].pid == lpi->pid)
+			lpi->profile[lpi->nr_profile++] = fp_recs[i];
+
+	lp_debug(lpi, "Prefetching %lu ranges from the fault profile\n", nr);
+	return 0;
+}
+
+/*
+ * Called with fp_lock held or from the main thread after the workers are
+ * done. Several restores from the same images may record the profile at
+ * once, so it's written aside and renamed over the image.
+ */
+static void fault_profile_write(void)
+{
+	FaultProfileEntry fpe = FAULT_PROFILE_ENTRY__INIT;
+	int dfd = get_service_fd(IMG_FD_OFF);
+	struct cr_img *img;
+	char tmp[PATH_MAX];
+	unsigned long i;
+
+	__atomic_store_n(&fp_recording, false, __ATOMIC_RELAXED);
+
+	snprintf(tmp, sizeof(tmp), imgset_template[CR_FD_FAULT_PROFILE_TMP].fmt, getpid());
+	img = open_image_at(dfd, CR_FD_FAULT_PROFILE_TMP, O_DUMP, getpid());
+	if (!img)
+		goto err;
+
+	for (i = 0; i < fp_nr; i++) {
+		fpe.pid = fp_recs[i].pid;
+		fpe.vaddr = fp_recs[i].vaddr;
+		fpe.nr_pages = fp_recs[i].nr_pages;
+		fpe.has_time_ms = true;
+		fpe.time_ms = fp_recs[i].time_ms;
+		if (pb_write_one(img, &fpe, PB_FAULT_PROFILE) < 0) {
+			close_image(img);
+			goto err_unlink;
+		}
+	}
+
+	close_image(img);
+
+	if (renameat(dfd, tmp, dfd, imgset_template[CR_FD_FAULT_PROFILE].fmt)) {
+		pr_perror("Can't rename %s", tmp);
+		goto err_unlink;
+	}
+
+	pr_info("Recorded %lu faults in %lu fault profile entries\n", fp_nr_faults, fp_nr);
+	return;
+
+err_unlink:
+	unlinkat(dfd, tmp, 0);
+err:
+	/* The profile only speeds up later restores, don't fail this one */
+	pr_warn("Can't write fault profile\n");
+}
+
+static unsigned int fault_profile_time(void)
+{
+	struct timespec now;
+
+	if (!lazy_flag(&restore_finished))
+		return 0;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (now.tv_sec - fp_start.tv_sec) * 1000 + (now.tv_nsec - fp_start.tv_nsec) / 1000000;
+}
+
+static void fault_profile_record(struct lazy_pages_info *lpi, unsigned long addr)
+{
+	struct lazy_iov *iov;
+	struct fault_rec *fr;
+	unsigned int time_ms;
+
+	/* forked children have no pages of their own in the images */
+	if (lpi->parent)
+		return;
+
+	iov = find_iov(lpi, addr);
+	if (!iov) {
+		/* the page may be in flight already */
+		list_for_each_entry(iov, &lpi->reqs, l)
+			if (addr >= iov->start && addr < iov->end)
+				break;
+		if (&iov->l == &lpi->reqs)
+			return;
+	}
+
+	addr = iov->img_start + addr - iov->start;
+
+	pthread_mutex_lock(&fp_lock);
+	if (!__atomic_load_n(&fp_recording, __ATOMIC_RELAXED))
+		goto out;
+
+	time_ms = fault_profile_time();
+	if (time_ms >= opts.fault_profile_ms || fp_nr_faults >= FAULT_PROFILE_MAX_FAULTS) {
+		fault_profile_write();
+		goto out;
+	}
+
+	fp_nr_faults++;
+
+	if (fp_nr) {
+		fr = &fp_recs[fp_nr - 1];
+		if (fr->pid == lpi->pid && fr->vaddr + fr->nr_pages * PAGE_SIZE == addr) {
+			fr->nr_pages++;
+			goto out;
+		}
+	}
+
+	fr = fault_profile_add();
+	if (!fr) {
+		__atomic_store_n(&fp_recording, false, __ATOMIC_RELAXED);
+		goto out;
+	}
+
+	fr->pid = lpi->pid;
+	fr->vaddr = addr;
+	fr->nr_pages = 1;
+	fr->time_ms = time_ms;
+out:
+	pthread_mutex_unlock(&fp_lock);
+}
+
+/*
+ * The profile is written as soon as the recording time is over, not on
+ * the next fault, which may never come. The workers don't sleep once
+ * the restore has finished, so it's enough to check it on each round.
+ */
+static void fault_profile_check(void)
+{
+	if (!__atomic_load_n(&fp_recording, __ATOMIC_RELAXED))
+		return;
+
+	pthread_mutex_lock(&fp_lock);
+	if (__atomic_load_n(&fp_recording, __ATOMIC_RELAXED) && fault_profile_time() >= opts.fault_profile_ms)
+		fault_profile_write();
+	pthread_mutex_unlock(&fp_lock);
+}
+
 static int uffd_io_complete(struct page_read *pr, unsigned long vaddr, int nr);
 
-static int ud_open(int client, struct lazy_pages_info **_lpi)
+static int ud_open(int client, struct lazy_pages_worker *w, struct lazy_pages_info **_lpi)
 {
 	struct lazy_pages_info *lpi;
 	int ret = -1;
@@ -766,6 +1073,8 @@ static int ud_open(int client, struct lazy_pages_info **_lpi)
 
 	if (opts.use_page_server)
 		pr_flags |= PR_REMOTE;
+	else if (opts.map_page_images)
+		pr_flags |= PR_MMAP;
 	ret = open_page_read(lpi->pid, &lpi->pr, pr_flags);
 	if (ret <= 0) {
 		lp_err(lpi, "Failed to open pagemap\n");
@@ -785,7 +1094,11 @@ static int ud_open(int client, struct lazy_pages_info **_lpi)
 
 	lp_debug(lpi, "Found %ld pages to be handled by UFFD\n", lpi->total_pages);
 
-	list_add_tail(&lpi->l, &lpis);
+	if (fault_profile_attach(lpi))
+		goto out;
+
+	lpi->w = w;
+	list_add_tail(&lpi->l, &w->lpis);
 	*_lpi = lpi;
 
 	return 0;
@@ -798,7 +1111,7 @@ out:
 static int handle_exit(struct lazy_pages_info *lpi)
 {
 	lp_debug(lpi, "EXIT\n");
-	if (epoll_del_rfd(epollfd, &lpi->lpfd))
+	if (epoll_del_rfd(lpi->w->epollfd, &lpi->lpfd))
 		return -1;
 	free_iovs(lpi);
 	close(lpi->lpfd.fd);
@@ -806,7 +1119,7 @@ static int handle_exit(struct lazy_pages_info *lpi)
 	lpi->exited = true;
 
 	/* keep it for tracking in-flight requests and for the summary */
-	list_move_tail(&lpi->l, &lpis);
+	list_move_tail(&lpi->l, &lpi->w->lpis);
 
 	return 0;
 }
@@ -844,13 +1157,13 @@ static int uffd_check_op_error(struct lazy_pages_info *lpi, const char *op, int
 	return 0;
 }
 
-static int uffd_copy(struct lazy_pages_info *lpi, __u64 address, int *nr_pages)
+static int uffd_copy(struct lazy_pages_info *lpi, __u64 address, void *src, int *nr_pages)
 {
 	struct uffdio_copy uffdio_copy;
 	unsigned long len = *nr_pages * page_size();
 
 	uffdio_copy.dst = address;
-	uffdio_copy.src = (unsigned long)lpi->buf;
+	uffdio_copy.src = (unsigned long)src;
 	uffdio_copy.len = len;
 	uffdio_copy.mode = 0;
 	uffdio_copy.copy = 0;
@@ -903,7 +1216,7 @@ static int uffd_io_complete(struct page_read *pr, unsigned long img_addr, int nr
 	req_pages = (req->end - req->start) / PAGE_SIZE;
 	nr = min(nr, req_pages);
 
-	ret = uffd_copy(lpi, addr, &nr);
+	ret = uffd_copy(lpi, addr, lpi->buf, &nr);
 	if (ret < 0)
 		return ret;
 
@@ -920,23 +1233,60 @@ static int uffd_io_complete(struct page_read *pr, unsigned long img_addr, int nr
 	return drop_iovs(lpi, addr, nr * PAGE_SIZE);
 }
 
-static int uffd_zero(struct lazy_pages_info *lpi, __u64 address, int nr_pages)
+static int uffd_zero(struct lazy_pages_info *lpi, __u64 address, int *nr_pages)
 {
 	struct uffdio_zeropage uffdio_zeropage;
-	unsigned long len = page_size() * nr_pages;
+	unsigned long len = page_size() * *nr_pages;
 
 	uffdio_zeropage.range.start = address;
 	uffdio_zeropage.range.len = len;
 	uffdio_zeropage.mode = 0;
+	uffdio_zeropage.zeropage = 0;
 
-	lp_debug(lpi, "zero page at 0x%llx\n", address);
+	lp_debug(lpi, "zero page at 0x%llx/%ld\n", address, len);
 	if (ioctl(lpi->lpfd.fd, UFFDIO_ZEROPAGE, &uffdio_zeropage) &&
-	    uffd_check_op_error(lpi, "zero", &nr_pages, uffdio_zeropage.zeropage))
+	    uffd_check_op_error(lpi, "zero", nr_pages, uffdio_zeropage.zeropage))
 		return -1;
 
 	return 0;
 }
 
+/*
+ * The aligned 2M unit around the address is clipped at the lazy pages
+ * that are still to be copied, but the daemon doesn't track VMAs, so
+ * the unit may still cross the VMA end or hit pages restored without
+ * uffd. The kernel rejects or stops the zeroing in that case, and the
+ * faulting page is then zeroed alone.
+ */
+static int uffd_zero_around(struct lazy_pages_info *lpi, __u64 address)
+{
+	unsigned long start = address & ~(ZERO_AROUND_LEN - 1UL);
+	unsigned long end = start + ZERO_AROUND_LEN;
+	struct list_head *lists[] = { &lpi->iovs, &lpi->reqs };
+	struct lazy_iov *iov;
+	int i, nr;
+
+	for (i = 0; i < ARRAY_SIZE(lists); i++) {
+		list_for_each_entry(iov, lists[i], l) {
+			if (iov->end <= address && iov->end > start)
+				start = iov->end;
+			if (iov->start > address && iov->start < end)
+				end = iov->start;
+		}
+	}
+
+	nr = (end - start) / PAGE_SIZE;
+	if (nr > 1) {
+		if (uffd_zero(lpi, start, &nr))
+			return -1;
+		if (lpi->exited || start + nr * PAGE_SIZE > address)
+			return 0;
+	}
+
+	nr = 1;
+	return uffd_zero(lpi, address, &nr);
+}
+
 /*
  * Seek for the requested address in the pagemap. If it is found, the
  * subsequent call to pr->page_read will bring us the data. If the
@@ -961,10 +1311,72 @@ static int uffd_seek_pages(struct lazy_pages_info *lpi, __u64 address, int nr)
 	return 0;
 }
 
+/*
+ * With --map-page-images the pages images are mapped and the pages
+ * are copied into the process right from the mapping. Returns 0 if
+ * the pages are not in a mapped image and should be read as usual.
+ */
+static int uffd_map_pages(struct lazy_pages_info *lpi, __u64 address, int nr)
+{
+	struct lazy_iov *req;
+	int copied = 0, ret;
+
+	list_for_each_entry(req, &lpi->reqs, l)
+		if (req->img_start == address)
+			break;
+	if (&req->l == &lpi->reqs)
+		return 0;
+
+	while (copied < nr) {
+		unsigned long img_addr = address + copied * PAGE_SIZE;
+		int n = nr - copied, len;
+		void *src;
+
+		ret = uffd_seek_pages(lpi, img_addr, n);
+		if (ret)
+			return ret;
+
+		ret = pagemap_map_pages(&lpi->pr, img_addr, &n, &src);
+		if (ret < 0)
+			return ret;
+		if (ret == 0) {
+			if (!copied)
+				return 0;
+			break;
+		}
+
+		len = n;
+		ret = uffd_copy(lpi, req->start + copied * PAGE_SIZE, src, &n);
+		if (ret < 0)
+			return ret;
+
+		/* the process may exit in uffd_copy and take the request with it */
+		if (lpi->exited)
+			return 1;
+
+		copied += n;
+		if (n < len)
+			break;
+	}
+
+	/* the rest of the request, if any, goes back to the IOVs, see uffd_io_complete */
+	iov_list_insert(req, &lpi->iovs);
+	if (drop_iovs(lpi, req->start, copied * PAGE_SIZE))
+		return -1;
+
+	return 1;
+}
+
 static int uffd_handle_pages(struct lazy_pages_info *lpi, __u64 address, int nr, unsigned flags)
 {
 	int ret;
 
+	if (lpi->pr.mapped) {
+		ret = uffd_map_pages(lpi, address, nr);
+		if (ret)
+			return ret < 0 ? ret : 0;
+	}
+
 	ret = uffd_seek_pages(lpi, address, nr);
 	if (ret)
 		return ret;
@@ -978,23 +1390,92 @@ static int uffd_handle_pages(struct lazy_pages_info *lpi, __u64 address, int nr,
 	return 0;
 }
 
-static struct lazy_iov *pick_next_range(struct lazy_pages_info *lpi)
+static bool xfer_window_full(struct lazy_pages_info *lpi)
+{
+	struct lazy_iov *req;
+	int nr = 0;
+
+	list_for_each_entry(req, &lpi->reqs, l)
+		if (++nr >= XFER_WINDOW)
+			return true;
+
+	return false;
+}
+
+static struct lazy_iov *find_img_iov(struct lazy_pages_info *lpi, unsigned long img_addr)
 {
-	return list_first_entry(&lpi->iovs, struct lazy_iov, l);
+	struct lazy_iov *iov;
+
+	list_for_each_entry(iov, &lpi->iovs, l)
+		if (img_addr >= iov->img_start && img_addr < iov->img_start + iov->end - iov->start)
+			return iov;
+
+	return NULL;
+}
+
+/*
+ * The ranges from the fault profile go first. Their pages might have
+ * been faulted in already, or only a part of a range may be left in one
+ * IOV, so we take what is still there piece by piece.
+ */
+static struct lazy_iov *pick_profile_range(struct lazy_pages_info *lpi, unsigned long *start, unsigned long *len)
+{
+	while (lpi->profile_pos < lpi->nr_profile) {
+		struct fault_rec *fr = &lpi->profile[lpi->profile_pos];
+		unsigned long img_end = fr->vaddr + fr->nr_pages * PAGE_SIZE;
+		struct lazy_iov *iov;
+
+		iov = find_img_iov(lpi, fr->vaddr);
+		if (!iov) {
+			fr->vaddr += PAGE_SIZE;
+			if (!--fr->nr_pages)
+				lpi->profile_pos++;
+			continue;
+		}
+
+		*start = iov->start + fr->vaddr - iov->img_start;
+		*len = min(iov->end - *start, img_end - fr->vaddr);
+
+		fr->vaddr += *len;
+		fr->nr_pages -= *len / PAGE_SIZE;
+		if (!fr->nr_pages)
+			lpi->profile_pos++;
+
+		return iov;
+	}
+
+	return NULL;
+}
+
+static struct lazy_iov *pick_next_range(struct lazy_pages_info *lpi, unsigned long *start, unsigned long *len)
+{
+	struct lazy_iov *iov;
+
+	iov = pick_profile_range(lpi, start, len);
+	if (iov)
+		return iov;
+
+	iov = list_first_entry(&lpi->iovs, struct lazy_iov, l);
+	*start = iov->start;
+	*len = min(iov->end - iov->start, lpi->xfer_len);
+
+	return iov;
 }
 
 /*
  * This is very simple heurstics for background transfer control.
  * The idea is to transfer larger chunks when there is no page faults
  * and drop the background transfer size each time #PF occurs to some
- * default value. The default is empirically set to 64Kbytes
+ * default value. The default is empirically set to 64Kbytes and the
+ * chunk doubles with every transfer, so that it reaches the maximum
+ * in a few rounds.
  */
 static void update_xfer_len(struct lazy_pages_info *lpi, bool pf)
 {
 	if (pf)
 		lpi->xfer_len = DEFAULT_XFER_LEN;
 	else
-		lpi->xfer_len += DEFAULT_XFER_LEN;
+		lpi->xfer_len *= 2;
 
 	if (lpi->xfer_len > MAX_XFER_LEN)
 		lpi->xfer_len = MAX_XFER_LEN;
@@ -1004,16 +1485,14 @@ static int xfer_pages(struct lazy_pages_info *lpi)
 {
 	struct lazy_iov *iov;
 	unsigned int nr_pages;
-	unsigned long len;
+	unsigned long start, len;
 	int err;
 
-	iov = pick_next_range(lpi);
+	iov = pick_next_range(lpi, &start, &len);
 	if (!iov)
 		return 0;
 
-	len = min(iov->end - iov->start, lpi->xfer_len);
-
-	iov = extract_range(iov, iov->start, iov->start + len);
+	iov = extract_range(iov, start, start + len);
 	if (!iov)
 		return -1;
 	list_move(&iov->l, &lpi->reqs);
@@ -1092,7 +1571,8 @@ static int handle_fork(struct lazy_pages_info *parent_lpi, struct uffd_msg *msg)
 	lpi->parent = parent_lpi->parent ? parent_lpi->parent : parent_lpi;
 	lpi->copied_pages = lpi->parent->copied_pages;
 	lpi->total_pages = lpi->parent->total_pages;
-	list_add_tail(&lpi->l, &pending_lpis);
+	lpi->w = parent_lpi->w;
+	list_add_tail(&lpi->l, &lpi->w->pending_lpis);
 
 	dup_page_read(&lpi->parent->pr, &lpi->pr);
 
@@ -1110,28 +1590,28 @@ out:
  * such case we return 1 rather than 0 to let the caller know that no
  * fork() events were pending
  */
-static int complete_forks(int epollfd, struct epoll_event **events, int *nr_fds)
+static int complete_forks(struct lazy_pages_worker *w)
 {
 	struct lazy_pages_info *lpi, *n;
 	struct epoll_event *tmp;
 
-	if (list_empty(&pending_lpis))
+	if (list_empty(&w->pending_lpis))
 		return 1;
 
-	list_for_each_entry(lpi, &pending_lpis, l)
-		(*nr_fds)++;
+	list_for_each_entry(lpi, &w->pending_lpis, l)
+		w->nr_fds++;
 
-	tmp = xrealloc(*events, sizeof(struct epoll_event) * (*nr_fds));
+	tmp = xrealloc(w->events, sizeof(struct epoll_event) * w->nr_fds);
 	if (!tmp)
 		return -1;
-	*events = tmp;
+	w->events = tmp;
 
-	list_for_each_entry_safe(lpi, n, &pending_lpis, l) {
-		if (epoll_add_rfd(epollfd, &lpi->lpfd))
+	list_for_each_entry_safe(lpi, n, &w->pending_lpis, l) {
+		if (epoll_add_rfd(w->epollfd, &lpi->lpfd))
 			return -1;
 
 		list_del_init(&lpi->l);
-		list_add_tail(&lpi->l, &lpis);
+		list_add_tail(&lpi->l, &w->lpis);
 	}
 
 	return 0;
@@ -1148,9 +1628,28 @@ static bool is_page_queued(struct lazy_pages_info *lpi, unsigned long addr)
 	return false;
 }
 
+static void fault_around(struct lazy_pages_info *lpi, struct lazy_iov *iov, unsigned long address,
+			 unsigned long *start, unsigned long *end)
+{
+	unsigned long dist, len;
+
+	dist = address > lpi->last_fault ? address - lpi->last_fault : lpi->last_fault - address;
+	if (dist <= 2 * lpi->fault_around * PAGE_SIZE)
+		lpi->fault_around = min(lpi->fault_around * 2, FAULT_AROUND_MAX);
+	else
+		lpi->fault_around = max(lpi->fault_around / 2, FAULT_AROUND_MIN);
+	lpi->last_fault = address;
+
+	len = lpi->fault_around * PAGE_SIZE;
+	*start = max(address & ~(len - 1), iov->start);
+	*end = min(*start + len, iov->end);
+	*end = min(*end, *start + lpi->buf_size);
+}
+
 static int handle_page_fault(struct lazy_pages_info *lpi, struct uffd_msg *msg)
 {
 	struct lazy_iov *iov;
+	unsigned long start, end;
 	__u64 address;
 	int ret;
 
@@ -1158,14 +1657,18 @@ static int handle_page_fault(struct lazy_pages_info *lpi, struct uffd_msg *msg)
 	address = msg->arg.pagefault.address & ~(page_size() - 1);
 	lp_debug(lpi, "#PF at 0x%llx\n", address);
 
+	if (__atomic_load_n(&fp_recording, __ATOMIC_RELAXED))
+		fault_profile_record(lpi, address);
+
 	if (is_page_queued(lpi, address))
 		return 0;
 
 	iov = find_iov(lpi, address);
 	if (!iov)
-		return uffd_zero(lpi, address, 1);
+		return uffd_zero_around(lpi, address);
 
-	iov = extract_range(iov, address, address + PAGE_SIZE);
+	fault_around(lpi, iov, address, &start, &end);
+	iov = extract_range(iov, start, end);
 	if (!iov)
 		return -1;
 
@@ -1173,7 +1676,7 @@ static int handle_page_fault(struct lazy_pages_info *lpi, struct uffd_msg *msg)
 
 	update_xfer_len(lpi, true);
 
-	ret = uffd_handle_pages(lpi, iov->img_start, 1, PR_ASYNC | PR_ASAP);
+	ret = uffd_handle_pages(lpi, iov->img_start, (end - start) / PAGE_SIZE, PR_ASYNC | PR_ASAP | PR_URGENT);
 	if (ret < 0) {
 		lp_err(lpi, "Error during regular page copy\n");
 		return -1;
@@ -1240,31 +1743,37 @@ static void lazy_pages_summary(struct lazy_pages_info *lpi)
 #endif
 }
 
-static int handle_requests(int epollfd, struct epoll_event **events, int nr_fds)
+static int handle_requests(struct lazy_pages_worker *w)
 {
 	struct lazy_pages_info *lpi, *n;
 	int poll_timeout = -1;
 	int ret;
 
 	for (;;) {
-		ret = epoll_run_rfds(epollfd, *events, nr_fds, poll_timeout);
+		ret = epoll_run_rfds(w->epollfd, w->events, w->nr_fds, poll_timeout);
 		if (ret < 0)
 			goto out;
+		if (lazy_flag(&lazy_pages_abort)) {
+			ret = -1;
+			goto out;
+		}
+		if (lazy_flag(&restore_finished))
+			fault_profile_check();
 		if (ret > 0) {
-			ret = complete_forks(epollfd, events, &nr_fds);
+			ret = complete_forks(w);
 			if (ret < 0)
 				goto out;
-			if (restore_finished)
+			if (lazy_flag(&restore_finished))
 				poll_timeout = 0;
-			if (!restore_finished || !ret)
+			if (!lazy_flag(&restore_finished) || !ret)
 				continue;
 		}
 
 		/* make sure we return success if there is nothing to xfer */
 		ret = 0;
 
-		list_for_each_entry_safe(lpi, n, &lpis, l) {
-			if (!list_empty(&lpi->iovs) && list_empty(&lpi->reqs)) {
+		list_for_each_entry_safe(lpi, n, &w->lpis, l) {
+			if (!list_empty(&lpi->iovs) && !xfer_window_full(lpi)) {
 				ret = xfer_pages(lpi);
 				if (ret < 0)
 					goto out;
@@ -1278,7 +1787,7 @@ static int handle_requests(int epollfd, struct epoll_event **events, int nr_fds)
 			}
 		}
 
-		if (list_empty(&lpis))
+		if (list_empty(&w->lpis))
 			break;
 	}
 
@@ -1326,6 +1835,28 @@ static int prepare_lazy_socket(void)
 	return listen;
 }
 
+static void wake_workers(void)
+{
+	uint64_t v = 1;
+	int i;
+
+	for (i = 0; i < nr_workers; i++)
+		if (write(workers[i].wake_rfd.fd, &v, sizeof(v)) != sizeof(v))
+			pr_perror("Can't wake lazy-pages worker %d", i);
+}
+
+static int wake_read_event(struct epoll_rfd *rfd)
+{
+	uint64_t v;
+
+	if (read(rfd->fd, &v, sizeof(v)) != sizeof(v)) {
+		pr_perror("Can't read lazy-pages worker wakeup");
+		return -1;
+	}
+
+	return 1;
+}
+
 static int lazy_sk_read_event(struct epoll_rfd *rfd)
 {
 	uint32_t fin;
@@ -1349,14 +1880,18 @@ static int lazy_sk_read_event(struct epoll_rfd *rfd)
 		return -1;
 	}
 
-	restore_finished = true;
+	/* The workers see the profile start along with the flag */
+	if (__atomic_load_n(&fp_recording, __ATOMIC_RELAXED))
+		clock_gettime(CLOCK_MONOTONIC, &fp_start);
+	lazy_flag_set(&restore_finished);
+	wake_workers();
 
 	return 1;
 }
 
 static int lazy_sk_hangup_event(struct epoll_rfd *rfd)
 {
-	if (!restore_finished) {
+	if (!lazy_flag(&restore_finished)) {
 		pr_err("Restorer unexpectedly closed the connection\n");
 		return -1;
 	}
@@ -1364,9 +1899,9 @@ static int lazy_sk_hangup_event(struct epoll_rfd *rfd)
 	return 0;
 }
 
-static int prepare_uffds(int listen, int epollfd)
+static int prepare_uffds(int listen)
 {
-	int i;
+	int i, nr = 0;
 	int client;
 	socklen_t len;
 	struct sockaddr_un saddr;
@@ -1380,19 +1915,22 @@ static int prepare_uffds(int listen, int epollfd)
 	}
 
 	for (i = 0; i < task_entries->nr_tasks; i++) {
+		struct lazy_pages_worker *w = &workers[nr % nr_workers];
 		struct lazy_pages_info *lpi = NULL;
-		if (ud_open(client, &lpi))
+
+		if (ud_open(client, w, &lpi))
 			goto close_uffd;
 		if (lpi == NULL)
 			continue;
-		if (epoll_add_rfd(epollfd, &lpi->lpfd))
+		if (epoll_add_rfd(w->epollfd, &lpi->lpfd))
 			goto close_uffd;
+		nr++;
 	}
 
 	lazy_sk_rfd.fd = client;
 	lazy_sk_rfd.read_event = lazy_sk_read_event;
 	lazy_sk_rfd.hangup_event = lazy_sk_hangup_event;
-	if (epoll_add_rfd(epollfd, &lazy_sk_rfd))
+	if (epoll_add_rfd(workers[0].epollfd, &lazy_sk_rfd))
 		goto close_uffd;
 
 	close(listen);
@@ -1404,10 +1942,142 @@ close_uffd:
 	return -1;
 }
 
+static void fini_workers(void)
+{
+	int i;
+
+	for (i = 0; i < nr_workers; i++) {
+		struct lazy_pages_worker *w = &workers[i];
+
+		if (w->epollfd >= 0)
+			close(w->epollfd);
+		if (w->wake_rfd.fd >= 0)
+			close(w->wake_rfd.fd);
+		xfree(w->events);
+	}
+
+	xfree(workers);
+	workers = NULL;
+	nr_workers = 0;
+}
+
+static int init_workers(void)
+{
+	long nr_wanted;
+	int i, nr_fds;
+
+	/*
+	 * The page server connection and the async reads over it are
+	 * shared by all processes, so with remote pages there's only
+	 * the main loop.
+	 */
+	nr_wanted = opts.lazy_pages_workers ?: sysconf(_SC_NPROCESSORS_ONLN);
+	nr_workers = min_t(long, max_t(long, nr_wanted, 1), LAZY_PAGES_MAX_WORKERS);
+	nr_workers = min(nr_workers, task_entries->nr_tasks);
+	if (opts.use_page_server || nr_workers < 1)
+		nr_workers = 1;
+
+	workers = xzalloc(nr_workers * sizeof(*workers));
+	if (!workers)
+		return -1;
+
+	for (i = 0; i < nr_workers; i++) {
+		workers[i].epollfd = -1;
+		workers[i].wake_rfd.fd = -1;
+	}
+
+	for (i = 0; i < nr_workers; i++) {
+		struct lazy_pages_worker *w = &workers[i];
+
+		INIT_LIST_HEAD(&w->lpis);
+		INIT_LIST_HEAD(&w->pending_lpis);
+
+		/*
+		 * we poll the userfault fds of our share of the tasks and
+		 * the wakeup eventfd. The main loop also polls the UNIX
+		 * socket between lazy-pages daemon and the cr-restore,
+		 * and, optionally TCP socket for remote pages
+		 */
+		nr_fds = task_entries->nr_tasks / nr_workers + 2;
+		if (i == 0)
+			nr_fds += opts.use_page_server ? 2 : 1;
+
+		w->nr_fds = nr_fds;
+		w->epollfd = epoll_prepare(nr_fds, &w->events);
+		if (w->epollfd < 0)
+			goto err;
+
+		w->wake_rfd.fd = eventfd(0, EFD_CLOEXEC);
+		if (w->wake_rfd.fd < 0) {
+			pr_perror("Can't create lazy-pages worker eventfd");
+			goto err;
+		}
+		w->wake_rfd.read_event = wake_read_event;
+		if (epoll_add_rfd(w->epollfd, &w->wake_rfd))
+			goto err;
+	}
+
+	pr_debug("Serving lazy pages with %d workers\n", nr_workers);
+	return 0;
+
+err:
+	fini_workers();
+	return -1;
+}
+
+static void *worker_fn(void *arg)
+{
+	struct lazy_pages_worker *w = arg;
+
+	w->ret = handle_requests(w);
+	if (w->ret < 0) {
+		lazy_flag_set(&lazy_pages_abort);
+		wake_workers();
+	}
+
+	return NULL;
+}
+
+static int run_workers(void)
+{
+	int i, ret = 0;
+
+	for (i = 1; i < nr_workers; i++) {
+		struct lazy_pages_worker *w = &workers[i];
+
+		w->threaded = !pthread_create(&w->thread, NULL, worker_fn, w);
+		if (!w->threaded) {
+			pr_err("Can't start lazy-pages worker %d\n", i);
+			lazy_flag_set(&lazy_pages_abort);
+			break;
+		}
+	}
+
+	if (!lazy_flag(&lazy_pages_abort))
+		ret = handle_requests(&workers[0]);
+	if (ret < 0 || lazy_flag(&lazy_pages_abort)) {
+		lazy_flag_set(&lazy_pages_abort);
+		wake_workers();
+		ret = -1;
+	}
+
+	for (i = 1; i < nr_workers; i++) {
+		struct lazy_pages_worker *w = &workers[i];
+
+		if (!w->threaded)
+			continue;
+		if (pthread_join(w->thread, NULL)) {
+			pr_err("Can't join lazy-pages worker %d\n", i);
+			ret = -1;
+		} else if (w->ret < 0)
+			ret = -1;
+	}
+
+	return ret;
+}
+
 int cr_lazy_pages(bool daemon)
 {
-	struct epoll_event *events = NULL;
-	int nr_fds;
 	int lazy_sk;
 	int ret;
 
@@ -1444,32 +2114,32 @@ int cr_lazy_pages(bool daemon)
 	if (status_ready())
 		return -1;
 
-	/*
-	 * we poll nr_tasks userfault fds, UNIX socket between lazy-pages
-	 * daemon and the cr-restore, and, optionally TCP socket for
-	 * remote pages
-	 */
-	nr_fds = task_entries->nr_tasks + (opts.use_page_server ? 2 : 1);
-	epollfd = epoll_prepare(nr_fds, &events);
-	if (epollfd < 0)
+	if (opts.fault_profile_ms && fault_profile_load())
+		return -1;
+
+	if (init_workers())
 		return -1;
 
-	if (prepare_uffds(lazy_sk, epollfd)) {
-		xfree(events);
+	if (prepare_uffds(lazy_sk)) {
+		fini_workers();
 		return -1;
 	}
 
 	if (opts.use_page_server) {
-		if (connect_to_page_server_to_recv(epollfd)) {
-			xfree(events);
+		if (connect_to_page_server_to_recv(workers[0].epollfd)) {
+			fini_workers();
 			return -1;
 		}
 	}
 
-	ret = handle_requests(epollfd, &events, nr_fds);
+	ret = run_workers();
+
+	if (fp_recording)
+		fault_profile_write();
+	xfree(fp_recs);
 
 	disconnect_from_page_server();
 
-	xfree(events);
+	fini_workers();
 	return ret;
 }
@@ -0,0 +1 @@
+#include "apparmor.pb-c.h"
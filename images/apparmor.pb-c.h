@@ -0,0 +1,46 @@
+#ifndef __APPARMOR_PB_C_H__
+#define __APPARMOR_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _AaPolicy AaPolicy;
+typedef struct _AaNamespace AaNamespace;
+typedef struct _ApparmorEntry ApparmorEntry;
+struct _AaPolicy {
+  ProtobufCMessage base;
+  char * name;
+  ProtobufCBinaryData blob;
+};
+#define AA_POLICY__INIT { PROTOBUF_C_MESSAGE_INIT(&aa_policy__descriptor) }
+void aa_policy__init(AaPolicy *message);
+size_t aa_policy__get_packed_size(const AaPolicy *message);
+size_t aa_policy__pack(const AaPolicy *message, uint8_t *out);
+AaPolicy *aa_policy__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void aa_policy__free_unpacked(AaPolicy *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor aa_policy__descriptor;
+struct _AaNamespace {
+  ProtobufCMessage base;
+  char * name;
+  size_t n_policies;
+  AaPolicy **policies;
+  size_t n_namespaces;
+  AaNamespace **namespaces;
+};
+#define AA_NAMESPACE__INIT { PROTOBUF_C_MESSAGE_INIT(&aa_namespace__descriptor) }
+void aa_namespace__init(AaNamespace *message);
+size_t aa_namespace__get_packed_size(const AaNamespace *message);
+size_t aa_namespace__pack(const AaNamespace *message, uint8_t *out);
+AaNamespace *aa_namespace__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void aa_namespace__free_unpacked(AaNamespace *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor aa_namespace__descriptor;
+struct _ApparmorEntry {
+  ProtobufCMessage base;
+  size_t n_namespaces;
+  AaNamespace **namespaces;
+};
+#define APPARMOR_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&apparmor_entry__descriptor) }
+void apparmor_entry__init(ApparmorEntry *message);
+size_t apparmor_entry__get_packed_size(const ApparmorEntry *message);
+size_t apparmor_entry__pack(const ApparmorEntry *message, uint8_t *out);
+ApparmorEntry *apparmor_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void apparmor_entry__free_unpacked(ApparmorEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor apparmor_entry__descriptor;
+#endif
@@ -0,0 +1 @@
+#include "autofs.pb-c.h"
@@ -0,0 +1,27 @@
+#ifndef __AUTOFS_PB_C_H__
+#define __AUTOFS_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _AutofsEntry AutofsEntry;
+struct _AutofsEntry {
+  ProtobufCMessage base;
+  int32_t fd;
+  int32_t pgrp;
+  int32_t timeout;
+  int32_t minproto;
+  int32_t maxproto;
+  int32_t mode;
+  protobuf_c_boolean has_uid;
+  int32_t uid;
+  protobuf_c_boolean has_gid;
+  int32_t gid;
+  protobuf_c_boolean has_read_fd;
+  int32_t read_fd;
+};
+#define AUTOFS_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&autofs_entry__descriptor) }
+void autofs_entry__init(AutofsEntry *message);
+size_t autofs_entry__get_packed_size(const AutofsEntry *message);
+size_t autofs_entry__pack(const AutofsEntry *message, uint8_t *out);
+AutofsEntry *autofs_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void autofs_entry__free_unpacked(AutofsEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor autofs_entry__descriptor;
+#endif
@@ -0,0 +1 @@
+#include "binfmt-misc.pb-c.h"
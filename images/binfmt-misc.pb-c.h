@@ -0,0 +1,24 @@
+#ifndef __BINFMT_MISC_PB_C_H__
+#define __BINFMT_MISC_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _BinfmtMiscEntry BinfmtMiscEntry;
+struct _BinfmtMiscEntry {
+  ProtobufCMessage base;
+  char * name;
+  protobuf_c_boolean enabled;
+  char * interpreter;
+  char * flags;
+  char * extension;
+  char * magic;
+  char * mask;
+  protobuf_c_boolean has_offset;
+  int32_t offset;
+};
+#define BINFMT_MISC_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&binfmt_misc_entry__descriptor) }
+void binfmt_misc_entry__init(BinfmtMiscEntry *message);
+size_t binfmt_misc_entry__get_packed_size(const BinfmtMiscEntry *message);
+size_t binfmt_misc_entry__pack(const BinfmtMiscEntry *message, uint8_t *out);
+BinfmtMiscEntry *binfmt_misc_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void binfmt_misc_entry__free_unpacked(BinfmtMiscEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor binfmt_misc_entry__descriptor;
+#endif
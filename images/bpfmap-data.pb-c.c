@@ -0,0 +1 @@
+#include "bpfmap-data.pb-c.h"
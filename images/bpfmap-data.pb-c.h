@@ -0,0 +1,19 @@
+#ifndef __BPFMAP_DATA_PB_C_H__
+#define __BPFMAP_DATA_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _BpfmapDataEntry BpfmapDataEntry;
+struct _BpfmapDataEntry {
+  ProtobufCMessage base;
+  uint32_t map_id;
+  uint32_t keys_bytes;
+  uint32_t values_bytes;
+  uint32_t count;
+};
+#define BPFMAP_DATA_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&bpfmap_data_entry__descriptor) }
+void bpfmap_data_entry__init(BpfmapDataEntry *message);
+size_t bpfmap_data_entry__get_packed_size(const BpfmapDataEntry *message);
+size_t bpfmap_data_entry__pack(const BpfmapDataEntry *message, uint8_t *out);
+BpfmapDataEntry *bpfmap_data_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void bpfmap_data_entry__free_unpacked(BpfmapDataEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor bpfmap_data_entry__descriptor;
+#endif
@@ -0,0 +1 @@
+#include "bpfmap-file.pb-c.h"
@@ -0,0 +1,35 @@
+#ifndef __BPFMAP_FILE_PB_C_H__
+#define __BPFMAP_FILE_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+#include "opts.pb-c.h"
+#include "fown.pb-c.h"
+typedef struct _BpfmapFileEntry BpfmapFileEntry;
+struct _BpfmapFileEntry {
+  ProtobufCMessage base;
+  uint32_t id;
+  uint32_t flags;
+  uint64_t pos;
+  FownEntry * fown;
+  uint32_t map_type;
+  uint32_t key_size;
+  uint32_t value_size;
+  uint32_t map_id;
+  uint32_t max_entries;
+  uint32_t map_flags;
+  uint64_t memlock;
+  protobuf_c_boolean frozen;
+  char * map_name;
+  uint32_t ifindex;
+  protobuf_c_boolean has_mnt_id;
+  int32_t mnt_id;
+  protobuf_c_boolean has_map_extra;
+  uint64_t map_extra;
+};
+#define BPFMAP_FILE_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&bpfmap_file_entry__descriptor) }
+void bpfmap_file_entry__init(BpfmapFileEntry *message);
+size_t bpfmap_file_entry__get_packed_size(const BpfmapFileEntry *message);
+size_t bpfmap_file_entry__pack(const BpfmapFileEntry *message, uint8_t *out);
+BpfmapFileEntry *bpfmap_file_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void bpfmap_file_entry__free_unpacked(BpfmapFileEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor bpfmap_file_entry__descriptor;
+#endif
@@ -0,0 +1 @@
+#include "cgroup.pb-c.h"
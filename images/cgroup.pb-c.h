@@ -0,0 +1,110 @@
+#ifndef __CGROUP_PB_C_H__
+#define __CGROUP_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _CgroupPerms CgroupPerms;
+typedef struct _CgroupPropEntry CgroupPropEntry;
+typedef struct _CgroupDirEntry CgroupDirEntry;
+typedef struct _CgControllerEntry CgControllerEntry;
+typedef struct _CgMemberEntry CgMemberEntry;
+typedef struct _CgSetEntry CgSetEntry;
+typedef struct _CgroupEntry CgroupEntry;
+struct _CgroupPerms {
+  ProtobufCMessage base;
+  uint32_t mode;
+  uint32_t uid;
+  uint32_t gid;
+};
+#define CGROUP_PERMS__INIT { PROTOBUF_C_MESSAGE_INIT(&cgroup_perms__descriptor) }
+void cgroup_perms__init(CgroupPerms *message);
+size_t cgroup_perms__get_packed_size(const CgroupPerms *message);
+size_t cgroup_perms__pack(const CgroupPerms *message, uint8_t *out);
+CgroupPerms *cgroup_perms__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void cgroup_perms__free_unpacked(CgroupPerms *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor cgroup_perms__descriptor;
+struct _CgroupPropEntry {
+  ProtobufCMessage base;
+  char * name;
+  char * value;
+  CgroupPerms * perms;
+};
+#define CGROUP_PROP_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&cgroup_prop_entry__descriptor) }
+void cgroup_prop_entry__init(CgroupPropEntry *message);
+size_t cgroup_prop_entry__get_packed_size(const CgroupPropEntry *message);
+size_t cgroup_prop_entry__pack(const CgroupPropEntry *message, uint8_t *out);
+CgroupPropEntry *cgroup_prop_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void cgroup_prop_entry__free_unpacked(CgroupPropEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor cgroup_prop_entry__descriptor;
+struct _CgroupDirEntry {
+  ProtobufCMessage base;
+  char * dir_name;
+  size_t n_children;
+  CgroupDirEntry **children;
+  size_t n_properties;
+  CgroupPropEntry **properties;
+  CgroupPerms * dir_perms;
+};
+#define CGROUP_DIR_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&cgroup_dir_entry__descriptor) }
+void cgroup_dir_entry__init(CgroupDirEntry *message);
+size_t cgroup_dir_entry__get_packed_size(const CgroupDirEntry *message);
+size_t cgroup_dir_entry__pack(const CgroupDirEntry *message, uint8_t *out);
+CgroupDirEntry *cgroup_dir_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void cgroup_dir_entry__free_unpacked(CgroupDirEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor cgroup_dir_entry__descriptor;
+struct _CgControllerEntry {
+  ProtobufCMessage base;
+  size_t n_cnames;
+  char **cnames;
+  size_t n_dirs;
+  CgroupDirEntry **dirs;
+  protobuf_c_boolean has_is_threaded;
+  protobuf_c_boolean is_threaded;
+};
+#define CG_CONTROLLER_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&cg_controller_entry__descriptor) }
+void cg_controller_entry__init(CgControllerEntry *message);
+size_t cg_controller_entry__get_packed_size(const CgControllerEntry *message);
+size_t cg_controller_entry__pack(const CgControllerEntry *message, uint8_t *out);
+CgControllerEntry *cg_controller_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void cg_controller_entry__free_unpacked(CgControllerEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor cg_controller_entry__descriptor;
+struct _CgMemberEntry {
+  ProtobufCMessage base;
+  char * name;
+  char * path;
+  protobuf_c_boolean has_cgns_prefix;
+  uint32_t cgns_prefix;
+};
+#define CG_MEMBER_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&cg_member_entry__descriptor) }
+void cg_member_entry__init(CgMemberEntry *message);
+size_t cg_member_entry__get_packed_size(const CgMemberEntry *message);
+size_t cg_member_entry__pack(const CgMemberEntry *message, uint8_t *out);
+CgMemberEntry *cg_member_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void cg_member_entry__free_unpacked(CgMemberEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor cg_member_entry__descriptor;
+struct _CgSetEntry {
+  ProtobufCMessage base;
+  uint32_t id;
+  size_t n_ctls;
+  CgMemberEntry **ctls;
+};
+#define CG_SET_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&cg_set_entry__descriptor) }
+void cg_set_entry__init(CgSetEntry *message);
+size_t cg_set_entry__get_packed_size(const CgSetEntry *message);
+size_t cg_set_entry__pack(const CgSetEntry *message, uint8_t *out);
+CgSetEntry *cg_set_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void cg_set_entry__free_unpacked(CgSetEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor cg_set_entry__descriptor;
+struct _CgroupEntry {
+  ProtobufCMessage base;
+  size_t n_sets;
+  CgSetEntry **sets;
+  size_t n_controllers;
+  CgControllerEntry **controllers;
+};
+#define CGROUP_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&cgroup_entry__descriptor) }
+void cgroup_entry__init(CgroupEntry *message);
+size_t cgroup_entry__get_packed_size(const CgroupEntry *message);
+size_t cgroup_entry__pack(const CgroupEntry *message, uint8_t *out);
+CgroupEntry *cgroup_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void cgroup_entry__free_unpacked(CgroupEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor cgroup_entry__descriptor;
+#endif
@@ -0,0 +1 @@
+#include "core-aarch64.pb-c.h"
@@ -0,0 +1,51 @@
+#ifndef __CORE_AARCH64_PB_C_H__
+#define __CORE_AARCH64_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+#include "opts.pb-c.h"
+typedef struct _UserAarch64RegsEntry UserAarch64RegsEntry;
+typedef struct _UserAarch64FpsimdContextEntry UserAarch64FpsimdContextEntry;
+typedef struct _ThreadInfoAarch64 ThreadInfoAarch64;
+struct _UserAarch64RegsEntry {
+  ProtobufCMessage base;
+  size_t n_regs;
+  uint64_t *regs;
+  uint64_t sp;
+  uint64_t pc;
+  uint64_t pstate;
+};
+#define USER_AARCH64_REGS_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&user_aarch64_regs_entry__descriptor) }
+void user_aarch64_regs_entry__init(UserAarch64RegsEntry *message);
+size_t user_aarch64_regs_entry__get_packed_size(const UserAarch64RegsEntry *message);
+size_t user_aarch64_regs_entry__pack(const UserAarch64RegsEntry *message, uint8_t *out);
+UserAarch64RegsEntry *user_aarch64_regs_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void user_aarch64_regs_entry__free_unpacked(UserAarch64RegsEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor user_aarch64_regs_entry__descriptor;
+struct _UserAarch64FpsimdContextEntry {
+  ProtobufCMessage base;
+  size_t n_vregs;
+  uint64_t *vregs;
+  uint32_t fpsr;
+  uint32_t fpcr;
+};
+#define USER_AARCH64_FPSIMD_CONTEXT_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&user_aarch64_fpsimd_context_entry__descriptor) }
+void user_aarch64_fpsimd_context_entry__init(UserAarch64FpsimdContextEntry *message);
+size_t user_aarch64_fpsimd_context_entry__get_packed_size(const UserAarch64FpsimdContextEntry *message);
+size_t user_aarch64_fpsimd_context_entry__pack(const UserAarch64FpsimdContextEntry *message, uint8_t *out);
+UserAarch64FpsimdContextEntry *user_aarch64_fpsimd_context_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void user_aarch64_fpsimd_context_entry__free_unpacked(UserAarch64FpsimdContextEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor user_aarch64_fpsimd_context_entry__descriptor;
+struct _ThreadInfoAarch64 {
+  ProtobufCMessage base;
+  uint64_t clear_tid_addr;
+  uint64_t tls;
+  UserAarch64RegsEntry * gpregs;
+  UserAarch64FpsimdContextEntry * fpsimd;
+};
+#define THREAD_INFO_AARCH64__INIT { PROTOBUF_C_MESSAGE_INIT(&thread_info_aarch64__descriptor) }
+void thread_info_aarch64__init(ThreadInfoAarch64 *message);
+size_t thread_info_aarch64__get_packed_size(const ThreadInfoAarch64 *message);
+size_t thread_info_aarch64__pack(const ThreadInfoAarch64 *message, uint8_t *out);
+ThreadInfoAarch64 *thread_info_aarch64__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void thread_info_aarch64__free_unpacked(ThreadInfoAarch64 *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor thread_info_aarch64__descriptor;
+#endif
@@ -0,0 +1 @@
+#include "core-arm.pb-c.h"
@@ -0,0 +1,66 @@
+#ifndef __CORE_ARM_PB_C_H__
+#define __CORE_ARM_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+#include "opts.pb-c.h"
+typedef struct _UserArmRegsEntry UserArmRegsEntry;
+typedef struct _UserArmVfpstateEntry UserArmVfpstateEntry;
+typedef struct _ThreadInfoArm ThreadInfoArm;
+struct _UserArmRegsEntry {
+  ProtobufCMessage base;
+  uint32_t r0;
+  uint32_t r1;
+  uint32_t r2;
+  uint32_t r3;
+  uint32_t r4;
+  uint32_t r5;
+  uint32_t r6;
+  uint32_t r7;
+  uint32_t r8;
+  uint32_t r9;
+  uint32_t r10;
+  uint32_t fp;
+  uint32_t ip;
+  uint32_t sp;
+  uint32_t lr;
+  uint32_t pc;
+  uint32_t cpsr;
+  uint32_t orig_r0;
+};
+#define USER_ARM_REGS_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&user_arm_regs_entry__descriptor) }
+void user_arm_regs_entry__init(UserArmRegsEntry *message);
+size_t user_arm_regs_entry__get_packed_size(const UserArmRegsEntry *message);
+size_t user_arm_regs_entry__pack(const UserArmRegsEntry *message, uint8_t *out);
+UserArmRegsEntry *user_arm_regs_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void user_arm_regs_entry__free_unpacked(UserArmRegsEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor user_arm_regs_entry__descriptor;
+struct _UserArmVfpstateEntry {
+  ProtobufCMessage base;
+  size_t n_vfp_regs;
+  uint64_t *vfp_regs;
+  uint32_t fpscr;
+  uint32_t fpexc;
+  uint32_t fpinst;
+  uint32_t fpinst2;
+};
+#define USER_ARM_VFPSTATE_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&user_arm_vfpstate_entry__descriptor) }
+void user_arm_vfpstate_entry__init(UserArmVfpstateEntry *message);
+size_t user_arm_vfpstate_entry__get_packed_size(const UserArmVfpstateEntry *message);
+size_t user_arm_vfpstate_entry__pack(const UserArmVfpstateEntry *message, uint8_t *out);
+UserArmVfpstateEntry *user_arm_vfpstate_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void user_arm_vfpstate_entry__free_unpacked(UserArmVfpstateEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor user_arm_vfpstate_entry__descriptor;
+struct _ThreadInfoArm {
+  ProtobufCMessage base;
+  uint64_t clear_tid_addr;
+  uint32_t tls;
+  UserArmRegsEntry * gpregs;
+  UserArmVfpstateEntry * fpstate;
+};
+#define THREAD_INFO_ARM__INIT { PROTOBUF_C_MESSAGE_INIT(&thread_info_arm__descriptor) }
+void thread_info_arm__init(ThreadInfoArm *message);
+size_t thread_info_arm__get_packed_size(const ThreadInfoArm *message);
+size_t thread_info_arm__pack(const ThreadInfoArm *message, uint8_t *out);
+ThreadInfoArm *thread_info_arm__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void thread_info_arm__free_unpacked(ThreadInfoArm *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor thread_info_arm__descriptor;
+#endif
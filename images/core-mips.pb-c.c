@@ -0,0 +1 @@
+#include "core-mips.pb-c.h"
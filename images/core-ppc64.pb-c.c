@@ -0,0 +1 @@
+#include "core-ppc64.pb-c.h"
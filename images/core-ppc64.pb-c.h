@@ -0,0 +1,104 @@
+#ifndef __CORE_PPC64_PB_C_H__
+#define __CORE_PPC64_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+#include "opts.pb-c.h"
+typedef struct _UserPpc64RegsEntry UserPpc64RegsEntry;
+typedef struct _UserPpc64FpstateEntry UserPpc64FpstateEntry;
+typedef struct _UserPpc64VrstateEntry UserPpc64VrstateEntry;
+typedef struct _UserPpc64VsxstateEntry UserPpc64VsxstateEntry;
+typedef struct _UserPpc64TmRegsEntry UserPpc64TmRegsEntry;
+typedef struct _ThreadInfoPpc64 ThreadInfoPpc64;
+struct _UserPpc64RegsEntry {
+  ProtobufCMessage base;
+  size_t n_gpr;
+  uint64_t *gpr;
+  uint64_t nip;
+  uint64_t msr;
+  uint64_t orig_gpr3;
+  uint64_t ctr;
+  uint64_t link;
+  uint64_t xer;
+  uint64_t ccr;
+  uint64_t trap;
+  protobuf_c_boolean has_texasr;
+  uint64_t texasr;
+  protobuf_c_boolean has_tfhar;
+  uint64_t tfhar;
+  protobuf_c_boolean has_tfiar;
+  uint64_t tfiar;
+};
+#define USER_PPC64_REGS_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&user_ppc64_regs_entry__descriptor) }
+void user_ppc64_regs_entry__init(UserPpc64RegsEntry *message);
+size_t user_ppc64_regs_entry__get_packed_size(const UserPpc64RegsEntry *message);
+size_t user_ppc64_regs_entry__pack(const UserPpc64RegsEntry *message, uint8_t *out);
+UserPpc64RegsEntry *user_ppc64_regs_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void user_ppc64_regs_entry__free_unpacked(UserPpc64RegsEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor user_ppc64_regs_entry__descriptor;
+struct _UserPpc64FpstateEntry {
+  ProtobufCMessage base;
+  size_t n_fpregs;
+  uint64_t *fpregs;
+};
+#define USER_PPC64_FPSTATE_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&user_ppc64_fpstate_entry__descriptor) }
+void user_ppc64_fpstate_entry__init(UserPpc64FpstateEntry *message);
+size_t user_ppc64_fpstate_entry__get_packed_size(const UserPpc64FpstateEntry *message);
+size_t user_ppc64_fpstate_entry__pack(const UserPpc64FpstateEntry *message, uint8_t *out);
+UserPpc64FpstateEntry *user_ppc64_fpstate_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void user_ppc64_fpstate_entry__free_unpacked(UserPpc64FpstateEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor user_ppc64_fpstate_entry__descriptor;
+struct _UserPpc64VrstateEntry {
+  ProtobufCMessage base;
+  size_t n_vrregs;
+  uint64_t *vrregs;
+  uint32_t vrsave;
+};
+#define USER_PPC64_VRSTATE_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&user_ppc64_vrstate_entry__descriptor) }
+void user_ppc64_vrstate_entry__init(UserPpc64VrstateEntry *message);
+size_t user_ppc64_vrstate_entry__get_packed_size(const UserPpc64VrstateEntry *message);
+size_t user_ppc64_vrstate_entry__pack(const UserPpc64VrstateEntry *message, uint8_t *out);
+UserPpc64VrstateEntry *user_ppc64_vrstate_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void user_ppc64_vrstate_entry__free_unpacked(UserPpc64VrstateEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor user_ppc64_vrstate_entry__descriptor;
+struct _UserPpc64VsxstateEntry {
+  ProtobufCMessage base;
+  size_t n_vsxregs;
+  uint64_t *vsxregs;
+};
+#define USER_PPC64_VSXSTATE_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&user_ppc64_vsxstate_entry__descriptor) }
+void user_ppc64_vsxstate_entry__init(UserPpc64VsxstateEntry *message);
+size_t user_ppc64_vsxstate_entry__get_packed_size(const UserPpc64VsxstateEntry *message);
+size_t user_ppc64_vsxstate_entry__pack(const UserPpc64VsxstateEntry *message, uint8_t *out);
+UserPpc64VsxstateEntry *user_ppc64_vsxstate_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void user_ppc64_vsxstate_entry__free_unpacked(UserPpc64VsxstateEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor user_ppc64_vsxstate_entry__descriptor;
+struct _UserPpc64TmRegsEntry {
+  ProtobufCMessage base;
+  UserPpc64RegsEntry * gpregs;
+  UserPpc64FpstateEntry * fpstate;
+  UserPpc64VrstateEntry * vrstate;
+  UserPpc64VsxstateEntry * vsxstate;
+};
+#define USER_PPC64_TM_REGS_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&user_ppc64_tm_regs_entry__descriptor) }
+void user_ppc64_tm_regs_entry__init(UserPpc64TmRegsEntry *message);
+size_t user_ppc64_tm_regs_entry__get_packed_size(const UserPpc64TmRegsEntry *message);
+size_t user_ppc64_tm_regs_entry__pack(const UserPpc64TmRegsEntry *message, uint8_t *out);
+UserPpc64TmRegsEntry *user_ppc64_tm_regs_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void user_ppc64_tm_regs_entry__free_unpacked(UserPpc64TmRegsEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor user_ppc64_tm_regs_entry__descriptor;
+struct _ThreadInfoPpc64 {
+  ProtobufCMessage base;
+  uint64_t clear_tid_addr;
+  UserPpc64RegsEntry * gpregs;
+  UserPpc64FpstateEntry * fpstate;
+  UserPpc64VrstateEntry * vrstate;
+  UserPpc64VsxstateEntry * vsxstate;
+  UserPpc64TmRegsEntry * tmstate;
+};
+#define THREAD_INFO_PPC64__INIT { PROTOBUF_C_MESSAGE_INIT(&thread_info_ppc64__descriptor) }
+void thread_info_ppc64__init(ThreadInfoPpc64 *message);
+size_t thread_info_ppc64__get_packed_size(const ThreadInfoPpc64 *message);
+size_t thread_info_ppc64__pack(const ThreadInfoPpc64 *message, uint8_t *out);
+ThreadInfoPpc64 *thread_info_ppc64__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void thread_info_ppc64__free_unpacked(ThreadInfoPpc64 *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor thread_info_ppc64__descriptor;
+#endif
@@ -0,0 +1 @@
+#include "core-s390.pb-c.h"
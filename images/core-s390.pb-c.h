@@ -0,0 +1,110 @@
+#ifndef __CORE_S390_PB_C_H__
+#define __CORE_S390_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+#include "opts.pb-c.h"
+typedef struct _UserS390RegsEntry UserS390RegsEntry;
+typedef struct _UserS390VxrsLowEntry UserS390VxrsLowEntry;
+typedef struct _UserS390VxrsHighEntry UserS390VxrsHighEntry;
+typedef struct _UserS390FpregsEntry UserS390FpregsEntry;
+typedef struct _UserS390GsCbEntry UserS390GsCbEntry;
+typedef struct _UserS390RiEntry UserS390RiEntry;
+typedef struct _ThreadInfoS390 ThreadInfoS390;
+struct _UserS390RegsEntry {
+  ProtobufCMessage base;
+  uint64_t psw_mask;
+  uint64_t psw_addr;
+  size_t n_gprs;
+  uint64_t *gprs;
+  size_t n_acrs;
+  uint32_t *acrs;
+  uint64_t orig_gpr2;
+  uint32_t system_call;
+};
+#define USER_S390_REGS_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&user_s390_regs_entry__descriptor) }
+void user_s390_regs_entry__init(UserS390RegsEntry *message);
+size_t user_s390_regs_entry__get_packed_size(const UserS390RegsEntry *message);
+size_t user_s390_regs_entry__pack(const UserS390RegsEntry *message, uint8_t *out);
+UserS390RegsEntry *user_s390_regs_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void user_s390_regs_entry__free_unpacked(UserS390RegsEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor user_s390_regs_entry__descriptor;
+struct _UserS390VxrsLowEntry {
+  ProtobufCMessage base;
+  size_t n_regs;
+  uint64_t *regs;
+};
+#define USER_S390_VXRS_LOW_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&user_s390_vxrs_low_entry__descriptor) }
+void user_s390_vxrs_low_entry__init(UserS390VxrsLowEntry *message);
+size_t user_s390_vxrs_low_entry__get_packed_size(const UserS390VxrsLowEntry *message);
+size_t user_s390_vxrs_low_entry__pack(const UserS390VxrsLowEntry *message, uint8_t *out);
+UserS390VxrsLowEntry *user_s390_vxrs_low_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void user_s390_vxrs_low_entry__free_unpacked(UserS390VxrsLowEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor user_s390_vxrs_low_entry__descriptor;
+struct _UserS390VxrsHighEntry {
+  ProtobufCMessage base;
+  size_t n_regs;
+  uint64_t *regs;
+};
+#define USER_S390_VXRS_HIGH_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&user_s390_vxrs_high_entry__descriptor) }
+void user_s390_vxrs_high_entry__init(UserS390VxrsHighEntry *message);
+size_t user_s390_vxrs_high_entry__get_packed_size(const UserS390VxrsHighEntry *message);
+size_t user_s390_vxrs_high_entry__pack(const UserS390VxrsHighEntry *message, uint8_t *out);
+UserS390VxrsHighEntry *user_s390_vxrs_high_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void user_s390_vxrs_high_entry__free_unpacked(UserS390VxrsHighEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor user_s390_vxrs_high_entry__descriptor;
+struct _UserS390FpregsEntry {
+  ProtobufCMessage base;
+  uint32_t fpc;
+  size_t n_fprs;
+  uint64_t *fprs;
+};
+#define USER_S390_FPREGS_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&user_s390_fpregs_entry__descriptor) }
+void user_s390_fpregs_entry__init(UserS390FpregsEntry *message);
+size_t user_s390_fpregs_entry__get_packed_size(const UserS390FpregsEntry *message);
+size_t user_s390_fpregs_entry__pack(const UserS390FpregsEntry *message, uint8_t *out);
+UserS390FpregsEntry *user_s390_fpregs_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void user_s390_fpregs_entry__free_unpacked(UserS390FpregsEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor user_s390_fpregs_entry__descriptor;
+struct _UserS390GsCbEntry {
+  ProtobufCMessage base;
+  size_t n_regs;
+  uint64_t *regs;
+};
+#define USER_S390_GS_CB_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&user_s390_gs_cb_entry__descriptor) }
+void user_s390_gs_cb_entry__init(UserS390GsCbEntry *message);
+size_t user_s390_gs_cb_entry__get_packed_size(const UserS390GsCbEntry *message);
+size_t user_s390_gs_cb_entry__pack(const UserS390GsCbEntry *message, uint8_t *out);
+UserS390GsCbEntry *user_s390_gs_cb_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void user_s390_gs_cb_entry__free_unpacked(UserS390GsCbEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor user_s390_gs_cb_entry__descriptor;
+struct _UserS390RiEntry {
+  ProtobufCMessage base;
+  uint32_t ri_on;
+  size_t n_regs;
+  uint64_t *regs;
+};
+#define USER_S390_RI_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&user_s390_ri_entry__descriptor) }
+void user_s390_ri_entry__init(UserS390RiEntry *message);
+size_t user_s390_ri_entry__get_packed_size(const UserS390RiEntry *message);
+size_t user_s390_ri_entry__pack(const UserS390RiEntry *message, uint8_t *out);
+UserS390RiEntry *user_s390_ri_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void user_s390_ri_entry__free_unpacked(UserS390RiEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor user_s390_ri_entry__descriptor;
+struct _ThreadInfoS390 {
+  ProtobufCMessage base;
+  uint64_t clear_tid_addr;
+  UserS390RegsEntry * gpregs;
+  UserS390FpregsEntry * fpregs;
+  UserS390VxrsLowEntry * vxrs_low;
+  UserS390VxrsHighEntry * vxrs_high;
+  UserS390GsCbEntry * gs_cb;
+  UserS390GsCbEntry * gs_bc;
+  UserS390RiEntry * ri_cb;
+};
+#define THREAD_INFO_S390__INIT { PROTOBUF_C_MESSAGE_INIT(&thread_info_s390__descriptor) }
+void thread_info_s390__init(ThreadInfoS390 *message);
+size_t thread_info_s390__get_packed_size(const ThreadInfoS390 *message);
+size_t thread_info_s390__pack(const ThreadInfoS390 *message, uint8_t *out);
+ThreadInfoS390 *thread_info_s390__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void thread_info_s390__free_unpacked(ThreadInfoS390 *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor thread_info_s390__descriptor;
+#endif
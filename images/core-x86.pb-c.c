@@ -0,0 +1 @@
+#include "core-x86.pb-c.h"
@@ -0,0 +1 @@
+#include "core.pb-c.h"
@@ -0,0 +1 @@
+#include "cpuinfo.pb-c.h"
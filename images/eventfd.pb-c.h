@@ -0,0 +1,20 @@
+#ifndef __EVENTFD_PB_C_H__
+#define __EVENTFD_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+#include "fown.pb-c.h"
+typedef struct _EventfdFileEntry EventfdFileEntry;
+struct _EventfdFileEntry {
+  ProtobufCMessage base;
+  uint32_t id;
+  uint32_t flags;
+  FownEntry * fown;
+  uint64_t counter;
+};
+#define EVENTFD_FILE_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&eventfd_file_entry__descriptor) }
+void eventfd_file_entry__init(EventfdFileEntry *message);
+size_t eventfd_file_entry__get_packed_size(const EventfdFileEntry *message);
+size_t eventfd_file_entry__pack(const EventfdFileEntry *message, uint8_t *out);
+EventfdFileEntry *eventfd_file_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void eventfd_file_entry__free_unpacked(EventfdFileEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor eventfd_file_entry__descriptor;
+#endif
@@ -0,0 +1,42 @@
+#ifndef __EVENTPOLL_PB_C_H__
+#define __EVENTPOLL_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+#include "fown.pb-c.h"
+typedef struct _EventpollTfdEntry EventpollTfdEntry;
+typedef struct _EventpollFileEntry EventpollFileEntry;
+struct _EventpollTfdEntry {
+  ProtobufCMessage base;
+  uint32_t id;
+  uint32_t tfd;
+  uint32_t events;
+  uint64_t data;
+  protobuf_c_boolean has_dev;
+  uint32_t dev;
+  protobuf_c_boolean has_inode;
+  uint64_t inode;
+  protobuf_c_boolean has_pos;
+  uint64_t pos;
+};
+#define EVENTPOLL_TFD_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&eventpoll_tfd_entry__descriptor) }
+void eventpoll_tfd_entry__init(EventpollTfdEntry *message);
+size_t eventpoll_tfd_entry__get_packed_size(const EventpollTfdEntry *message);
+size_t eventpoll_tfd_entry__pack(const EventpollTfdEntry *message, uint8_t *out);
+EventpollTfdEntry *eventpoll_tfd_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void eventpoll_tfd_entry__free_unpacked(EventpollTfdEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor eventpoll_tfd_entry__descriptor;
+struct _EventpollFileEntry {
+  ProtobufCMessage base;
+  uint32_t id;
+  uint32_t flags;
+  FownEntry * fown;
+  size_t n_tfd;
+  EventpollTfdEntry **tfd;
+};
+#define EVENTPOLL_FILE_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&eventpoll_file_entry__descriptor) }
+void eventpoll_file_entry__init(EventpollFileEntry *message);
+size_t eventpoll_file_entry__get_packed_size(const EventpollFileEntry *message);
+size_t eventpoll_file_entry__pack(const EventpollFileEntry *message, uint8_t *out);
+EventpollFileEntry *eventpoll_file_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void eventpoll_file_entry__free_unpacked(EventpollFileEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor eventpoll_file_entry__descriptor;
+#endif
@@ -0,0 +1,18 @@
+#ifndef __EXT_FILE_PB_C_H__
+#define __EXT_FILE_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+#include "fown.pb-c.h"
+typedef struct _ExtFileEntry ExtFileEntry;
+struct _ExtFileEntry {
+  ProtobufCMessage base;
+  uint32_t id;
+  FownEntry * fown;
+};
+#define EXT_FILE_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&ext_file_entry__descriptor) }
+void ext_file_entry__init(ExtFileEntry *message);
+size_t ext_file_entry__get_packed_size(const ExtFileEntry *message);
+size_t ext_file_entry__pack(const ExtFileEntry *message, uint8_t *out);
+ExtFileEntry *ext_file_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void ext_file_entry__free_unpacked(ExtFileEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor ext_file_entry__descriptor;
+#endif
@@ -0,0 +1 @@
+#include "fh.pb-c.h"
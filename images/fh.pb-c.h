@@ -0,0 +1,41 @@
+#ifndef __FH_PB_C_H__
+#define __FH_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+#include "opts.pb-c.h"
+typedef struct _FhEntry FhEntry;
+typedef struct _IrmapCacheEntry IrmapCacheEntry;
+typedef enum _FhEntrySizes {
+  FH_ENTRY_SIZES__min_entries = 16,
+} FhEntrySizes;
+extern const ProtobufCEnumDescriptor fh_entry_sizes__descriptor;
+struct _FhEntry {
+  ProtobufCMessage base;
+  uint32_t bytes;
+  uint32_t type;
+  size_t n_handle;
+  uint64_t *handle;
+  char * path;
+  protobuf_c_boolean has_mnt_id;
+  uint32_t mnt_id;
+};
+#define FH_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&fh_entry__descriptor) }
+void fh_entry__init(FhEntry *message);
+size_t fh_entry__get_packed_size(const FhEntry *message);
+size_t fh_entry__pack(const FhEntry *message, uint8_t *out);
+FhEntry *fh_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void fh_entry__free_unpacked(FhEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor fh_entry__descriptor;
+struct _IrmapCacheEntry {
+  ProtobufCMessage base;
+  uint32_t dev;
+  uint64_t inode;
+  char * path;
+};
+#define IRMAP_CACHE_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&irmap_cache_entry__descriptor) }
+void irmap_cache_entry__init(IrmapCacheEntry *message);
+size_t irmap_cache_entry__get_packed_size(const IrmapCacheEntry *message);
+size_t irmap_cache_entry__pack(const IrmapCacheEntry *message, uint8_t *out);
+IrmapCacheEntry *irmap_cache_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void irmap_cache_entry__free_unpacked(IrmapCacheEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor irmap_cache_entry__descriptor;
+#endif
@@ -0,0 +1 @@
+#include "fifo.pb-c.h"
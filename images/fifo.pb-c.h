@@ -0,0 +1,19 @@
+#ifndef __FIFO_PB_C_H__
+#define __FIFO_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _FifoEntry FifoEntry;
+struct _FifoEntry {
+  ProtobufCMessage base;
+  uint32_t id;
+  uint32_t pipe_id;
+  protobuf_c_boolean has_regf_id;
+  uint32_t regf_id;
+};
+#define FIFO_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&fifo_entry__descriptor) }
+void fifo_entry__init(FifoEntry *message);
+size_t fifo_entry__get_packed_size(const FifoEntry *message);
+size_t fifo_entry__pack(const FifoEntry *message, uint8_t *out);
+FifoEntry *fifo_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void fifo_entry__free_unpacked(FifoEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor fifo_entry__descriptor;
+#endif
@@ -0,0 +1,21 @@
+#ifndef __FILE_LOCK_PB_C_H__
+#define __FILE_LOCK_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _FileLockEntry FileLockEntry;
+struct _FileLockEntry {
+  ProtobufCMessage base;
+  uint32_t flag;
+  uint32_t type;
+  int32_t pid;
+  int32_t fd;
+  int64_t start;
+  int64_t len;
+};
+#define FILE_LOCK_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&file_lock_entry__descriptor) }
+void file_lock_entry__init(FileLockEntry *message);
+size_t file_lock_entry__get_packed_size(const FileLockEntry *message);
+size_t file_lock_entry__pack(const FileLockEntry *message, uint8_t *out);
+FileLockEntry *file_lock_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void file_lock_entry__free_unpacked(FileLockEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor file_lock_entry__descriptor;
+#endif
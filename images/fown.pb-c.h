@@ -0,0 +1,20 @@
+#ifndef __FOWN_PB_C_H__
+#define __FOWN_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _FownEntry FownEntry;
+struct _FownEntry {
+  ProtobufCMessage base;
+  uint32_t uid;
+  uint32_t euid;
+  uint32_t signum;
+  uint32_t pid_type;
+  uint32_t pid;
+};
+#define FOWN_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&fown_entry__descriptor) }
+void fown_entry__init(FownEntry *message);
+size_t fown_entry__get_packed_size(const FownEntry *message);
+size_t fown_entry__pack(const FownEntry *message, uint8_t *out);
+FownEntry *fown_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void fown_entry__free_unpacked(FownEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor fown_entry__descriptor;
+#endif
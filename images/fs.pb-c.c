@@ -0,0 +1 @@
+#include "fs.pb-c.h"
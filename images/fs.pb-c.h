@@ -0,0 +1,19 @@
+#ifndef __FS_PB_C_H__
+#define __FS_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _FsEntry FsEntry;
+struct _FsEntry {
+  ProtobufCMessage base;
+  uint32_t cwd_id;
+  uint32_t root_id;
+  protobuf_c_boolean has_umask;
+  uint32_t umask;
+};
+#define FS_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&fs_entry__descriptor) }
+void fs_entry__init(FsEntry *message);
+size_t fs_entry__get_packed_size(const FsEntry *message);
+size_t fs_entry__pack(const FsEntry *message, uint8_t *out);
+FsEntry *fs_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void fs_entry__free_unpacked(FsEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor fs_entry__descriptor;
+#endif
@@ -0,0 +1 @@
+#include "ghost-file.pb-c.h"
@@ -0,0 +1,46 @@
+#ifndef __GHOST_FILE_PB_C_H__
+#define __GHOST_FILE_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+#include "opts.pb-c.h"
+#include "time.pb-c.h"
+typedef struct _GhostFileEntry GhostFileEntry;
+typedef struct _GhostChunkEntry GhostChunkEntry;
+struct _GhostFileEntry {
+  ProtobufCMessage base;
+  uint32_t uid;
+  uint32_t gid;
+  uint32_t mode;
+  protobuf_c_boolean has_dev;
+  uint32_t dev;
+  protobuf_c_boolean has_ino;
+  uint64_t ino;
+  protobuf_c_boolean has_rdev;
+  uint32_t rdev;
+  Timeval * atim;
+  Timeval * mtim;
+  protobuf_c_boolean has_chunks;
+  protobuf_c_boolean chunks;
+  protobuf_c_boolean has_size;
+  uint64_t size;
+  char * symlnk_target;
+};
+#define GHOST_FILE_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&ghost_file_entry__descriptor) }
+void ghost_file_entry__init(GhostFileEntry *message);
+size_t ghost_file_entry__get_packed_size(const GhostFileEntry *message);
+size_t ghost_file_entry__pack(const GhostFileEntry *message, uint8_t *out);
+GhostFileEntry *ghost_file_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void ghost_file_entry__free_unpacked(GhostFileEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor ghost_file_entry__descriptor;
+struct _GhostChunkEntry {
+  ProtobufCMessage base;
+  uint64_t len;
+  uint64_t off;
+};
+#define GHOST_CHUNK_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&ghost_chunk_entry__descriptor) }
+void ghost_chunk_entry__init(GhostChunkEntry *message);
+size_t ghost_chunk_entry__get_packed_size(const GhostChunkEntry *message);
+size_t ghost_chunk_entry__pack(const GhostChunkEntry *message, uint8_t *out);
+GhostChunkEntry *ghost_chunk_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void ghost_chunk_entry__free_unpacked(GhostChunkEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor ghost_chunk_entry__descriptor;
+#endif
@@ -0,0 +1 @@
+#include "descriptor.pb-c.h"
@@ -0,0 +1,561 @@
+#ifndef __GOOGLE_PROTOBUF_DESCRIPTOR_PB_C_H__
+#define __GOOGLE_PROTOBUF_DESCRIPTOR_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _FileDescriptorSet FileDescriptorSet;
+typedef struct _FileDescriptorProto FileDescriptorProto;
+typedef struct _DescriptorProto__ExtensionRange DescriptorProto__ExtensionRange;
+typedef struct _DescriptorProto__ReservedRange DescriptorProto__ReservedRange;
+typedef struct _DescriptorProto DescriptorProto;
+typedef struct _ExtensionRangeOptions ExtensionRangeOptions;
+typedef struct _FieldDescriptorProto FieldDescriptorProto;
+typedef struct _OneofDescriptorProto OneofDescriptorProto;
+typedef struct _EnumDescriptorProto__EnumReservedRange EnumDescriptorProto__EnumReservedRange;
+typedef struct _EnumDescriptorProto EnumDescriptorProto;
+typedef struct _EnumValueDescriptorProto EnumValueDescriptorProto;
+typedef struct _ServiceDescriptorProto ServiceDescriptorProto;
+typedef struct _MethodDescriptorProto MethodDescriptorProto;
+typedef struct _FileOptions FileOptions;
+typedef struct _MessageOptions MessageOptions;
+typedef struct _FieldOptions FieldOptions;
+typedef struct _OneofOptions OneofOptions;
+typedef struct _EnumOptions EnumOptions;
+typedef struct _EnumValueOptions EnumValueOptions;
+typedef struct _ServiceOptions ServiceOptions;
+typedef struct _MethodOptions MethodOptions;
+typedef struct _UninterpretedOption__NamePart UninterpretedOption__NamePart;
+typedef struct _UninterpretedOption UninterpretedOption;
+typedef struct _SourceCodeInfo__Location SourceCodeInfo__Location;
+typedef struct _SourceCodeInfo SourceCodeInfo;
+typedef struct _GeneratedCodeInfo__Annotation GeneratedCodeInfo__Annotation;
+typedef struct _GeneratedCodeInfo GeneratedCodeInfo;
+typedef enum _FieldDescriptorProto__Type {
+  FIELDDESCRIPTORPROTO__TYPE__TYPE_DOUBLE = 1,
+  FIELDDESCRIPTORPROTO__TYPE__TYPE_FLOAT = 2,
+  FIELDDESCRIPTORPROTO__TYPE__TYPE_INT64 = 3,
+  FIELDDESCRIPTORPROTO__TYPE__TYPE_UINT64 = 4,
+  FIELDDESCRIPTORPROTO__TYPE__TYPE_INT32 = 5,
+  FIELDDESCRIPTORPROTO__TYPE__TYPE_FIXED64 = 6,
+  FIELDDESCRIPTORPROTO__TYPE__TYPE_FIXED32 = 7,
+  FIELDDESCRIPTORPROTO__TYPE__TYPE_BOOL = 8,
+  FIELDDESCRIPTORPROTO__TYPE__TYPE_STRING = 9,
+  FIELDDESCRIPTORPROTO__TYPE__TYPE_GROUP = 10,
+  FIELDDESCRIPTORPROTO__TYPE__TYPE_MESSAGE = 11,
+  FIELDDESCRIPTORPROTO__TYPE__TYPE_BYTES = 12,
+  FIELDDESCRIPTORPROTO__TYPE__TYPE_UINT32 = 13,
+  FIELDDESCRIPTORPROTO__TYPE__TYPE_ENUM = 14,
+  FIELDDESCRIPTORPROTO__TYPE__TYPE_SFIXED32 = 15,
+  FIELDDESCRIPTORPROTO__TYPE__TYPE_SFIXED64 = 16,
+  FIELDDESCRIPTORPROTO__TYPE__TYPE_SINT32 = 17,
+  FIELDDESCRIPTORPROTO__TYPE__TYPE_SINT64 = 18,
+} FieldDescriptorProto__Type;
+extern const ProtobufCEnumDescriptor fielddescriptorproto__type__descriptor;
+typedef enum _FieldDescriptorProto__Label {
+  FIELDDESCRIPTORPROTO__LABEL__LABEL_OPTIONAL = 1,
+  FIELDDESCRIPTORPROTO__LABEL__LABEL_REQUIRED = 2,
+  FIELDDESCRIPTORPROTO__LABEL__LABEL_REPEATED = 3,
+} FieldDescriptorProto__Label;
+extern const ProtobufCEnumDescriptor fielddescriptorproto__label__descriptor;
+typedef enum _FileOptions__OptimizeMode {
+  FILEOPTIONS__OPTIMIZEMODE__SPEED = 1,
+  FILEOPTIONS__OPTIMIZEMODE__CODE_SIZE = 2,
+  FILEOPTIONS__OPTIMIZEMODE__LITE_RUNTIME = 3,
+} FileOptions__OptimizeMode;
+extern const ProtobufCEnumDescriptor fileoptions__optimizemode__descriptor;
+typedef enum _FieldOptions__CType {
+  FIELDOPTIONS__CTYPE__STRING = 0,
+  FIELDOPTIONS__CTYPE__CORD = 1,
+  FIELDOPTIONS__CTYPE__STRING_PIECE = 2,
+} FieldOptions__CType;
+extern const ProtobufCEnumDescriptor fieldoptions__ctype__descriptor;
+typedef enum _FieldOptions__JSType {
+  FIELDOPTIONS__JSTYPE__JS_NORMAL = 0,
+  FIELDOPTIONS__JSTYPE__JS_STRING = 1,
+  FIELDOPTIONS__JSTYPE__JS_NUMBER = 2,
+} FieldOptions__JSType;
+extern const ProtobufCEnumDescriptor fieldoptions__jstype__descriptor;
+typedef enum _MethodOptions__IdempotencyLevel {
+  METHODOPTIONS__IDEMPOTENCYLEVEL__IDEMPOTENCY_UNKNOWN = 0,
+  METHODOPTIONS__IDEMPOTENCYLEVEL__NO_SIDE_EFFECTS = 1,
+  METHODOPTIONS__IDEMPOTENCYLEVEL__IDEMPOTENT = 2,
+} MethodOptions__IdempotencyLevel;
+extern const ProtobufCEnumDescriptor methodoptions__idempotencylevel__descriptor;
+struct _FileDescriptorSet {
+  ProtobufCMessage base;
+  size_t n_file;
+  FileDescriptorProto **file;
+};
+#define FILEDESCRIPTORSET__INIT { PROTOBUF_C_MESSAGE_INIT(&filedescriptorset__descriptor) }
+void filedescriptorset__init(FileDescriptorSet *message);
+size_t filedescriptorset__get_packed_size(const FileDescriptorSet *message);
+size_t filedescriptorset__pack(const FileDescriptorSet *message, uint8_t *out);
+FileDescriptorSet *filedescriptorset__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void filedescriptorset__free_unpacked(FileDescriptorSet *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor filedescriptorset__descriptor;
+struct _FileDescriptorProto {
+  ProtobufCMessage base;
+  char * name;
+  char * package;
+  size_t n_dependency;
+  char **dependency;
+  size_t n_public_dependency;
+  int32_t *public_dependency;
+  size_t n_weak_dependency;
+  int32_t *weak_dependency;
+  size_t n_message_type;
+  DescriptorProto **message_type;
+  size_t n_enum_type;
+  EnumDescriptorProto **enum_type;
+  size_t n_service;
+  ServiceDescriptorProto **service;
+  size_t n_extension;
+  FieldDescriptorProto **extension;
+  FileOptions * options;
+  SourceCodeInfo * source_code_info;
+  char * syntax;
+};
+#define FILEDESCRIPTORPROTO__INIT { PROTOBUF_C_MESSAGE_INIT(&filedescriptorproto__descriptor) }
+void filedescriptorproto__init(FileDescriptorProto *message);
+size_t filedescriptorproto__get_packed_size(const FileDescriptorProto *message);
+size_t filedescriptorproto__pack(const FileDescriptorProto *message, uint8_t *out);
+FileDescriptorProto *filedescriptorproto__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void filedescriptorproto__free_unpacked(FileDescriptorProto *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor filedescriptorproto__descriptor;
+struct _DescriptorProto__ExtensionRange {
+  ProtobufCMessage base;
+  protobuf_c_boolean has_start;
+  int32_t start;
+  protobuf_c_boolean has_end;
+  int32_t end;
+  ExtensionRangeOptions * options;
+};
+#define DESCRIPTORPROTO__EXTENSIONRANGE__INIT { PROTOBUF_C_MESSAGE_INIT(&descriptorproto__extensionrange__descriptor) }
+void descriptorproto__extensionrange__init(DescriptorProto__ExtensionRange *message);
+size_t descriptorproto__extensionrange__get_packed_size(const DescriptorProto__ExtensionRange *message);
+size_t descriptorproto__extensionrange__pack(const DescriptorProto__ExtensionRange *message, uint8_t *out);
+DescriptorProto__ExtensionRange *descriptorproto__extensionrange__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void descriptorproto__extensionrange__free_unpacked(DescriptorProto__ExtensionRange *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor descriptorproto__extensionrange__descriptor;
+struct _DescriptorProto__ReservedRange {
+  ProtobufCMessage base;
+  protobuf_c_boolean has_start;
+  int32_t start;
+  protobuf_c_boolean has_end;
+  int32_t end;
+};
+#define DESCRIPTORPROTO__RESERVEDRANGE__INIT { PROTOBUF_C_MESSAGE_INIT(&descriptorproto__reservedrange__descriptor) }
+void descriptorproto__reservedrange__init(DescriptorProto__ReservedRange *message);
+size_t descriptorproto__reservedrange__get_packed_size(const DescriptorProto__ReservedRange *message);
+size_t descriptorproto__reservedrange__pack(const DescriptorProto__ReservedRange *message, uint8_t *out);
+DescriptorProto__ReservedRange *descriptorproto__reservedrange__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void descriptorproto__reservedrange__free_unpacked(DescriptorProto__ReservedRange *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor descriptorproto__reservedrange__descriptor;
+struct _DescriptorProto {
+  ProtobufCMessage base;
+  char * name;
+  size_t n_field;
+  FieldDescriptorProto **field;
+  size_t n_extension;
+  FieldDescriptorProto **extension;
+  size_t n_nested_type;
+  DescriptorProto **nested_type;
+  size_t n_enum_type;
+  EnumDescriptorProto **enum_type;
+  size_t n_extension_range;
+  DescriptorProto__ExtensionRange **extension_range;
+  size_t n_oneof_decl;
+  OneofDescriptorProto **oneof_decl;
+  MessageOptions * options;
+  size_t n_reserved_range;
+  DescriptorProto__ReservedRange **reserved_range;
+  size_t n_reserved_name;
+  char **reserved_name;
+};
+#define DESCRIPTORPROTO__INIT { PROTOBUF_C_MESSAGE_INIT(&descriptorproto__descriptor) }
+void descriptorproto__init(DescriptorProto *message);
+size_t descriptorproto__get_packed_size(const DescriptorProto *message);
+size_t descriptorproto__pack(const DescriptorProto *message, uint8_t *out);
+DescriptorProto *descriptorproto__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void descriptorproto__free_unpacked(DescriptorProto *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor descriptorproto__descriptor;
+struct _ExtensionRangeOptions {
+  ProtobufCMessage base;
+  size_t n_uninterpreted_option;
+  UninterpretedOption **uninterpreted_option;
+};
+#define EXTENSIONRANGEOPTIONS__INIT { PROTOBUF_C_MESSAGE_INIT(&extensionrangeoptions__descriptor) }
+void extensionrangeoptions__init(ExtensionRangeOptions *message);
+size_t extensionrangeoptions__get_packed_size(const ExtensionRangeOptions *message);
+size_t extensionrangeoptions__pack(const ExtensionRangeOptions *message, uint8_t *out);
+ExtensionRangeOptions *extensionrangeoptions__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void extensionrangeoptions__free_unpacked(ExtensionRangeOptions *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor extensionrangeoptions__descriptor;
+struct _FieldDescriptorProto {
+  ProtobufCMessage base;
+  char * name;
+  protobuf_c_boolean has_number;
+  int32_t number;
+  protobuf_c_boolean has_label;
+  FieldDescriptorProto__Label label;
+  protobuf_c_boolean has_type;
+  FieldDescriptorProto__Type type;
+  char * type_name;
+  char * extendee;
+  char * default_value;
+  protobuf_c_boolean has_oneof_index;
+  int32_t oneof_index;
+  char * json_name;
+  FieldOptions * options;
+  protobuf_c_boolean has_proto3_optional;
+  protobuf_c_boolean proto3_optional;
+};
+#define FIELDDESCRIPTORPROTO__INIT { PROTOBUF_C_MESSAGE_INIT(&fielddescriptorproto__descriptor) }
+void fielddescriptorproto__init(FieldDescriptorProto *message);
+size_t fielddescriptorproto__get_packed_size(const FieldDescriptorProto *message);
+size_t fielddescriptorproto__pack(const FieldDescriptorProto *message, uint8_t *out);
+FieldDescriptorProto *fielddescriptorproto__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void fielddescriptorproto__free_unpacked(FieldDescriptorProto *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor fielddescriptorproto__descriptor;
+struct _OneofDescriptorProto {
+  ProtobufCMessage base;
+  char * name;
+  OneofOptions * options;
+};
+#define ONEOFDESCRIPTORPROTO__INIT { PROTOBUF_C_MESSAGE_INIT(&oneofdescriptorproto__descriptor) }
+void oneofdescriptorproto__init(OneofDescriptorProto *message);
+size_t oneofdescriptorproto__get_packed_size(const OneofDescriptorProto *message);
+size_t oneofdescriptorproto__pack(const OneofDescriptorProto *message, uint8_t *out);
+OneofDescriptorProto *oneofdescriptorproto__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void oneofdescriptorproto__free_unpacked(OneofDescriptorProto *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor oneofdescriptorproto__descriptor;
+struct _EnumDescriptorProto__EnumReservedRange {
+  ProtobufCMessage base;
+  protobuf_c_boolean has_start;
+  int32_t start;
+  protobuf_c_boolean has_end;
+  int32_t end;
+};
+#define ENUMDESCRIPTORPROTO__ENUMRESERVEDRANGE__INIT { PROTOBUF_C_MESSAGE_INIT(&enumdescriptorproto__enumreservedrange__descriptor) }
+void enumdescriptorproto__enumreservedrange__init(EnumDescriptorProto__EnumReservedRange *message);
+size_t enumdescriptorproto__enumreservedrange__get_packed_size(const EnumDescriptorProto__EnumReservedRange *message);
+size_t enumdescriptorproto__enumreservedrange__pack(const EnumDescriptorProto__EnumReservedRange *message, uint8_t *out);
+EnumDescriptorProto__EnumReservedRange *enumdescriptorproto__enumreservedrange__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void enumdescriptorproto__enumreservedrange__free_unpacked(EnumDescriptorProto__EnumReservedRange *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor enumdescriptorproto__enumreservedrange__descriptor;
+struct _EnumDescriptorProto {
+  ProtobufCMessage base;
+  char * name;
+  size_t n_value;
+  EnumValueDescriptorProto **value;
+  EnumOptions * options;
+  size_t n_reserved_range;
+  EnumDescriptorProto__EnumReservedRange **reserved_range;
+  size_t n_reserved_name;
+  char **reserved_name;
+};
+#define ENUMDESCRIPTORPROTO__INIT { PROTOBUF_C_MESSAGE_INIT(&enumdescriptorproto__descriptor) }
+void enumdescriptorproto__init(EnumDescriptorProto *message);
+size_t enumdescriptorproto__get_packed_size(const EnumDescriptorProto *message);
+size_t enumdescriptorproto__pack(const EnumDescriptorProto *message, uint8_t *out);
+EnumDescriptorProto *enumdescriptorproto__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void enumdescriptorproto__free_unpacked(EnumDescriptorProto *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor enumdescriptorproto__descriptor;
+struct _EnumValueDescriptorProto {
+  ProtobufCMessage base;
+  char * name;
+  protobuf_c_boolean has_number;
+  int32_t number;
+  EnumValueOptions * options;
+};
+#define ENUMVALUEDESCRIPTORPROTO__INIT { PROTOBUF_C_MESSAGE_INIT(&enumvaluedescriptorproto__descriptor) }
+void enumvaluedescriptorproto__init(EnumValueDescriptorProto *message);
+size_t enumvaluedescriptorproto__get_packed_size(const EnumValueDescriptorProto *message);
+size_t enumvaluedescriptorproto__pack(const EnumValueDescriptorProto *message, uint8_t *out);
+EnumValueDescriptorProto *enumvaluedescriptorproto__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void enumvaluedescriptorproto__free_unpacked(EnumValueDescriptorProto *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor enumvaluedescriptorproto__descriptor;
+struct _ServiceDescriptorProto {
+  ProtobufCMessage base;
+  char * name;
+  size_t n_method;
+  MethodDescriptorProto **method;
+  ServiceOptions * options;
+};
+#define SERVICEDESCRIPTORPROTO__INIT { PROTOBUF_C_MESSAGE_INIT(&servicedescriptorproto__descriptor) }
+void servicedescriptorproto__init(ServiceDescriptorProto *message);
+size_t servicedescriptorproto__get_packed_size(const ServiceDescriptorProto *message);
+size_t servicedescriptorproto__pack(const ServiceDescriptorProto *message, uint8_t *out);
+ServiceDescriptorProto *servicedescriptorproto__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void servicedescriptorproto__free_unpacked(ServiceDescriptorProto *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor servicedescriptorproto__descriptor;
+struct _MethodDescriptorProto {
+  ProtobufCMessage base;
+  char * name;
+  char * input_type;
+  char * output_type;
+  MethodOptions * options;
+  protobuf_c_boolean has_client_streaming;
+  protobuf_c_boolean client_streaming;
+  protobuf_c_boolean has_server_streaming;
+  protobuf_c_boolean server_streaming;
+};
+#define METHODDESCRIPTORPROTO__INIT { PROTOBUF_C_MESSAGE_INIT(&methoddescriptorproto__descriptor) }
+void methoddescriptorproto__init(MethodDescriptorProto *message);
+size_t methoddescriptorproto__get_packed_size(const MethodDescriptorProto *message);
+size_t methoddescriptorproto__pack(const MethodDescriptorProto *message, uint8_t *out);
+MethodDescriptorProto *methoddescriptorproto__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void methoddescriptorproto__free_unpacked(MethodDescriptorProto *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor methoddescriptorproto__descriptor;
+struct _FileOptions {
+  ProtobufCMessage base;
+  char * java_package;
+  char * java_outer_classname;
+  protobuf_c_boolean has_java_multiple_files;
+  protobuf_c_boolean java_multiple_files;
+  protobuf_c_boolean has_java_generate_equals_and_hash;
+  protobuf_c_boolean java_generate_equals_and_hash;
+  protobuf_c_boolean has_java_string_check_utf8;
+  protobuf_c_boolean java_string_check_utf8;
+  protobuf_c_boolean has_optimize_for;
+  FileOptions__OptimizeMode optimize_for;
+  char * go_package;
+  protobuf_c_boolean has_cc_generic_services;
+  protobuf_c_boolean cc_generic_services;
+  protobuf_c_boolean has_java_generic_services;
+  protobuf_c_boolean java_generic_services;
+  protobuf_c_boolean has_py_generic_services;
+  protobuf_c_boolean py_generic_services;
+  protobuf_c_boolean has_php_generic_services;
+  protobuf_c_boolean php_generic_services;
+  protobuf_c_boolean has_deprecated;
+  protobuf_c_boolean deprecated;
+  protobuf_c_boolean has_cc_enable_arenas;
+  protobuf_c_boolean cc_enable_arenas;
+  char * objc_class_prefix;
+  char * csharp_namespace;
+  char * swift_prefix;
+  char * php_class_prefix;
+  char * php_namespace;
+  char * php_metadata_namespace;
+  char * ruby_package;
+  size_t n_uninterpreted_option;
+  UninterpretedOption **uninterpreted_option;
+};
+#define FILEOPTIONS__INIT { PROTOBUF_C_MESSAGE_INIT(&fileoptions__descriptor) }
+void fileoptions__init(FileOptions *message);
+size_t fileoptions__get_packed_size(const FileOptions *message);
+size_t fileoptions__pack(const FileOptions *message, uint8_t *out);
+FileOptions *fileoptions__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void fileoptions__free_unpacked(FileOptions *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor fileoptions__descriptor;
+struct _MessageOptions {
+  ProtobufCMessage base;
+  protobuf_c_boolean has_message_set_wire_format;
+  protobuf_c_boolean message_set_wire_format;
+  protobuf_c_boolean has_no_standard_descriptor_accessor;
+  protobuf_c_boolean no_standard_descriptor_accessor;
+  protobuf_c_boolean has_deprecated;
+  protobuf_c_boolean deprecated;
+  protobuf_c_boolean has_map_entry;
+  protobuf_c_boolean map_entry;
+  size_t n_uninterpreted_option;
+  UninterpretedOption **uninterpreted_option;
+};
+#define MESSAGEOPTIONS__INIT { PROTOBUF_C_MESSAGE_INIT(&messageoptions__descriptor) }
+void messageoptions__init(MessageOptions *message);
+size_t messageoptions__get_packed_size(const MessageOptions *message);
+size_t messageoptions__pack(const MessageOptions *message, uint8_t *out);
+MessageOptions *messageoptions__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void messageoptions__free_unpacked(MessageOptions *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor messageoptions__descriptor;
+struct _FieldOptions {
+  ProtobufCMessage base;
+  protobuf_c_boolean has_ctype;
+  FieldOptions__CType ctype;
+  protobuf_c_boolean has_packed;
+  protobuf_c_boolean packed;
+  protobuf_c_boolean has_jstype;
+  FieldOptions__JSType jstype;
+  protobuf_c_boolean has_lazy;
+  protobuf_c_boolean lazy;
+  protobuf_c_boolean has_unverified_lazy;
+  protobuf_c_boolean unverified_lazy;
+  protobuf_c_boolean has_deprecated;
+  protobuf_c_boolean deprecated;
+  protobuf_c_boolean has_weak;
+  protobuf_c_boolean weak;
+  size_t n_uninterpreted_option;
+  UninterpretedOption **uninterpreted_option;
+};
+#define FIELDOPTIONS__INIT { PROTOBUF_C_MESSAGE_INIT(&fieldoptions__descriptor) }
+void fieldoptions__init(FieldOptions *message);
+size_t fieldoptions__get_packed_size(const FieldOptions *message);
+size_t fieldoptions__pack(const FieldOptions *message, uint8_t *out);
+FieldOptions *fieldoptions__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void fieldoptions__free_unpacked(FieldOptions *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor fieldoptions__descriptor;
+struct _OneofOptions {
+  ProtobufCMessage base;
+  size_t n_uninterpreted_option;
+  UninterpretedOption **uninterpreted_option;
+};
+#define ONEOFOPTIONS__INIT { PROTOBUF_C_MESSAGE_INIT(&oneofoptions__descriptor) }
+void oneofoptions__init(OneofOptions *message);
+size_t oneofoptions__get_packed_size(const OneofOptions *message);
+size_t oneofoptions__pack(const OneofOptions *message, uint8_t *out);
+OneofOptions *oneofoptions__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void oneofoptions__free_unpacked(OneofOptions *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor oneofoptions__descriptor;
+struct _EnumOptions {
+  ProtobufCMessage base;
+  protobuf_c_boolean has_allow_alias;
+  protobuf_c_boolean allow_alias;
+  protobuf_c_boolean has_deprecated;
+  protobuf_c_boolean deprecated;
+  size_t n_uninterpreted_option;
+  UninterpretedOption **uninterpreted_option;
+};
+#define ENUMOPTIONS__INIT { PROTOBUF_C_MESSAGE_INIT(&enumoptions__descriptor) }
+void enumoptions__init(EnumOptions *message);
+size_t enumoptions__get_packed_size(const EnumOptions *message);
+size_t enumoptions__pack(const EnumOptions *message, uint8_t *out);
+EnumOptions *enumoptions__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void enumoptions__free_unpacked(EnumOptions *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor enumoptions__descriptor;
+struct _EnumValueOptions {
+  ProtobufCMessage base;
+  protobuf_c_boolean has_deprecated;
+  protobuf_c_boolean deprecated;
+  size_t n_uninterpreted_option;
+  UninterpretedOption **uninterpreted_option;
+};
+#define ENUMVALUEOPTIONS__INIT { PROTOBUF_C_MESSAGE_INIT(&enumvalueoptions__descriptor) }
+void enumvalueoptions__init(EnumValueOptions *message);
+size_t enumvalueoptions__get_packed_size(const EnumValueOptions *message);
+size_t enumvalueoptions__pack(const EnumValueOptions *message, uint8_t *out);
+EnumValueOptions *enumvalueoptions__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void enumvalueoptions__free_unpacked(EnumValueOptions *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor enumvalueoptions__descriptor;
+struct _ServiceOptions {
+  ProtobufCMessage base;
+  protobuf_c_boolean has_deprecated;
+  protobuf_c_boolean deprecated;
+  size_t n_uninterpreted_option;
+  UninterpretedOption **uninterpreted_option;
+};
+#define SERVICEOPTIONS__INIT { PROTOBUF_C_MESSAGE_INIT(&serviceoptions__descriptor) }
+void serviceoptions__init(ServiceOptions *message);
+size_t serviceoptions__get_packed_size(const ServiceOptions *message);
+size_t serviceoptions__pack(const ServiceOptions *message, uint8_t *out);
+ServiceOptions *serviceoptions__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void serviceoptions__free_unpacked(ServiceOptions *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor serviceoptions__descriptor;
+struct _MethodOptions {
+  ProtobufCMessage base;
+  protobuf_c_boolean has_deprecated;
+  protobuf_c_boolean deprecated;
+  protobuf_c_boolean has_idempotency_level;
+  MethodOptions__IdempotencyLevel idempotency_level;
+  size_t n_uninterpreted_option;
+  UninterpretedOption **uninterpreted_option;
+};
+#define METHODOPTIONS__INIT { PROTOBUF_C_MESSAGE_INIT(&methodoptions__descriptor) }
+void methodoptions__init(MethodOptions *message);
+size_t methodoptions__get_packed_size(const MethodOptions *message);
+size_t methodoptions__pack(const MethodOptions *message, uint8_t *out);
+MethodOptions *methodoptions__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void methodoptions__free_unpacked(MethodOptions *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor methodoptions__descriptor;
+struct _UninterpretedOption__NamePart {
+  ProtobufCMessage base;
+  char * name_part;
+  protobuf_c_boolean is_extension;
+};
+#define UNINTERPRETEDOPTION__NAMEPART__INIT { PROTOBUF_C_MESSAGE_INIT(&uninterpretedoption__namepart__descriptor) }
+void uninterpretedoption__namepart__init(UninterpretedOption__NamePart *message);
+size_t uninterpretedoption__namepart__get_packed_size(const UninterpretedOption__NamePart *message);
+size_t uninterpretedoption__namepart__pack(const UninterpretedOption__NamePart *message, uint8_t *out);
+UninterpretedOption__NamePart *uninterpretedoption__namepart__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void uninterpretedoption__namepart__free_unpacked(UninterpretedOption__NamePart *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor uninterpretedoption__namepart__descriptor;
+struct _UninterpretedOption {
+  ProtobufCMessage base;
+  size_t n_name;
+  UninterpretedOption__NamePart **name;
+  char * identifier_value;
+  protobuf_c_boolean has_positive_int_value;
+  uint64_t positive_int_value;
+  protobuf_c_boolean has_negative_int_value;
+  int64_t negative_int_value;
+  protobuf_c_boolean has_double_value;
+  double double_value;
+  protobuf_c_boolean has_string_value;
+  ProtobufCBinaryData string_value;
+  char * aggregate_value;
+};
+#define UNINTERPRETEDOPTION__INIT { PROTOBUF_C_MESSAGE_INIT(&uninterpretedoption__descriptor) }
+void uninterpretedoption__init(UninterpretedOption *message);
+size_t uninterpretedoption__get_packed_size(const UninterpretedOption *message);
+size_t uninterpretedoption__pack(const UninterpretedOption *message, uint8_t *out);
+UninterpretedOption *uninterpretedoption__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void uninterpretedoption__free_unpacked(UninterpretedOption *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor uninterpretedoption__descriptor;
+struct _SourceCodeInfo__Location {
+  ProtobufCMessage base;
+  size_t n_path;
+  int32_t *path;
+  size_t n_span;
+  int32_t *span;
+  char * leading_comments;
+  char * trailing_comments;
+  size_t n_leading_detached_comments;
+  char **leading_detached_comments;
+};
+#define SOURCECODEINFO__LOCATION__INIT { PROTOBUF_C_MESSAGE_INIT(&sourcecodeinfo__location__descriptor) }
+void sourcecodeinfo__location__init(SourceCodeInfo__Location *message);
+size_t sourcecodeinfo__location__get_packed_size(const SourceCodeInfo__Location *message);
+size_t sourcecodeinfo__location__pack(const SourceCodeInfo__Location *message, uint8_t *out);
+SourceCodeInfo__Location *sourcecodeinfo__location__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void sourcecodeinfo__location__free_unpacked(SourceCodeInfo__Location *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor sourcecodeinfo__location__descriptor;
+struct _SourceCodeInfo {
+  ProtobufCMessage base;
+  size_t n_location;
+  SourceCodeInfo__Location **location;
+};
+#define SOURCECODEINFO__INIT { PROTOBUF_C_MESSAGE_INIT(&sourcecodeinfo__descriptor) }
+void sourcecodeinfo__init(SourceCodeInfo *message);
+size_t sourcecodeinfo__get_packed_size(const SourceCodeInfo *message);
+size_t sourcecodeinfo__pack(const SourceCodeInfo *message, uint8_t *out);
+SourceCodeInfo *sourcecodeinfo__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void sourcecodeinfo__free_unpacked(SourceCodeInfo *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor sourcecodeinfo__descriptor;
+struct _GeneratedCodeInfo__Annotation {
+  ProtobufCMessage base;
+  size_t n_path;
+  int32_t *path;
+  char * source_file;
+  protobuf_c_boolean has_begin;
+  int32_t begin;
+  protobuf_c_boolean has_end;
+  int32_t end;
+};
+#define GENERATEDCODEINFO__ANNOTATION__INIT { PROTOBUF_C_MESSAGE_INIT(&generatedcodeinfo__annotation__descriptor) }
+void generatedcodeinfo__annotation__init(GeneratedCodeInfo__Annotation *message);
+size_t generatedcodeinfo__annotation__get_packed_size(const GeneratedCodeInfo__Annotation *message);
+size_t generatedcodeinfo__annotation__pack(const GeneratedCodeInfo__Annotation *message, uint8_t *out);
+GeneratedCodeInfo__Annotation *generatedcodeinfo__annotation__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void generatedcodeinfo__annotation__free_unpacked(GeneratedCodeInfo__Annotation *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor generatedcodeinfo__annotation__descriptor;
+struct _GeneratedCodeInfo {
+  ProtobufCMessage base;
+  size_t n_annotation;
+  GeneratedCodeInfo__Annotation **annotation;
+};
+#define GENERATEDCODEINFO__INIT { PROTOBUF_C_MESSAGE_INIT(&generatedcodeinfo__descriptor) }
+void generatedcodeinfo__init(GeneratedCodeInfo *message);
+size_t generatedcodeinfo__get_packed_size(const GeneratedCodeInfo *message);
+size_t generatedcodeinfo__pack(const GeneratedCodeInfo *message, uint8_t *out);
+GeneratedCodeInfo *generatedcodeinfo__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void generatedcodeinfo__free_unpacked(GeneratedCodeInfo *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor generatedcodeinfo__descriptor;
+#endif
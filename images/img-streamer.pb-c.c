@@ -0,0 +1 @@
+#include "img-streamer.pb-c.h"
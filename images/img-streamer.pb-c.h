@@ -0,0 +1,28 @@
+#ifndef __IMG_STREAMER_PB_C_H__
+#define __IMG_STREAMER_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _ImgStreamerRequestEntry ImgStreamerRequestEntry;
+typedef struct _ImgStreamerReplyEntry ImgStreamerReplyEntry;
+struct _ImgStreamerRequestEntry {
+  ProtobufCMessage base;
+  char * filename;
+};
+#define IMG_STREAMER_REQUEST_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&img_streamer_request_entry__descriptor) }
+void img_streamer_request_entry__init(ImgStreamerRequestEntry *message);
+size_t img_streamer_request_entry__get_packed_size(const ImgStreamerRequestEntry *message);
+size_t img_streamer_request_entry__pack(const ImgStreamerRequestEntry *message, uint8_t *out);
+ImgStreamerRequestEntry *img_streamer_request_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void img_streamer_request_entry__free_unpacked(ImgStreamerRequestEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor img_streamer_request_entry__descriptor;
+struct _ImgStreamerReplyEntry {
+  ProtobufCMessage base;
+  protobuf_c_boolean exists;
+};
+#define IMG_STREAMER_REPLY_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&img_streamer_reply_entry__descriptor) }
+void img_streamer_reply_entry__init(ImgStreamerReplyEntry *message);
+size_t img_streamer_reply_entry__get_packed_size(const ImgStreamerReplyEntry *message);
+size_t img_streamer_reply_entry__pack(const ImgStreamerReplyEntry *message, uint8_t *out);
+ImgStreamerReplyEntry *img_streamer_reply_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void img_streamer_reply_entry__free_unpacked(ImgStreamerReplyEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor img_streamer_reply_entry__descriptor;
+#endif
@@ -0,0 +1 @@
+#include "inventory.pb-c.h"
@@ -0,0 +1,42 @@
+#ifndef __INVENTORY_PB_C_H__
+#define __INVENTORY_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+#include "core.pb-c.h"
+typedef struct _InventoryEntry InventoryEntry;
+typedef enum _Lsmtype {
+  LSMTYPE__NO_LSM = 0,
+  LSMTYPE__SELINUX = 1,
+  LSMTYPE__APPARMOR = 2,
+} Lsmtype;
+extern const ProtobufCEnumDescriptor lsmtype__descriptor;
+struct _InventoryEntry {
+  ProtobufCMessage base;
+  uint32_t img_version;
+  protobuf_c_boolean has_fdinfo_per_id;
+  protobuf_c_boolean fdinfo_per_id;
+  TaskKobjIdsEntry * root_ids;
+  protobuf_c_boolean has_ns_per_id;
+  protobuf_c_boolean ns_per_id;
+  protobuf_c_boolean has_root_cg_set;
+  uint32_t root_cg_set;
+  protobuf_c_boolean has_lsmtype;
+  Lsmtype lsmtype;
+  protobuf_c_boolean has_dump_uptime;
+  uint64_t dump_uptime;
+  protobuf_c_boolean has_pre_dump_mode;
+  uint32_t pre_dump_mode;
+  protobuf_c_boolean has_tcp_close;
+  protobuf_c_boolean tcp_close;
+  protobuf_c_boolean has_network_lock_method;
+  uint32_t network_lock_method;
+  protobuf_c_boolean has_dump_id;
+  uint64_t dump_id;
+};
+#define INVENTORY_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&inventory_entry__descriptor) }
+void inventory_entry__init(InventoryEntry *message);
+size_t inventory_entry__get_packed_size(const InventoryEntry *message);
+size_t inventory_entry__pack(const InventoryEntry *message, uint8_t *out);
+InventoryEntry *inventory_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void inventory_entry__free_unpacked(InventoryEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor inventory_entry__descriptor;
+#endif
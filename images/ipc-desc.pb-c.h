@@ -0,0 +1,22 @@
+#ifndef __IPC_DESC_PB_C_H__
+#define __IPC_DESC_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _IpcDescEntry IpcDescEntry;
+struct _IpcDescEntry {
+  ProtobufCMessage base;
+  uint32_t key;
+  uint32_t uid;
+  uint32_t gid;
+  uint32_t cuid;
+  uint32_t cgid;
+  uint32_t mode;
+  uint32_t id;
+};
+#define IPC_DESC_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&ipc_desc_entry__descriptor) }
+void ipc_desc_entry__init(IpcDescEntry *message);
+size_t ipc_desc_entry__get_packed_size(const IpcDescEntry *message);
+size_t ipc_desc_entry__pack(const IpcDescEntry *message, uint8_t *out);
+IpcDescEntry *ipc_desc_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void ipc_desc_entry__free_unpacked(IpcDescEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor ipc_desc_entry__descriptor;
+#endif
@@ -0,0 +1,32 @@
+#ifndef __IPC_MSG_PB_C_H__
+#define __IPC_MSG_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+#include "ipc-desc.pb-c.h"
+typedef struct _IpcMsg IpcMsg;
+typedef struct _IpcMsgEntry IpcMsgEntry;
+struct _IpcMsg {
+  ProtobufCMessage base;
+  uint64_t mtype;
+  uint32_t msize;
+};
+#define IPC_MSG__INIT { PROTOBUF_C_MESSAGE_INIT(&ipc_msg__descriptor) }
+void ipc_msg__init(IpcMsg *message);
+size_t ipc_msg__get_packed_size(const IpcMsg *message);
+size_t ipc_msg__pack(const IpcMsg *message, uint8_t *out);
+IpcMsg *ipc_msg__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void ipc_msg__free_unpacked(IpcMsg *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor ipc_msg__descriptor;
+struct _IpcMsgEntry {
+  ProtobufCMessage base;
+  IpcDescEntry * desc;
+  uint32_t qbytes;
+  uint32_t qnum;
+};
+#define IPC_MSG_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&ipc_msg_entry__descriptor) }
+void ipc_msg_entry__init(IpcMsgEntry *message);
+size_t ipc_msg_entry__get_packed_size(const IpcMsgEntry *message);
+size_t ipc_msg_entry__pack(const IpcMsgEntry *message, uint8_t *out);
+IpcMsgEntry *ipc_msg_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void ipc_msg_entry__free_unpacked(IpcMsgEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor ipc_msg_entry__descriptor;
+#endif
@@ -0,0 +1 @@
+#include "ipc-sem.pb-c.h"
@@ -0,0 +1,18 @@
+#ifndef __IPC_SEM_PB_C_H__
+#define __IPC_SEM_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+#include "ipc-desc.pb-c.h"
+typedef struct _IpcSemEntry IpcSemEntry;
+struct _IpcSemEntry {
+  ProtobufCMessage base;
+  IpcDescEntry * desc;
+  uint32_t nsems;
+};
+#define IPC_SEM_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&ipc_sem_entry__descriptor) }
+void ipc_sem_entry__init(IpcSemEntry *message);
+size_t ipc_sem_entry__get_packed_size(const IpcSemEntry *message);
+size_t ipc_sem_entry__pack(const IpcSemEntry *message, uint8_t *out);
+IpcSemEntry *ipc_sem_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void ipc_sem_entry__free_unpacked(IpcSemEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor ipc_sem_entry__descriptor;
+#endif
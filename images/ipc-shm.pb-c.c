@@ -0,0 +1 @@
+#include "ipc-shm.pb-c.h"
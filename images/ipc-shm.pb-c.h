@@ -0,0 +1,22 @@
+#ifndef __IPC_SHM_PB_C_H__
+#define __IPC_SHM_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+#include "ipc-desc.pb-c.h"
+typedef struct _IpcShmEntry IpcShmEntry;
+struct _IpcShmEntry {
+  ProtobufCMessage base;
+  IpcDescEntry * desc;
+  uint64_t size;
+  protobuf_c_boolean has_in_pagemaps;
+  protobuf_c_boolean in_pagemaps;
+  protobuf_c_boolean has_hugetlb_flag;
+  uint32_t hugetlb_flag;
+};
+#define IPC_SHM_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&ipc_shm_entry__descriptor) }
+void ipc_shm_entry__init(IpcShmEntry *message);
+size_t ipc_shm_entry__get_packed_size(const IpcShmEntry *message);
+size_t ipc_shm_entry__pack(const IpcShmEntry *message, uint8_t *out);
+IpcShmEntry *ipc_shm_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void ipc_shm_entry__free_unpacked(IpcShmEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor ipc_shm_entry__descriptor;
+#endif
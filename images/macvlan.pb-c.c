@@ -0,0 +1 @@
+#include "macvlan.pb-c.h"
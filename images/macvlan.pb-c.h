@@ -0,0 +1,18 @@
+#ifndef __MACVLAN_PB_C_H__
+#define __MACVLAN_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _MacvlanLinkEntry MacvlanLinkEntry;
+struct _MacvlanLinkEntry {
+  ProtobufCMessage base;
+  uint32_t mode;
+  protobuf_c_boolean has_flags;
+  uint32_t flags;
+};
+#define MACVLAN_LINK_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&macvlan_link_entry__descriptor) }
+void macvlan_link_entry__init(MacvlanLinkEntry *message);
+size_t macvlan_link_entry__get_packed_size(const MacvlanLinkEntry *message);
+size_t macvlan_link_entry__pack(const MacvlanLinkEntry *message, uint8_t *out);
+MacvlanLinkEntry *macvlan_link_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void macvlan_link_entry__free_unpacked(MacvlanLinkEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor macvlan_link_entry__descriptor;
+#endif
@@ -0,0 +1 @@
+#include "memfd.pb-c.h"
@@ -0,0 +1,42 @@
+#ifndef __MEMFD_PB_C_H__
+#define __MEMFD_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+#include "opts.pb-c.h"
+#include "fown.pb-c.h"
+typedef struct _MemfdFileEntry MemfdFileEntry;
+typedef struct _MemfdInodeEntry MemfdInodeEntry;
+struct _MemfdFileEntry {
+  ProtobufCMessage base;
+  uint32_t id;
+  uint32_t flags;
+  uint64_t pos;
+  FownEntry * fown;
+  uint32_t inode_id;
+};
+#define MEMFD_FILE_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&memfd_file_entry__descriptor) }
+void memfd_file_entry__init(MemfdFileEntry *message);
+size_t memfd_file_entry__get_packed_size(const MemfdFileEntry *message);
+size_t memfd_file_entry__pack(const MemfdFileEntry *message, uint8_t *out);
+MemfdFileEntry *memfd_file_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void memfd_file_entry__free_unpacked(MemfdFileEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor memfd_file_entry__descriptor;
+struct _MemfdInodeEntry {
+  ProtobufCMessage base;
+  char * name;
+  uint32_t uid;
+  uint32_t gid;
+  uint64_t size;
+  uint32_t shmid;
+  uint32_t seals;
+  uint64_t inode_id;
+  protobuf_c_boolean has_hugetlb_flag;
+  uint32_t hugetlb_flag;
+};
+#define MEMFD_INODE_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&memfd_inode_entry__descriptor) }
+void memfd_inode_entry__init(MemfdInodeEntry *message);
+size_t memfd_inode_entry__get_packed_size(const MemfdInodeEntry *message);
+size_t memfd_inode_entry__pack(const MemfdInodeEntry *message, uint8_t *out);
+MemfdInodeEntry *memfd_inode_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void memfd_inode_entry__free_unpacked(MemfdInodeEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor memfd_inode_entry__descriptor;
+#endif
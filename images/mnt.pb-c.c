@@ -0,0 +1 @@
+#include "mnt.pb-c.h"
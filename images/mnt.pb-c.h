@@ -0,0 +1,65 @@
+#ifndef __MNT_PB_C_H__
+#define __MNT_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+#include "opts.pb-c.h"
+typedef struct _MntEntry MntEntry;
+typedef enum _Fstype {
+  FSTYPE__UNSUPPORTED = 0,
+  FSTYPE__PROC = 1,
+  FSTYPE__SYSFS = 2,
+  FSTYPE__DEVTMPFS = 3,
+  FSTYPE__BINFMT_MISC = 4,
+  FSTYPE__TMPFS = 5,
+  FSTYPE__DEVPTS = 6,
+  FSTYPE__SIMFS = 7,
+  FSTYPE__PSTORE = 8,
+  FSTYPE__SECURITYFS = 9,
+  FSTYPE__FUSECTL = 10,
+  FSTYPE__DEBUGFS = 11,
+  FSTYPE__CGROUP = 12,
+  FSTYPE__AUFS = 13,
+  FSTYPE__MQUEUE = 14,
+  FSTYPE__FUSE = 15,
+  FSTYPE__AUTO = 16,
+  FSTYPE__OVERLAYFS = 17,
+  FSTYPE__AUTOFS = 18,
+  FSTYPE__TRACEFS = 19,
+  FSTYPE__CGROUP2 = 23,
+} Fstype;
+extern const ProtobufCEnumDescriptor fstype__descriptor;
+struct _MntEntry {
+  ProtobufCMessage base;
+  uint32_t fstype;
+  uint32_t mnt_id;
+  uint32_t root_dev;
+  uint32_t parent_mnt_id;
+  uint32_t flags;
+  char * root;
+  char * mountpoint;
+  char * source;
+  char * options;
+  protobuf_c_boolean has_shared_id;
+  uint32_t shared_id;
+  protobuf_c_boolean has_master_id;
+  uint32_t master_id;
+  protobuf_c_boolean has_with_plugin;
+  protobuf_c_boolean with_plugin;
+  protobuf_c_boolean has_ext_mount;
+  protobuf_c_boolean ext_mount;
+  char * fsname;
+  protobuf_c_boolean has_internal_sharing;
+  protobuf_c_boolean internal_sharing;
+  protobuf_c_boolean has_deleted;
+  protobuf_c_boolean deleted;
+  protobuf_c_boolean has_sb_flags;
+  uint32_t sb_flags;
+  char * ext_key;
+};
+#define MNT_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&mnt_entry__descriptor) }
+void mnt_entry__init(MntEntry *message);
+size_t mnt_entry__get_packed_size(const MntEntry *message);
+size_t mnt_entry__pack(const MntEntry *message, uint8_t *out);
+MntEntry *mnt_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void mnt_entry__free_unpacked(MntEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor mnt_entry__descriptor;
+#endif
@@ -0,0 +1 @@
+#include "netdev.pb-c.h"
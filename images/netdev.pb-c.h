@@ -0,0 +1,94 @@
+#ifndef __NETDEV_PB_C_H__
+#define __NETDEV_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+#include "macvlan.pb-c.h"
+#include "opts.pb-c.h"
+#include "tun.pb-c.h"
+#include "sysctl.pb-c.h"
+#include "sit.pb-c.h"
+typedef struct _NetDeviceEntry NetDeviceEntry;
+typedef struct _NetnsId NetnsId;
+typedef struct _NetnsEntry NetnsEntry;
+typedef enum _NdType {
+  ND_TYPE__LOOPBACK = 1,
+  ND_TYPE__VETH = 2,
+  ND_TYPE__TUN = 3,
+  ND_TYPE__EXTLINK = 4,
+  ND_TYPE__VENET = 5,
+  ND_TYPE__BRIDGE = 6,
+  ND_TYPE__MACVLAN = 7,
+  ND_TYPE__SIT = 8,
+} NdType;
+extern const ProtobufCEnumDescriptor nd_type__descriptor;
+struct _NetDeviceEntry {
+  ProtobufCMessage base;
+  NdType type;
+  uint32_t ifindex;
+  uint32_t mtu;
+  uint32_t flags;
+  char * name;
+  TunLinkEntry * tun;
+  protobuf_c_boolean has_address;
+  ProtobufCBinaryData address;
+  size_t n_conf;
+  int32_t *conf;
+  size_t n_conf4;
+  SysctlEntry **conf4;
+  size_t n_conf6;
+  SysctlEntry **conf6;
+  MacvlanLinkEntry * macvlan;
+  protobuf_c_boolean has_peer_ifindex;
+  uint32_t peer_ifindex;
+  protobuf_c_boolean has_peer_nsid;
+  uint32_t peer_nsid;
+  protobuf_c_boolean has_master;
+  uint32_t master;
+  SitEntry * sit;
+};
+#define NET_DEVICE_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&net_device_entry__descriptor) }
+void net_device_entry__init(NetDeviceEntry *message);
+size_t net_device_entry__get_packed_size(const NetDeviceEntry *message);
+size_t net_device_entry__pack(const NetDeviceEntry *message, uint8_t *out);
+NetDeviceEntry *net_device_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void net_device_entry__free_unpacked(NetDeviceEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor net_device_entry__descriptor;
+struct _NetnsId {
+  ProtobufCMessage base;
+  uint32_t target_ns_id;
+  int32_t netnsid_value;
+};
+#define NETNS_ID__INIT { PROTOBUF_C_MESSAGE_INIT(&netns_id__descriptor) }
+void netns_id__init(NetnsId *message);
+size_t netns_id__get_packed_size(const NetnsId *message);
+size_t netns_id__pack(const NetnsId *message, uint8_t *out);
+NetnsId *netns_id__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void netns_id__free_unpacked(NetnsId *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor netns_id__descriptor;
+struct _NetnsEntry {
+  ProtobufCMessage base;
+  size_t n_def_conf;
+  int32_t *def_conf;
+  size_t n_all_conf;
+  int32_t *all_conf;
+  size_t n_def_conf4;
+  SysctlEntry **def_conf4;
+  size_t n_all_conf4;
+  SysctlEntry **all_conf4;
+  size_t n_def_conf6;
+  SysctlEntry **def_conf6;
+  size_t n_all_conf6;
+  SysctlEntry **all_conf6;
+  size_t n_nsids;
+  NetnsId **nsids;
+  char * ext_key;
+  size_t n_unix_conf;
+  SysctlEntry **unix_conf;
+};
+#define NETNS_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&netns_entry__descriptor) }
+void netns_entry__init(NetnsEntry *message);
+size_t netns_entry__get_packed_size(const NetnsEntry *message);
+size_t netns_entry__pack(const NetnsEntry *message, uint8_t *out);
+NetnsEntry *netns_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void netns_entry__free_unpacked(NetnsEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor netns_entry__descriptor;
+#endif
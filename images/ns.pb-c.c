@@ -0,0 +1 @@
+#include "ns.pb-c.h"
@@ -0,0 +1 @@
+#include "opts.pb-c.h"
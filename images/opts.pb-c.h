@@ -0,0 +1,27 @@
+#ifndef __OPTS_PB_C_H__
+#define __OPTS_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+#include "google/protobuf/descriptor.pb-c.h"
+typedef struct _CRIUOpts CRIUOpts;
+struct _CRIUOpts {
+  ProtobufCMessage base;
+  protobuf_c_boolean has_hex;
+  protobuf_c_boolean hex;
+  protobuf_c_boolean has_ipadd;
+  protobuf_c_boolean ipadd;
+  char * flags;
+  protobuf_c_boolean has_dev;
+  protobuf_c_boolean dev;
+  protobuf_c_boolean has_odev;
+  protobuf_c_boolean odev;
+  char * dict;
+  char * conv;
+};
+#define CRIU_OPTS_X__INIT { PROTOBUF_C_MESSAGE_INIT(&criu_opts_x__descriptor) }
+void criu_opts_x__init(CRIUOpts *message);
+size_t criu_opts_x__get_packed_size(const CRIUOpts *message);
+size_t criu_opts_x__pack(const CRIUOpts *message, uint8_t *out);
+CRIUOpts *criu_opts_x__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void criu_opts_x__free_unpacked(CRIUOpts *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor criu_opts_x__descriptor;
+#endif
@@ -0,0 +1,68 @@
+#ifndef __PAGEMAP_PB_C_H__
+#define __PAGEMAP_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+#include "opts.pb-c.h"
+typedef struct _PagemapHead PagemapHead;
+typedef struct _PagemapEntry PagemapEntry;
+typedef struct _PagesBlockEntry PagesBlockEntry;
+typedef struct _FaultProfileEntry FaultProfileEntry;
+struct _PagemapHead {
+  ProtobufCMessage base;
+  uint32_t pages_id;
+  protobuf_c_boolean has_comp_algo;
+  uint32_t comp_algo;
+};
+#define PAGEMAP_HEAD__INIT { PROTOBUF_C_MESSAGE_INIT(&pagemap_head__descriptor) }
+void pagemap_head__init(PagemapHead *message);
+size_t pagemap_head__get_packed_size(const PagemapHead *message);
+size_t pagemap_head__pack(const PagemapHead *message, uint8_t *out);
+PagemapHead *pagemap_head__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void pagemap_head__free_unpacked(PagemapHead *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor pagemap_head__descriptor;
+struct _PagemapEntry {
+  ProtobufCMessage base;
+  uint64_t vaddr;
+  uint32_t nr_pages;
+  protobuf_c_boolean has_in_parent;
+  protobuf_c_boolean in_parent;
+  protobuf_c_boolean has_flags;
+  uint32_t flags;
+  size_t n_csum;
+  uint32_t *csum;
+};
+#define PAGEMAP_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&pagemap_entry__descriptor) }
+void pagemap_entry__init(PagemapEntry *message);
+size_t pagemap_entry__get_packed_size(const PagemapEntry *message);
+size_t pagemap_entry__pack(const PagemapEntry *message, uint8_t *out);
+PagemapEntry *pagemap_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void pagemap_entry__free_unpacked(PagemapEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor pagemap_entry__descriptor;
+struct _PagesBlockEntry {
+  ProtobufCMessage base;
+  uint64_t off;
+  uint32_t len;
+  uint32_t raw_len;
+};
+#define PAGES_BLOCK_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&pages_block_entry__descriptor) }
+void pages_block_entry__init(PagesBlockEntry *message);
+size_t pages_block_entry__get_packed_size(const PagesBlockEntry *message);
+size_t pages_block_entry__pack(const PagesBlockEntry *message, uint8_t *out);
+PagesBlockEntry *pages_block_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void pages_block_entry__free_unpacked(PagesBlockEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor pages_block_entry__descriptor;
+struct _FaultProfileEntry {
+  ProtobufCMessage base;
+  uint32_t pid;
+  uint64_t vaddr;
+  uint32_t nr_pages;
+  protobuf_c_boolean has_time_ms;
+  uint32_t time_ms;
+};
+#define FAULT_PROFILE_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&fault_profile_entry__descriptor) }
+void fault_profile_entry__init(FaultProfileEntry *message);
+size_t fault_profile_entry__get_packed_size(const FaultProfileEntry *message);
+size_t fault_profile_entry__pack(const FaultProfileEntry *message, uint8_t *out);
+FaultProfileEntry *fault_profile_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void fault_profile_entry__free_unpacked(FaultProfileEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor fault_profile_entry__descriptor;
+#endif
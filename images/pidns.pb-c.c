@@ -0,0 +1 @@
+#include "pidns.pb-c.h"
@@ -0,0 +1,16 @@
+#ifndef __PIDNS_PB_C_H__
+#define __PIDNS_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _PidnsEntry PidnsEntry;
+struct _PidnsEntry {
+  ProtobufCMessage base;
+  char * ext_key;
+};
+#define PIDNS_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&pidns_entry__descriptor) }
+void pidns_entry__init(PidnsEntry *message);
+size_t pidns_entry__get_packed_size(const PidnsEntry *message);
+size_t pidns_entry__pack(const PidnsEntry *message, uint8_t *out);
+PidnsEntry *pidns_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void pidns_entry__free_unpacked(PidnsEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor pidns_entry__descriptor;
+#endif
@@ -0,0 +1,19 @@
+#ifndef __PIPE_DATA_PB_C_H__
+#define __PIPE_DATA_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _PipeDataEntry PipeDataEntry;
+struct _PipeDataEntry {
+  ProtobufCMessage base;
+  uint32_t pipe_id;
+  uint32_t bytes;
+  protobuf_c_boolean has_size;
+  uint32_t size;
+};
+#define PIPE_DATA_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&pipe_data_entry__descriptor) }
+void pipe_data_entry__init(PipeDataEntry *message);
+size_t pipe_data_entry__get_packed_size(const PipeDataEntry *message);
+size_t pipe_data_entry__pack(const PipeDataEntry *message, uint8_t *out);
+PipeDataEntry *pipe_data_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void pipe_data_entry__free_unpacked(PipeDataEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor pipe_data_entry__descriptor;
+#endif
@@ -0,0 +1 @@
+#include "pipe.pb-c.h"
@@ -0,0 +1,21 @@
+#ifndef __PSTREE_PB_C_H__
+#define __PSTREE_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _PstreeEntry PstreeEntry;
+struct _PstreeEntry {
+  ProtobufCMessage base;
+  uint32_t pid;
+  uint32_t ppid;
+  uint32_t pgid;
+  uint32_t sid;
+  size_t n_threads;
+  uint32_t *threads;
+};
+#define PSTREE_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&pstree_entry__descriptor) }
+void pstree_entry__init(PstreeEntry *message);
+size_t pstree_entry__get_packed_size(const PstreeEntry *message);
+size_t pstree_entry__pack(const PstreeEntry *message, uint8_t *out);
+PstreeEntry *pstree_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void pstree_entry__free_unpacked(PstreeEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor pstree_entry__descriptor;
+#endif
@@ -0,0 +1,38 @@
+#ifndef __REGFILE_PB_C_H__
+#define __REGFILE_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+#include "opts.pb-c.h"
+#include "fown.pb-c.h"
+typedef struct _RegFileEntry RegFileEntry;
+struct _RegFileEntry {
+  ProtobufCMessage base;
+  uint32_t id;
+  uint32_t flags;
+  uint64_t pos;
+  FownEntry * fown;
+  char * name;
+  protobuf_c_boolean has_mnt_id;
+  int32_t mnt_id;
+  protobuf_c_boolean has_size;
+  uint64_t size;
+  protobuf_c_boolean has_ext;
+  protobuf_c_boolean ext;
+  protobuf_c_boolean has_mode;
+  uint32_t mode;
+  size_t n_build_id;
+  uint32_t *build_id;
+  protobuf_c_boolean has_checksum;
+  uint32_t checksum;
+  protobuf_c_boolean has_checksum_config;
+  uint32_t checksum_config;
+  protobuf_c_boolean has_checksum_parameter;
+  uint32_t checksum_parameter;
+};
+#define REG_FILE_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&reg_file_entry__descriptor) }
+void reg_file_entry__init(RegFileEntry *message);
+size_t reg_file_entry__get_packed_size(const RegFileEntry *message);
+size_t reg_file_entry__pack(const RegFileEntry *message, uint8_t *out);
+RegFileEntry *reg_file_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void reg_file_entry__free_unpacked(RegFileEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor reg_file_entry__descriptor;
+#endif
@@ -0,0 +1,25 @@
+#ifndef __REMAP_FILE_PATH_PB_C_H__
+#define __REMAP_FILE_PATH_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _RemapFilePathEntry RemapFilePathEntry;
+typedef enum _RemapType {
+  REMAP_TYPE__LINKED = 0,
+  REMAP_TYPE__GHOST = 1,
+  REMAP_TYPE__PROCFS = 2,
+} RemapType;
+extern const ProtobufCEnumDescriptor remap_type__descriptor;
+struct _RemapFilePathEntry {
+  ProtobufCMessage base;
+  uint32_t orig_id;
+  uint32_t remap_id;
+  protobuf_c_boolean has_remap_type;
+  RemapType remap_type;
+};
+#define REMAP_FILE_PATH_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&remap_file_path_entry__descriptor) }
+void remap_file_path_entry__init(RemapFilePathEntry *message);
+size_t remap_file_path_entry__get_packed_size(const RemapFilePathEntry *message);
+size_t remap_file_path_entry__pack(const RemapFilePathEntry *message, uint8_t *out);
+RemapFilePathEntry *remap_file_path_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void remap_file_path_entry__free_unpacked(RemapFilePathEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor remap_file_path_entry__descriptor;
+#endif
@@ -0,0 +1,413 @@
+#ifndef __RPC_PB_C_H__
+#define __RPC_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _CriuPageServerInfo CriuPageServerInfo;
+typedef struct _CriuVethPair CriuVethPair;
+typedef struct _ExtMountMap ExtMountMap;
+typedef struct _JoinNamespace JoinNamespace;
+typedef struct _InheritFd InheritFd;
+typedef struct _CgroupRoot CgroupRoot;
+typedef struct _UnixSk UnixSk;
+typedef struct _CriuOpts CriuOpts;
+typedef struct _CriuDumpResp CriuDumpResp;
+typedef struct _CriuRestoreResp CriuRestoreResp;
+typedef struct _CriuPreDumpIter CriuPreDumpIter;
+typedef struct _CriuNotify CriuNotify;
+typedef struct _CriuFeatures CriuFeatures;
+typedef struct _CriuReq CriuReq;
+typedef struct _CriuResp CriuResp;
+typedef struct _CriuVersion CriuVersion;
+typedef enum _CriuCgMode {
+  CRIU_CG_MODE__IGNORE = 0,
+  CRIU_CG_MODE__CG_NONE = 1,
+  CRIU_CG_MODE__PROPS = 2,
+  CRIU_CG_MODE__SOFT = 3,
+  CRIU_CG_MODE__FULL = 4,
+  CRIU_CG_MODE__STRICT = 5,
+  CRIU_CG_MODE__DEFAULT = 6,
+} CriuCgMode;
+extern const ProtobufCEnumDescriptor criu_cg_mode__descriptor;
+typedef enum _CriuNetworkLockMethod {
+  CRIU_NETWORK_LOCK_METHOD__IPTABLES = 1,
+  CRIU_NETWORK_LOCK_METHOD__NFTABLES = 2,
+} CriuNetworkLockMethod;
+extern const ProtobufCEnumDescriptor criu_network_lock_method__descriptor;
+typedef enum _CriuPreDumpMode {
+  CRIU_PRE_DUMP_MODE__SPLICE = 1,
+  CRIU_PRE_DUMP_MODE__VM_READ = 2,
+  CRIU_PRE_DUMP_MODE__VM_READ_BATCH = 3,
+} CriuPreDumpMode;
+extern const ProtobufCEnumDescriptor criu_pre_dump_mode__descriptor;
+typedef enum _CriuReqType {
+  CRIU_REQ_TYPE__EMPTY = 0,
+  CRIU_REQ_TYPE__DUMP = 1,
+  CRIU_REQ_TYPE__RESTORE = 2,
+  CRIU_REQ_TYPE__CHECK = 3,
+  CRIU_REQ_TYPE__PRE_DUMP = 4,
+  CRIU_REQ_TYPE__PAGE_SERVER = 5,
+  CRIU_REQ_TYPE__NOTIFY = 6,
+  CRIU_REQ_TYPE__CPUINFO_DUMP = 7,
+  CRIU_REQ_TYPE__CPUINFO_CHECK = 8,
+  CRIU_REQ_TYPE__FEATURE_CHECK = 9,
+  CRIU_REQ_TYPE__VERSION = 10,
+  CRIU_REQ_TYPE__WAIT_PID = 11,
+  CRIU_REQ_TYPE__PAGE_SERVER_CHLD = 12,
+  CRIU_REQ_TYPE__SINGLE_PRE_DUMP = 13,
+  CRIU_REQ_TYPE__CONVERGE_DUMP = 14,
+} CriuReqType;
+extern const ProtobufCEnumDescriptor criu_req_type__descriptor;
+struct _CriuPageServerInfo {
+  ProtobufCMessage base;
+  char * address;
+  protobuf_c_boolean has_port;
+  int32_t port;
+  protobuf_c_boolean has_pid;
+  int32_t pid;
+  protobuf_c_boolean has_fd;
+  int32_t fd;
+};
+#define CRIU_PAGE_SERVER_INFO__INIT { PROTOBUF_C_MESSAGE_INIT(&criu_page_server_info__descriptor) }
+void criu_page_server_info__init(CriuPageServerInfo *message);
+size_t criu_page_server_info__get_packed_size(const CriuPageServerInfo *message);
+size_t criu_page_server_info__pack(const CriuPageServerInfo *message, uint8_t *out);
+CriuPageServerInfo *criu_page_server_info__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void criu_page_server_info__free_unpacked(CriuPageServerInfo *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor criu_page_server_info__descriptor;
+struct _CriuVethPair {
+  ProtobufCMessage base;
+  char * if_in;
+  char * if_out;
+};
+#define CRIU_VETH_PAIR__INIT { PROTOBUF_C_MESSAGE_INIT(&criu_veth_pair__descriptor) }
+void criu_veth_pair__init(CriuVethPair *message);
+size_t criu_veth_pair__get_packed_size(const CriuVethPair *message);
+size_t criu_veth_pair__pack(const CriuVethPair *message, uint8_t *out);
+CriuVethPair *criu_veth_pair__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void criu_veth_pair__free_unpacked(CriuVethPair *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor criu_veth_pair__descriptor;
+struct _ExtMountMap {
+  ProtobufCMessage base;
+  char * key;
+  char * val;
+};
+#define EXT_MOUNT_MAP__INIT { PROTOBUF_C_MESSAGE_INIT(&ext_mount_map__descriptor) }
+void ext_mount_map__init(ExtMountMap *message);
+size_t ext_mount_map__get_packed_size(const ExtMountMap *message);
+size_t ext_mount_map__pack(const ExtMountMap *message, uint8_t *out);
+ExtMountMap *ext_mount_map__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void ext_mount_map__free_unpacked(ExtMountMap *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor ext_mount_map__descriptor;
+struct _JoinNamespace {
+  ProtobufCMessage base;
+  char * ns;
+  char * ns_file;
+  char * extra_opt;
+};
+#define JOIN_NAMESPACE__INIT { PROTOBUF_C_MESSAGE_INIT(&join_namespace__descriptor) }
+void join_namespace__init(JoinNamespace *message);
+size_t join_namespace__get_packed_size(const JoinNamespace *message);
+size_t join_namespace__pack(const JoinNamespace *message, uint8_t *out);
+JoinNamespace *join_namespace__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void join_namespace__free_unpacked(JoinNamespace *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor join_namespace__descriptor;
+struct _InheritFd {
+  ProtobufCMessage base;
+  char * key;
+  int32_t fd;
+};
+#define INHERIT_FD__INIT { PROTOBUF_C_MESSAGE_INIT(&inherit_fd__descriptor) }
+void inherit_fd__init(InheritFd *message);
+size_t inherit_fd__get_packed_size(const InheritFd *message);
+size_t inherit_fd__pack(const InheritFd *message, uint8_t *out);
+InheritFd *inherit_fd__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void inherit_fd__free_unpacked(InheritFd *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor inherit_fd__descriptor;
+struct _CgroupRoot {
+  ProtobufCMessage base;
+  char * ctrl;
+  char * path;
+};
+#define CGROUP_ROOT__INIT { PROTOBUF_C_MESSAGE_INIT(&cgroup_root__descriptor) }
+void cgroup_root__init(CgroupRoot *message);
+size_t cgroup_root__get_packed_size(const CgroupRoot *message);
+size_t cgroup_root__pack(const CgroupRoot *message, uint8_t *out);
+CgroupRoot *cgroup_root__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void cgroup_root__free_unpacked(CgroupRoot *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor cgroup_root__descriptor;
+struct _UnixSk {
+  ProtobufCMessage base;
+  uint32_t inode;
+};
+#define UNIX_SK__INIT { PROTOBUF_C_MESSAGE_INIT(&unix_sk__descriptor) }
+void unix_sk__init(UnixSk *message);
+size_t unix_sk__get_packed_size(const UnixSk *message);
+size_t unix_sk__pack(const UnixSk *message, uint8_t *out);
+UnixSk *unix_sk__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void unix_sk__free_unpacked(UnixSk *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor unix_sk__descriptor;
+struct _CriuOpts {
+  ProtobufCMessage base;
+  int32_t images_dir_fd;
+  protobuf_c_boolean has_pid;
+  int32_t pid;
+  protobuf_c_boolean has_leave_running;
+  protobuf_c_boolean leave_running;
+  protobuf_c_boolean has_ext_unix_sk;
+  protobuf_c_boolean ext_unix_sk;
+  protobuf_c_boolean has_tcp_established;
+  protobuf_c_boolean tcp_established;
+  protobuf_c_boolean has_evasive_devices;
+  protobuf_c_boolean evasive_devices;
+  protobuf_c_boolean has_shell_job;
+  protobuf_c_boolean shell_job;
+  protobuf_c_boolean has_file_locks;
+  protobuf_c_boolean file_locks;
+  protobuf_c_boolean has_log_level;
+  int32_t log_level;
+  char * log_file;
+  CriuPageServerInfo * ps;
+  protobuf_c_boolean has_notify_scripts;
+  protobuf_c_boolean notify_scripts;
+  char * root;
+  char * parent_img;
+  protobuf_c_boolean has_track_mem;
+  protobuf_c_boolean track_mem;
+  protobuf_c_boolean has_auto_dedup;
+  protobuf_c_boolean auto_dedup;
+  protobuf_c_boolean has_work_dir_fd;
+  int32_t work_dir_fd;
+  protobuf_c_boolean has_link_remap;
+  protobuf_c_boolean link_remap;
+  size_t n_veths;
+  CriuVethPair **veths;
+  protobuf_c_boolean has_cpu_cap;
+  uint32_t cpu_cap;
+  protobuf_c_boolean has_force_irmap;
+  protobuf_c_boolean force_irmap;
+  size_t n_exec_cmd;
+  char **exec_cmd;
+  size_t n_ext_mnt;
+  ExtMountMap **ext_mnt;
+  protobuf_c_boolean has_manage_cgroups;
+  protobuf_c_boolean manage_cgroups;
+  size_t n_cg_root;
+  CgroupRoot **cg_root;
+  protobuf_c_boolean has_rst_sibling;
+  protobuf_c_boolean rst_sibling;
+  size_t n_inherit_fd;
+  InheritFd **inherit_fd;
+  protobuf_c_boolean has_auto_ext_mnt;
+  protobuf_c_boolean auto_ext_mnt;
+  protobuf_c_boolean has_ext_sharing;
+  protobuf_c_boolean ext_sharing;
+  protobuf_c_boolean has_ext_masters;
+  protobuf_c_boolean ext_masters;
+  size_t n_skip_mnt;
+  char **skip_mnt;
+  size_t n_enable_fs;
+  char **enable_fs;
+  size_t n_unix_sk_ino;
+  UnixSk **unix_sk_ino;
+  protobuf_c_boolean has_manage_cgroups_mode;
+  CriuCgMode manage_cgroups_mode;
+  protobuf_c_boolean has_ghost_limit;
+  uint32_t ghost_limit;
+  size_t n_irmap_scan_paths;
+  char **irmap_scan_paths;
+  size_t n_external;
+  char **external;
+  protobuf_c_boolean has_empty_ns;
+  uint32_t empty_ns;
+  size_t n_join_ns;
+  JoinNamespace **join_ns;
+  char * cgroup_props;
+  char * cgroup_props_file;
+  size_t n_cgroup_dump_controller;
+  char **cgroup_dump_controller;
+  char * freeze_cgroup;
+  protobuf_c_boolean has_timeout;
+  uint32_t timeout;
+  protobuf_c_boolean has_tcp_skip_in_flight;
+  protobuf_c_boolean tcp_skip_in_flight;
+  protobuf_c_boolean has_weak_sysctls;
+  protobuf_c_boolean weak_sysctls;
+  protobuf_c_boolean has_lazy_pages;
+  protobuf_c_boolean lazy_pages;
+  protobuf_c_boolean has_status_fd;
+  int32_t status_fd;
+  protobuf_c_boolean has_orphan_pts_master;
+  protobuf_c_boolean orphan_pts_master;
+  char * config_file;
+  protobuf_c_boolean has_tcp_close;
+  protobuf_c_boolean tcp_close;
+  char * lsm_profile;
+  char * tls_cacert;
+  char * tls_cacrl;
+  char * tls_cert;
+  char * tls_key;
+  protobuf_c_boolean has_tls;
+  protobuf_c_boolean tls;
+  protobuf_c_boolean has_tls_no_cn_verify;
+  protobuf_c_boolean tls_no_cn_verify;
+  char * cgroup_yard;
+  protobuf_c_boolean has_pre_dump_mode;
+  CriuPreDumpMode pre_dump_mode;
+  protobuf_c_boolean has_pidfd_store_sk;
+  int32_t pidfd_store_sk;
+  char * lsm_mount_context;
+  protobuf_c_boolean has_network_lock;
+  CriuNetworkLockMethod network_lock;
+  protobuf_c_boolean has_mntns_compat_mode;
+  protobuf_c_boolean mntns_compat_mode;
+  protobuf_c_boolean has_skip_file_rwx_check;
+  protobuf_c_boolean skip_file_rwx_check;
+  protobuf_c_boolean has_unprivileged;
+  protobuf_c_boolean unprivileged;
+  protobuf_c_boolean has_switch_;
+  protobuf_c_boolean switch_;
+  protobuf_c_boolean has_compress_pages;
+  protobuf_c_boolean compress_pages;
+  protobuf_c_boolean has_pre_dump_max_iters;
+  uint32_t pre_dump_max_iters;
+  protobuf_c_boolean has_pre_dump_target_ms;
+  uint32_t pre_dump_target_ms;
+  protobuf_c_boolean has_overlap_dump;
+  protobuf_c_boolean overlap_dump;
+  protobuf_c_boolean has_ps_streams;
+  uint32_t ps_streams;
+};
+#define CRIU_OPTS__INIT { PROTOBUF_C_MESSAGE_INIT(&criu_opts__descriptor) }
+void criu_opts__init(CriuOpts *message);
+size_t criu_opts__get_packed_size(const CriuOpts *message);
+size_t criu_opts__pack(const CriuOpts *message, uint8_t *out);
+CriuOpts *criu_opts__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void criu_opts__free_unpacked(CriuOpts *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor criu_opts__descriptor;
+struct _CriuDumpResp {
+  ProtobufCMessage base;
+  protobuf_c_boolean has_restored;
+  protobuf_c_boolean restored;
+};
+#define CRIU_DUMP_RESP__INIT { PROTOBUF_C_MESSAGE_INIT(&criu_dump_resp__descriptor) }
+void criu_dump_resp__init(CriuDumpResp *message);
+size_t criu_dump_resp__get_packed_size(const CriuDumpResp *message);
+size_t criu_dump_resp__pack(const CriuDumpResp *message, uint8_t *out);
+CriuDumpResp *criu_dump_resp__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void criu_dump_resp__free_unpacked(CriuDumpResp *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor criu_dump_resp__descriptor;
+struct _CriuRestoreResp {
+  ProtobufCMessage base;
+  int32_t pid;
+};
+#define CRIU_RESTORE_RESP__INIT { PROTOBUF_C_MESSAGE_INIT(&criu_restore_resp__descriptor) }
+void criu_restore_resp__init(CriuRestoreResp *message);
+size_t criu_restore_resp__get_packed_size(const CriuRestoreResp *message);
+size_t criu_restore_resp__pack(const CriuRestoreResp *message, uint8_t *out);
+CriuRestoreResp *criu_restore_resp__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void criu_restore_resp__free_unpacked(CriuRestoreResp *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor criu_restore_resp__descriptor;
+struct _CriuPreDumpIter {
+  ProtobufCMessage base;
+  uint32_t iter;
+  uint64_t pages_written;
+  uint64_t dirty_rate;
+  uint32_t projected_ms;
+};
+#define CRIU_PRE_DUMP_ITER__INIT { PROTOBUF_C_MESSAGE_INIT(&criu_pre_dump_iter__descriptor) }
+void criu_pre_dump_iter__init(CriuPreDumpIter *message);
+size_t criu_pre_dump_iter__get_packed_size(const CriuPreDumpIter *message);
+size_t criu_pre_dump_iter__pack(const CriuPreDumpIter *message, uint8_t *out);
+CriuPreDumpIter *criu_pre_dump_iter__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void criu_pre_dump_iter__free_unpacked(CriuPreDumpIter *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor criu_pre_dump_iter__descriptor;
+struct _CriuNotify {
+  ProtobufCMessage base;
+  char * script;
+  protobuf_c_boolean has_pid;
+  int32_t pid;
+  CriuPreDumpIter * pre_dump;
+};
+#define CRIU_NOTIFY__INIT { PROTOBUF_C_MESSAGE_INIT(&criu_notify__descriptor) }
+void criu_notify__init(CriuNotify *message);
+size_t criu_notify__get_packed_size(const CriuNotify *message);
+size_t criu_notify__pack(const CriuNotify *message, uint8_t *out);
+CriuNotify *criu_notify__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void criu_notify__free_unpacked(CriuNotify *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor criu_notify__descriptor;
+struct _CriuFeatures {
+  ProtobufCMessage base;
+  protobuf_c_boolean has_mem_track;
+  protobuf_c_boolean mem_track;
+  protobuf_c_boolean has_lazy_pages;
+  protobuf_c_boolean lazy_pages;
+  protobuf_c_boolean has_pidfd_store;
+  protobuf_c_boolean pidfd_store;
+};
+#define CRIU_FEATURES__INIT { PROTOBUF_C_MESSAGE_INIT(&criu_features__descriptor) }
+void criu_features__init(CriuFeatures *message);
+size_t criu_features__get_packed_size(const CriuFeatures *message);
+size_t criu_features__pack(const CriuFeatures *message, uint8_t *out);
+CriuFeatures *criu_features__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void criu_features__free_unpacked(CriuFeatures *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor criu_features__descriptor;
+struct _CriuReq {
+  ProtobufCMessage base;
+  CriuReqType type;
+  CriuOpts * opts;
+  protobuf_c_boolean has_notify_success;
+  protobuf_c_boolean notify_success;
+  protobuf_c_boolean has_keep_open;
+  protobuf_c_boolean keep_open;
+  CriuFeatures * features;
+  protobuf_c_boolean has_pid;
+  uint32_t pid;
+};
+#define CRIU_REQ__INIT { PROTOBUF_C_MESSAGE_INIT(&criu_req__descriptor) }
+void criu_req__init(CriuReq *message);
+size_t criu_req__get_packed_size(const CriuReq *message);
+size_t criu_req__pack(const CriuReq *message, uint8_t *out);
+CriuReq *criu_req__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void criu_req__free_unpacked(CriuReq *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor criu_req__descriptor;
+struct _CriuResp {
+  ProtobufCMessage base;
+  CriuReqType type;
+  protobuf_c_boolean success;
+  CriuDumpResp * dump;
+  CriuRestoreResp * restore;
+  CriuNotify * notify;
+  CriuPageServerInfo * ps;
+  protobuf_c_boolean has_cr_errno;
+  int32_t cr_errno;
+  CriuFeatures * features;
+  char * cr_errmsg;
+  CriuVersion * version;
+  protobuf_c_boolean has_status;
+  int32_t status;
+};
+#define CRIU_RESP__INIT { PROTOBUF_C_MESSAGE_INIT(&criu_resp__descriptor) }
+void criu_resp__init(CriuResp *message);
+size_t criu_resp__get_packed_size(const CriuResp *message);
+size_t criu_resp__pack(const CriuResp *message, uint8_t *out);
+CriuResp *criu_resp__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void criu_resp__free_unpacked(CriuResp *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor criu_resp__descriptor;
+struct _CriuVersion {
+  ProtobufCMessage base;
+  int32_t major_number;
+  int32_t minor_number;
+  char * gitid;
+  protobuf_c_boolean has_sublevel;
+  int32_t sublevel;
+  protobuf_c_boolean has_extra;
+  int32_t extra;
+  char * name;
+};
+#define CRIU_VERSION__INIT { PROTOBUF_C_MESSAGE_INIT(&criu_version__descriptor) }
+void criu_version__init(CriuVersion *message);
+size_t criu_version__get_packed_size(const CriuVersion *message);
+size_t criu_version__pack(const CriuVersion *message, uint8_t *out);
+CriuVersion *criu_version__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void criu_version__free_unpacked(CriuVersion *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor criu_version__descriptor;
+#endif
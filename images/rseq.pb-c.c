@@ -0,0 +1 @@
+#include "rseq.pb-c.h"
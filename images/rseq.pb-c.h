@@ -0,0 +1,20 @@
+#ifndef __RSEQ_PB_C_H__
+#define __RSEQ_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _RseqEntry RseqEntry;
+struct _RseqEntry {
+  ProtobufCMessage base;
+  uint64_t rseq_abi_pointer;
+  uint32_t rseq_abi_size;
+  uint32_t signature;
+  protobuf_c_boolean has_rseq_cs_pointer;
+  uint64_t rseq_cs_pointer;
+};
+#define RSEQ_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&rseq_entry__descriptor) }
+void rseq_entry__init(RseqEntry *message);
+size_t rseq_entry__get_packed_size(const RseqEntry *message);
+size_t rseq_entry__pack(const RseqEntry *message, uint8_t *out);
+RseqEntry *rseq_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void rseq_entry__free_unpacked(RseqEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor rseq_entry__descriptor;
+#endif
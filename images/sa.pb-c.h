@@ -0,0 +1,24 @@
+#ifndef __SA_PB_C_H__
+#define __SA_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+#include "opts.pb-c.h"
+typedef struct _SaEntry SaEntry;
+struct _SaEntry {
+  ProtobufCMessage base;
+  uint64_t sigaction;
+  uint64_t flags;
+  uint64_t restorer;
+  uint64_t mask;
+  protobuf_c_boolean has_compat_sigaction;
+  protobuf_c_boolean compat_sigaction;
+  protobuf_c_boolean has_mask_extended;
+  uint64_t mask_extended;
+};
+#define SA_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&sa_entry__descriptor) }
+void sa_entry__init(SaEntry *message);
+size_t sa_entry__get_packed_size(const SaEntry *message);
+size_t sa_entry__pack(const SaEntry *message, uint8_t *out);
+SaEntry *sa_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void sa_entry__free_unpacked(SaEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor sa_entry__descriptor;
+#endif
@@ -0,0 +1 @@
+#include "seccomp.pb-c.h"
@@ -0,0 +1,33 @@
+#ifndef __SECCOMP_PB_C_H__
+#define __SECCOMP_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _SeccompFilter SeccompFilter;
+typedef struct _SeccompEntry SeccompEntry;
+struct _SeccompFilter {
+  ProtobufCMessage base;
+  ProtobufCBinaryData filter;
+  protobuf_c_boolean has_prev;
+  uint32_t prev;
+  protobuf_c_boolean has_flags;
+  uint32_t flags;
+};
+#define SECCOMP_FILTER__INIT { PROTOBUF_C_MESSAGE_INIT(&seccomp_filter__descriptor) }
+void seccomp_filter__init(SeccompFilter *message);
+size_t seccomp_filter__get_packed_size(const SeccompFilter *message);
+size_t seccomp_filter__pack(const SeccompFilter *message, uint8_t *out);
+SeccompFilter *seccomp_filter__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void seccomp_filter__free_unpacked(SeccompFilter *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor seccomp_filter__descriptor;
+struct _SeccompEntry {
+  ProtobufCMessage base;
+  size_t n_seccomp_filters;
+  SeccompFilter **seccomp_filters;
+};
+#define SECCOMP_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&seccomp_entry__descriptor) }
+void seccomp_entry__init(SeccompEntry *message);
+size_t seccomp_entry__get_packed_size(const SeccompEntry *message);
+size_t seccomp_entry__pack(const SeccompEntry *message, uint8_t *out);
+SeccompEntry *seccomp_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void seccomp_entry__free_unpacked(SeccompEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor seccomp_entry__descriptor;
+#endif
@@ -0,0 +1,29 @@
+#ifndef __SIGINFO_PB_C_H__
+#define __SIGINFO_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _SiginfoEntry SiginfoEntry;
+typedef struct _SignalQueueEntry SignalQueueEntry;
+struct _SiginfoEntry {
+  ProtobufCMessage base;
+  ProtobufCBinaryData siginfo;
+};
+#define SIGINFO_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&siginfo_entry__descriptor) }
+void siginfo_entry__init(SiginfoEntry *message);
+size_t siginfo_entry__get_packed_size(const SiginfoEntry *message);
+size_t siginfo_entry__pack(const SiginfoEntry *message, uint8_t *out);
+SiginfoEntry *siginfo_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void siginfo_entry__free_unpacked(SiginfoEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor siginfo_entry__descriptor;
+struct _SignalQueueEntry {
+  ProtobufCMessage base;
+  size_t n_signals;
+  SiginfoEntry **signals;
+};
+#define SIGNAL_QUEUE_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&signal_queue_entry__descriptor) }
+void signal_queue_entry__init(SignalQueueEntry *message);
+size_t signal_queue_entry__get_packed_size(const SignalQueueEntry *message);
+size_t signal_queue_entry__pack(const SignalQueueEntry *message, uint8_t *out);
+SignalQueueEntry *signal_queue_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void signal_queue_entry__free_unpacked(SignalQueueEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor signal_queue_entry__descriptor;
+#endif
@@ -0,0 +1,21 @@
+#ifndef __SIGNALFD_PB_C_H__
+#define __SIGNALFD_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+#include "opts.pb-c.h"
+#include "fown.pb-c.h"
+typedef struct _SignalfdEntry SignalfdEntry;
+struct _SignalfdEntry {
+  ProtobufCMessage base;
+  uint32_t id;
+  uint32_t flags;
+  FownEntry * fown;
+  uint64_t sigmask;
+};
+#define SIGNALFD_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&signalfd_entry__descriptor) }
+void signalfd_entry__init(SignalfdEntry *message);
+size_t signalfd_entry__get_packed_size(const SignalfdEntry *message);
+size_t signalfd_entry__pack(const SignalfdEntry *message, uint8_t *out);
+SignalfdEntry *signalfd_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void signalfd_entry__free_unpacked(SignalfdEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor signalfd_entry__descriptor;
+#endif
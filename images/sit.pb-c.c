@@ -0,0 +1 @@
+#include "sit.pb-c.h"
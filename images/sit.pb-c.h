@@ -0,0 +1,48 @@
+#ifndef __SIT_PB_C_H__
+#define __SIT_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+#include "opts.pb-c.h"
+typedef struct _SitEntry SitEntry;
+struct _SitEntry {
+  ProtobufCMessage base;
+  protobuf_c_boolean has_link;
+  uint32_t link;
+  size_t n_local;
+  uint32_t *local;
+  size_t n_remote;
+  uint32_t *remote;
+  protobuf_c_boolean has_ttl;
+  uint32_t ttl;
+  protobuf_c_boolean has_tos;
+  uint32_t tos;
+  protobuf_c_boolean has_pmtudisc;
+  protobuf_c_boolean pmtudisc;
+  protobuf_c_boolean has_proto;
+  uint32_t proto;
+  protobuf_c_boolean has_flags;
+  uint32_t flags;
+  protobuf_c_boolean has_encap_type;
+  uint32_t encap_type;
+  protobuf_c_boolean has_encap_flags;
+  uint32_t encap_flags;
+  protobuf_c_boolean has_encap_sport;
+  uint32_t encap_sport;
+  protobuf_c_boolean has_encap_dport;
+  uint32_t encap_dport;
+  protobuf_c_boolean has_rd_prefixlen;
+  uint32_t rd_prefixlen;
+  size_t n_rd_prefix;
+  uint32_t *rd_prefix;
+  protobuf_c_boolean has_relay_prefixlen;
+  uint32_t relay_prefixlen;
+  size_t n_relay_prefix;
+  uint32_t *relay_prefix;
+};
+#define SIT_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&sit_entry__descriptor) }
+void sit_entry__init(SitEntry *message);
+size_t sit_entry__get_packed_size(const SitEntry *message);
+size_t sit_entry__pack(const SitEntry *message, uint8_t *out);
+SitEntry *sit_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void sit_entry__free_unpacked(SitEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor sit_entry__descriptor;
+#endif
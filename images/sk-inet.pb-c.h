@@ -0,0 +1,77 @@
+#ifndef __SK_INET_PB_C_H__
+#define __SK_INET_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+#include "opts.pb-c.h"
+#include "fown.pb-c.h"
+#include "sk-opts.pb-c.h"
+typedef struct _IpOptsRawEntry IpOptsRawEntry;
+typedef struct _IpOptsEntry IpOptsEntry;
+typedef struct _InetSkEntry InetSkEntry;
+struct _IpOptsRawEntry {
+  ProtobufCMessage base;
+  protobuf_c_boolean has_hdrincl;
+  protobuf_c_boolean hdrincl;
+  protobuf_c_boolean has_nodefrag;
+  protobuf_c_boolean nodefrag;
+  protobuf_c_boolean has_checksum;
+  protobuf_c_boolean checksum;
+  size_t n_icmpv_filter;
+  uint32_t *icmpv_filter;
+};
+#define IP_OPTS_RAW_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&ip_opts_raw_entry__descriptor) }
+void ip_opts_raw_entry__init(IpOptsRawEntry *message);
+size_t ip_opts_raw_entry__get_packed_size(const IpOptsRawEntry *message);
+size_t ip_opts_raw_entry__pack(const IpOptsRawEntry *message, uint8_t *out);
+IpOptsRawEntry *ip_opts_raw_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void ip_opts_raw_entry__free_unpacked(IpOptsRawEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor ip_opts_raw_entry__descriptor;
+struct _IpOptsEntry {
+  ProtobufCMessage base;
+  protobuf_c_boolean has_freebind;
+  protobuf_c_boolean freebind;
+  IpOptsRawEntry * raw;
+  protobuf_c_boolean has_pktinfo;
+  protobuf_c_boolean pktinfo;
+};
+#define IP_OPTS_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&ip_opts_entry__descriptor) }
+void ip_opts_entry__init(IpOptsEntry *message);
+size_t ip_opts_entry__get_packed_size(const IpOptsEntry *message);
+size_t ip_opts_entry__pack(const IpOptsEntry *message, uint8_t *out);
+IpOptsEntry *ip_opts_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void ip_opts_entry__free_unpacked(IpOptsEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor ip_opts_entry__descriptor;
+struct _InetSkEntry {
+  ProtobufCMessage base;
+  uint32_t id;
+  uint32_t ino;
+  uint32_t family;
+  uint32_t type;
+  uint32_t proto;
+  uint32_t state;
+  uint32_t src_port;
+  uint32_t dst_port;
+  uint32_t flags;
+  uint32_t backlog;
+  size_t n_src_addr;
+  uint32_t *src_addr;
+  size_t n_dst_addr;
+  uint32_t *dst_addr;
+  FownEntry * fown;
+  SkOptsEntry * opts;
+  protobuf_c_boolean has_v6only;
+  protobuf_c_boolean v6only;
+  IpOptsEntry * ip_opts;
+  char * ifname;
+  protobuf_c_boolean has_ns_id;
+  uint32_t ns_id;
+  protobuf_c_boolean has_shutdown;
+  SkShutdown shutdown;
+};
+#define INET_SK_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&inet_sk_entry__descriptor) }
+void inet_sk_entry__init(InetSkEntry *message);
+size_t inet_sk_entry__get_packed_size(const InetSkEntry *message);
+size_t inet_sk_entry__pack(const InetSkEntry *message, uint8_t *out);
+InetSkEntry *inet_sk_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void inet_sk_entry__free_unpacked(InetSkEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor inet_sk_entry__descriptor;
+#endif
@@ -0,0 +1 @@
+#include "sk-netlink.pb-c.h"
@@ -0,0 +1,32 @@
+#ifndef __SK_NETLINK_PB_C_H__
+#define __SK_NETLINK_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+#include "opts.pb-c.h"
+#include "fown.pb-c.h"
+#include "sk-opts.pb-c.h"
+typedef struct _NetlinkSkEntry NetlinkSkEntry;
+struct _NetlinkSkEntry {
+  ProtobufCMessage base;
+  uint32_t id;
+  uint32_t ino;
+  uint32_t protocol;
+  uint32_t state;
+  uint32_t flags;
+  uint32_t portid;
+  size_t n_groups;
+  uint32_t *groups;
+  uint32_t dst_portid;
+  uint32_t dst_group;
+  FownEntry * fown;
+  SkOptsEntry * opts;
+  protobuf_c_boolean has_ns_id;
+  uint32_t ns_id;
+};
+#define NETLINK_SK_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&netlink_sk_entry__descriptor) }
+void netlink_sk_entry__init(NetlinkSkEntry *message);
+size_t netlink_sk_entry__get_packed_size(const NetlinkSkEntry *message);
+size_t netlink_sk_entry__pack(const NetlinkSkEntry *message, uint8_t *out);
+NetlinkSkEntry *netlink_sk_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void netlink_sk_entry__free_unpacked(NetlinkSkEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor netlink_sk_entry__descriptor;
+#endif
@@ -0,0 +1 @@
+#include "sk-opts.pb-c.h"
@@ -0,0 +1,65 @@
+#ifndef __SK_OPTS_PB_C_H__
+#define __SK_OPTS_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _SkOptsEntry SkOptsEntry;
+typedef enum _SkShutdown {
+  SK_SHUTDOWN__NONE = 0,
+  SK_SHUTDOWN__READ = 1,
+  SK_SHUTDOWN__WRITE = 2,
+  SK_SHUTDOWN__BOTH = 3,
+} SkShutdown;
+extern const ProtobufCEnumDescriptor sk_shutdown__descriptor;
+struct _SkOptsEntry {
+  ProtobufCMessage base;
+  uint32_t so_sndbuf;
+  uint32_t so_rcvbuf;
+  uint64_t so_snd_tmo_sec;
+  uint64_t so_snd_tmo_usec;
+  uint64_t so_rcv_tmo_sec;
+  uint64_t so_rcv_tmo_usec;
+  protobuf_c_boolean has_reuseaddr;
+  protobuf_c_boolean reuseaddr;
+  protobuf_c_boolean has_so_priority;
+  uint32_t so_priority;
+  protobuf_c_boolean has_so_rcvlowat;
+  uint32_t so_rcvlowat;
+  protobuf_c_boolean has_so_mark;
+  uint32_t so_mark;
+  protobuf_c_boolean has_so_passcred;
+  protobuf_c_boolean so_passcred;
+  protobuf_c_boolean has_so_passsec;
+  protobuf_c_boolean so_passsec;
+  protobuf_c_boolean has_so_dontroute;
+  protobuf_c_boolean so_dontroute;
+  protobuf_c_boolean has_so_no_check;
+  protobuf_c_boolean so_no_check;
+  char * so_bound_dev;
+  size_t n_so_filter;
+  uint64_t *so_filter;
+  protobuf_c_boolean has_so_reuseport;
+  protobuf_c_boolean so_reuseport;
+  protobuf_c_boolean has_so_broadcast;
+  protobuf_c_boolean so_broadcast;
+  protobuf_c_boolean has_so_keepalive;
+  protobuf_c_boolean so_keepalive;
+  protobuf_c_boolean has_tcp_keepcnt;
+  uint32_t tcp_keepcnt;
+  protobuf_c_boolean has_tcp_keepidle;
+  uint32_t tcp_keepidle;
+  protobuf_c_boolean has_tcp_keepintvl;
+  uint32_t tcp_keepintvl;
+  protobuf_c_boolean has_so_oobinline;
+  uint32_t so_oobinline;
+  protobuf_c_boolean has_so_linger;
+  uint32_t so_linger;
+  protobuf_c_boolean has_so_buf_lock;
+  uint32_t so_buf_lock;
+};
+#define SK_OPTS_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&sk_opts_entry__descriptor) }
+void sk_opts_entry__init(SkOptsEntry *message);
+size_t sk_opts_entry__get_packed_size(const SkOptsEntry *message);
+size_t sk_opts_entry__pack(const SkOptsEntry *message, uint8_t *out);
+SkOptsEntry *sk_opts_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void sk_opts_entry__free_unpacked(SkOptsEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor sk_opts_entry__descriptor;
+#endif
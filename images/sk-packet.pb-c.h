@@ -0,0 +1,33 @@
+#ifndef __SK_PACKET_PB_C_H__
+#define __SK_PACKET_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _ScmEntry ScmEntry;
+typedef struct _SkPacketEntry SkPacketEntry;
+struct _ScmEntry {
+  ProtobufCMessage base;
+  uint32_t type;
+  size_t n_rights;
+  uint32_t *rights;
+};
+#define SCM_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&scm_entry__descriptor) }
+void scm_entry__init(ScmEntry *message);
+size_t scm_entry__get_packed_size(const ScmEntry *message);
+size_t scm_entry__pack(const ScmEntry *message, uint8_t *out);
+ScmEntry *scm_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void scm_entry__free_unpacked(ScmEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor scm_entry__descriptor;
+struct _SkPacketEntry {
+  ProtobufCMessage base;
+  uint32_t id_for;
+  uint32_t length;
+  size_t n_scm;
+  ScmEntry **scm;
+};
+#define SK_PACKET_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&sk_packet_entry__descriptor) }
+void sk_packet_entry__init(SkPacketEntry *message);
+size_t sk_packet_entry__get_packed_size(const SkPacketEntry *message);
+size_t sk_packet_entry__pack(const SkPacketEntry *message, uint8_t *out);
+SkPacketEntry *sk_packet_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void sk_packet_entry__free_unpacked(SkPacketEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor sk_packet_entry__descriptor;
+#endif
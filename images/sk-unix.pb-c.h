@@ -0,0 +1,53 @@
+#ifndef __SK_UNIX_PB_C_H__
+#define __SK_UNIX_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+#include "opts.pb-c.h"
+#include "fown.pb-c.h"
+#include "sk-opts.pb-c.h"
+typedef struct _FilePermsEntry FilePermsEntry;
+typedef struct _UnixSkEntry UnixSkEntry;
+struct _FilePermsEntry {
+  ProtobufCMessage base;
+  uint32_t mode;
+  uint32_t uid;
+  uint32_t gid;
+};
+#define FILE_PERMS_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&file_perms_entry__descriptor) }
+void file_perms_entry__init(FilePermsEntry *message);
+size_t file_perms_entry__get_packed_size(const FilePermsEntry *message);
+size_t file_perms_entry__pack(const FilePermsEntry *message, uint8_t *out);
+FilePermsEntry *file_perms_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void file_perms_entry__free_unpacked(FilePermsEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor file_perms_entry__descriptor;
+struct _UnixSkEntry {
+  ProtobufCMessage base;
+  uint32_t id;
+  uint32_t ino;
+  uint32_t type;
+  uint32_t state;
+  uint32_t flags;
+  uint32_t uflags;
+  uint32_t backlog;
+  uint32_t peer;
+  FownEntry * fown;
+  SkOptsEntry * opts;
+  ProtobufCBinaryData name;
+  protobuf_c_boolean has_shutdown;
+  SkShutdown shutdown;
+  FilePermsEntry * file_perms;
+  char * name_dir;
+  protobuf_c_boolean has_deleted;
+  protobuf_c_boolean deleted;
+  protobuf_c_boolean has_ns_id;
+  uint32_t ns_id;
+  protobuf_c_boolean has_mnt_id;
+  int32_t mnt_id;
+};
+#define UNIX_SK_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&unix_sk_entry__descriptor) }
+void unix_sk_entry__init(UnixSkEntry *message);
+size_t unix_sk_entry__get_packed_size(const UnixSkEntry *message);
+size_t unix_sk_entry__pack(const UnixSkEntry *message, uint8_t *out);
+UnixSkEntry *unix_sk_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void unix_sk_entry__free_unpacked(UnixSkEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor unix_sk_entry__descriptor;
+#endif
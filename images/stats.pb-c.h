@@ -0,0 +1,65 @@
+#ifndef __STATS_PB_C_H__
+#define __STATS_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _DumpStatsEntry DumpStatsEntry;
+typedef struct _RestoreStatsEntry RestoreStatsEntry;
+typedef struct _StatsEntry StatsEntry;
+struct _DumpStatsEntry {
+  ProtobufCMessage base;
+  uint32_t freezing_time;
+  uint32_t frozen_time;
+  uint32_t memdump_time;
+  uint32_t memwrite_time;
+  uint64_t pages_scanned;
+  uint64_t pages_skipped_parent;
+  uint64_t pages_written;
+  protobuf_c_boolean has_irmap_resolve;
+  uint32_t irmap_resolve;
+  uint64_t pages_lazy;
+  protobuf_c_boolean has_page_pipes;
+  uint64_t page_pipes;
+  protobuf_c_boolean has_page_pipe_bufs;
+  uint64_t page_pipe_bufs;
+  protobuf_c_boolean has_shpages_scanned;
+  uint64_t shpages_scanned;
+  protobuf_c_boolean has_shpages_skipped_parent;
+  uint64_t shpages_skipped_parent;
+  protobuf_c_boolean has_shpages_written;
+  uint64_t shpages_written;
+};
+#define DUMP_STATS_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&dump_stats_entry__descriptor) }
+void dump_stats_entry__init(DumpStatsEntry *message);
+size_t dump_stats_entry__get_packed_size(const DumpStatsEntry *message);
+size_t dump_stats_entry__pack(const DumpStatsEntry *message, uint8_t *out);
+DumpStatsEntry *dump_stats_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void dump_stats_entry__free_unpacked(DumpStatsEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor dump_stats_entry__descriptor;
+struct _RestoreStatsEntry {
+  ProtobufCMessage base;
+  uint64_t pages_compared;
+  uint64_t pages_skipped_cow;
+  uint32_t forking_time;
+  uint32_t restore_time;
+  protobuf_c_boolean has_pages_restored;
+  uint64_t pages_restored;
+};
+#define RESTORE_STATS_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&restore_stats_entry__descriptor) }
+void restore_stats_entry__init(RestoreStatsEntry *message);
+size_t restore_stats_entry__get_packed_size(const RestoreStatsEntry *message);
+size_t restore_stats_entry__pack(const RestoreStatsEntry *message, uint8_t *out);
+RestoreStatsEntry *restore_stats_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void restore_stats_entry__free_unpacked(RestoreStatsEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor restore_stats_entry__descriptor;
+struct _StatsEntry {
+  ProtobufCMessage base;
+  DumpStatsEntry * dump;
+  RestoreStatsEntry * restore;
+};
+#define STATS_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&stats_entry__descriptor) }
+void stats_entry__init(StatsEntry *message);
+size_t stats_entry__get_packed_size(const StatsEntry *message);
+size_t stats_entry__pack(const StatsEntry *message, uint8_t *out);
+StatsEntry *stats_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void stats_entry__free_unpacked(StatsEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor stats_entry__descriptor;
+#endif
@@ -0,0 +1 @@
+#include "sysctl.pb-c.h"
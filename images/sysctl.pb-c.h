@@ -0,0 +1,24 @@
+#ifndef __SYSCTL_PB_C_H__
+#define __SYSCTL_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _SysctlEntry SysctlEntry;
+typedef enum _SysctlType {
+  SYSCTL_TYPE__CTL_STR = 5,
+  SYSCTL_TYPE__CTL_32 = 6,
+} SysctlType;
+extern const ProtobufCEnumDescriptor sysctltype__descriptor;
+struct _SysctlEntry {
+  ProtobufCMessage base;
+  SysctlType type;
+  protobuf_c_boolean has_iarg;
+  int32_t iarg;
+  char * sarg;
+};
+#define SYSCTL_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&sysctl_entry__descriptor) }
+void sysctl_entry__init(SysctlEntry *message);
+size_t sysctl_entry__get_packed_size(const SysctlEntry *message);
+size_t sysctl_entry__pack(const SysctlEntry *message, uint8_t *out);
+SysctlEntry *sysctl_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void sysctl_entry__free_unpacked(SysctlEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor sysctl_entry__descriptor;
+#endif
@@ -0,0 +1 @@
+#include "tcp-stream.pb-c.h"
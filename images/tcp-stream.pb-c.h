@@ -0,0 +1,43 @@
+#ifndef __TCP_STREAM_PB_C_H__
+#define __TCP_STREAM_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+#include "opts.pb-c.h"
+typedef struct _TcpStreamEntry TcpStreamEntry;
+struct _TcpStreamEntry {
+  ProtobufCMessage base;
+  uint32_t inq_len;
+  uint32_t inq_seq;
+  uint32_t outq_len;
+  uint32_t outq_seq;
+  uint32_t opt_mask;
+  uint32_t snd_wscale;
+  uint32_t mss_clamp;
+  protobuf_c_boolean has_rcv_wscale;
+  uint32_t rcv_wscale;
+  protobuf_c_boolean has_timestamp;
+  uint32_t timestamp;
+  protobuf_c_boolean has_cork;
+  protobuf_c_boolean cork;
+  protobuf_c_boolean has_nodelay;
+  protobuf_c_boolean nodelay;
+  protobuf_c_boolean has_unsq_len;
+  uint32_t unsq_len;
+  protobuf_c_boolean has_snd_wl1;
+  uint32_t snd_wl1;
+  protobuf_c_boolean has_snd_wnd;
+  uint32_t snd_wnd;
+  protobuf_c_boolean has_max_window;
+  uint32_t max_window;
+  protobuf_c_boolean has_rcv_wnd;
+  uint32_t rcv_wnd;
+  protobuf_c_boolean has_rcv_wup;
+  uint32_t rcv_wup;
+};
+#define TCP_STREAM_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&tcp_stream_entry__descriptor) }
+void tcp_stream_entry__init(TcpStreamEntry *message);
+size_t tcp_stream_entry__get_packed_size(const TcpStreamEntry *message);
+size_t tcp_stream_entry__pack(const TcpStreamEntry *message, uint8_t *out);
+TcpStreamEntry *tcp_stream_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void tcp_stream_entry__free_unpacked(TcpStreamEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor tcp_stream_entry__descriptor;
+#endif
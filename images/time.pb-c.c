@@ -0,0 +1 @@
+#include "time.pb-c.h"
@@ -0,0 +1,17 @@
+#ifndef __TIME_PB_C_H__
+#define __TIME_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _Timeval Timeval;
+struct _Timeval {
+  ProtobufCMessage base;
+  uint64_t tv_sec;
+  uint64_t tv_usec;
+};
+#define TIMEVAL__INIT { PROTOBUF_C_MESSAGE_INIT(&timeval__descriptor) }
+void timeval__init(Timeval *message);
+size_t timeval__get_packed_size(const Timeval *message);
+size_t timeval__pack(const Timeval *message, uint8_t *out);
+Timeval *timeval__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void timeval__free_unpacked(Timeval *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor timeval__descriptor;
+#endif
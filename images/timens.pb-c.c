@@ -0,0 +1 @@
+#include "timens.pb-c.h"
@@ -0,0 +1,30 @@
+#ifndef __TIMENS_PB_C_H__
+#define __TIMENS_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _Timespec Timespec;
+typedef struct _TimensEntry TimensEntry;
+struct _Timespec {
+  ProtobufCMessage base;
+  uint64_t tv_sec;
+  uint64_t tv_nsec;
+};
+#define TIMESPEC__INIT { PROTOBUF_C_MESSAGE_INIT(&timespec__descriptor) }
+void timespec__init(Timespec *message);
+size_t timespec__get_packed_size(const Timespec *message);
+size_t timespec__pack(const Timespec *message, uint8_t *out);
+Timespec *timespec__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void timespec__free_unpacked(Timespec *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor timespec__descriptor;
+struct _TimensEntry {
+  ProtobufCMessage base;
+  Timespec * monotonic;
+  Timespec * boottime;
+};
+#define TIMENS_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&timens_entry__descriptor) }
+void timens_entry__init(TimensEntry *message);
+size_t timens_entry__get_packed_size(const TimensEntry *message);
+size_t timens_entry__pack(const TimensEntry *message, uint8_t *out);
+TimensEntry *timens_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void timens_entry__free_unpacked(TimensEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor timens_entry__descriptor;
+#endif
@@ -0,0 +1,58 @@
+#ifndef __TIMER_PB_C_H__
+#define __TIMER_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _ItimerEntry ItimerEntry;
+typedef struct _PosixTimerEntry PosixTimerEntry;
+typedef struct _TaskTimersEntry TaskTimersEntry;
+struct _ItimerEntry {
+  ProtobufCMessage base;
+  uint64_t isec;
+  uint64_t iusec;
+  uint64_t vsec;
+  uint64_t vusec;
+};
+#define ITIMER_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&itimer_entry__descriptor) }
+void itimer_entry__init(ItimerEntry *message);
+size_t itimer_entry__get_packed_size(const ItimerEntry *message);
+size_t itimer_entry__pack(const ItimerEntry *message, uint8_t *out);
+ItimerEntry *itimer_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void itimer_entry__free_unpacked(ItimerEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor itimer_entry__descriptor;
+struct _PosixTimerEntry {
+  ProtobufCMessage base;
+  uint32_t it_id;
+  uint32_t clock_id;
+  uint32_t si_signo;
+  uint32_t it_sigev_notify;
+  uint64_t sival_ptr;
+  uint32_t overrun;
+  uint64_t isec;
+  uint64_t insec;
+  uint64_t vsec;
+  uint64_t vnsec;
+  protobuf_c_boolean has_notify_thread_id;
+  int32_t notify_thread_id;
+};
+#define POSIX_TIMER_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&posix_timer_entry__descriptor) }
+void posix_timer_entry__init(PosixTimerEntry *message);
+size_t posix_timer_entry__get_packed_size(const PosixTimerEntry *message);
+size_t posix_timer_entry__pack(const PosixTimerEntry *message, uint8_t *out);
+PosixTimerEntry *posix_timer_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void posix_timer_entry__free_unpacked(PosixTimerEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor posix_timer_entry__descriptor;
+struct _TaskTimersEntry {
+  ProtobufCMessage base;
+  ItimerEntry * real;
+  ItimerEntry * virt;
+  ItimerEntry * prof;
+  size_t n_posix;
+  PosixTimerEntry **posix;
+};
+#define TASK_TIMERS_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&task_timers_entry__descriptor) }
+void task_timers_entry__init(TaskTimersEntry *message);
+size_t task_timers_entry__get_packed_size(const TaskTimersEntry *message);
+size_t task_timers_entry__pack(const TaskTimersEntry *message, uint8_t *out);
+TaskTimersEntry *task_timers_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void task_timers_entry__free_unpacked(TaskTimersEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor task_timers_entry__descriptor;
+#endif
@@ -0,0 +1 @@
+#include "timerfd.pb-c.h"
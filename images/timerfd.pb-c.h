@@ -0,0 +1,27 @@
+#ifndef __TIMERFD_PB_C_H__
+#define __TIMERFD_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+#include "opts.pb-c.h"
+#include "fown.pb-c.h"
+typedef struct _TimerfdEntry TimerfdEntry;
+struct _TimerfdEntry {
+  ProtobufCMessage base;
+  uint32_t id;
+  uint32_t flags;
+  FownEntry * fown;
+  uint32_t clockid;
+  uint64_t ticks;
+  uint32_t settime_flags;
+  uint64_t vsec;
+  uint64_t vnsec;
+  uint64_t isec;
+  uint64_t insec;
+};
+#define TIMERFD_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&timerfd_entry__descriptor) }
+void timerfd_entry__init(TimerfdEntry *message);
+size_t timerfd_entry__get_packed_size(const TimerfdEntry *message);
+size_t timerfd_entry__pack(const TimerfdEntry *message, uint8_t *out);
+TimerfdEntry *timerfd_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void timerfd_entry__free_unpacked(TimerfdEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor timerfd_entry__descriptor;
+#endif
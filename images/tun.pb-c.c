@@ -0,0 +1 @@
+#include "tun.pb-c.h"
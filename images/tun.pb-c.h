@@ -0,0 +1,38 @@
+#ifndef __TUN_PB_C_H__
+#define __TUN_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+#include "opts.pb-c.h"
+typedef struct _TunfileEntry TunfileEntry;
+typedef struct _TunLinkEntry TunLinkEntry;
+struct _TunfileEntry {
+  ProtobufCMessage base;
+  uint32_t id;
+  char * netdev;
+  protobuf_c_boolean has_detached;
+  protobuf_c_boolean detached;
+  protobuf_c_boolean has_ns_id;
+  uint32_t ns_id;
+};
+#define TUNFILE_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&tunfile_entry__descriptor) }
+void tunfile_entry__init(TunfileEntry *message);
+size_t tunfile_entry__get_packed_size(const TunfileEntry *message);
+size_t tunfile_entry__pack(const TunfileEntry *message, uint8_t *out);
+TunfileEntry *tunfile_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void tunfile_entry__free_unpacked(TunfileEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor tunfile_entry__descriptor;
+struct _TunLinkEntry {
+  ProtobufCMessage base;
+  uint32_t flags;
+  int32_t owner;
+  int32_t group;
+  uint32_t vnethdr;
+  uint32_t sndbuf;
+};
+#define TUN_LINK_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&tun_link_entry__descriptor) }
+void tun_link_entry__init(TunLinkEntry *message);
+size_t tun_link_entry__get_packed_size(const TunLinkEntry *message);
+size_t tun_link_entry__pack(const TunLinkEntry *message, uint8_t *out);
+TunLinkEntry *tun_link_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void tun_link_entry__free_unpacked(TunLinkEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor tun_link_entry__descriptor;
+#endif
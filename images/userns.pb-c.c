@@ -0,0 +1 @@
+#include "userns.pb-c.h"
@@ -0,0 +1,33 @@
+#ifndef __USERNS_PB_C_H__
+#define __USERNS_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _UidGidExtent UidGidExtent;
+typedef struct _UsernsEntry UsernsEntry;
+struct _UidGidExtent {
+  ProtobufCMessage base;
+  uint32_t first;
+  uint32_t lower_first;
+  uint32_t count;
+};
+#define UID_GID_EXTENT__INIT { PROTOBUF_C_MESSAGE_INIT(&uid_gid_extent__descriptor) }
+void uid_gid_extent__init(UidGidExtent *message);
+size_t uid_gid_extent__get_packed_size(const UidGidExtent *message);
+size_t uid_gid_extent__pack(const UidGidExtent *message, uint8_t *out);
+UidGidExtent *uid_gid_extent__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void uid_gid_extent__free_unpacked(UidGidExtent *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor uid_gid_extent__descriptor;
+struct _UsernsEntry {
+  ProtobufCMessage base;
+  size_t n_uid_map;
+  UidGidExtent **uid_map;
+  size_t n_gid_map;
+  UidGidExtent **gid_map;
+};
+#define USERNS_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&userns_entry__descriptor) }
+void userns_entry__init(UsernsEntry *message);
+size_t userns_entry__get_packed_size(const UsernsEntry *message);
+size_t userns_entry__pack(const UsernsEntry *message, uint8_t *out);
+UsernsEntry *userns_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void userns_entry__free_unpacked(UsernsEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor userns_entry__descriptor;
+#endif
@@ -0,0 +1 @@
+#include "utsns.pb-c.h"
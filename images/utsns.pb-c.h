@@ -0,0 +1,17 @@
+#ifndef __UTSNS_PB_C_H__
+#define __UTSNS_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _UtsnsEntry UtsnsEntry;
+struct _UtsnsEntry {
+  ProtobufCMessage base;
+  char * nodename;
+  char * domainname;
+};
+#define UTSNS_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&utsns_entry__descriptor) }
+void utsns_entry__init(UtsnsEntry *message);
+size_t utsns_entry__get_packed_size(const UtsnsEntry *message);
+size_t utsns_entry__pack(const UtsnsEntry *message, uint8_t *out);
+UtsnsEntry *utsns_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void utsns_entry__free_unpacked(UtsnsEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor utsns_entry__descriptor;
+#endif
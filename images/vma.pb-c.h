@@ -0,0 +1,28 @@
+#ifndef __VMA_PB_C_H__
+#define __VMA_PB_C_H__
+#include <google/protobuf-c/protobuf-c.h>
+#include "opts.pb-c.h"
+typedef struct _VmaEntry VmaEntry;
+struct _VmaEntry {
+  ProtobufCMessage base;
+  uint64_t start;
+  uint64_t end;
+  uint64_t pgoff;
+  uint64_t shmid;
+  uint32_t prot;
+  uint32_t flags;
+  uint32_t status;
+  int64_t fd;
+  protobuf_c_boolean has_madv;
+  uint64_t madv;
+  protobuf_c_boolean has_fdflags;
+  uint32_t fdflags;
+};
+#define VMA_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&vma_entry__descriptor) }
+void vma_entry__init(VmaEntry *message);
+size_t vma_entry__get_packed_size(const VmaEntry *message);
+size_t vma_entry__pack(const VmaEntry *message, uint8_t *out);
+VmaEntry *vma_entry__unpack(ProtobufCAllocator *allocator, size_t len, const uint8_t *data);
+void vma_entry__free_unpacked(VmaEntry *message, ProtobufCAllocator *allocator);
+extern const ProtobufCMessageDescriptor vma_entry__descriptor;
+#endif
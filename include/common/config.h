@@ -0,0 +1,12 @@
+#ifndef __CR_CONFIG_H__
+#define __CR_CONFIG_H__
+
+#define CONFIG_HAS_TCP_REPAIR
+
+#define CONFIG_HAS_TCP_REPAIR_WINDOW
+
+#define CONFIG_HAS_MEMFD_CREATE
+
+#define CONFIG_HAS_OPENAT2
+
+#endif /* __CR_CONFIG_H__ */
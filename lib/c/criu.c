@@ -315,6 +315,19 @@ int criu_notify_pid(criu_notify_arg_t na)
 	return na->has_pid ? na->pid : 0;
 }
 
+int criu_notify_pre_dump_iter(criu_notify_arg_t na, unsigned long *pages_written, unsigned int *projected_ms)
+{
+	if (!na->pre_dump)
+		return -1;
+
+	if (pages_written)
+		*pages_written = na->pre_dump->pages_written;
+	if (projected_ms)
+		*projected_ms = na->pre_dump->projected_ms;
+
+	return na->pre_dump->iter;
+}
+
 void criu_local_set_pid(criu_opts *opts, int pid)
 {
 	opts->rpc->has_pid = true;
@@ -387,6 +400,61 @@ void criu_set_auto_dedup(bool auto_dedup)
 	criu_local_set_auto_dedup(global_opts, auto_dedup);
 }
 
+void criu_local_set_compress_pages(criu_opts *opts, bool compress_pages)
+{
+	opts->rpc->has_compress_pages = true;
+	opts->rpc->compress_pages = compress_pages;
+}
+
+void criu_set_compress_pages(bool compress_pages)
+{
+	criu_local_set_compress_pages(global_opts, compress_pages);
+}
+
+void criu_local_set_overlap_dump(criu_opts *opts, bool overlap_dump)
+{
+	opts->rpc->has_overlap_dump = true;
+	opts->rpc->overlap_dump = overlap_dump;
+}
+
+void criu_set_overlap_dump(bool overlap_dump)
+{
+	criu_local_set_overlap_dump(global_opts, overlap_dump);
+}
+
+void criu_local_set_ps_streams(criu_opts *opts, unsigned int streams)
+{
+	opts->rpc->has_ps_streams = true;
+	opts->rpc->ps_streams = streams;
+}
+
+void criu_set_ps_streams(unsigned int streams)
+{
+	criu_local_set_ps_streams(global_opts, streams);
+}
+
+void criu_local_set_pre_dump_max_iters(criu_opts *opts, unsigned int iters)
+{
+	opts->rpc->has_pre_dump_max_iters = true;
+	opts->rpc->pre_dump_max_iters = iters;
+}
+
+void criu_set_pre_dump_max_iters(unsigned int iters)
+{
+	criu_local_set_pre_dump_max_iters(global_opts, iters);
+}
+
+void criu_local_set_pre_dump_target_ms(criu_opts *opts, unsigned int ms)
+{
+	opts->rpc->has_pre_dump_target_ms = true;
+	opts->rpc->pre_dump_target_ms = ms;
+}
+
+void criu_set_pre_dump_target_ms(unsigned int ms)
+{
+	criu_local_set_pre_dump_target_ms(global_opts, ms);
+}
+
 void criu_local_set_force_irmap(criu_opts *opts, bool force_irmap)
 {
 	opts->rpc->has_force_irmap = true;
@@ -1685,6 +1753,42 @@ int criu_dump_iters(int (*more)(criu_predump_info pi))
 	return criu_local_dump_iters((void *)global_opts, more);
 }
 
+int criu_local_dump_converge(criu_opts *opts)
+{
+	int ret = -1;
+	CriuReq req = CRIU_REQ__INIT;
+	CriuResp *resp = NULL;
+
+	saved_errno = 0;
+
+	req.type = CRIU_REQ_TYPE__CONVERGE_DUMP;
+	req.opts = opts->rpc;
+
+	ret = -EINVAL;
+	if (!opts->rpc->has_pid)
+		goto exit;
+
+	ret = send_req_and_recv_resp(opts, &req, &resp);
+	if (ret)
+		goto exit;
+
+	ret = resp->success ? 0 : -EBADE;
+exit:
+	if (resp)
+		criu_resp__free_unpacked(resp, NULL);
+
+	swrk_wait(opts);
+
+	errno = saved_errno;
+
+	return ret;
+}
+
+int criu_dump_converge(void)
+{
+	return criu_local_dump_converge(global_opts);
+}
+
 int criu_local_restore(criu_opts *opts)
 {
 	int ret = -1;
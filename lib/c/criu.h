@@ -84,6 +84,11 @@ void criu_set_orphan_pts_master(bool orphan_pts_master);
 void criu_set_file_locks(bool file_locks);
 void criu_set_track_mem(bool track_mem);
 void criu_set_auto_dedup(bool auto_dedup);
+void criu_set_compress_pages(bool compress_pages);
+void criu_set_overlap_dump(bool overlap_dump);
+void criu_set_ps_streams(unsigned int streams);
+void criu_set_pre_dump_max_iters(unsigned int iters);
+void criu_set_pre_dump_target_ms(unsigned int ms);
 void criu_set_force_irmap(bool force_irmap);
 void criu_set_link_remap(bool link_remap);
 void criu_set_log_level(int log_level);
@@ -130,6 +135,15 @@ void criu_set_notify_cb(int (*cb)(char *action, criu_notify_arg_t na));
 /* Get pid of root task. 0 if not available */
 int criu_notify_pid(criu_notify_arg_t na);
 
+/*
+ * On "pre-dump-iter" notifications sent by criu_dump_converge()
+ * returns the number of the pre-dump round that has just finished
+ * and fills in how many pages it wrote and for how long the final
+ * dump is projected to keep the tasks frozen. Returns -1 for other
+ * notifications.
+ */
+int criu_notify_pre_dump_iter(criu_notify_arg_t na, unsigned long *pages_written, unsigned int *projected_ms);
+
 /*
  * If CRIU sends and FD in the case of 'orphan-pts-master',
  * this FD can be retrieved with criu_get_orphan_pts_master_fd().
@@ -183,6 +197,19 @@ int criu_restore_child(void);
 typedef void *criu_predump_info;
 int criu_dump_iters(int (*more)(criu_predump_info pi));
 
+/*
+ * Same as criu_dump_iters, but CRIU decides itself when to stop
+ * pre-dumping. Rounds go on until the final dump is projected to
+ * keep the tasks frozen for no longer than the pre_dump_target_ms,
+ * a round writes less than 256 pages or no less than 80% of the
+ * pages of the previous one, or pre_dump_max_iters rounds are done.
+ * These are the rules of the --pre-copy iterations too. Round images go
+ * into pre-N subdirectories of the images directory, the final
+ * dump goes into the images directory itself. With the notify
+ * callback set, it is called with "pre-dump-iter" after each round.
+ */
+int criu_dump_converge(void);
+
 /*
  * Get the version of the actual binary used for RPC.
  *
@@ -245,6 +272,11 @@ void criu_local_set_orphan_pts_master(criu_opts *opts, bool orphan_pts_master);
 void criu_local_set_file_locks(criu_opts *opts, bool file_locks);
 void criu_local_set_track_mem(criu_opts *opts, bool track_mem);
 void criu_local_set_auto_dedup(criu_opts *opts, bool auto_dedup);
+void criu_local_set_compress_pages(criu_opts *opts, bool compress_pages);
+void criu_local_set_overlap_dump(criu_opts *opts, bool overlap_dump);
+void criu_local_set_ps_streams(criu_opts *opts, unsigned int streams);
+void criu_local_set_pre_dump_max_iters(criu_opts *opts, unsigned int iters);
+void criu_local_set_pre_dump_target_ms(criu_opts *opts, unsigned int ms);
 void criu_local_set_force_irmap(criu_opts *opts, bool force_irmap);
 void criu_local_set_link_remap(criu_opts *opts, bool link_remap);
 void criu_local_set_log_level(criu_opts *opts, int log_level);
@@ -289,6 +321,7 @@ int criu_local_pre_dump(criu_opts *opts);
 int criu_local_restore(criu_opts *opts);
 int criu_local_restore_child(criu_opts *opts);
 int criu_local_dump_iters(criu_opts *opts, int (*more)(criu_predump_info pi));
+int criu_local_dump_converge(criu_opts *opts);
 
 int criu_local_get_version(criu_opts *opts);
 int criu_local_check_version(criu_opts *opts, int minimum);
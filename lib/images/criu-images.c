@@ -0,0 +1,426 @@
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+
+#include "criu-images.h"
+#include "image-pack.h"
+#include "magic.h"
+
+struct criu_images {
+	int dfd;
+
+	/* images.pack, if there's one */
+	void *pack;
+	size_t pack_len;
+	struct image_pack_entry *index;
+	uint32_t nr;
+};
+
+struct criu_image {
+	const ProtobufCMessageDescriptor *desc;
+	void *map; /* NULL if the image is in the pack */
+	size_t map_len;
+	const uint8_t *pos;
+	const uint8_t *end;
+};
+
+struct criu_pagemap {
+	criu_image *img;
+	void *pages;
+	size_t pages_len;
+	size_t off;
+};
+
+static int map_file(int dfd, const char *name, void **map, size_t *len)
+{
+	struct stat st;
+	int fd, ret = 0;
+
+	*map = NULL;
+	*len = 0;
+
+	fd = openat(dfd, name, O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		return -errno;
+
+	if (fstat(fd, &st))
+		ret = -errno;
+	else if (st.st_size) {
+		*map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (*map == MAP_FAILED) {
+			*map = NULL;
+			ret = -errno;
+		} else
+			*len = st.st_size;
+	}
+
+	close(fd);
+	return ret;
+}
+
+static int map_pack(criu_images *imgs)
+{
+	struct image_pack_head *head;
+	int ret;
+
+	ret = map_file(imgs->dfd, IMAGE_PACK_NAME, &imgs->pack, &imgs->pack_len);
+	if (ret == -ENOENT)
+		return 0;
+	if (ret)
+		return ret;
+
+	head = imgs->pack;
+	if (imgs->pack_len < sizeof(*head) || head->magic != IMAGE_PACK_MAGIC || head->version != IMAGE_PACK_VERSION ||
+	    head->index_off > imgs->pack_len ||
+	    (imgs->pack_len - head->index_off) / sizeof(*imgs->index) < head->nr_entries)
+		return -EINVAL;
+
+	imgs->index = imgs->pack + head->index_off;
+	imgs->nr = head->nr_entries;
+	return 0;
+}
+
+criu_images *criu_images_open_at(int dfd)
+{
+	criu_images *imgs;
+	int ret;
+
+	imgs = calloc(1, sizeof(*imgs));
+	if (!imgs) {
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	imgs->dfd = fcntl(dfd, F_DUPFD_CLOEXEC, 0);
+	if (imgs->dfd < 0) {
+		free(imgs);
+		return NULL;
+	}
+
+	ret = map_pack(imgs);
+	if (ret) {
+		criu_images_close(imgs);
+		errno = -ret;
+		return NULL;
+	}
+
+	return imgs;
+}
+
+criu_images *criu_images_open(const char *dir)
+{
+	criu_images *imgs;
+	int dfd;
+
+	dfd = open(dir, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	if (dfd < 0)
+		return NULL;
+
+	imgs = criu_images_open_at(dfd);
+	close(dfd);
+	return imgs;
+}
+
+void criu_images_close(criu_images *imgs)
+{
+	if (!imgs)
+		return;
+
+	if (imgs->pack)
+		munmap(imgs->pack, imgs->pack_len);
+	close(imgs->dfd);
+	free(imgs);
+}
+
+static int entry_cmp(const void *key, const void *e)
+{
+	return strncmp(key, ((struct image_pack_entry *)e)->name, IMAGE_PACK_NAME_LEN);
+}
+
+static criu_image *open_image_va(criu_images *imgs, const char *fmt, uint32_t magic,
+				 const ProtobufCMessageDescriptor *desc, va_list args)
+{
+	struct image_pack_entry *e = NULL;
+	char name[PATH_MAX];
+	criu_image *img;
+	uint32_t m;
+	int ret = 0;
+
+	vsnprintf(name, sizeof(name), fmt, args);
+
+	img = calloc(1, sizeof(*img));
+	if (!img) {
+		errno = ENOMEM;
+		return NULL;
+	}
+	img->desc = desc;
+
+	if (imgs->pack && strlen(name) < IMAGE_PACK_NAME_LEN)
+		e = bsearch(name, imgs->index, imgs->nr, sizeof(*e), entry_cmp);
+	if (e) {
+		if (e->off > imgs->pack_len || e->len > imgs->pack_len - e->off) {
+			ret = -EINVAL;
+			goto err;
+		}
+		img->pos = imgs->pack + e->off;
+		img->end = img->pos + e->len;
+	} else {
+		ret = map_file(imgs->dfd, name, &img->map, &img->map_len);
+		/* Like criu does, missing images are empty */
+		if (ret == -ENOENT)
+			return img;
+		if (ret)
+			goto err;
+		img->pos = img->map;
+		img->end = img->pos + img->map_len;
+	}
+
+	if (img->pos == img->end)
+		return img;
+
+	/* The inventory has no common magic */
+	if (img->end - img->pos < sizeof(m))
+		goto bad;
+	memcpy(&m, img->pos, sizeof(m));
+	if (m == IMG_COMMON_MAGIC || m == IMG_SERVICE_MAGIC) {
+		img->pos += sizeof(m);
+		if (img->end - img->pos < sizeof(m))
+			goto bad;
+		memcpy(&m, img->pos, sizeof(m));
+	}
+	if (magic && m != magic)
+		goto bad;
+	img->pos += sizeof(m);
+
+	return img;
+
+bad:
+	ret = -EINVAL;
+err:
+	criu_image_close(img);
+	errno = -ret;
+	return NULL;
+}
+
+criu_image *criu_image_open(criu_images *imgs, const char *fmt, uint32_t magic,
+			    const ProtobufCMessageDescriptor *desc, ...)
+{
+	criu_image *img;
+	va_list args;
+
+	va_start(args, desc);
+	img = open_image_va(imgs, fmt, magic, desc, args);
+	va_end(args);
+
+	return img;
+}
+
+int criu_image_next(criu_image *img, ProtobufCMessage **entry)
+{
+	uint32_t size;
+
+	if (img->pos == img->end)
+		return 0;
+
+	if (img->end - img->pos < sizeof(size))
+		return -EIO;
+	memcpy(&size, img->pos, sizeof(size));
+	if (img->end - img->pos - sizeof(size) < size)
+		return -EIO;
+
+	*entry = protobuf_c_message_unpack(img->desc, NULL, size, img->pos + sizeof(size));
+	if (!*entry)
+		return -EIO;
+
+	img->pos += sizeof(size) + size;
+	return 1;
+}
+
+void criu_image_close(criu_image *img)
+{
+	if (!img)
+		return;
+
+	if (img->map)
+		munmap(img->map, img->map_len);
+	free(img);
+}
+
+void criu_images_free_entry(void *entry)
+{
+	if (entry)
+		protobuf_c_message_free_unpacked(entry, NULL);
+}
+
+static void *read_one(criu_images *imgs, const char *fmt, uint32_t magic, const ProtobufCMessageDescriptor *desc,
+		      ...)
+{
+	ProtobufCMessage *entry = NULL;
+	criu_image *img;
+	va_list args;
+	int ret;
+
+	va_start(args, desc);
+	img = open_image_va(imgs, fmt, magic, desc, args);
+	va_end(args);
+	if (!img)
+		return NULL;
+
+	ret = criu_image_next(img, &entry);
+	criu_image_close(img);
+	if (ret <= 0) {
+		errno = ret ? -ret : ENOENT;
+		return NULL;
+	}
+
+	return entry;
+}
+
+InventoryEntry *criu_images_inventory(criu_images *imgs)
+{
+	return read_one(imgs, "inventory.img", INVENTORY_MAGIC, &inventory_entry__descriptor);
+}
+
+criu_image *criu_images_pstree(criu_images *imgs)
+{
+	return criu_image_open(imgs, "pstree.img", PSTREE_MAGIC, &pstree_entry__descriptor);
+}
+
+int criu_images_pstree_next(criu_image *img, PstreeEntry **e)
+{
+	return criu_image_next(img, (ProtobufCMessage **)e);
+}
+
+CoreEntry *criu_images_core(criu_images *imgs, uint32_t pid)
+{
+	return read_one(imgs, "core-%u.img", CORE_MAGIC, &core_entry__descriptor, pid);
+}
+
+MmEntry *criu_images_mm(criu_images *imgs, uint32_t pid)
+{
+	return read_one(imgs, "mm-%u.img", MM_MAGIC, &mm_entry__descriptor, pid);
+}
+
+criu_image *criu_images_fdinfo(criu_images *imgs, uint32_t files_id)
+{
+	return criu_image_open(imgs, "fdinfo-%u.img", FDINFO_MAGIC, &fdinfo_entry__descriptor, files_id);
+}
+
+int criu_images_fdinfo_next(criu_image *img, FdinfoEntry **e)
+{
+	return criu_image_next(img, (ProtobufCMessage **)e);
+}
+
+criu_image *criu_images_files(criu_images *imgs)
+{
+	return criu_image_open(imgs, "files.img", FILES_MAGIC, &file_entry__descriptor);
+}
+
+int criu_images_files_next(criu_image *img, FileEntry **e)
+{
+	return criu_image_next(img, (ProtobufCMessage **)e);
+}
+
+criu_pagemap *criu_images_pagemap(criu_images *imgs, uint32_t pid)
+{
+	PagemapHead *h = NULL;
+	criu_pagemap *pm;
+	char name[32];
+	int ret;
+
+	pm = calloc(1, sizeof(*pm));
+	if (!pm) {
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	pm->img = criu_image_open(imgs, "pagemap-%u.img", PAGEMAP_MAGIC, &pagemap_head__descriptor, pid);
+	if (!pm->img)
+		goto err;
+
+	ret = criu_image_next(pm->img, (ProtobufCMessage **)&h);
+	if (ret <= 0) {
+		errno = ret ? -ret : ENOENT;
+		goto err;
+	}
+	pm->img->desc = &pagemap_entry__descriptor;
+
+	/* The pages would have to be decompressed, not mapped */
+	if (h->has_comp_algo && h->comp_algo) {
+		criu_images_free_entry(h);
+		errno = EOPNOTSUPP;
+		goto err;
+	}
+
+	/*
+	 * Pages images are never packed. Unlike other images, they are
+	 * there even if empty, so a missing one is an error.
+	 */
+	snprintf(name, sizeof(name), "pages-%u.img", h->pages_id);
+	criu_images_free_entry(h);
+	ret = map_file(imgs->dfd, name, &pm->pages, &pm->pages_len);
+	if (ret) {
+		errno = -ret;
+		goto err;
+	}
+
+	return pm;
+
+err:
+	criu_images_pagemap_close(pm);
+	return NULL;
+}
+
+int criu_images_pagemap_next(criu_pagemap *pm, PagemapEntry **e, const void **pages)
+{
+	size_t len;
+	int ret;
+
+	ret = criu_image_next(pm->img, (ProtobufCMessage **)e);
+	if (ret <= 0)
+		return ret;
+
+	/* Pagemaps from older versions */
+	if (!(*e)->has_flags) {
+		(*e)->has_flags = true;
+		(*e)->flags = (*e)->has_in_parent && (*e)->in_parent ? CRIU_PE_PARENT : CRIU_PE_PRESENT;
+	}
+
+	/* The pages are somewhere down the parent chain */
+	if ((*e)->flags & CRIU_PE_PARENT) {
+		criu_images_free_entry(*e);
+		return -EOPNOTSUPP;
+	}
+
+	*pages = NULL;
+	if (!((*e)->flags & CRIU_PE_PRESENT))
+		return 1;
+
+	len = (size_t)(*e)->nr_pages * sysconf(_SC_PAGESIZE);
+	if (pm->off > pm->pages_len || len > pm->pages_len - pm->off) {
+		criu_images_free_entry(*e);
+		return -EIO;
+	}
+	*pages = pm->pages + pm->off;
+	pm->off += len;
+
+	return 1;
+}
+
+void criu_images_pagemap_close(criu_pagemap *pm)
+{
+	if (!pm)
+		return;
+
+	if (pm->pages)
+		munmap(pm->pages, pm->pages_len);
+	criu_image_close(pm->img);
+	free(pm);
+}
@@ -0,0 +1,111 @@
+/*
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU Lesser General Public License
+ * (LGPL) version 2.1 which accompanies this distribution, and is available at
+ * http://www.gnu.org/licenses/lgpl-2.1.html
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, you can find it here:
+ * www.gnu.org/licenses/lgpl.html
+ */
+
+#ifndef __CRIU_IMAGES_LIB_H__
+#define __CRIU_IMAGES_LIB_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "inventory.pb-c.h"
+#include "pstree.pb-c.h"
+#include "core.pb-c.h"
+#include "mm.pb-c.h"
+#include "pagemap.pb-c.h"
+#include "fdinfo.pb-c.h"
+
+#ifdef __GNUG__
+extern "C" {
+#endif
+
+/* Pagemap entries flags */
+#define CRIU_PE_PARENT	(1 << 0) /* pages are in parent snapshot */
+#define CRIU_PE_LAZY	(1 << 1) /* pages can be lazily restored */
+#define CRIU_PE_PRESENT (1 << 2) /* pages are present in pages image */
+
+/*
+ * In-process reading of images directories, without the criu binary.
+ *
+ * Images are mapped and their entries are unpacked one by one with the
+ * protobuf-c descriptors criu uses, packed images (images.pack) are
+ * read from the pack. Entries returned by the iterators are to be freed
+ * with criu_images_free_entry(). Functions returning int return a
+ * negative errno on error, iterators return 1 with an entry and 0 at
+ * the end of the image. Functions returning pointers set errno and
+ * return NULL on error.
+ *
+ * The library doesn't follow parent images: pages in parent snapshots
+ * are reported as such, "criu compact" flattens them.
+ */
+
+typedef struct criu_images criu_images;
+typedef struct criu_image criu_image;
+typedef struct criu_pagemap criu_pagemap;
+
+/* Opening of an images directory, the handle may be used from one thread at a time */
+criu_images *criu_images_open(const char *dir);
+criu_images *criu_images_open_at(int dfd);
+void criu_images_close(criu_images *imgs);
+
+/*
+ * Images of entries w/o extra payload by name, e.g.
+ * criu_image_open(imgs, "tty-info.img", 0, &tty_info_entry__descriptor).
+ * The magic is checked unless it's 0.
+ */
+criu_image *criu_image_open(criu_images *imgs, const char *fmt, uint32_t magic,
+			    const ProtobufCMessageDescriptor *desc, ...);
+int criu_image_next(criu_image *img, ProtobufCMessage **entry);
+void criu_image_close(criu_image *img);
+
+void criu_images_free_entry(void *entry);
+
+/* The only entry of the inventory image */
+InventoryEntry *criu_images_inventory(criu_images *imgs);
+
+/* The tree of tasks, an entry per task */
+criu_image *criu_images_pstree(criu_images *imgs);
+int criu_images_pstree_next(criu_image *img, PstreeEntry **e);
+
+/* Per-task state, by pid */
+CoreEntry *criu_images_core(criu_images *imgs, uint32_t pid);
+/* Memory layout of a task, with the VMAs in ->vmas */
+MmEntry *criu_images_mm(criu_images *imgs, uint32_t pid);
+
+/* Files table of a task, by ->ids->files_id of the core */
+criu_image *criu_images_fdinfo(criu_images *imgs, uint32_t files_id);
+int criu_images_fdinfo_next(criu_image *img, FdinfoEntry **e);
+/* Files the fdinfo entries refer to by ->id */
+criu_image *criu_images_files(criu_images *imgs);
+int criu_images_files_next(criu_image *img, FileEntry **e);
+
+/*
+ * Pagemaps of tasks, by pid. The pages of each entry are passed mapped
+ * from the pages image, or NULL for lazy entries, which have no pages
+ * in the images. Opening fails with ENOENT if the pagemap or its pages
+ * image is missing, and with EOPNOTSUPP if the pages are compressed.
+ * Entries with the pages in a parent snapshot make _next() fail with
+ * -EOPNOTSUPP, such chains have to be flattened with criu compact.
+ */
+criu_pagemap *criu_images_pagemap(criu_images *imgs, uint32_t pid);
+int criu_images_pagemap_next(criu_pagemap *pm, PagemapEntry **e, const void **pages);
+void criu_images_pagemap_close(criu_pagemap *pm);
+
+#ifdef __GNUG__
+}
+#endif
+
+#endif /* __CRIU_IMAGES_LIB_H__ */
@@ -3,6 +3,7 @@ import argparse
 import sys
 import json
 import os
+import multiprocessing
 
 import pycriu
 
@@ -36,14 +37,125 @@ def outf(opts, decode):
 
 
 def dinf(opts, name):
-    return open(os.path.join(opts['dir'], name), mode='rb')
+    path = os.path.join(opts['dir'], name)
+    pack = os.path.join(opts['dir'], pycriu.images.IMAGE_PACK_NAME)
+    if os.path.exists(path) or not os.path.exists(pack):
+        return open(path, mode='rb')
+
+    # The image may be packed by criu dump --pack-images
+    with open(pack, mode='rb') as f:
+        index = pycriu.images.load_pack_index(f)
+        if name not in index:
+            return open(path, mode='rb')
+        return pycriu.images.load_packed(f, *index[name])
+
+
+def json_dump_image(m, entries, f, indent=None):
+    """
+    Writes the image in the same format json.dump() does, but
+    entry by entry, as the entries iterator yields them.
+    """
+    if indent is None:
+        f.write('{"magic": %s, "entries": [' % json.dumps(m))
+        sep = ''
+        for entry in entries:
+            f.write(sep + json.dumps(entry))
+            sep = ', '
+        f.write(']}')
+        return
+
+    pad = ' ' * indent
+    f.write('{\n%s"magic": %s,\n%s"entries": [' % (pad, json.dumps(m), pad))
+    sep = '\n'
+    for entry in entries:
+        js = json.dumps(entry, indent=indent)
+        f.write(sep + pad * 2 + js.replace('\n', '\n' + pad * 2))
+        sep = ',\n'
+    if sep == '\n':
+        f.write(']\n}')
+    else:
+        f.write('\n%s]\n}' % pad)
+
+
+def decode_dir_one(args):
+    """
+    Decodes one image of the directory, runs in a worker process.
+    Returns None on success or the reason the image was not decoded.
+    """
+    src, packed, dst, pretty = args
+
+    try:
+        with open(src, 'rb') as f:
+            img = packed and pycriu.images.load_packed(f, *packed) or f
+            m, entries = pycriu.images.load_iter(img, pretty)
+            with open(dst, 'w') as out:
+                json_dump_image(m, entries, out, pretty and 4 or None)
+    except pycriu.images.MagicException as exc:
+        return "raw data (magic %#x), skipped" % exc.magic
+    except Exception as exc:
+        return str(exc)
+
+    return None
+
+
+def decode_dir(opts):
+    """
+    Decodes all images of the directory into DIR or OUT, as
+    IMAGE.json, using a process per CPU or per --jobs.
+    """
+    out = opts['out'] or opts['dir']
+    if not os.path.isdir(out):
+        os.makedirs(out)
+
+    work = []
+    for name in sorted(os.listdir(opts['dir'])):
+        if not name.endswith('.img') or name.startswith('pages-'):
+            continue
+        work.append((os.path.join(opts['dir'], name), None,
+                     os.path.join(out, name + '.json'), opts['pretty']))
+
+    # Images packed by criu dump --pack-images
+    pack = os.path.join(opts['dir'], pycriu.images.IMAGE_PACK_NAME)
+    if os.path.exists(pack):
+        try:
+            with open(pack, 'rb') as f:
+                index = pycriu.images.load_pack_index(f)
+        except Exception as exc:
+            print("%s: %s" % (pack, exc), file=sys.stderr)
+            sys.exit(1)
+        for name in sorted(index):
+            work.append((pack, index[name], os.path.join(out, name + '.json'),
+                         opts['pretty']))
+
+    pool = multiprocessing.Pool(opts['jobs'] or multiprocessing.cpu_count())
+    try:
+        res = pool.map(decode_dir_one, work, chunksize=1)
+    finally:
+        pool.close()
+        pool.join()
+
+    ret = 0
+    for (src, packed, dst, _), err in zip(work, res):
+        if err is None:
+            continue
+        if packed:
+            src += ':' + os.path.basename(dst)[:-len('.json')]
+        print("%s: %s" % (src, err), file=sys.stderr)
+        if not err.startswith('raw data'):
+            ret = 1
+
+    sys.exit(ret)
 
 
 def decode(opts):
     indent = None
 
+    if opts.get('dir'):
+        decode_dir(opts)
+
     try:
-        img = pycriu.images.load(inf(opts), opts['pretty'], opts['nopl'])
+        m, entries = pycriu.images.load_iter(inf(opts), opts['pretty'],
+                                             opts['nopl'])
     except pycriu.images.MagicException as exc:
         print("Unknown magic %#x.\n"\
           "Maybe you are feeding me an image with "\
@@ -54,7 +166,7 @@ def decode(opts):
         indent = 4
 
     f = outf(opts, True)
-    json.dump(img, f, indent=indent)
+    json_dump_image(m, entries, f, indent)
     if f == sys.stdout:
         f.write("\n")
 
@@ -388,6 +500,17 @@ def main():
         '-o',
         '--out',
         help='where to put criu image in json format (stdout by default)')
+    decode_parser.add_argument(
+        '-d',
+        '--dir',
+        help='decode all images of the directory, each into OUT/IMAGE.json\n'
+        '(into the directory itself if no --out is given), packed ones too')
+    decode_parser.add_argument(
+        '-j',
+        '--jobs',
+        type=int,
+        help='number of images decoded in parallel with --dir\n'
+        '(the number of CPUs by default)')
     decode_parser.set_defaults(func=decode, nopl=False)
 
     # Encode
@@ -106,8 +106,13 @@ class entry_handler:
         Takes a file-like object and returns a list with entries in
         dict(json) format.
         """
-        entries = []
+        return list(self.iter_load(f, pretty, no_payload))
 
+    def iter_load(self, f, pretty=False, no_payload=False):
+        """
+        Same as load(), but yields entries one by one as they are
+        read, so that the whole image is never kept in memory.
+        """
         while True:
             entry = {}
 
@@ -139,9 +144,7 @@ class entry_handler:
                 else:
                     entry['extra'] = self.extra_handler.load(f, pbuff)
 
-            entries.append(entry)
-
-        return entries
+            yield entry
 
     def loads(self, s, pretty=False):
         """
@@ -206,8 +209,9 @@ class pagemap_handler:
     """
 
     def load(self, f, pretty=False, no_payload=False):
-        entries = []
+        return list(self.iter_load(f, pretty, no_payload))
 
+    def iter_load(self, f, pretty=False, no_payload=False):
         pbuff = pb.pagemap_head()
         while True:
             buf = f.read(4)
@@ -215,12 +219,10 @@ class pagemap_handler:
                 break
             size, = struct.unpack('i', buf)
             pbuff.ParseFromString(f.read(size))
-            entries.append(pb2dict.pb2dict(pbuff, pretty))
+            yield pb2dict.pb2dict(pbuff, pretty)
 
             pbuff = pb.pagemap_entry()
 
-        return entries
-
     def loads(self, s, pretty=False):
         f = io.BytesIO(s)
         return self.load(f, pretty)
@@ -248,8 +250,9 @@ class pagemap_handler:
 # Special handler for ghost-file.img
 class ghost_file_handler:
     def load(self, f, pretty=False, no_payload=False):
-        entries = []
+        return list(self.iter_load(f, pretty, no_payload))
 
+    def iter_load(self, f, pretty=False, no_payload=False):
         gf = pb.ghost_file_entry()
         buf = f.read(4)
         size, = struct.unpack('i', buf)
@@ -257,7 +260,7 @@ class ghost_file_handler:
         g_entry = pb2dict.pb2dict(gf, pretty)
 
         if gf.chunks:
-            entries.append(g_entry)
+            yield g_entry
             while True:
                 gc = pb.ghost_chunk_entry()
                 buf = f.read(4)
@@ -270,15 +273,13 @@ class ghost_file_handler:
                     f.seek(gc.len, os.SEEK_CUR)
                 else:
                     entry['extra'] = base64.encodebytes(f.read(gc.len)).decode('utf-8')
-                entries.append(entry)
+                yield entry
         else:
             if no_payload:
                 f.seek(0, os.SEEK_END)
             else:
                 g_entry['extra'] = base64.encodebytes(f.read()).decode('utf-8')
-            entries.append(g_entry)
-
-        return entries
+            yield g_entry
 
     def loads(self, s, pretty=False):
         f = io.BytesIO(s)
@@ -509,6 +510,8 @@ handlers = {
                                 tcp_stream_extra_handler()),
     'STATS': entry_handler(pb.stats_entry),
     'PAGEMAP': pagemap_handler(),  # Special one
+    'PAGES_INDEX': entry_handler(pb.pages_block_entry),
+    'FAULT_PROFILE': entry_handler(pb.fault_profile_entry),
     'PSTREE': entry_handler(pb.pstree_entry),
     'REG_FILES': entry_handler(pb.reg_file_entry),
     'NS_FILES': entry_handler(pb.ns_file_entry),
@@ -601,6 +604,17 @@ def load(f, pretty=False, no_payload=False):
     return image
 
 
+def load_iter(f, pretty=False, no_payload=False):
+    """
+    Same as load(), but returns the image magic and an iterator
+    over its entries in dict(json) format, which reads them from
+    the file-like object as they are consumed.
+    """
+    m, handler = __rhandler(f)
+
+    return m, handler.iter_load(f, pretty, no_payload)
+
+
 def info(f):
     res = {}
 
@@ -655,3 +669,55 @@ def dumps(img):
     f = io.BytesIO(b'')
     dump(img, f)
     return f.getvalue()
+
+
+#
+# Packed images, see criu/include/image-pack.h
+IMAGE_PACK_NAME = 'images.pack'
+IMAGE_PACK_MAGIC = 0x4b434150
+IMAGE_PACK_VERSION = 1
+image_pack_head_fmt = '=IIIIQ'
+image_pack_entry_fmt = '=64sQQ'
+
+
+def load_pack_index(f):
+    """
+    Reads the index of images.pack from a file-like object.
+    Returns a dict of image name -> (offset, length) in the pack.
+    """
+    head_size = struct.calcsize(image_pack_head_fmt)
+    entry_size = struct.calcsize(image_pack_entry_fmt)
+
+    head = f.read(head_size)
+    if len(head) < head_size:
+        raise Exception("Truncated images pack")
+    pmagic, version, nr, _, index_off = struct.unpack(image_pack_head_fmt,
+                                                      head)
+    if pmagic != IMAGE_PACK_MAGIC:
+        raise MagicException(pmagic)
+    if version != IMAGE_PACK_VERSION:
+        raise Exception("Unsupported images pack version %d" % version)
+
+    f.seek(index_off)
+    index = f.read(nr * entry_size)
+    if len(index) < nr * entry_size:
+        raise Exception("Truncated images pack index")
+
+    entries = {}
+    for i in range(nr):
+        name, off, size = struct.unpack_from(image_pack_entry_fmt, index,
+                                             i * entry_size)
+        entries[name.rstrip(b'\0').decode()] = (off, size)
+
+    return entries
+
+
+def load_packed(f, off, size):
+    """
+    Returns a file-like object with the image at off in images.pack.
+    """
+    f.seek(off)
+    data = f.read(size)
+    if len(data) < size:
+        raise Exception("Truncated images pack")
+    return io.BytesIO(data)
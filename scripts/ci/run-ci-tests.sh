@@ -6,7 +6,8 @@ CI_PKGS=(protobuf-c-compiler libprotobuf-c-dev libaio-dev libgnutls28-dev
 		libnl-3-dev gdb bash libnet-dev util-linux asciidoctor
 		libnl-route-3-dev time flake8 libbsd-dev python3-yaml
 		libperl-dev pkg-config python3-future python3-protobuf
-		python3-pip python3-importlib-metadata python3-junit.xml)
+		python3-pip python3-importlib-metadata python3-junit.xml
+		libzstd-dev xfsprogs)
 
 X86_64_PKGS=(gcc-multilib)
 
@@ -223,6 +224,14 @@ if criu/criu check --feature move_mount_set_group; then
 fi
 
 ./test/zdtm.py run -a -p 2 --keep-going --criu-config "${ZDTM_OPTS[@]}"
+# Restore from images.pack
+./test/zdtm.py run -p 2 -T '.*(env00|maps0|pipe0|unix|fifo|sk-inet|pstree|session|file_fown).*' \
+	--keep-going "${ZDTM_OPTS[@]}" --pack-images
+# Compressed pages images, pre-dumps included
+./test/zdtm.py run -p 2 -T '.*(maps0|mem-touch|pipe0|env00|vdso).*' \
+	--keep-going "${ZDTM_OPTS[@]}" --compress-pages
+./test/zdtm.py run -p 2 -T '.*(maps0|mem-touch).*' --pre 2 \
+	--keep-going "${ZDTM_OPTS[@]}" --compress-pages
 
 # Newer kernels are blocking access to userfaultfd:
 # uffd: Set unprivileged_userfaultfd sysctl knob to 1 if kernel faults must be handled without obtaining CAP_SYS_PTRACE capability
@@ -238,6 +247,12 @@ LAZY_OPTS=(-p 2 -T "$LAZY_TESTS" "${LAZY_EXCLUDE[@]}" "${ZDTM_OPTS[@]}")
 ./test/zdtm.py run "${LAZY_OPTS[@]}" --lazy-pages
 ./test/zdtm.py run "${LAZY_OPTS[@]}" --remote-lazy-pages
 ./test/zdtm.py run "${LAZY_OPTS[@]}" --remote-lazy-pages --tls
+# Several processes served from several threads
+./test/zdtm.py run -p 2 -t zdtm/transition/fork -t zdtm/transition/fork2 -t zdtm/static/maps008 \
+	"${ZDTM_OPTS[@]}" --lazy-pages --lazy-pages-workers 4
+
+make -C test/others/fault-profile/ run
+make -C test/others/lazy-pages-cache/ run
 
 bash -x ./test/jenkins/criu-fault.sh
 if [ "$UNAME_M" == "x86_64" ]; then
@@ -261,6 +276,11 @@ if [ -n "$TRAVIS" ] || [ -n "$CIRCLECI" ]; then
        make -C test/others/shell-job/ run
 fi
 make -C test/others/skip-file-rwx-check/ run
+make -C test/others/pre-copy/ run
+make -C test/others/pagemap-scan/ run
+make -C test/others/dedup-store/ run
+make -C test/others/pages-csum/ run
+make -C test/others/compact/ run
 make -C test/others/rpc/ run
 
 ./test/zdtm.py run -t zdtm/static/env00 --sibling
@@ -0,0 +1,38 @@
+#!/bin/bash
+# A pre-dump chain compacted into one directory is restored without the chain
+
+set -x
+
+# shellcheck source=test/others/env.sh
+source ../env.sh || exit 1
+
+IMGDIR="dump"
+FLAT="$(pwd)/flat"
+
+function fail {
+	echo "$@"
+	[ -n "$PID" ] && kill -9 "$PID"
+	exit 1
+}
+
+rm -rf "$IMGDIR" "$FLAT"
+mkdir -p "$IMGDIR/1" "$IMGDIR/2" "$IMGDIR/3"
+
+PID=$(../loop)
+${CRIU} pre-dump -D "$IMGDIR/1" -o pre-dump.log -t "$PID" -v4 --track-mem || fail "Can't pre-dump 1"
+${CRIU} pre-dump -D "$IMGDIR/2" -o pre-dump.log -t "$PID" -v4 --track-mem \
+	--prev-images-dir=../1 || fail "Can't pre-dump 2"
+${CRIU} dump -D "$IMGDIR/3" -o dump.log -t "$PID" -v4 --track-mem --prev-images-dir=../2 || fail "Can't dump"
+[ -L "$IMGDIR/3/parent" ] || fail "The dump has no parent"
+
+${CRIU} compact -D "$IMGDIR/3" -o "$(pwd)/compact.log" -v4 --compact-dir "$FLAT" || fail "Can't compact"
+[ -e "$FLAT/parent" ] && fail "The compacted images have a parent"
+
+# Nothing is to be taken from the chain anymore
+rm -rf "$IMGDIR"
+
+${CRIU} restore -D "$FLAT" -o restore.log -v4 -d || fail "Can't restore"
+kill -0 "$PID" || fail "The task is gone after restore"
+
+kill -9 "$PID"
+echo "Test PASSED"
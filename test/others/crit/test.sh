@@ -94,6 +94,12 @@ function run_test2 {
 	${CRIT} decode -i "${JSON_IN}" -o "${OUT}" || true
 	${CRIT} decode -i "${JSON_IN}" > "${OUT}" || true
 
+	# decode the whole directory in parallel
+	DIR_OUT=$(mktemp -d -p ./ tmp.XXXXXXXXXX)
+	${CRIT} decode -d ./ -o "${DIR_OUT}" -j 2 || exit 1
+	${CRIT} encode -i "${DIR_OUT}/$(basename "${PROTO_IN}").json" -o "${OUT}" || exit 1
+	cmp "${PROTO_IN}" "${OUT}" || exit 1
+
 	# explore image directory
 	${CRIT} x ./ ps || exit 1
 	${CRIT} x ./ fds || exit 1
@@ -101,6 +107,28 @@ function run_test2 {
 	${CRIT} x ./ rss || exit 1
 }
 
+function run_test3 {
+	# images packed with --pack-images
+	PID=$(../loop)
+	mkdir -p packed
+	if ! $CRIU dump -v4 -o dump.log -D ./packed -t "$PID" --pack-images; then
+		echo "Failed to checkpoint process $PID"
+		kill -9 "$PID"
+		exit 1
+	fi
+	[ -f packed/images.pack ] || exit 1
+
+	DIR_OUT=$(mktemp -d -p ./ tmp.XXXXXXXXXX)
+	${CRIT} decode -d ./packed -o "${DIR_OUT}" || exit 1
+	[ -f "${DIR_OUT}/pstree.img.json" ] || exit 1
+	${CRIT} encode -i "${DIR_OUT}/inventory.img.json" -o "${DIR_OUT}/inventory.img" || exit 1
+
+	${CRIT} x ./packed ps || exit 1
+	${CRIT} x ./packed fds || exit 1
+	${CRIT} x ./packed mems || exit 1
+}
+
 gen_imgs
 run_test1
 run_test2
+run_test3
@@ -0,0 +1,73 @@
+#!/bin/bash
+# Two dumps of similar tasks share their pages through a dedup store
+
+set -x
+
+# shellcheck source=test/others/env.sh
+source ../env.sh || exit 1
+
+TOP="$(pwd)"
+
+function fail {
+	echo "$@"
+	[ -n "$PID" ] && kill -9 "$PID"
+	exit 1
+}
+
+function shared_pages {
+	sed -n 's/.*dedup-store: \([0-9]*\) pages shared with the store.*/\1/p' "$1/dump.log"
+}
+
+function reflinks {
+	echo reflink > "$1/reflink-src"
+	cp --reflink=always "$1/reflink-src" "$1/reflink-dst" 2>/dev/null
+}
+
+# Without reflinks the store can't be used, and the dump must say so
+if ! reflinks "$TOP"; then
+	mkdir -p "$TOP/no-reflink/dump" "$TOP/no-reflink/store"
+	PID=$(../loop)
+	if ${CRIU} dump -D "$TOP/no-reflink/dump" -o dump.log -t "$PID" -v4 \
+			--dedup-store "$TOP/no-reflink/store"; then
+		unset PID
+		fail "Dumped with a store on a file system without reflinks"
+	fi
+	kill -9 "$PID"
+	unset PID
+
+	# The pages are shared by cloning extents, which needs btrfs or XFS
+	truncate -s 1G "$TOP/xfs.img"
+	mkfs.xfs -q -m reflink=1 "$TOP/xfs.img" || fail "Can't make XFS with reflinks"
+	mkdir -p "$TOP/xfs"
+	mount -o loop "$TOP/xfs.img" "$TOP/xfs" || fail "Can't mount XFS"
+	trap 'umount "$TOP/xfs"' EXIT
+	TOP="$TOP/xfs"
+	reflinks "$TOP" || fail "No reflinks on XFS"
+fi
+
+STORE="$TOP/store"
+rm -rf "$TOP/dump-1" "$TOP/dump-2" "$STORE"
+mkdir "$TOP/dump-1" "$TOP/dump-2" "$STORE"
+
+for i in 1 2; do
+	PID=$(../loop)
+	${CRIU} dump -D "$TOP/dump-$i" -o dump.log -t "$PID" -v4 --dedup-store "$STORE" || fail "Can't dump $i"
+	[ -f "$STORE/chunks" ] || fail "No pages in the store"
+	eval "size_$i=$(stat -c %s "$STORE/chunks")"
+	unset PID
+done
+
+[ "$(shared_pages "$TOP/dump-1")" -eq 0 ] || fail "The empty store shares pages"
+[ "$(shared_pages "$TOP/dump-2")" -gt 0 ] || fail "The second dump doesn't reuse the stored pages"
+# shellcheck disable=SC2154
+[ "$((size_2 - size_1))" -lt "$size_1" ] || fail "All the pages are added to the store again"
+# The tasks don't wait for the store
+grep -m1 -e "Unfreezing tasks" -e "pages shared with the store" "$TOP/dump-2/dump.log" | grep -q Unfreezing ||
+	fail "The store is updated while the tasks are frozen"
+
+for i in 1 2; do
+	${CRIU} restore -D "$TOP/dump-$i" -o restore.log -v4 -d --pidfile "$TOP/dump-$i/pid" || fail "Can't restore $i"
+	kill -9 "$(cat "$TOP/dump-$i/pid")"
+done
+
+echo "Test PASSED"
@@ -0,0 +1,54 @@
+#!/bin/bash
+# The first lazy restore records a fault profile, the second one replays it
+
+set -x
+
+# shellcheck source=test/others/env.sh
+source ../env.sh || exit 1
+
+IMGDIR="dump"
+LP_PIDFILE="$(pwd)/lazy-pages.pid"
+
+function fail {
+	echo "$@"
+	[ -n "$PID" ] && kill -9 "$PID"
+	exit 1
+}
+
+function wait_gone {
+	while kill -0 "$1" 2>/dev/null; do
+		sleep 0.1
+	done
+}
+
+function lazy_restore {
+	rm -f "$LP_PIDFILE"
+	${CRIU} lazy-pages -D "$IMGDIR" -o "lazy-pages-$1.log" -v4 --fault-profile 1000 \
+		--pidfile "$LP_PIDFILE" -d || fail "Can't start lazy-pages daemon"
+	${CRIU} restore -D "$IMGDIR" -o "restore-$1.log" -v4 --lazy-pages -d || fail "Can't restore"
+
+	# The daemon exits once all the pages are copied
+	wait_gone "$(cat "$LP_PIDFILE")"
+}
+
+rm -rf "$IMGDIR"
+mkdir "$IMGDIR"
+
+PID=$(../loop)
+${CRIU} dump -D "$IMGDIR" -o dump.log -t "$PID" -v4 || fail "Can't dump"
+
+lazy_restore 1
+grep "Recorded [0-9]* faults" "$IMGDIR/lazy-pages-1.log" || fail "Fault profile isn't recorded"
+[ -f "$IMGDIR/fault-profile.img" ] || fail "No fault profile"
+compgen -G "$IMGDIR/fault-profile.img.*" && fail "Temporary fault profile is left"
+${CRIT} decode -i "$IMGDIR/fault-profile.img" --pretty || fail "Can't decode fault profile"
+
+kill -9 "$PID"
+wait_gone "$PID"
+
+lazy_restore 2
+grep "Loaded [0-9]* fault profile entries" "$IMGDIR/lazy-pages-2.log" || fail "Fault profile isn't loaded"
+grep "Recorded [0-9]* faults" "$IMGDIR/lazy-pages-2.log" && fail "Fault profile is recorded again"
+
+kill -9 "$PID"
+echo "Test PASSED"
@@ -0,0 +1,57 @@
+#!/bin/bash
+# The first remote lazy restore fills the pages cache, the second one reads from it
+
+set -x
+
+# shellcheck source=test/others/env.sh
+source ../env.sh || exit 1
+
+IMGDIR="dump"
+CACHE="$(pwd)/cache"
+PS_PIDFILE="$(pwd)/page-server.pid"
+LP_PIDFILE="$(pwd)/lazy-pages.pid"
+
+function fail {
+	echo "$@"
+	[ -n "$PID" ] && kill -9 "$PID"
+	exit 1
+}
+
+function wait_gone {
+	while kill -0 "$1" 2>/dev/null; do
+		sleep 0.1
+	done
+}
+
+function lazy_restore {
+	rm -f "$PS_PIDFILE" "$LP_PIDFILE"
+	${CRIU} page-server -D "$IMGDIR" -o "page-server-$1.log" -v4 --lazy-pages --port 12345 \
+		--pidfile "$PS_PIDFILE" -d || fail "Can't start page server"
+	${CRIU} lazy-pages -D "$IMGDIR" -o "lazy-pages-$1.log" -v4 --page-server --address 127.0.0.1 \
+		--port 12345 --lazy-pages-cache "$CACHE" --pidfile "$LP_PIDFILE" -d || fail "Can't start lazy-pages daemon"
+	${CRIU} restore -D "$IMGDIR" -o "restore-$1.log" -v4 --lazy-pages -d || fail "Can't restore"
+
+	# Both exit once all the pages are copied
+	wait_gone "$(cat "$LP_PIDFILE")"
+	wait_gone "$(cat "$PS_PIDFILE")"
+	kill -0 "$PID" || fail "The task is gone after restore $1"
+}
+
+rm -rf "$IMGDIR" "$CACHE"
+mkdir "$IMGDIR" "$CACHE"
+
+PID=$(../loop)
+${CRIU} dump -D "$IMGDIR" -o dump.log -t "$PID" -v4 || fail "Can't dump"
+
+lazy_restore 1
+compgen -G "$CACHE/*.pages" || fail "No pages are cached"
+grep "pages from cache" "$IMGDIR/lazy-pages-1.log" && fail "Empty cache is hit"
+
+kill -9 "$PID"
+wait_gone "$PID"
+
+lazy_restore 2
+grep "pages from cache" "$IMGDIR/lazy-pages-2.log" || fail "Cache isn't hit"
+
+kill -9 "$PID"
+echo "Test PASSED"
@@ -58,6 +58,7 @@ run_test test_notify
 if [ "$(uname -m)" = "x86_64" ]; then
 	# Skip this on aarch64 as aarch64 has no dirty page tracking
 	run_test test_iters
+	run_test test_converge
 	run_test test_pre_dump
 fi
 run_test test_errno
@@ -72,6 +73,7 @@ if criu check --feature pidfd_store > /dev/null; then
 	export CRIU_FEATURE_PIDFD_STORE=1
 fi
 run_test test_feature_check
+run_test test_images
 
 echo "== Tests done"
 make libcriu_clean
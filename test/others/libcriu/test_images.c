@@ -0,0 +1,340 @@
+#include "criu-images.h"
+#include <fcntl.h>
+#include <limits.h>
+#include <stdio.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <signal.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <dirent.h>
+#include "lib.h"
+
+#define fail(fmt, ...)                                        \
+	do {                                                  \
+		printf("   `- FAIL: " fmt "\n", ##__VA_ARGS__); \
+		goto out;                                     \
+	} while (0)
+
+static int start_loop(void)
+{
+	int pid, ret, p[2];
+
+	if (pipe(p)) {
+		perror("Can't make pipe");
+		return -1;
+	}
+
+	pid = fork();
+	if (pid < 0) {
+		perror("Can't fork");
+		return -1;
+	}
+
+	if (!pid) {
+		if (setsid() < 0)
+			exit(1);
+
+		close(0);
+		close(1);
+		close(2);
+		close(p[0]);
+
+		/* Something for the files images */
+		if (open("/dev/null", O_RDONLY) < 0)
+			exit(1);
+
+		ret = SUCC_ECODE;
+		write(p[1], &ret, sizeof(ret));
+		close(p[1]);
+
+		while (1)
+			sleep(1);
+	}
+
+	close(p[1]);
+	ret = -1;
+	read(p[0], &ret, sizeof(ret));
+	close(p[0]);
+	if (ret != SUCC_ECODE) {
+		printf("Error starting loop\n");
+		kill(pid, SIGKILL);
+		waitpid(pid, NULL, 0);
+		return -1;
+	}
+
+	return pid;
+}
+
+/* There's no --pack-images in RPC, so the binary is run right away */
+static int run_criu(char *criu, char *action, char *dir, int pid, char **extra)
+{
+	char spid[16], *argv[16] = { criu, action, "-t", spid, "-D", dir, "-o", "dump.log", "-v4" };
+	int status, cpid, i = 9;
+
+	snprintf(spid, sizeof(spid), "%d", pid);
+	while (extra && *extra)
+		argv[i++] = *extra++;
+
+	cpid = fork();
+	if (cpid < 0) {
+		perror("Can't fork");
+		return -1;
+	}
+
+	if (!cpid) {
+		execv(criu, argv);
+		perror("Can't exec criu");
+		exit(1);
+	}
+
+	if (waitpid(cpid, &status, 0) < 0) {
+		perror("Can't wait criu");
+		return -1;
+	}
+
+	/* The loop is killed by the dump */
+	if (!strcmp(action, "dump"))
+		waitpid(pid, NULL, 0);
+
+	return chk_exit(status, 0);
+}
+
+static int check_images(char *dir, int pid, int packed)
+{
+	criu_images *imgs;
+	criu_image *img = NULL;
+	criu_pagemap *pm = NULL;
+	InventoryEntry *inv = NULL;
+	CoreEntry *core = NULL;
+	PstreeEntry *pe;
+	FdinfoEntry *fe;
+	FileEntry *file;
+	PagemapEntry *pme;
+	const void *pages;
+	uint32_t files_id, file_id = 0;
+	int ret, found = 0, nr_pages = 0;
+
+	imgs = criu_images_open(dir);
+	if (!imgs) {
+		printf("   `- Can't open %s: %s\n", dir, strerror(errno));
+		return -1;
+	}
+
+	inv = criu_images_inventory(imgs);
+	if (!inv)
+		fail("no inventory: %s", strerror(errno));
+	printf("   `- Images version %u\n", inv->img_version);
+
+	img = criu_images_pstree(imgs);
+	if (!img)
+		fail("no pstree: %s", strerror(errno));
+	while ((ret = criu_images_pstree_next(img, &pe)) > 0) {
+		if (pe->pid == pid)
+			found = 1;
+		criu_images_free_entry(pe);
+	}
+	criu_image_close(img);
+	img = NULL;
+	if (ret < 0 || !found)
+		fail("task %d isn't in pstree (%d)", pid, ret);
+
+	core = criu_images_core(imgs, pid);
+	if (!core)
+		fail("no core: %s", strerror(errno));
+	if (!core->tc || !core->ids)
+		fail("core has no task state");
+	files_id = core->ids->files_id;
+
+	img = criu_images_fdinfo(imgs, files_id);
+	if (!img)
+		fail("no fdinfo: %s", strerror(errno));
+	while ((ret = criu_images_fdinfo_next(img, &fe)) > 0) {
+		if (fe->fd == 0)
+			file_id = fe->id;
+		criu_images_free_entry(fe);
+	}
+	criu_image_close(img);
+	img = NULL;
+	if (ret < 0 || !file_id)
+		fail("fd 0 isn't in fdinfo (%d)", ret);
+
+	img = criu_images_files(imgs);
+	if (!img)
+		fail("no files: %s", strerror(errno));
+	found = 0;
+	while ((ret = criu_images_files_next(img, &file)) > 0) {
+		if (file->id == file_id && file->reg && !strcmp(file->reg->name, "/dev/null"))
+			found = 1;
+		criu_images_free_entry(file);
+	}
+	criu_image_close(img);
+	img = NULL;
+	if (ret < 0 || !found)
+		fail("fd 0 isn't /dev/null in files (%d)", ret);
+
+	pm = criu_images_pagemap(imgs, pid);
+	if (!pm)
+		fail("no pagemap: %s", strerror(errno));
+	while ((ret = criu_images_pagemap_next(pm, &pme, &pages)) > 0) {
+		if ((pme->flags & CRIU_PE_PRESENT) && !pages) {
+			criu_images_free_entry(pme);
+			fail("no pages at %#llx", (unsigned long long)pme->vaddr);
+		}
+		nr_pages += pages ? pme->nr_pages : 0;
+		criu_images_free_entry(pme);
+	}
+	if (ret < 0 || !nr_pages)
+		fail("no pages in pagemap (%d)", ret);
+	printf("   `- %d pages in pagemap\n", nr_pages);
+
+	/* The packed images must have been read from the pack */
+	if (packed) {
+		char path[PATH_MAX];
+
+		snprintf(path, sizeof(path), "%s/core-%d.img", dir, pid);
+		if (access(path, F_OK) == 0)
+			fail("images aren't packed");
+	}
+
+	ret = 0;
+	goto close;
+out:
+	ret = -1;
+close:
+	criu_images_pagemap_close(pm);
+	criu_image_close(img);
+	criu_images_free_entry(core);
+	criu_images_free_entry(inv);
+	criu_images_close(imgs);
+	return ret;
+}
+
+/* Without the pages image the pagemap can't be opened */
+static int check_no_pages(char *dir, int pid)
+{
+	criu_images *imgs;
+	criu_pagemap *pm;
+	struct dirent *de;
+	DIR *d;
+
+	d = opendir(dir);
+	if (!d) {
+		perror("Can't open images dir");
+		return -1;
+	}
+	while ((de = readdir(d)))
+		if (!strncmp(de->d_name, "pages-", 6))
+			unlinkat(dirfd(d), de->d_name, 0);
+	closedir(d);
+
+	imgs = criu_images_open(dir);
+	if (!imgs) {
+		printf("   `- Can't open %s: %s\n", dir, strerror(errno));
+		return -1;
+	}
+
+	errno = 0;
+	pm = criu_images_pagemap(imgs, pid);
+	criu_images_close(imgs);
+	if (pm || errno != ENOENT) {
+		printf("   `- FAIL: pagemap w/o pages is opened (%s)\n", strerror(errno));
+		criu_images_pagemap_close(pm);
+		return -1;
+	}
+
+	return 0;
+}
+
+/* The pages in the parent snapshot aren't looked up */
+static int check_parent(char *criu, char *dir)
+{
+	char *dump_opts[] = { "--prev-images-dir", "../pre", "--track-mem", NULL };
+	char pre[PATH_MAX];
+	criu_images *imgs;
+	criu_pagemap *pm;
+	PagemapEntry *pme;
+	const void *pages;
+	int pid, ret;
+
+	snprintf(pre, sizeof(pre), "%s/pre", dir);
+	if (mkdir(dir, 0700) || mkdir(pre, 0700)) {
+		perror("Can't make images dir");
+		return -1;
+	}
+
+	pid = start_loop();
+	if (pid < 0)
+		return -1;
+	if (run_criu(criu, "pre-dump", pre, pid, NULL) || run_criu(criu, "dump", dir, pid, dump_opts)) {
+		kill(pid, SIGKILL);
+		waitpid(pid, NULL, 0);
+		return -1;
+	}
+
+	imgs = criu_images_open(dir);
+	if (!imgs) {
+		printf("   `- Can't open %s: %s\n", dir, strerror(errno));
+		return -1;
+	}
+
+	pm = criu_images_pagemap(imgs, pid);
+	criu_images_close(imgs);
+	if (!pm) {
+		printf("   `- FAIL: no pagemap: %s\n", strerror(errno));
+		return -1;
+	}
+
+	while ((ret = criu_images_pagemap_next(pm, &pme, &pages)) > 0)
+		criu_images_free_entry(pme);
+	criu_images_pagemap_close(pm);
+
+	if (ret != -EOPNOTSUPP) {
+		printf("   `- FAIL: pages in parent are read (%d)\n", ret);
+		return -1;
+	}
+
+	return 0;
+}
+
+int main(int argc, char **argv)
+{
+	char *pack_opts[] = { "--pack-images", NULL };
+	char dir[2][PATH_MAX], pdir[PATH_MAX];
+	int pid[2], pack;
+
+	for (pack = 0; pack < 2; pack++) {
+		printf("--- Dump loop%s ---\n", pack ? " with --pack-images" : "");
+		snprintf(dir[pack], sizeof(dir[pack]), "%s/%s", argv[2], pack ? "packed" : "plain");
+		if (mkdir(dir[pack], 0700)) {
+			perror("Can't make images dir");
+			return 1;
+		}
+
+		pid[pack] = start_loop();
+		if (pid[pack] < 0)
+			return 1;
+		if (run_criu(argv[1], "dump", dir[pack], pid[pack], pack ? pack_opts : NULL))
+			return 1;
+
+		printf("--- Read images ---\n");
+		if (check_images(dir[pack], pid[pack], pack))
+			return 1;
+	}
+
+	printf("--- Remove pages ---\n");
+	if (check_no_pages(dir[0], pid[0]))
+		return 1;
+
+	if (getenv("CRIU_FEATURE_MEM_TRACK")) {
+		printf("--- Dump on top of a pre-dump ---\n");
+		snprintf(pdir, sizeof(pdir), "%s/incremental", argv[2]);
+		if (check_parent(argv[1], pdir))
+			return 1;
+	}
+
+	return 0;
+}
@@ -4,7 +4,7 @@
 #include <errno.h>
 #include <stdlib.h>
 #include <signal.h>
-#include <fcntl.h>
+#include <string.h>
 #include <sys/stat.h>
 #include <sys/wait.h>
 #include <unistd.h>
@@ -18,6 +18,66 @@ static void sh(int sig)
 	stop = 1;
 }
 
+#ifdef TEST_CONVERGE
+/*
+ * The same loop dumped with criu_dump_converge(). The loop doesn't
+ * touch its memory, so the second round writes less than the first
+ * one and the rounds stop before the limit.
+ */
+#define MAX_ITERS 4
+#define TARGET_MS 1000
+
+static unsigned long round_pages[MAX_ITERS];
+static int nr_rounds;
+
+static int notify(char *action, criu_notify_arg_t na)
+{
+	unsigned long pages;
+	unsigned int projected;
+	int iter;
+
+	if (strcmp(action, "pre-dump-iter"))
+		return 0;
+
+	iter = criu_notify_pre_dump_iter(na, &pages, &projected);
+	if (iter != nr_rounds || iter >= MAX_ITERS) {
+		printf("   `- unexpected round %d (want %d)\n", iter, nr_rounds);
+		return -1;
+	}
+
+	printf("   `- round %d over: %lu pages, %u ms projected\n", iter, pages, projected);
+	round_pages[nr_rounds++] = pages;
+	return 0;
+}
+
+static int dump_loop(void)
+{
+	int ret;
+
+	cur_imgdir = wdir_fd;
+	criu_set_images_dir_fd(cur_imgdir);
+	criu_set_notify_cb(notify);
+	criu_set_pre_dump_max_iters(MAX_ITERS);
+	criu_set_pre_dump_target_ms(TARGET_MS);
+
+	ret = criu_dump_converge();
+	if (ret < 0)
+		return ret;
+
+	if (nr_rounds < 2 || nr_rounds >= MAX_ITERS) {
+		printf("   `- Didn't converge, %d rounds\n", nr_rounds);
+		return -1;
+	}
+
+	if (!round_pages[0] || round_pages[1] >= round_pages[0]) {
+		printf("   `- Rounds didn't shrink: %lu -> %lu pages\n", round_pages[0], round_pages[1]);
+		return -1;
+	}
+
+	printf("   `- Converged after %d rounds\n", nr_rounds);
+	return 0;
+}
+#else
 static int open_imgdir(void)
 {
 	char p[10];
@@ -46,6 +106,13 @@ static int next_iter(criu_predump_info pi)
 	return cur_iter < MAX_ITERS;
 }
 
+static int dump_loop(void)
+{
+	open_imgdir();
+	return criu_dump_iters(next_iter);
+}
+#endif
+
 int main(int argc, char **argv)
 {
 	int pid, ret, p[2];
@@ -106,10 +173,10 @@ int main(int argc, char **argv)
 	criu_set_log_file("dump.log");
 	criu_set_log_level(CRIU_LOG_DEBUG);
 
-	open_imgdir();
-	ret = criu_dump_iters(next_iter);
+	ret = dump_loop();
 	if (ret < 0) {
-		what_err_ret_mean(ret);
+		if (ret != -1)
+			what_err_ret_mean(ret);
 		kill(pid, SIGKILL);
 		goto err;
 	}
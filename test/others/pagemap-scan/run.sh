@@ -0,0 +1,43 @@
+#!/bin/bash
+# The pagemap cache builds the same pagemap out of PAGEMAP_SCAN as out of reading the pagemap file
+
+set -x
+
+# shellcheck source=test/others/env.sh
+source ../env.sh || exit 1
+
+function fail {
+	echo "$@"
+	[ -n "$PID" ] && kill -9 "$PID"
+	exit 1
+}
+
+if ! ${CRIU} check --feature pagemap_scan; then
+	echo "PAGEMAP_SCAN isn't supported, skipping"
+	exit 0
+fi
+
+rm -rf scan pread
+mkdir scan pread
+
+PID=$(../loop)
+# Keep the memory as it is between the dumps
+kill -STOP "$PID"
+
+${CRIU} dump -D scan -o dump.log -t "$PID" -v4 --leave-running || fail "Can't dump with PAGEMAP_SCAN"
+CRIU_PMC_NO_SCAN=1 ${CRIU} dump -D pread -o dump.log -t "$PID" -v4 --leave-running || fail "Can't dump with pread"
+
+for img in scan/pagemap-*.img; do
+	name=$(basename "$img")
+	[ -f "pread/$name" ] || fail "No $name from pread"
+	${CRIT} decode --pretty -i "$img" > "scan/$name.txt" || fail "Can't decode $img"
+	${CRIT} decode --pretty -i "pread/$name" > "pread/$name.txt" || fail "Can't decode pread/$name"
+	diff -u "pread/$name.txt" "scan/$name.txt" || fail "The $name differ"
+done
+
+for img in scan/pages-*.img; do
+	cmp "$img" "pread/$(basename "$img")" || fail "The $(basename "$img") differ"
+done
+
+kill -9 "$PID"
+echo "Test PASSED"
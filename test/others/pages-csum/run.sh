@@ -0,0 +1,64 @@
+#!/bin/bash
+# A flipped byte in a pages image fails check-image and the restore,
+# the checksums are written by dump and by the page server
+
+set -x
+
+# shellcheck source=test/others/env.sh
+source ../env.sh || exit 1
+
+function fail {
+	echo "$@"
+	[ -n "$PID" ] && kill -9 "$PID"
+	exit 1
+}
+
+function flip_byte {
+	${PYTHON} -c "
+import sys
+with open(sys.argv[1], 'r+b') as f:
+    f.seek(int(sys.argv[2]))
+    b = f.read(1)
+    f.seek(int(sys.argv[2]))
+    f.write(bytes([b[0] ^ 0xff]))
+" "$1" "$2"
+}
+
+function wait_gone {
+	while kill -0 "$1" 2>/dev/null; do
+		sleep 0.1
+	done
+}
+
+rm -rf dump corrupted ps ps.pid
+mkdir dump ps
+
+# The page server checksums the pages it receives
+PID=$(../loop)
+${CRIU} page-server -D ps -o page-server.log -v4 --port 12345 --pidfile "$(pwd)/ps.pid" -d || fail "Can't start page server"
+${CRIU} dump -D ps -o dump.log -t "$PID" -v4 --pages-csum --page-server --address 127.0.0.1 --port 12345 \
+	--leave-running || fail "Can't dump to page server"
+wait_gone "$(cat ps.pid)"
+${CRIU} check-image -D ps -o check-image.log -v4 || fail "Page server images are reported corrupted"
+grep "pages images are intact" ps/check-image.log || fail "Page server images aren't checked"
+
+${CRIU} dump -D dump -o dump.log -t "$PID" -v4 --pages-csum || fail "Can't dump"
+PAGEMAP=$(find dump -name 'pagemap-[0-9]*.img' | head -n 1)
+${CRIT} decode -i "$PAGEMAP" | grep '"csum"' || fail "No checksums are written"
+${CRIU} check-image -D dump -o check-image.log -v4 || fail "Intact images are reported corrupted"
+
+cp -a dump corrupted
+PAGES=$(find corrupted -name 'pages-[0-9]*.img' -size +0 | head -n 1)
+[ -n "$PAGES" ] || fail "No pages images"
+flip_byte "$PAGES" 100
+
+${CRIU} check-image -D corrupted -o check-image.log -v4 && fail "Corrupted images pass check-image"
+${CRIU} restore -D corrupted -o restore.log -v4 --pages-csum -d && fail "Corrupted images are restored"
+kill -0 "$PID" 2>/dev/null && fail "The task is left after the failed restore"
+grep "Pages images checksums don't match" corrupted/restore.log || fail "The restore fails not on checksums"
+
+${CRIU} restore -D dump -o restore.log -v4 --pages-csum -d || fail "Can't restore"
+kill -0 "$PID" || fail "The task is gone after restore"
+
+kill -9 "$PID"
+echo "Test PASSED"
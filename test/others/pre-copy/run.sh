@@ -0,0 +1,46 @@
+#!/bin/bash
+# The final dump of --pre-copy only writes the pages dirtied since the last pre-dump
+
+set -x
+
+# shellcheck source=test/others/env.sh
+source ../env.sh || exit 1
+
+IMGDIR="dump"
+
+function fail {
+	echo "$@"
+	[ -n "$PID" ] && kill -9 "$PID"
+	exit 1
+}
+
+function dump_stat {
+	${CRIT} decode -i "$1/stats-dump.img" | \
+		${PYTHON} -c "import json, sys; print(json.load(sys.stdin)['entries'][0]['dump']['$2'])"
+}
+
+rm -rf "$IMGDIR"
+mkdir "$IMGDIR"
+
+PID=$(../loop)
+${CRIU} dump -D "$IMGDIR" -o dump.log -t "$PID" -v4 --pre-copy 3 || fail "Can't dump"
+
+[ -d "$IMGDIR/pre-copy-1" ] || fail "No pre-copy iterations"
+[ -L "$IMGDIR/parent" ] || fail "The dump has no parent"
+
+scanned=$(dump_stat "$IMGDIR" pages_scanned)
+skipped=$(dump_stat "$IMGDIR" pages_skipped_parent)
+written=$(dump_stat "$IMGDIR" pages_written)
+[ "$skipped" -gt 0 ] || fail "No pages are taken from the pre-dumps"
+[ "$written" -lt "$scanned" ] || fail "All $scanned pages are written again"
+
+# The kernel with async write-protect gets it instead of soft-dirty
+if ${CRIU} check --feature uffd_wp_async; then
+	grep -q "Write-protected" "$IMGDIR/dump.log" || fail "The pages aren't write-protected"
+fi
+
+${CRIU} restore -D "$IMGDIR" -o restore.log -v4 -d || fail "Can't restore"
+kill -0 "$PID" || fail "The task is gone after restore"
+
+kill -9 "$PID"
+echo "Test PASSED"
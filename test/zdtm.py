@@ -945,6 +945,8 @@ class criu_rpc:
                 criu.opts.ps.address = args.pop(0)
             elif "--page-server" == arg:
                 continue
+            elif "--ps-streams" == arg:
+                criu.opts.ps_streams = int(args.pop(0))
             elif "--prev-images-dir" == arg:
                 criu.opts.parent_img = args.pop(0)
             elif "--pre-dump-mode" == arg:
@@ -1056,6 +1058,11 @@ class criu:
         self.__rootless = bool(opts['rootless'])
         self.__leave_stopped = bool(opts['stop'])
         self.__stream = bool(opts['stream'])
+        self.__compress_pages = bool(opts['compress_pages'])
+        self.__overlap_dump = bool(opts['overlap_dump'])
+        self.__pack_images = bool(opts['pack_images'])
+        self.__ps_streams = opts['ps_streams']
+        self.__lazy_pages_workers = opts['lazy_pages_workers']
         self.__show_stats = bool(opts['show_stats'])
         self.__lazy_pages_p = None
         self.__page_server_p = None
@@ -1371,6 +1378,8 @@ class criu:
             a_opts += [
                 "--page-server", "--address", "127.0.0.1", "--port", "12345"
             ] + self.__tls
+            if self.__ps_streams:
+                a_opts += ["--ps-streams", self.__ps_streams]
 
         a_opts += self.__test.getdopts()
 
@@ -1381,6 +1390,15 @@ class criu:
         if self.__dedup:
             a_opts += ["--auto-dedup"]
 
+        if self.__compress_pages:
+            a_opts += ["--compress-pages"]
+
+        if self.__overlap_dump and action == "dump":
+            a_opts += ["--overlap-dump"]
+
+        if self.__pack_images and action == "dump":
+            a_opts += ["--pack-images"]
+
         a_opts += ["--timeout", "10"]
 
         criu_dir = os.path.dirname(os.getcwd())
@@ -1465,6 +1483,8 @@ class criu:
                 self.__page_server_p = self.__criu_act("page-server",
                                                        opts=ps_opts,
                                                        nowait=True)
+            if self.__lazy_pages_workers:
+                lp_opts += ["--lazy-pages-workers", self.__lazy_pages_workers]
             self.__lazy_pages_p = self.__criu_act("lazy-pages",
                                                   opts=lp_opts,
                                                   nowait=True)
@@ -2074,7 +2094,8 @@ class Launcher:
               'dedup', 'sbs', 'freezecg', 'user', 'dry_run', 'noauto_dedup',
               'remote_lazy_pages', 'show_stats', 'lazy_migrate', 'stream',
               'tls', 'criu_bin', 'crit_bin', 'pre_dump_mode', 'mntns_compat_mode',
-              'rootless')
+              'rootless', 'compress_pages', 'overlap_dump', 'ps_streams',
+              'lazy_pages_workers', 'pack_images')
         arg = repr((name, desc, flavor, {d: self.__opts[d] for d in nd}))
 
         if self.__use_log:
@@ -2720,6 +2741,17 @@ def get_cli_args():
     rp.add_argument("--stream",
                     help="Use criu-image-streamer",
                     action='store_true')
+    rp.add_argument("--compress-pages",
+                    help="Write compressed pages images",
+                    action='store_true')
+    rp.add_argument("--overlap-dump",
+                    help="Write pages in background on dump",
+                    action='store_true')
+    rp.add_argument("--pack-images",
+                    help="Pack images into one file on dump",
+                    action='store_true')
+    rp.add_argument("--ps-streams",
+                    help="Send pages to page server over that many connections")
     rp.add_argument("-p", "--parallel", help="Run test in parallel")
     rp.add_argument("--dry-run",
                     help="Don't run tests, just pretend to",
@@ -2743,6 +2775,8 @@ def get_cli_args():
     rp.add_argument("--lazy-migrate",
                     help="restore pages on demand",
                     action='store_true')
+    rp.add_argument("--lazy-pages-workers",
+                    help="Serve lazy pages from that many threads")
     rp.add_argument("--remote-lazy-pages",
                     help="simulate lazy migration",
                     action='store_true')
@@ -2762,7 +2796,7 @@ def get_cli_args():
                     default="../../criu-image-streamer")
     rp.add_argument("--pre-dump-mode",
                     help="Use splice or read mode of pre-dumping",
-                    choices=['splice', 'read'],
+                    choices=['splice', 'read', 'read-batch'],
                     default='splice')
     rp.add_argument("--mntns-compat-mode",
                     help="Use old compat mounts restore engine",